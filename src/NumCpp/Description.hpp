@@ -0,0 +1,130 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+/// @version 1.0
+///
+/// @section LICENSE
+/// Copyright 2018 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software 
+/// without restriction, including without limitation the rights to use, copy, modify, 
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to 
+/// permit persons to whom the Software is furnished to do so, subject to the following 
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies 
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+/// DEALINGS IN THE SOFTWARE.
+///
+/// @section DESCRIPTION
+/// Holds the summary statistics computed by Methods::describe
+///
+#pragma once
+
+#include"NumCpp/NdArray.hpp"
+#include"NumCpp/Types.hpp"
+
+#include<iostream>
+#include<string>
+
+namespace NumCpp
+{
+    //================================================================================
+    ///						Summary statistics of an array, computed in a single pass
+    ///						by Methods::describe. Statistics that were not requested
+    ///						are left as empty arrays.
+    template<typename dtype>
+    class Description
+    {
+    public:
+        //====================================Attributes==============================
+        NdArray<uint32>     count;
+        NdArray<dtype>      min;
+        NdArray<dtype>      max;
+        NdArray<double>     sum;
+        NdArray<double>     mean;
+        NdArray<double>     std;
+        NdArray<uint32>     count_nonzero;
+        NdArray<uint32>     argmin;
+        NdArray<uint32>     argmax;
+
+        //============================================================================
+        ///						Returns the description as a string representation
+        ///		
+        /// @param      None
+        ///
+        /// @return     string
+        ///
+        std::string str() const
+        {
+            std::string out;
+            out += "count:\n" + count.str();
+            if (min.size() > 0)
+            {
+                out += "min:\n" + min.str();
+            }
+            if (max.size() > 0)
+            {
+                out += "max:\n" + max.str();
+            }
+            if (sum.size() > 0)
+            {
+                out += "sum:\n" + sum.str();
+            }
+            if (mean.size() > 0)
+            {
+                out += "mean:\n" + mean.str();
+            }
+            if (std.size() > 0)
+            {
+                out += "std:\n" + std.str();
+            }
+            if (count_nonzero.size() > 0)
+            {
+                out += "count_nonzero:\n" + count_nonzero.str();
+            }
+            if (argmin.size() > 0)
+            {
+                out += "argmin:\n" + argmin.str();
+            }
+            if (argmax.size() > 0)
+            {
+                out += "argmax:\n" + argmax.str();
+            }
+
+            return out;
+        }
+
+        //============================================================================
+        ///						Prints the description to the console
+        ///		
+        /// @param      None
+        ///
+        /// @return     None
+        ///
+        void print() const
+        {
+            std::cout << *this;
+        }
+
+        //============================================================================
+        ///						IO operator for the Description class
+        ///		
+        /// @param      None
+        ///
+        /// @return     None
+        ///
+        friend std::ostream& operator<<(std::ostream& inOStream, const Description<dtype>& inDescription)
+        {
+            inOStream << inDescription.str();
+            return inOStream;
+        }
+    };
+}
@@ -28,9 +28,16 @@
 ///
 #pragma once
 
-#include"NumCpp/NdArray.hpp"
+#include"NumCpp/Constants.hpp"
 #include"NumCpp/Types.hpp"
 
+#include<cmath>
+#include<complex>
+#include<stdexcept>
+#include<string>
+#include<utility>
+#include<vector>
+
 namespace NumCpp
 {
     //================================FFT Class=============================
@@ -39,6 +46,274 @@ namespace NumCpp
     class FFT
     {
     public:
-        /// \todo Complete This Module
+        //============================================================================
+        ///						Returns the smallest power of two that is not less than
+        ///						the input value
+        ///		
+        /// @param      value
+        ///
+        /// @return     power of two
+        ///
+        static uint32 nextPowerOfTwo(uint32 inValue)
+        {
+            uint32 power = 1;
+            while (power < inValue)
+            {
+                power <<= 1;
+            }
+
+            return power;
+        }
+
+        //============================================================================
+        ///						In place radix-2 forward transform. The size of the data
+        ///						must be a power of two.
+        ///		
+        /// @param      data
+        ///
+        /// @return     None
+        ///
+        static void fft(std::vector<std::complex<dtype> >& ioData)
+        {
+            checkSize(static_cast<uint32>(ioData.size()), "fft");
+            transformLine(ioData.data(), twiddles(static_cast<uint32>(ioData.size()), false), static_cast<uint32>(ioData.size()));
+        }
+
+        //============================================================================
+        ///						In place radix-2 inverse transform, scaled by 1/N so that
+        ///						ifft(fft(x)) == x. The size of the data must be a power of two.
+        ///		
+        /// @param      data
+        ///
+        /// @return     None
+        ///
+        static void ifft(std::vector<std::complex<dtype> >& ioData)
+        {
+            const uint32 size = static_cast<uint32>(ioData.size());
+            checkSize(size, "ifft");
+            transformLine(ioData.data(), twiddles(size, true), size);
+            scale(ioData, size);
+        }
+
+        //============================================================================
+        ///						In place two dimensional forward transform of row major
+        ///						data. Both dimensions must be powers of two.
+        ///		
+        /// @param      data
+        /// @param      number of rows
+        /// @param      number of columns
+        ///
+        /// @return     None
+        ///
+        static void fft2(std::vector<std::complex<dtype> >& ioData, uint32 inNumRows, uint32 inNumCols)
+        {
+            transform2d(ioData, inNumRows, inNumCols, false, "fft2");
+        }
+
+        //============================================================================
+        ///						In place two dimensional inverse transform of row major
+        ///						data, scaled by 1/(rows * cols). Both dimensions must be
+        ///						powers of two.
+        ///		
+        /// @param      data
+        /// @param      number of rows
+        /// @param      number of columns
+        ///
+        /// @return     None
+        ///
+        static void ifft2(std::vector<std::complex<dtype> >& ioData, uint32 inNumRows, uint32 inNumCols)
+        {
+            transform2d(ioData, inNumRows, inNumCols, true, "ifft2");
+            scale(ioData, inNumRows * inNumCols);
+        }
+
+    private:
+        //============================================================================
+        ///						Throws if the size is not a power of two
+        ///		
+        /// @param      size
+        /// @param      name of the calling function for the error message
+        ///
+        /// @return     None
+        ///
+        static void checkSize(uint32 inSize, const std::string& inFunctionName)
+        {
+            if (inSize == 0 || (inSize & (inSize - 1)) != 0)
+            {
+                throw std::invalid_argument("ERROR: NumCpp::FFT::" + inFunctionName + ": input size must be a power of two.");
+            }
+        }
+
+        //============================================================================
+        ///						Returns the N/2 twiddle factors exp(-+2 pi i k / N)
+        ///		
+        /// @param      transform size
+        /// @param      true for the inverse transform
+        ///
+        /// @return     twiddle factors
+        ///
+        static std::vector<std::complex<dtype> > twiddles(uint32 inSize, bool inInverse)
+        {
+            const double sign = inInverse ? 1.0 : -1.0;
+            std::vector<std::complex<dtype> > factors(inSize / 2);
+            for (uint32 k = 0; k < factors.size(); ++k)
+            {
+                const double angle = sign * 2.0 * Constants::pi * static_cast<double>(k) / static_cast<double>(inSize);
+                factors[k] = std::complex<dtype>(static_cast<dtype>(std::cos(angle)), static_cast<dtype>(std::sin(angle)));
+            }
+
+            return factors;
+        }
+
+        //============================================================================
+        ///						Returns the bit reversed index
+        ///		
+        /// @param      index
+        /// @param      transform size, a power of two
+        ///
+        /// @return     bit reversed index
+        ///
+        static uint32 bitReverse(uint32 inIndex, uint32 inSize)
+        {
+            uint32 reversed = 0;
+            for (uint32 bit = 1; bit < inSize; bit <<= 1)
+            {
+                reversed = (reversed << 1) | (inIndex & 1);
+                inIndex >>= 1;
+            }
+
+            return reversed;
+        }
+
+        //============================================================================
+        ///						Complex multiply without the inf/nan recovery of the
+        ///						standard operator, which keeps the butterflies vectorizable
+        ///		
+        /// @param      lhs
+        /// @param      rhs
+        ///
+        /// @return     product
+        ///
+        static std::complex<dtype> multiply(const std::complex<dtype>& inLhs, const std::complex<dtype>& inRhs)
+        {
+            return std::complex<dtype>(inLhs.real() * inRhs.real() - inLhs.imag() * inRhs.imag(),
+                inLhs.real() * inRhs.imag() + inLhs.imag() * inRhs.real());
+        }
+
+        //============================================================================
+        ///						Iterative radix-2 transform of one contiguous line
+        ///		
+        /// @param      data
+        /// @param      twiddle factors for the line size
+        /// @param      line size, a power of two
+        ///
+        /// @return     None
+        ///
+        static void transformLine(std::complex<dtype>* ioData, const std::vector<std::complex<dtype> >& inTwiddles, uint32 inSize)
+        {
+            for (uint32 i = 0; i < inSize; ++i)
+            {
+                const uint32 j = bitReverse(i, inSize);
+                if (i < j)
+                {
+                    std::swap(ioData[i], ioData[j]);
+                }
+            }
+
+            for (uint32 length = 2; length <= inSize; length <<= 1)
+            {
+                const uint32 half = length / 2;
+                const uint32 step = inSize / length;
+                for (uint32 start = 0; start < inSize; start += length)
+                {
+                    for (uint32 k = 0; k < half; ++k)
+                    {
+                        const std::complex<dtype> odd = multiply(inTwiddles[k * step], ioData[start + k + half]);
+                        ioData[start + k + half] = ioData[start + k] - odd;
+                        ioData[start + k] += odd;
+                    }
+                }
+            }
+        }
+
+        //============================================================================
+        ///						Two dimensional transform. The rows are transformed one at
+        ///						a time, the columns by running the same butterflies over
+        ///						whole rows so the inner loops stay contiguous.
+        ///		
+        /// @param      data
+        /// @param      number of rows
+        /// @param      number of columns
+        /// @param      true for the inverse transform
+        /// @param      name of the calling function for the error message
+        ///
+        /// @return     None
+        ///
+        static void transform2d(std::vector<std::complex<dtype> >& ioData, uint32 inNumRows, uint32 inNumCols,
+            bool inInverse, const std::string& inFunctionName)
+        {
+            checkSize(inNumRows, inFunctionName);
+            checkSize(inNumCols, inFunctionName);
+            if (ioData.size() != static_cast<size_t>(inNumRows) * inNumCols)
+            {
+                throw std::invalid_argument("ERROR: NumCpp::FFT::" + inFunctionName + ": input size does not match the dimensions.");
+            }
+
+            const std::vector<std::complex<dtype> > rowTwiddles = twiddles(inNumCols, inInverse);
+            for (uint32 row = 0; row < inNumRows; ++row)
+            {
+                transformLine(&ioData[static_cast<size_t>(row) * inNumCols], rowTwiddles, inNumCols);
+            }
+
+            std::complex<dtype>* data = ioData.data();
+            for (uint32 row = 0; row < inNumRows; ++row)
+            {
+                const uint32 reversed = bitReverse(row, inNumRows);
+                if (row < reversed)
+                {
+                    std::swap_ranges(data + static_cast<size_t>(row) * inNumCols, data + static_cast<size_t>(row + 1) * inNumCols,
+                        data + static_cast<size_t>(reversed) * inNumCols);
+                }
+            }
+
+            const std::vector<std::complex<dtype> > colTwiddles = twiddles(inNumRows, inInverse);
+            for (uint32 length = 2; length <= inNumRows; length <<= 1)
+            {
+                const uint32 half = length / 2;
+                const uint32 step = inNumRows / length;
+                for (uint32 start = 0; start < inNumRows; start += length)
+                {
+                    for (uint32 k = 0; k < half; ++k)
+                    {
+                        const std::complex<dtype> twiddle = colTwiddles[k * step];
+                        std::complex<dtype>* evenRow = data + static_cast<size_t>(start + k) * inNumCols;
+                        std::complex<dtype>* oddRow = data + static_cast<size_t>(start + k + half) * inNumCols;
+                        for (uint32 col = 0; col < inNumCols; ++col)
+                        {
+                            const std::complex<dtype> odd = multiply(twiddle, oddRow[col]);
+                            oddRow[col] = evenRow[col] - odd;
+                            evenRow[col] += odd;
+                        }
+                    }
+                }
+            }
+        }
+
+        //============================================================================
+        ///						Scales the data by 1/N after an inverse transform
+        ///		
+        /// @param      data
+        /// @param      N
+        ///
+        /// @return     None
+        ///
+        static void scale(std::vector<std::complex<dtype> >& ioData, uint32 inSize)
+        {
+            const dtype factor = static_cast<dtype>(1) / static_cast<dtype>(inSize);
+            for (auto& value : ioData)
+            {
+                value *= factor;
+            }
+        }
     };
 }
@@ -0,0 +1,888 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+/// @version 1.0
+///
+/// @section LICENSE
+/// Copyright 2018 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software
+/// without restriction, including without limitation the rights to use, copy, modify,
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+/// permit persons to whom the Software is furnished to do so, subject to the following
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+/// DEALINGS IN THE SOFTWARE.
+///
+/// @section DESCRIPTION
+/// Element-wise math kernels for contiguous buffers
+///
+#pragma once
+
+#include"NumCpp/Types.hpp"
+
+#include<algorithm>
+#include<cmath>
+#include<cstring>
+#include<limits>
+
+namespace NumCpp
+{
+    //================================================================================
+    // Class Description:
+    ///						Element-wise math kernels that operate on contiguous buffers.
+    ///
+    ///						The generic version simply forwards to the standard library.  The
+    ///						float specialization below replaces the hot transcendental functions
+    ///						with branch-free polynomial approximations.
+    ///
+    ///						All kernels take (first, last, out) like std::transform, and out
+    ///						may be the same buffer as the input.
+    template<typename dtype>
+    class FastMath
+    {
+    public:
+        //============================================================================
+        // Method Description:
+        ///						Exponential of each element
+        ///
+        /// @param				first input element
+        /// @param				one past the last input element
+        /// @param				first output element
+        ///
+        static void exp(const dtype* inFirst, const dtype* inLast, dtype* outFirst)
+        {
+            std::transform(inFirst, inLast, outFirst, [](dtype inValue) { return std::exp(inValue); });
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						2**x of each element
+        ///
+        /// @param				first input element
+        /// @param				one past the last input element
+        /// @param				first output element
+        ///
+        static void exp2(const dtype* inFirst, const dtype* inLast, dtype* outFirst)
+        {
+            std::transform(inFirst, inLast, outFirst, [](dtype inValue) { return std::exp2(inValue); });
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						Natural log of each element
+        ///
+        /// @param				first input element
+        /// @param				one past the last input element
+        /// @param				first output element
+        ///
+        static void log(const dtype* inFirst, const dtype* inLast, dtype* outFirst)
+        {
+            std::transform(inFirst, inLast, outFirst, [](dtype inValue) { return std::log(inValue); });
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						Base 10 log of each element
+        ///
+        /// @param				first input element
+        /// @param				one past the last input element
+        /// @param				first output element
+        ///
+        static void log10(const dtype* inFirst, const dtype* inLast, dtype* outFirst)
+        {
+            std::transform(inFirst, inLast, outFirst, [](dtype inValue) { return std::log10(inValue); });
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						Base 2 log of each element
+        ///
+        /// @param				first input element
+        /// @param				one past the last input element
+        /// @param				first output element
+        ///
+        static void log2(const dtype* inFirst, const dtype* inLast, dtype* outFirst)
+        {
+            std::transform(inFirst, inLast, outFirst, [](dtype inValue) { return std::log2(inValue); });
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						Sine of each element
+        ///
+        /// @param				first input element
+        /// @param				one past the last input element
+        /// @param				first output element
+        ///
+        static void sin(const dtype* inFirst, const dtype* inLast, dtype* outFirst)
+        {
+            std::transform(inFirst, inLast, outFirst, [](dtype inValue) { return std::sin(inValue); });
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						Cosine of each element
+        ///
+        /// @param				first input element
+        /// @param				one past the last input element
+        /// @param				first output element
+        ///
+        static void cos(const dtype* inFirst, const dtype* inLast, dtype* outFirst)
+        {
+            std::transform(inFirst, inLast, outFirst, [](dtype inValue) { return std::cos(inValue); });
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						Tangent of each element
+        ///
+        /// @param				first input element
+        /// @param				one past the last input element
+        /// @param				first output element
+        ///
+        static void tan(const dtype* inFirst, const dtype* inLast, dtype* outFirst)
+        {
+            std::transform(inFirst, inLast, outFirst, [](dtype inValue) { return std::tan(inValue); });
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						Inverse tangent of each element
+        ///
+        /// @param				first input element
+        /// @param				one past the last input element
+        /// @param				first output element
+        ///
+        static void arctan(const dtype* inFirst, const dtype* inLast, dtype* outFirst)
+        {
+            std::transform(inFirst, inLast, outFirst, [](dtype inValue) { return std::atan(inValue); });
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						Quadrant aware inverse tangent of y/x of each element pair
+        ///
+        /// @param				first input y element
+        /// @param				one past the last input y element
+        /// @param				first input x element
+        /// @param				first output element
+        ///
+        static void arctan2(const dtype* inFirstY, const dtype* inLastY, const dtype* inFirstX, dtype* outFirst)
+        {
+            std::transform(inFirstY, inLastY, inFirstX, outFirst, [](dtype inY, dtype inX) { return std::atan2(inY, inX); });
+        }
+    };
+
+    //================================================================================
+    // Class Description:
+    ///						Single precision kernels.
+    ///
+    ///						Every kernel is a straight line sequence of multiply-adds and
+    ///						selects with no calls or branches, so the loops auto-vectorize to
+    ///						the widest instruction set the translation unit is compiled for
+    ///						(/arch:AVX2 or /arch:AVX512 with Visual Studio, -mavx2 or
+    ///						-mavx512f with gcc).  The polynomials are the Cephes single
+    ///						precision minimax fits.
+    ///
+    ///						Maximum error measured against the double precision result,
+    ///						rounded, over all finite float inputs in the valid domain:
+    ///						exp 1 ulp, exp2 1 ulp, log 1 ulp, log2 2 ulp, log10 2 ulp,
+    ///						sin 2 ulp, cos 2 ulp, tan 3 ulp, arctan 3 ulp, arctan2 3 ulp.
+    ///						Results are not correctly rounded, denormal outputs of exp/exp2
+    ///						are supported, and inf/nan inputs follow the C library.
+    template<>
+    class FastMath<float>
+    {
+    private:
+        //============================================================================
+        // Method Description:
+        ///						reinterprets the bits of a float as an int
+        ///
+        /// @param				float
+        /// @return             int32
+        ///
+        static int32 asInt(float inValue)
+        {
+            int32 returnValue;
+            std::memcpy(&returnValue, &inValue, sizeof(float));
+            return returnValue;
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						reinterprets the bits of an int as a float
+        ///
+        /// @param				int32
+        /// @return             float
+        ///
+        static float asFloat(int32 inValue)
+        {
+            float returnValue;
+            std::memcpy(&returnValue, &inValue, sizeof(float));
+            return returnValue;
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						branch-free select, keeps the compiler from turning
+        ///						the kernels back into control flow
+        ///
+        /// @param				condition
+        /// @param				value if true
+        /// @param				value if false
+        /// @return             float
+        ///
+        static float select(bool inCondition, float inTrue, float inFalse)
+        {
+            const int32 mask = -static_cast<int32>(inCondition);
+            return asFloat((asInt(inTrue) & mask) | (asInt(inFalse) & ~mask));
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						negates the value if the condition is true
+        ///
+        /// @param				float
+        /// @param				condition
+        /// @return             float
+        ///
+        static float flipSign(float inValue, bool inCondition)
+        {
+            return asFloat(asInt(inValue) ^ (static_cast<int32>(inCondition) << 31));
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						rounds to the nearest integer, halfway cases away from zero
+        ///
+        /// @param				float
+        /// @return             float
+        ///
+        static float roundNearest(float inValue)
+        {
+            return static_cast<float>(static_cast<int32>(inValue + select(inValue < 0.0f, -0.5f, 0.5f)));
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						multiplies by 2**n, n in [-150, 128], without overflowing
+        ///						the exponent field of the intermediate scale factors
+        ///
+        /// @param				float
+        /// @param				exponent
+        /// @return             float
+        ///
+        static float scaleByPow2(float inValue, int32 inExponent)
+        {
+            const int32 half = inExponent / 2;
+            return inValue * asFloat((half + 127) << 23) * asFloat((inExponent - half + 127) << 23);
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						exp(r) for |r| <= ln(2)/2
+        ///
+        /// @param				float
+        /// @return             float
+        ///
+        static float expPoly(float inR)
+        {
+            const float z = inR * inR;
+            float y = 1.9875691500e-4f;
+            y = y * inR + 1.3981999507e-3f;
+            y = y * inR + 8.3334519073e-3f;
+            y = y * inR + 4.1665795894e-2f;
+            y = y * inR + 1.6666665459e-1f;
+            y = y * inR + 5.0000001201e-1f;
+            return y * z + inR + 1.0f;
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						exp kernel
+        ///
+        /// @param				float
+        /// @return             float
+        ///
+        static float expKernel(float inValue)
+        {
+            const float EXP_HIGH = 88.72283935546875f;
+            const float EXP_LOW = -103.97207708f;
+            const float LOG2E = 1.44269504088896341f;
+            const float LN2_HI = 0.693359375f;
+            const float LN2_LO = -2.12194440e-4f;
+
+            float x = select(inValue > EXP_HIGH, EXP_HIGH, inValue);
+            x = select(x < EXP_LOW, EXP_LOW, x);
+            x = select(x != x, 0.0f, x);
+
+            const float n = roundNearest(x * LOG2E);
+            const float r = (x - n * LN2_HI) - n * LN2_LO;
+            const float y = scaleByPow2(expPoly(r), static_cast<int32>(n));
+
+            float result = select(inValue < EXP_LOW, 0.0f, y);
+            result = select(inValue > EXP_HIGH, std::numeric_limits<float>::infinity(), result);
+            return select(inValue != inValue, inValue, result);
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						exp2 kernel
+        ///
+        /// @param				float
+        /// @return             float
+        ///
+        static float exp2Kernel(float inValue)
+        {
+            float x = select(inValue > 128.0f, 128.0f, inValue);
+            x = select(x < -150.0f, -150.0f, x);
+            x = select(x != x, 0.0f, x);
+
+            const float n = roundNearest(x);
+            const float y = scaleByPow2(expPoly((x - n) * 0.693147180559945309f), static_cast<int32>(n));
+
+            float result = select(inValue < -150.0f, 0.0f, y);
+            result = select(inValue >= 128.0f, std::numeric_limits<float>::infinity(), result);
+            return select(inValue != inValue, inValue, result);
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						splits x into 2**e * (1 + f) with sqrt(1/2) <= 1 + f < sqrt(2)
+        ///						and returns log(1 + f) without the exponent contribution
+        ///
+        /// @param				float
+        /// @param				returns the exponent as a float
+        /// @return             float
+        ///
+        static float logMantissa(float inValue, float& outExponent)
+        {
+            const float SQRTHF = 0.707106781186547524f;
+
+            const float scaled = inValue * 8388608.0f;
+            const bool subnormal = inValue < std::numeric_limits<float>::min();
+            const int32 bits = asInt(select(subnormal, scaled, inValue));
+            int32 exponent = ((bits >> 23) & 0xff) - 126 - 23 * static_cast<int32>(subnormal);
+            const float m = asFloat((bits & 0x007fffff) | 0x3f000000);
+
+            const bool belowSqrtHalf = m < SQRTHF;
+            exponent -= static_cast<int32>(belowSqrtHalf);
+            const float mMinusOne = m - 1.0f;
+            const float twoMMinusOne = m + mMinusOne;
+            const float f = select(belowSqrtHalf, twoMMinusOne, mMinusOne);
+
+            const float z = f * f;
+            float y = 7.0376836292e-2f;
+            y = y * f - 1.1514610310e-1f;
+            y = y * f + 1.1676998740e-1f;
+            y = y * f - 1.2420140846e-1f;
+            y = y * f + 1.4249322787e-1f;
+            y = y * f - 1.6668057665e-1f;
+            y = y * f + 2.0000714765e-1f;
+            y = y * f - 2.4999993993e-1f;
+            y = y * f + 3.3333331174e-1f;
+            y = y * f * z - 0.5f * z;
+
+            outExponent = static_cast<float>(exponent);
+            return f + y;
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						applies the C library results for the special log inputs
+        ///
+        /// @param				input value
+        /// @param				kernel result
+        /// @return             float
+        ///
+        static float logSpecialCases(float inValue, float inResult)
+        {
+            float result = select(inValue < 0.0f, std::numeric_limits<float>::quiet_NaN(), inResult);
+            result = select(inValue == 0.0f, -std::numeric_limits<float>::infinity(), result);
+            result = select(inValue == std::numeric_limits<float>::infinity(), inValue, result);
+            return select(inValue != inValue, inValue, result);
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						log kernel
+        ///
+        /// @param				float
+        /// @return             float
+        ///
+        static float logKernel(float inValue)
+        {
+            const float LN2_HI = 0.693359375f;
+            const float LN2_LO = -2.12194440e-4f;
+
+            float exponent;
+            const float lnMantissa = logMantissa(inValue, exponent);
+            return logSpecialCases(inValue, (lnMantissa + exponent * LN2_LO) + exponent * LN2_HI);
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						log2 kernel
+        ///
+        /// @param				float
+        /// @return             float
+        ///
+        static float log2Kernel(float inValue)
+        {
+            const float LOG2E = 1.44269504088896341f;
+
+            float exponent;
+            const float lnMantissa = logMantissa(inValue, exponent);
+            return logSpecialCases(inValue, lnMantissa * LOG2E + exponent);
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						log10 kernel
+        ///
+        /// @param				float
+        /// @return             float
+        ///
+        static float log10Kernel(float inValue)
+        {
+            const float LOG10E = 0.434294481903251827651f;
+            const float LOG10_2_HI = 0.30078125f;
+            const float LOG10_2_LO = 2.48745663981195213739e-4f;
+
+            float exponent;
+            const float lnMantissa = logMantissa(inValue, exponent);
+            return logSpecialCases(inValue, (lnMantissa * LOG10E + exponent * LOG10_2_LO) + exponent * LOG10_2_HI);
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						reduces |x| to r in [-pi/4, pi/4] and returns the even
+        ///						octant index j with |x| = j * pi/4 + r.  The reduction is done
+        ///						in double precision so that r keeps full relative accuracy near
+        ///						the zeros of sin and cos.
+        ///
+        /// @param				float
+        /// @param				returns the reduced argument
+        /// @return             int32
+        ///
+        static int32 reduceOctant(float inValue, float& outR)
+        {
+            const double FOPI = 1.27323954473516268615;
+            const double PIO4_A = 0.78539812564849853515625;
+            const double PIO4_B = 3.774894977445941e-08;
+            const double PIO4_C = -1.3359453669305078e-24;
+
+            const double ax = std::abs(static_cast<double>(inValue));
+            const int32 j = (static_cast<int32>(ax * FOPI) + 1) & ~1;
+            const double dj = static_cast<double>(j);
+            outR = static_cast<float>(((ax - dj * PIO4_A) - dj * PIO4_B) - dj * PIO4_C);
+            return j;
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						sin(r) for |r| <= pi/4
+        ///
+        /// @param				float
+        /// @return             float
+        ///
+        static float sinPoly(float inR)
+        {
+            const float z = inR * inR;
+            return ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f) * z * inR + inR;
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						cos(r) for |r| <= pi/4
+        ///
+        /// @param				float
+        /// @return             float
+        ///
+        static float cosPoly(float inR)
+        {
+            const float z = inR * inR;
+            return ((2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f) * z * z - 0.5f * z + 1.0f;
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						sin kernel, valid for |x| <= SINCOS_LIMIT
+        ///
+        /// @param				float
+        /// @return             float
+        ///
+        static float sinKernel(float inValue)
+        {
+            float r;
+            const int32 j = reduceOctant(inValue, r);
+            const float s = sinPoly(r);
+            const float c = cosPoly(r);
+            const float y = select((j & 2) != 0, c, s);
+            const bool negate = ((j & 4) != 0) != (inValue < 0.0f);
+            return flipSign(y, negate);
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						cos kernel, valid for |x| <= SINCOS_LIMIT
+        ///
+        /// @param				float
+        /// @return             float
+        ///
+        static float cosKernel(float inValue)
+        {
+            float r;
+            const int32 j = reduceOctant(inValue, r);
+            const float s = sinPoly(r);
+            const float c = cosPoly(r);
+            const float y = select((j & 2) != 0, s, c);
+            return flipSign(y, ((j + 2) & 4) != 0);
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						tan kernel, valid for |x| <= SINCOS_LIMIT
+        ///
+        /// @param				float
+        /// @return             float
+        ///
+        static float tanKernel(float inValue)
+        {
+            float r;
+            const int32 j = reduceOctant(inValue, r);
+            const float s = sinPoly(r);
+            const float c = cosPoly(r);
+            const float numerator = select((j & 2) != 0, c, s);
+            const float denominator = select((j & 2) != 0, flipSign(s, true), c);
+            return flipSign(numerator / denominator, inValue < 0.0f);
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						arctan kernel
+        ///
+        /// @param				float
+        /// @return             float
+        ///
+        static float arctanKernel(float inValue)
+        {
+            const float PI_2 = 1.57079632679489661923f;
+            const float PI_4 = 0.785398163397448309616f;
+            const float TAN_3PI_8 = 2.414213562373095f;
+            const float TAN_PI_8 = 0.4142135623730950f;
+
+            const float ax = std::abs(inValue);
+            const bool big = ax > TAN_3PI_8;
+            const bool mid = ax > TAN_PI_8;
+
+            const float axMinusOne = ax - 1.0f;
+            const float axPlusOne = ax + 1.0f;
+            const float numerator = select(big, -1.0f, select(mid, axMinusOne, ax));
+            const float denominator = select(big, ax, select(mid, axPlusOne, 1.0f));
+            const float y0 = select(big, PI_2, select(mid, PI_4, 0.0f));
+            const float t = numerator / denominator;
+            const float z = t * t;
+
+            const float y = (((8.05374449538e-2f * z - 1.38776856032e-1f) * z + 1.99777106478e-1f) * z - 3.33329491539e-1f) * z * t + t + y0;
+            return flipSign(y, inValue < 0.0f);
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						arctan2 kernel, valid when x and y are nonzero and y/x is finite
+        ///
+        /// @param				y
+        /// @param				x
+        /// @return             float
+        ///
+        static float arctan2Kernel(float inY, float inX)
+        {
+            const float PI = 3.14159265358979323846f;
+
+            const float y = arctanKernel(inY / inX);
+            const float offset = select(inX < 0.0f, select(inY < 0.0f, -PI, PI), 0.0f);
+            return y + offset;
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						true if the argument reduction for sin/cos/tan is not accurate
+        ///
+        /// @param				float
+        /// @return             bool
+        ///
+        static bool sinCosOutOfRange(float inValue)
+        {
+            const float SINCOS_LIMIT = 8192.0f;
+
+            return !(std::abs(inValue) <= SINCOS_LIMIT);
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						true if arctan2 is at a zero, infinity, or nan
+        ///
+        /// @param				y
+        /// @param				x
+        /// @return             bool
+        ///
+        static bool arctan2OutOfRange(float inY, float inX)
+        {
+            return !(std::abs(inY / inX) <= std::numeric_limits<float>::max()) || inX == 0.0f || inY == 0.0f;
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						Runs a kernel over fixed size blocks and patches the elements that
+        ///						are outside of the kernel's valid domain with the C library result.
+        ///						The input is staged per block so the operation may be done in place.
+        ///
+        /// @param				first input element
+        /// @param				one past the last input element
+        /// @param				first output element
+        /// @param				kernel
+        /// @param				out of range predicate
+        /// @param				C library fallback
+        ///
+        template<typename Kernel, typename OutOfRange, typename Fallback>
+        static void blockTransform(const float* inFirst, const float* inLast, float* outFirst,
+            Kernel inKernel, OutOfRange inOutOfRange, Fallback inFallback)
+        {
+            const uint32 BLOCK_SIZE = 256;
+
+            float block[BLOCK_SIZE];
+            while (inFirst != inLast)
+            {
+                const uint32 count = static_cast<uint32>(std::min<std::ptrdiff_t>(BLOCK_SIZE, inLast - inFirst));
+                std::copy(inFirst, inFirst + count, block);
+
+                uint32 numOutOfRange = 0;
+                for (uint32 i = 0; i < count; ++i)
+                {
+                    outFirst[i] = inKernel(block[i]);
+                    numOutOfRange += inOutOfRange(block[i]) ? 1 : 0;
+                }
+
+                if (numOutOfRange > 0)
+                {
+                    for (uint32 i = 0; i < count; ++i)
+                    {
+                        if (inOutOfRange(block[i]))
+                        {
+                            outFirst[i] = inFallback(block[i]);
+                        }
+                    }
+                }
+
+                inFirst += count;
+                outFirst += count;
+            }
+        }
+
+    public:
+        //============================================================================
+        // Method Description:
+        ///						Exponential of each element, max error 1 ulp
+        ///
+        /// @param				first input element
+        /// @param				one past the last input element
+        /// @param				first output element
+        ///
+        static void exp(const float* inFirst, const float* inLast, float* outFirst)
+        {
+            const uint32 size = static_cast<uint32>(inLast - inFirst);
+            for (uint32 i = 0; i < size; ++i)
+            {
+                outFirst[i] = expKernel(inFirst[i]);
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						2**x of each element, max error 1 ulp
+        ///
+        /// @param				first input element
+        /// @param				one past the last input element
+        /// @param				first output element
+        ///
+        static void exp2(const float* inFirst, const float* inLast, float* outFirst)
+        {
+            const uint32 size = static_cast<uint32>(inLast - inFirst);
+            for (uint32 i = 0; i < size; ++i)
+            {
+                outFirst[i] = exp2Kernel(inFirst[i]);
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						Natural log of each element, max error 1 ulp
+        ///
+        /// @param				first input element
+        /// @param				one past the last input element
+        /// @param				first output element
+        ///
+        static void log(const float* inFirst, const float* inLast, float* outFirst)
+        {
+            const uint32 size = static_cast<uint32>(inLast - inFirst);
+            for (uint32 i = 0; i < size; ++i)
+            {
+                outFirst[i] = logKernel(inFirst[i]);
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						Base 10 log of each element, max error 2 ulp
+        ///
+        /// @param				first input element
+        /// @param				one past the last input element
+        /// @param				first output element
+        ///
+        static void log10(const float* inFirst, const float* inLast, float* outFirst)
+        {
+            const uint32 size = static_cast<uint32>(inLast - inFirst);
+            for (uint32 i = 0; i < size; ++i)
+            {
+                outFirst[i] = log10Kernel(inFirst[i]);
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						Base 2 log of each element, max error 2 ulp
+        ///
+        /// @param				first input element
+        /// @param				one past the last input element
+        /// @param				first output element
+        ///
+        static void log2(const float* inFirst, const float* inLast, float* outFirst)
+        {
+            const uint32 size = static_cast<uint32>(inLast - inFirst);
+            for (uint32 i = 0; i < size; ++i)
+            {
+                outFirst[i] = log2Kernel(inFirst[i]);
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						Sine of each element, max error 2 ulp.  Arguments larger
+        ///						than 8192 in magnitude fall back to the C library.
+        ///
+        /// @param				first input element
+        /// @param				one past the last input element
+        /// @param				first output element
+        ///
+        static void sin(const float* inFirst, const float* inLast, float* outFirst)
+        {
+            blockTransform(inFirst, inLast, outFirst, sinKernel, sinCosOutOfRange,
+                [](float inValue) { return std::sin(inValue); });
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						Cosine of each element, max error 2 ulp.  Arguments larger
+        ///						than 8192 in magnitude fall back to the C library.
+        ///
+        /// @param				first input element
+        /// @param				one past the last input element
+        /// @param				first output element
+        ///
+        static void cos(const float* inFirst, const float* inLast, float* outFirst)
+        {
+            blockTransform(inFirst, inLast, outFirst, cosKernel, sinCosOutOfRange,
+                [](float inValue) { return std::cos(inValue); });
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						Tangent of each element, max error 3 ulp.  Arguments larger
+        ///						than 8192 in magnitude fall back to the C library.
+        ///
+        /// @param				first input element
+        /// @param				one past the last input element
+        /// @param				first output element
+        ///
+        static void tan(const float* inFirst, const float* inLast, float* outFirst)
+        {
+            blockTransform(inFirst, inLast, outFirst, tanKernel, sinCosOutOfRange,
+                [](float inValue) { return std::tan(inValue); });
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						Inverse tangent of each element, max error 3 ulp
+        ///
+        /// @param				first input element
+        /// @param				one past the last input element
+        /// @param				first output element
+        ///
+        static void arctan(const float* inFirst, const float* inLast, float* outFirst)
+        {
+            const uint32 size = static_cast<uint32>(inLast - inFirst);
+            for (uint32 i = 0; i < size; ++i)
+            {
+                outFirst[i] = arctanKernel(inFirst[i]);
+            }
+        }
+
+        //============================================================================
+        // Method Description:
+        ///						Quadrant aware inverse tangent of y/x of each element pair,
+        ///						max error 3 ulp.  Zeros, infinities, and nans fall back to
+        ///						the C library.
+        ///
+        /// @param				first input y element
+        /// @param				one past the last input y element
+        /// @param				first input x element
+        /// @param				first output element
+        ///
+        static void arctan2(const float* inFirstY, const float* inLastY, const float* inFirstX, float* outFirst)
+        {
+            const uint32 BLOCK_SIZE = 256;
+
+            float blockY[BLOCK_SIZE];
+            float blockX[BLOCK_SIZE];
+            while (inFirstY != inLastY)
+            {
+                const uint32 count = static_cast<uint32>(std::min<std::ptrdiff_t>(BLOCK_SIZE, inLastY - inFirstY));
+                std::copy(inFirstY, inFirstY + count, blockY);
+                std::copy(inFirstX, inFirstX + count, blockX);
+
+                uint32 numOutOfRange = 0;
+                for (uint32 i = 0; i < count; ++i)
+                {
+                    outFirst[i] = arctan2Kernel(blockY[i], blockX[i]);
+                    numOutOfRange += arctan2OutOfRange(blockY[i], blockX[i]) ? 1 : 0;
+                }
+
+                if (numOutOfRange > 0)
+                {
+                    for (uint32 i = 0; i < count; ++i)
+                    {
+                        if (arctan2OutOfRange(blockY[i], blockX[i]))
+                        {
+                            outFirst[i] = std::atan2(blockY[i], blockX[i]);
+                        }
+                    }
+                }
+
+                inFirstY += count;
+                inFirstX += count;
+                outFirst += count;
+            }
+        }
+    };
+}
@@ -28,13 +28,21 @@
 ///
 #pragma once
 
+#include<NumCpp/DtypeInfo.hpp>
+#include<NumCpp/FFT.hpp>
 #include<NumCpp/NdArray.hpp>
 #include<NumCpp/Methods.hpp>
+#include<NumCpp/TileExecutor.hpp>
 #include<NumCpp/Types.hpp>
 #include<NumCpp/Utils.hpp>
 
+#include<algorithm>
 #include<cmath>
+#include<complex>
+#include<functional>
+#include<stdexcept>
 #include<utility>
+#include<vector>
 
 namespace NumCpp
 {
@@ -46,8 +54,29 @@ namespace NumCpp
         // Enum Description:
         ///						Boundary condition to apply to the image filter
         struct Boundary { enum Mode { REFLECT = 0, CONSTANT, NEAREST, MIRROR, WRAP }; };
+
+        //================================================================================
+        // Enum Description:
+        ///						Algorithm used by the gaussian and uniform filters and the
+        ///						convolutions. DIRECT convolves with the kernel. RECURSIVE uses
+        ///						the Young-van Vliet recursive approximation for the gaussian,
+        ///						whose cost does not depend on sigma and is intended for large
+        ///						sigma, and block running sums for the uniform filters, whose
+        ///						cost does not depend on the kernel size. FFT (convolution only)
+        ///						multiplies overlap-save blocks in the frequency domain, and AUTO
+        ///						picks DIRECT or FFT from the kernel size, keeping to DIRECT when
+        ///						the image holds a non-finite value. The convolutions default to
+        ///						DIRECT. The gaussian and uniform filters treat FFT and AUTO as
+        ///						DIRECT.
+        struct Method { enum Type { DIRECT = 0, RECURSIVE, FFT, AUTO }; };
     }
 
+    template<typename dtype>
+    class FilterPipeline;
+
+    template<typename dtype>
+    class StreamingFilter;
+
     //================================================================================
     // Class Description:
     ///						Class for performing many types of image filtering
@@ -55,614 +84,1916 @@ namespace NumCpp
     class Filters
     {
     private:
+        // the pipeline stages and the streaming filters reuse the filter kernels
+        friend class FilterPipeline<dtype>;
+        friend class StreamingFilter<dtype>;
+
         //============================================================================
         // Method Description: 
-        ///						samples a gaussian of mean zero and input STD sigma
+        ///						Returns the normalized 1d gaussian kernel for the input sigma,
+        ///						4 standard deviations either side of the center. The 2d
+        ///						gaussian kernel is the outer product of this kernel with itself.
         ///		
-        /// @param				x value,
-        /// @param              y value,
         /// @param              sigma value
         ///              
-        /// @return             dtype
+        /// @return             std::vector<double>
         ///
-        static dtype gaussian(dtype inX, dtype inY, dtype inSigma)
+        static std::vector<double> gaussianKernel(double inSigma)
         {
-            double exponent = -(Utils<dtype>::sqr(inX) + Utils<dtype>::sqr(inY)) / (2 * Utils<dtype>::sqr(inSigma));
-            return static_cast<dtype>(std::exp(exponent));
+            // calculate the kernel size based off of the input sigma value
+            const uint32 MIN_KERNEL_SIZE = 5;
+            uint32 kernelSize = std::max(static_cast<uint32>(std::ceil(inSigma * 2.0 * 4.0)), MIN_KERNEL_SIZE); // 4 standard deviations
+            if (kernelSize % 2 == 0)
+            {
+                ++kernelSize; // make sure the kernel is an odd size
+            }
+
+            const double kernalHalfSize = static_cast<double>(kernelSize / 2); // integer division
+            const double twoSigmaSqr = 2.0 * Utils<double>::sqr(inSigma);
+
+            std::vector<double> kernel(kernelSize);
+            double kernelSum = 0;
+            for (uint32 i = 0; i < kernelSize; ++i)
+            {
+                kernel[i] = std::exp(-Utils<double>::sqr(static_cast<double>(i) - kernalHalfSize) / twoSigmaSqr);
+                kernelSum += kernel[i];
+            }
+
+            // normalize the kernel
+            for (uint32 i = 0; i < kernelSize; ++i)
+            {
+                kernel[i] /= kernelSum;
+            }
+
+            return kernel;
         }
 
         //============================================================================
         // Method Description: 
-        ///						extends the corner values
+        ///						Correlates the image with the separable kernel rowWeights x colWeights
+        ///						as a horizontal pass followed by a vertical pass, accumulating in
+        ///						double. Both kernels must have the same odd size. The vertical pass
+        ///						streams whole rows of the intermediate so every inner loop is
+        ///						contiguous and vectorizable. Each pass is split into row tiles
+        ///						that run in parallel.
         ///		
         /// @param				NdArray
-        /// @param              boundary size
+        /// @param              weights along the columns (horizontal pass)
+        /// @param              weights along the rows (vertical pass)
+        /// @param				NdArray, output array
+        /// @param              boundary mode
+        /// @param				contant value if boundary = 'constant'
         ///
         /// @return             None
         ///
-        static void fillCorners(NdArray<dtype>& inArray, uint32 inBorderWidth)
+        static void separableCorrelate(const NdArray<dtype>& inImageArray, const std::vector<double>& inRowWeights,
+            const std::vector<double>& inColWeights, NdArray<dtype>& outArray, Filter::Boundary::Mode inMode, dtype inConstantValue)
         {
-            Shape inShape = inArray.shape();
-            int32 numRows = static_cast<int32>(inShape.rows);
-            int32 numCols = static_cast<int32>(inShape.cols);
-
-            // top left
-            inArray.put(Slice(0, inBorderWidth), Slice(0, inBorderWidth), inArray(inBorderWidth, inBorderWidth));
+            const uint32 kernelSize = static_cast<uint32>(inRowWeights.size());
+            const Shape inShape = inImageArray.shape();
+            const BoundaryView view(inImageArray, inShape.rows, inShape.cols, kernelSize, kernelSize, inMode, inConstantValue);
+            const uint32 numCols = inShape.cols;
+
+            // horizontal pass once per distinct line, the boundary rows of the
+            // vertical pass are repeats of these
+            const uint32 numLines = view.numLines();
+            std::vector<double> horizontal(static_cast<size_t>(numLines) * numCols, 0.0);
+            TileExecutor::forEachRowTile(numLines, TileExecutor::tileRows(view.paddedCols() * sizeof(dtype)),
+                [&](uint32 inFirstLine, uint32 inNumLines)
+                {
+                    std::vector<dtype> line(view.paddedCols());
+                    for (uint32 lineIdx = inFirstLine; lineIdx < inFirstLine + inNumLines; ++lineIdx)
+                    {
+                        view.distinctLine(lineIdx, &line[0]);
+                        double* outRow = &horizontal[static_cast<size_t>(lineIdx) * numCols];
+                        for (uint32 k = 0; k < kernelSize; ++k)
+                        {
+                            const double weight = inRowWeights[k];
+                            const dtype* inData = &line[k];
+                            for (uint32 col = 0; col < numCols; ++col)
+                            {
+                                outRow[col] += weight * static_cast<double>(inData[col]);
+                            }
+                        }
+                    }
+                });
+
+            // vertical pass
+            TileExecutor::forEachRowTile(inShape.rows, TileExecutor::tileRows(numCols * sizeof(double), kernelSize),
+                [&](uint32 inFirstRow, uint32 inNumRows)
+                {
+                    std::vector<double> accumulator(numCols);
+                    for (uint32 row = inFirstRow; row < inFirstRow + inNumRows; ++row)
+                    {
+                        std::fill(accumulator.begin(), accumulator.end(), 0.0);
+                        for (uint32 k = 0; k < kernelSize; ++k)
+                        {
+                            const double weight = inColWeights[k];
+                            const double* inRow = &horizontal[static_cast<size_t>(view.lineIndex(row + k)) * numCols];
+                            for (uint32 col = 0; col < numCols; ++col)
+                            {
+                                accumulator[col] += weight * inRow[col];
+                            }
+                        }
+
+                        typename NdArray<dtype>::iterator outRow = outArray.begin(row);
+                        for (uint32 col = 0; col < numCols; ++col)
+                        {
+                            outRow[col] = static_cast<dtype>(accumulator[col]);
+                        }
+                    }
+                });
+        }
 
-            // top right
-            inArray.put(Slice(0, inBorderWidth), Slice(numCols - inBorderWidth, numCols), inArray(inBorderWidth, numCols - inBorderWidth - 1));
+        //============================================================================
+        // Method Description: 
+        ///						Returns the Young-van Vliet-van Ginkel recursive gaussian
+        ///						coefficients {B, b1, b2, b3}, already divided through by b0.
+        ///						The poles tabulated for sigma = 2 are scaled by the power 1/q,
+        ///						with q solved so the variance of the two passes together is
+        ///						exactly sigma^2. The closed form q(sigma) of the 1995 paper
+        ///						overshoots sigma by 6-11% in the 5-50 range.
+        ///						
+        ///						I.T. Young, L.J. van Vliet, M. van Ginkel, "Recursive Gabor
+        ///						filtering", IEEE Transactions on Signal Processing 50 (2002)
+        ///		
+        /// @param              sigma value, must be at least 0.5
+        ///              
+        /// @return             std::vector<double>
+        ///
+        static std::vector<double> recursiveGaussianCoefficients(double inSigma)
+        {
+            if (inSigma < 0.5)
+            {
+                throw std::invalid_argument("ERROR: NumCpp::Filters::recursiveGaussianCoefficients: the recursive gaussian requires sigma >= 0.5.");
+            }
 
-            // bottom left
-            inArray.put(Slice(numRows - inBorderWidth, numRows), Slice(0, inBorderWidth), inArray(numRows - inBorderWidth - 1, inBorderWidth));
+            // the poles for sigma = 2, the third is real
+            const std::complex<double> complexPole(1.40098, 1.00236);
+            const double realPole = 1.85132;
 
-            // bottom right
-            inArray.put(Slice(numRows - inBorderWidth, numRows), Slice(numCols - inBorderWidth, numCols), inArray(numRows - inBorderWidth - 1, numCols - inBorderWidth - 1));
+            // the variance of the causal and anti-causal passes, sum(2 * d / (d - 1)^2) over the poles
+            auto variance = [&](double inQ) -> double
+            {
+                const std::complex<double> d = std::exp(std::log(complexPole) / inQ);
+                const double d3 = std::pow(realPole, 1.0 / inQ);
+                return 2.0 * (2.0 * d / ((d - 1.0) * (d - 1.0))).real() + 2.0 * d3 / ((d3 - 1.0) * (d3 - 1.0));
+            };
+
+            // the variance grows with q, bisect for sigma^2
+            const double targetVariance = inSigma * inSigma;
+            double qLow = 0.1;
+            double qHigh = inSigma;
+            while (variance(qHigh) < targetVariance)
+            {
+                qLow = qHigh;
+                qHigh *= 2.0;
+            }
+            for (uint32 i = 0; i < 64; ++i)
+            {
+                const double qMid = 0.5 * (qLow + qHigh);
+                if (variance(qMid) < targetVariance)
+                {
+                    qLow = qMid;
+                }
+                else
+                {
+                    qHigh = qMid;
+                }
+            }
+            const double q = 0.5 * (qLow + qHigh);
+
+            // expand 1 / ((1 - z^-1 / d) (1 - z^-1 / conj(d)) (1 - z^-1 / d3))
+            const std::complex<double> d = std::exp(std::log(complexPole) / q);
+            const double d3 = std::pow(realPole, 1.0 / q);
+            const double dNorm = std::norm(d);
+            const double b1 = 2.0 * d.real() / dNorm + 1.0 / d3;
+            const double b2 = -(1.0 / dNorm + 2.0 * d.real() / (dNorm * d3));
+            const double b3 = 1.0 / (dNorm * d3);
+
+            std::vector<double> coefficients = { 1.0 - (b1 + b2 + b3), b1, b2, b3 };
+            return coefficients;
         }
 
         //============================================================================
         // Method Description: 
-        ///						extends the corner values
+        ///						Runs the causal and anti-causal recursive gaussian passes over
+        ///						a contiguous line, in-place. Both passes start in the steady
+        ///						state of their first sample.
         ///		
-        /// @param				NdArray
-        /// @param              boundary size
-        /// @param				fill value
+        /// @param				pointer to the line
+        /// @param              number of samples
+        /// @param              coefficients from recursiveGaussianCoefficients
         ///
-        /// @return
-        ///				None
+        /// @return             None
         ///
-        static void fillCorners(NdArray<dtype>& inArray, uint32 inBorderWidth, dtype inFillValue)
+        static void recursiveGaussianLine(double* ioData, uint32 inSize, const std::vector<double>& inCoefficients)
         {
-            Shape inShape = inArray.shape();
-            int32 numRows = static_cast<int32>(inShape.rows);
-            int32 numCols = static_cast<int32>(inShape.cols);
-
-            // top left
-            inArray.put(Slice(0, inBorderWidth), Slice(0, inBorderWidth), inFillValue);
+            if (inSize == 0)
+            {
+                return;
+            }
 
-            // top right
-            inArray.put(Slice(0, inBorderWidth), Slice(numCols - inBorderWidth, numCols), inFillValue);
+            const double B = inCoefficients[0];
+            const double b1 = inCoefficients[1];
+            const double b2 = inCoefficients[2];
+            const double b3 = inCoefficients[3];
 
-            // bottom left
-            inArray.put(Slice(numRows - inBorderWidth, numRows), Slice(0, inBorderWidth), inFillValue);
+            double w1 = ioData[0];
+            double w2 = w1;
+            double w3 = w1;
+            for (uint32 i = 0; i < inSize; ++i)
+            {
+                const double w0 = B * ioData[i] + b1 * w1 + b2 * w2 + b3 * w3;
+                ioData[i] = w0;
+                w3 = w2;
+                w2 = w1;
+                w1 = w0;
+            }
 
-            // bottom right
-            inArray.put(Slice(numRows - inBorderWidth, numRows), Slice(numCols - inBorderWidth, numCols), inFillValue);
+            w1 = ioData[inSize - 1];
+            w2 = w1;
+            w3 = w1;
+            for (uint32 i = inSize; i-- > 0; )
+            {
+                const double w0 = B * ioData[i] + b1 * w1 + b2 * w2 + b3 * w3;
+                ioData[i] = w0;
+                w3 = w2;
+                w2 = w1;
+                w1 = w0;
+            }
         }
 
         //============================================================================
         // Method Description: 
-        ///						Reflects the boundaries
+        ///						Recursive gaussian over an image. The rows are filtered in
+        ///						parallel row tiles, then the columns are filtered in parallel
+        ///						column stripes by running the recursion down whole rows of
+        ///						the intermediate.
         ///		
         /// @param				NdArray
-        /// @param              boundary size
+        /// @param              sigma value
+        /// @param				NdArray, output array
+        /// @param              boundary mode
+        /// @param				contant value if boundary = 'constant'
         ///
-        /// @return
-        ///				NdArray
+        /// @return             None
         ///
-        static NdArray<dtype> reflectBoundary(const NdArray<dtype>& inImage, uint32 inBoundarySize)
+        static void recursiveGaussian(const NdArray<dtype>& inImageArray, double inSigma, NdArray<dtype>& outArray,
+            Filter::Boundary::Mode inMode, dtype inConstantValue)
         {
-            Shape inShape = inImage.shape();
-            Shape outShape(inShape);
-            outShape.rows += inBoundarySize * 2;
-            outShape.cols += inBoundarySize * 2;
+            const std::vector<double> coefficients = recursiveGaussianCoefficients(inSigma);
+            const double B = coefficients[0];
+            const double b1 = coefficients[1];
+            const double b2 = coefficients[2];
+            const double b3 = coefficients[3];
+
+            // extend by the same amount as the direct filter so the boundary modes agree
+            const uint32 kernelSize = static_cast<uint32>(gaussianKernel(inSigma).size());
+            const uint32 boundarySize = kernelSize / 2; // integer division
+            const Shape inShape = inImageArray.shape();
+            const BoundaryView view(inImageArray, inShape.rows, inShape.cols, kernelSize, kernelSize, inMode, inConstantValue);
+            const uint32 paddedRows = view.paddedRows();
+            const uint32 paddedCols = view.paddedCols();
+            const uint32 numCols = inShape.cols;
+
+            // filter each distinct line once, then lay the results out down
+            // the padded rows for the vertical recursion
+            const uint32 numLines = view.numLines();
+            std::vector<double> lines(static_cast<size_t>(numLines) * numCols);
+            TileExecutor::forEachRowTile(numLines, TileExecutor::tileRows(paddedCols * sizeof(double)),
+                [&](uint32 inFirstLine, uint32 inNumLines)
+                {
+                    std::vector<dtype> paddedLine(paddedCols);
+                    std::vector<double> line(paddedCols);
+                    for (uint32 lineIdx = inFirstLine; lineIdx < inFirstLine + inNumLines; ++lineIdx)
+                    {
+                        view.distinctLine(lineIdx, &paddedLine[0]);
+                        std::copy(paddedLine.begin(), paddedLine.end(), line.begin());
+                        recursiveGaussianLine(&line[0], paddedCols, coefficients);
+                        std::copy(line.begin() + boundarySize, line.begin() + boundarySize + numCols,
+                            lines.begin() + static_cast<size_t>(lineIdx) * numCols);
+                    }
+                });
+
+            // the columns are independent, so the recursion runs over column
+            // stripes; the stripe width does not change the result
+            std::vector<double> horizontal(static_cast<size_t>(paddedRows) * numCols);
+            const uint32 numThreads = TileExecutor::numThreads();
+            const uint32 stripeCols = std::max((numCols + numThreads - 1) / numThreads, static_cast<uint32>(16));
+            const uint32 numStripes = (numCols + stripeCols - 1) / stripeCols;
+            TileExecutor::parallelFor(numStripes,
+                [&](uint32 inStripe)
+                {
+                    const uint32 firstCol = inStripe * stripeCols;
+                    const uint32 lastCol = std::min(firstCol + stripeCols, numCols);
+
+                    for (uint32 row = 0; row < paddedRows; ++row)
+                    {
+                        const double* lineRow = &lines[static_cast<size_t>(view.lineIndex(row)) * numCols];
+                        std::copy(lineRow + firstCol, lineRow + lastCol, horizontal.begin() + static_cast<size_t>(row) * numCols + firstCol);
+                    }
+
+                    // causal pass down the rows, the first row is its own steady state
+                    for (uint32 row = 1; row < paddedRows; ++row)
+                    {
+                        double* current = &horizontal[static_cast<size_t>(row) * numCols];
+                        const double* prev1 = &horizontal[static_cast<size_t>(row - 1) * numCols];
+                        const double* prev2 = &horizontal[static_cast<size_t>(row > 1 ? row - 2 : 0) * numCols];
+                        const double* prev3 = &horizontal[static_cast<size_t>(row > 2 ? row - 3 : 0) * numCols];
+                        for (uint32 col = firstCol; col < lastCol; ++col)
+                        {
+                            current[col] = B * current[col] + b1 * prev1[col] + b2 * prev2[col] + b3 * prev3[col];
+                        }
+                    }
+
+                    // anti-causal pass back up the rows, likewise starting from the last row
+                    for (uint32 row = paddedRows - 1; row-- > 0; )
+                    {
+                        double* current = &horizontal[static_cast<size_t>(row) * numCols];
+                        const double* next1 = &horizontal[static_cast<size_t>(row + 1) * numCols];
+                        const double* next2 = &horizontal[static_cast<size_t>(std::min(row + 2, paddedRows - 1)) * numCols];
+                        const double* next3 = &horizontal[static_cast<size_t>(std::min(row + 3, paddedRows - 1)) * numCols];
+                        for (uint32 col = firstCol; col < lastCol; ++col)
+                        {
+                            current[col] = B * current[col] + b1 * next1[col] + b2 * next2[col] + b3 * next3[col];
+                        }
+                    }
+
+                    for (uint32 row = 0; row < inShape.rows; ++row)
+                    {
+                        const double* inRow = &horizontal[static_cast<size_t>(row + boundarySize) * numCols];
+                        typename NdArray<dtype>::iterator outRow = outArray.begin(row);
+                        for (uint32 col = firstCol; col < lastCol; ++col)
+                        {
+                            outRow[col] = static_cast<dtype>(inRow[col]);
+                        }
+                    }
+                });
+        }
 
-            NdArray<dtype> outArray(outShape);
-            outArray.put(Slice(inBoundarySize, inBoundarySize + inShape.rows), Slice(inBoundarySize, inBoundarySize + inShape.cols), inImage);
+        //============================================================================
+        // Class Description:
+        ///						Multiset of the values under a sliding window that answers
+        ///						k-th order statistic queries. 8 and 16 bit integer types are
+        ///						counted in a full range histogram with a coarse level on top
+        ///						(Huang / Perreault-Hebert), so adding or removing a value is O(1)
+        ///						and a query walks the coarse bins from where the last query
+        ///						ended. All other types keep the window as a sorted vector.
+        ///
+        class RankWindow
+        {
+        public:
+            //============================================================================
+            // Method Description: 
+            ///						Constructor
+            ///
+            RankWindow() :
+                useHistogram_(DtypeInfo<dtype>::isInteger() && sizeof(dtype) <= 2),
+                offset_(0),
+                shift_(0),
+                coarseBin_(0),
+                countBelow_(0)
+            {
+                if (useHistogram_)
+                {
+                    const uint32 numBits = 8 * static_cast<uint32>(std::min<size_t>(sizeof(dtype), 2));
+                    offset_ = static_cast<int32>(DtypeInfo<dtype>::min());
+                    shift_ = numBits / 2;
+                    fine_.resize(static_cast<size_t>(1) << numBits, 0);
+                    coarse_.resize(static_cast<size_t>(1) << (numBits - shift_), 0);
+                }
+            }
 
-            for (uint32 row = 0; row < inBoundarySize; ++row)
+            //============================================================================
+            // Method Description: 
+            ///						Adds a value to the window
+            ///		
+            /// @param				value
+            ///
+            void add(dtype inValue)
             {
-                // bottom
-                outArray.put(row,
-                    Slice(inBoundarySize, inBoundarySize + inShape.cols),
-                    inImage(inBoundarySize - row - 1, Slice(0, inShape.cols)));
+                if (useHistogram_)
+                {
+                    const uint32 bin = binOf(inValue);
+                    ++fine_[bin];
+                    ++coarse_[bin >> shift_];
+                    if ((bin >> shift_) < coarseBin_)
+                    {
+                        ++countBelow_;
+                    }
+                }
+                else
+                {
+                    sorted_.insert(std::upper_bound(sorted_.begin(), sorted_.end(), inValue), inValue);
+                }
+            }
 
-                // top
-                outArray.put(row + inBoundarySize + inShape.rows,
-                    Slice(inBoundarySize, inBoundarySize + inShape.cols),
-                    inImage(inShape.rows - row - 1, Slice(0, inShape.cols)));
+            //============================================================================
+            // Method Description: 
+            ///						Removes one occurrence of a value that is in the window
+            ///		
+            /// @param				value
+            ///
+            void remove(dtype inValue)
+            {
+                if (useHistogram_)
+                {
+                    const uint32 bin = binOf(inValue);
+                    --fine_[bin];
+                    --coarse_[bin >> shift_];
+                    if ((bin >> shift_) < coarseBin_)
+                    {
+                        --countBelow_;
+                    }
+                }
+                else
+                {
+                    sorted_.erase(std::lower_bound(sorted_.begin(), sorted_.end(), inValue));
+                }
             }
 
-            for (uint32 col = 0; col < inBoundarySize; ++col)
+            //============================================================================
+            // Method Description: 
+            ///						Swaps a run of values out of the window for another run of
+            ///						the same length. The sorted vector merges both runs in a
+            ///						single pass instead of shifting once per value.
+            ///		
+            /// @param				outgoing values
+            /// @param				incoming values
+            /// @param				number of values in each run
+            ///
+            void replace(const dtype* inOutgoing, const dtype* inIncoming, uint32 inCount)
             {
-                // left
-                outArray.put(Slice(inBoundarySize, inBoundarySize + inShape.rows),
-                    col,
-                    inImage(Slice(0, inShape.rows), inBoundarySize - col - 1));
+                if (useHistogram_ || inCount == 1)
+                {
+                    for (uint32 i = 0; i < inCount; ++i)
+                    {
+                        remove(inOutgoing[i]);
+                        add(inIncoming[i]);
+                    }
+                    return;
+                }
+
+                outgoing_.assign(inOutgoing, inOutgoing + inCount);
+                incoming_.assign(inIncoming, inIncoming + inCount);
+                std::sort(outgoing_.begin(), outgoing_.end());
+                std::sort(incoming_.begin(), incoming_.end());
+
+                merged_.clear();
+                typename std::vector<dtype>::const_iterator outgoingIter = outgoing_.begin();
+                typename std::vector<dtype>::const_iterator incomingIter = incoming_.begin();
+                for (typename std::vector<dtype>::const_iterator iter = sorted_.begin(); iter != sorted_.end(); ++iter)
+                {
+                    if (outgoingIter != outgoing_.end() && !(*outgoingIter < *iter) && !(*iter < *outgoingIter))
+                    {
+                        ++outgoingIter;
+                        continue;
+                    }
+
+                    while (incomingIter != incoming_.end() && *incomingIter < *iter)
+                    {
+                        merged_.push_back(*incomingIter++);
+                    }
+                    merged_.push_back(*iter);
+                }
+                merged_.insert(merged_.end(), incomingIter, incoming_.cend());
 
-                // right
-                outArray.put(Slice(inBoundarySize, inBoundarySize + inShape.rows),
-                    col + inBoundarySize + inShape.cols,
-                    inImage(Slice(0, inShape.rows), inShape.cols - col - 1));
+                sorted_.swap(merged_);
             }
 
-            // now fill in the corners
-            NdArray<dtype> lowerLeft = Methods<dtype>::flipud(outArray(Slice(inBoundarySize, 2 * inBoundarySize), Slice(0, inBoundarySize)));
-            NdArray<dtype> lowerRight = Methods<dtype>::flipud(outArray(Slice(inBoundarySize, 2 * inBoundarySize), Slice(outShape.cols - inBoundarySize, outShape.cols)));
+            //============================================================================
+            // Method Description: 
+            ///						Returns the value of the given rank, 0 being the smallest
+            ///						value in the window
+            ///		
+            /// @param				rank
+            /// @return
+            ///				dtype
+            ///
+            dtype select(uint32 inRank)
+            {
+                if (!useHistogram_)
+                {
+                    return sorted_[inRank];
+                }
 
-            uint32 upperRowStart = outShape.rows - 2 * inBoundarySize;
-            NdArray<dtype> upperLeft = Methods<dtype>::flipud(outArray(Slice(upperRowStart, upperRowStart + inBoundarySize), Slice(0, inBoundarySize)));
-            NdArray<dtype> upperRight = Methods<dtype>::flipud(outArray(Slice(upperRowStart, upperRowStart + inBoundarySize), Slice(outShape.cols - inBoundarySize, outShape.cols)));
+                while (countBelow_ > inRank)
+                {
+                    --coarseBin_;
+                    countBelow_ -= coarse_[coarseBin_];
+                }
 
-            outArray.put(Slice(0, inBoundarySize), Slice(0, inBoundarySize), lowerLeft);
-            outArray.put(Slice(0, inBoundarySize), Slice(outShape.cols - inBoundarySize, outShape.cols), lowerRight);
-            outArray.put(Slice(outShape.rows - inBoundarySize, outShape.rows), Slice(0, inBoundarySize), upperLeft);
-            outArray.put(Slice(outShape.rows - inBoundarySize, outShape.rows), Slice(outShape.cols - inBoundarySize, outShape.cols), upperRight);
+                while (countBelow_ + coarse_[coarseBin_] <= inRank)
+                {
+                    countBelow_ += coarse_[coarseBin_];
+                    ++coarseBin_;
+                }
 
-            return std::move(outArray);
-        }
+                uint32 count = countBelow_;
+                uint32 bin = coarseBin_ << shift_;
+                while (count + fine_[bin] <= inRank)
+                {
+                    count += fine_[bin];
+                    ++bin;
+                }
+
+                return static_cast<dtype>(static_cast<int32>(bin) + offset_);
+            }
+
+        private:
+            uint32 binOf(dtype inValue) const
+            {
+                return static_cast<uint32>(static_cast<int32>(inValue) - offset_);
+            }
+
+            bool                useHistogram_;
+            int32               offset_;
+            uint32              shift_;
+            uint32              coarseBin_;
+            uint32              countBelow_;
+            std::vector<uint32> fine_;
+            std::vector<uint32> coarse_;
+            std::vector<dtype>  sorted_;
+            std::vector<dtype>  outgoing_;
+            std::vector<dtype>  incoming_;
+            std::vector<dtype>  merged_;
+        };
 
         //============================================================================
         // Method Description: 
-        ///						Reflects the boundaries
-        ///	
-        /// @param			NdArray
-        /// @param          boundary size
+        ///						Converts a percentile of a window of the input size into the
+        ///						rank of the lower sorted value and the fraction of the way to
+        ///						the next one, following the same index arithmetic as
+        ///						Methods::percentile. For 'nearest' the fraction is always 0.
+        ///		
+        /// @param				number of values in the window
+        /// @param				percentile [0, 100]
+        /// @param				true for 'nearest', false for 'linear'
+        /// @param				returned lower rank
+        /// @param				returned fraction
         ///
-        /// @return         NdArray
+        /// @return             None
         ///
-        static NdArray<dtype> reflectBoundary1d(const NdArray<dtype>& inImage, uint32 inBoundarySize)
+        static void percentileRank(uint32 inCount, double inPercentile, bool inNearest, uint32& outRank, double& outFraction)
         {
-            uint32 outSize = inImage.size() + inBoundarySize * 2;
+            outRank = 0;
+            outFraction = 0;
+            if (inCount < 2)
+            {
+                return;
+            }
 
-            NdArray<dtype> outArray(1, outSize);
-            outArray.put(Slice(inBoundarySize, inBoundarySize + inImage.size()), inImage);
+            const int32 i = static_cast<int32>(std::floor(static_cast<double>(inCount - 1) * inPercentile / 100.0));
+            const uint32 indexLower = static_cast<uint32>(std::max(std::min(i, static_cast<int32>(inCount) - 2), 0));
+            const double percent = inPercentile / 100.0;
+            const double percent1 = static_cast<double>(indexLower) / static_cast<double>(inCount - 1);
+            const double percent2 = static_cast<double>(indexLower + 1) / static_cast<double>(inCount - 1);
 
-            // left
-            outArray.put(Slice(0, inBoundarySize), Methods<dtype>::fliplr(inImage[Slice(0, inBoundarySize)]));
+            if (inNearest)
+            {
+                outRank = percent - percent1 <= percent2 - percent ? indexLower : indexLower + 1;
+            }
+            else
+            {
+                outRank = indexLower;
+                outFraction = (percent - percent1) / (percent2 - percent1);
+            }
+        }
 
-            // right
-            outArray.put(Slice(inImage.size() + inBoundarySize, outSize), Methods<dtype>::fliplr(inImage[Slice(-static_cast<int32>(inBoundarySize), inImage.size())]));
+        //============================================================================
+        // Method Description: 
+        ///						Reads the order statistic for a window. A non-zero fraction
+        ///						interpolates linearly towards the value of the next rank.
+        ///		
+        /// @param				RankWindow
+        /// @param				rank
+        /// @param				fraction
+        /// @return
+        ///				dtype
+        ///
+        static dtype rankValue(RankWindow& inWindow, uint32 inRank, double inFraction)
+        {
+            if (inFraction == 0)
+            {
+                return inWindow.select(inRank);
+            }
 
-            return std::move(outArray);
+            const double lower = static_cast<double>(inWindow.select(inRank));
+            const double upper = static_cast<double>(inWindow.select(inRank + 1));
+            return static_cast<dtype>(lower + (upper - lower) * inFraction);
         }
 
         //============================================================================
         // Method Description: 
-        ///						Constant boundary
+        ///						Kernel convolution over one tile of output rows, keeping a
+        ///						ring of the padded lines under the kernel.
         ///		
         /// @param				NdArray
-        /// @param              boundary size
-        /// @return
-        ///				NdArray
+        /// @param				first output row of the tile
+        /// @param				number of output rows in the tile
+        /// @param				square size of the kernel to apply
+        /// @param				flattened weights, already rotated for the convolution
+        /// @param				NdArray, output array
+        /// @param              boundary mode
+        /// @param				contant value if boundary = 'constant'
         ///
-        static NdArray<dtype> constantBoundary(const NdArray<dtype>& inImage, uint32 inBoundarySize, dtype inConstantValue)
+        /// @return             None
+        ///
+        static void convolveTile(const NdArray<dtype>& inImageArray, uint32 inFirstRow, uint32 inNumRows, uint32 inSize,
+            const NdArray<dtype>& inWeightsFlat, NdArray<dtype>& outArray, Filter::Boundary::Mode inMode, dtype inConstantValue)
         {
-            Shape inShape = inImage.shape();
-            Shape outShape(inShape);
-            outShape.rows += inBoundarySize * 2;
-            outShape.cols += inBoundarySize * 2;
-
-            NdArray<dtype> outArray(outShape);
-            outArray.put(Slice(inBoundarySize, inBoundarySize + inShape.rows), Slice(inBoundarySize, inBoundarySize + inShape.cols), inImage);
-            fillCorners(outArray, inBoundarySize, inConstantValue);
+            const Shape inShape = inImageArray.shape();
+            const BoundaryView view(inImageArray, inShape.rows, inShape.cols, inFirstRow, inNumRows, inSize, inSize, inMode, inConstantValue);
+            const uint32 paddedCols = view.paddedCols();
+            const std::vector<double> weights(inWeightsFlat.cbegin(), inWeightsFlat.cend());
+
+            // ring of the padded lines under the kernel, one new line per output row
+            std::vector<dtype> ring(static_cast<size_t>(inSize) * paddedCols);
+            for (uint32 row = 0; row < inSize - 1; ++row)
+            {
+                view.paddedLine(row, &ring[static_cast<size_t>(row) * paddedCols]);
+            }
 
-            outArray.put(Slice(0, inBoundarySize), Slice(inBoundarySize, inBoundarySize + inShape.cols), inConstantValue); /// bottom
-            outArray.put(Slice(outShape.rows - inBoundarySize, outShape.rows), Slice(inBoundarySize, inBoundarySize + inShape.cols), inConstantValue); /// top
-            outArray.put(Slice(inBoundarySize, inBoundarySize + inShape.rows), Slice(0, inBoundarySize), inConstantValue); /// left
-            outArray.put(Slice(inBoundarySize, inBoundarySize + inShape.rows), Slice(outShape.cols - inBoundarySize, outShape.cols), inConstantValue); /// right
+            std::vector<const dtype*> windowLines(inSize);
+            for (uint32 row = 0; row < inNumRows; ++row)
+            {
+                const uint32 newRow = row + inSize - 1;
+                view.paddedLine(newRow, &ring[static_cast<size_t>(newRow % inSize) * paddedCols]);
+                for (uint32 k = 0; k < inSize; ++k)
+                {
+                    windowLines[k] = &ring[static_cast<size_t>((row + k) % inSize) * paddedCols];
+                }
 
-            return std::move(outArray);
+                convolveRow(&windowLines[0], &weights[0], inSize, inShape.cols, outArray.begin(inFirstRow + row));
+            }
         }
 
         //============================================================================
         // Method Description: 
-        ///						Constant boundary1d
+        ///						Convolves one output row, the common odd kernel sizes get
+        ///						their own unrolled row kernels.
         ///		
-        /// @param				NdArray
-        /// @param              boundary size
-        /// @return
-        ///				NdArray
+        /// @param				padded lines under the kernel
+        /// @param				flattened weights as double, already rotated for the convolution
+        /// @param				square size of the kernel
+        /// @param				number of columns
+        /// @param				output row
+        ///
+        /// @return             None
         ///
-        static NdArray<dtype> constantBoundary1d(const NdArray<dtype>& inImage, uint32 inBoundarySize, dtype inConstantValue)
+        static void convolveRow(const dtype* const* inWindowLines, const double* inWeights, uint32 inSize, uint32 inNumCols,
+            typename NdArray<dtype>::iterator outRow)
         {
-            uint32 outSize = inImage.size() + inBoundarySize * 2;
+            switch (inSize)
+            {
+                case 3:
+                {
+                    convolveRowBlocked<3>(inWindowLines, inWeights, inSize, inNumCols, outRow);
+                    break;
+                }
+                case 5:
+                {
+                    convolveRowBlocked<5>(inWindowLines, inWeights, inSize, inNumCols, outRow);
+                    break;
+                }
+                case 7:
+                {
+                    convolveRowBlocked<7>(inWindowLines, inWeights, inSize, inNumCols, outRow);
+                    break;
+                }
+                default:
+                {
+                    convolveRowBlocked<0>(inWindowLines, inWeights, inSize, inNumCols, outRow);
+                    break;
+                }
+            }
+        }
 
-            NdArray<dtype> outArray(1, outSize);
-            outArray.put(Slice(inBoundarySize, inBoundarySize + inImage.size()), inImage);
+        //============================================================================
+        // Method Description: 
+        ///						Convolves one output row. Blocks of output pixels are filtered
+        ///						together, each weight being applied across the block, so the
+        ///						block sums stay in registers and the inner loop vectorizes.
+        ///						Size is the kernel size when known at compile time, which fully
+        ///						unrolls the kernel, or 0 to use inSize. Every pixel sums its
+        ///						products in the same order whatever the path.
+        ///		
+        /// @param				padded lines under the kernel
+        /// @param				flattened weights as double, already rotated for the convolution
+        /// @param				square size of the kernel
+        /// @param				number of columns
+        /// @param				output row
+        ///
+        /// @return             None
+        ///
+        template<uint32 Size>
+        static void convolveRowBlocked(const dtype* const* inWindowLines, const double* inWeights, uint32 inSize, uint32 inNumCols,
+            typename NdArray<dtype>::iterator outRow)
+        {
+            const uint32 size = Size > 0 ? Size : inSize;
+            const uint32 blockCols = 8;
 
-            // left
-            outArray.put(Slice(0, inBoundarySize), inConstantValue);
+            uint32 col = 0;
+            double sums[blockCols];
+            for (; col + blockCols <= inNumCols; col += blockCols)
+            {
+                std::fill(sums, sums + blockCols, 0.0);
+                for (uint32 k = 0; k < size; ++k)
+                {
+                    const dtype* inData = inWindowLines[k] + col;
+                    const double* weights = inWeights + k * size;
+                    for (uint32 i = 0; i < size; ++i)
+                    {
+                        const double weight = weights[i];
+                        for (uint32 b = 0; b < blockCols; ++b)
+                        {
+                            sums[b] += static_cast<double>(inData[i + b]) * weight;
+                        }
+                    }
+                }
 
-            // right
-            outArray.put(Slice(inImage.size() + inBoundarySize, outSize), inConstantValue);
+                for (uint32 b = 0; b < blockCols; ++b)
+                {
+                    outRow[col + b] = static_cast<dtype>(sums[b]);
+                }
+            }
 
-            return std::move(outArray);
+            for (; col < inNumCols; ++col)
+            {
+                double sum = 0;
+                for (uint32 k = 0; k < size; ++k)
+                {
+                    const dtype* inData = inWindowLines[k] + col;
+                    const double* weights = inWeights + k * size;
+                    for (uint32 i = 0; i < size; ++i)
+                    {
+                        sum += static_cast<double>(inData[i]) * weights[i];
+                    }
+                }
+                outRow[col] = static_cast<dtype>(sum);
+            }
         }
 
         //============================================================================
         // Method Description: 
-        ///						Nearest boundary
+        ///						Returns true if AUTO should convolve through the FFT. The
+        ///						direct cost grows with the kernel area while the FFT cost per
+        ///						pixel barely depends on the kernel size. An image holding a
+        ///						non-finite value stays on the direct path, the FFT would spread
+        ///						it over its whole block instead of only the outputs it reaches.
         ///		
         /// @param				NdArray
-        /// @param              boundary size
+        /// @param				kernel rows
+        /// @param				kernel columns
         /// @return
-        ///				NdArray
+        ///				bool
         ///
-        static NdArray<dtype> nearestBoundary(const NdArray<dtype>& inImage, uint32 inBoundarySize)
+        static bool useFFT(const NdArray<dtype>& inImageArray, uint32 inKernelRows, uint32 inKernelCols)
         {
-            Shape inShape = inImage.shape();
-            Shape outShape(inShape);
-            outShape.rows += inBoundarySize * 2;
-            outShape.cols += inBoundarySize * 2;
+            const bool largeKernel = inKernelRows == 1 ? inKernelCols >= 81 : inKernelRows * inKernelCols >= 11 * 11;
+            if (!largeKernel)
+            {
+                return false;
+            }
 
-            NdArray<dtype> outArray(outShape);
-            outArray.put(Slice(inBoundarySize, inBoundarySize + inShape.rows), Slice(inBoundarySize, inBoundarySize + inShape.cols), inImage);
-            fillCorners(outArray, inBoundarySize);
+            return std::all_of(inImageArray.cbegin(), inImageArray.cend(),
+                [](dtype inValue) { return std::isfinite(static_cast<double>(inValue)); });
+        }
 
-            for (uint32 row = 0; row < inBoundarySize; ++row)
+        //============================================================================
+        // Method Description: 
+        ///						Picks the overlap-save block size along one dimension,
+        ///						the power of two with the least transform work for the
+        ///						outputs it has to cover.
+        ///		
+        /// @param				kernel size along the dimension
+        /// @param				padded size along the dimension
+        /// @param				largest block size to consider
+        /// @return
+        ///				uint32
+        ///
+        static uint32 fftBlockSize(uint32 inKernelSize, uint32 inPaddedSize, uint32 inMaxSize)
+        {
+            const uint32 numOutputs = inPaddedSize - inKernelSize + 1;
+            uint32 bestSize = FFT<double>::nextPowerOfTwo(inKernelSize);
+            double bestCost = 0;
+            for (uint32 size = bestSize; ; size <<= 1)
             {
-                // bottom
-                outArray.put(row,
-                    Slice(inBoundarySize, inBoundarySize + inShape.cols),
-                    inImage(0, Slice(0, inShape.cols)));
+                uint32 log2Size = 0;
+                while ((1u << log2Size) < size)
+                {
+                    ++log2Size;
+                }
+
+                const uint32 step = size - inKernelSize + 1;
+                const uint32 numBlocks = (numOutputs + step - 1) / step;
+                const double cost = static_cast<double>(numBlocks) * static_cast<double>(size) * static_cast<double>(log2Size + 1);
+                if (size == bestSize || cost < bestCost)
+                {
+                    bestSize = size;
+                    bestCost = cost;
+                }
 
-                // top
-                outArray.put(row + inBoundarySize + inShape.rows,
-                    Slice(inBoundarySize, inBoundarySize + inShape.cols),
-                    inImage(inShape.rows - 1, Slice(0, inShape.cols)));
+                if (size >= inPaddedSize || size >= inMaxSize)
+                {
+                    break;
+                }
             }
 
-            for (uint32 col = 0; col < inBoundarySize; ++col)
+            return bestSize;
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Converts a convolution result to dtype. Integer weights on an
+        ///						integer image give an integer result, so the rounding error of
+        ///						the FFT is rounded away and the direct result is reproduced.
+        ///		
+        /// @param				value
+        /// @return
+        ///				dtype
+        ///
+        static dtype fftResult(double inValue)
+        {
+            return static_cast<dtype>(DtypeInfo<dtype>::isInteger() ? std::round(inValue) : inValue);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Convolution through the FFT with overlap-save blocks. The padded
+        ///						image is cut into blocks that overlap by the kernel size less one,
+        ///						two blocks are transformed at once as the real and imaginary parts
+        ///						of one complex block, and the row bands of blocks run in parallel.
+        ///						The one dimensional convolution is the case of a single row.
+        ///		
+        /// @param				NdArray
+        /// @param				number of rows to view the data as
+        /// @param				number of columns to view the data as
+        /// @param				NdArray, weights, inKernelRows x inKernelCols in row major order
+        /// @param				kernel rows
+        /// @param				kernel columns
+        /// @param				NdArray, output array, may not alias the input
+        /// @param              boundary mode
+        /// @param				contant value if boundary = 'constant'
+        ///
+        /// @return             None
+        ///
+        static void fftConvolve(const NdArray<dtype>& inImageArray, uint32 inRows, uint32 inCols, const NdArray<dtype>& inWeights,
+            uint32 inKernelRows, uint32 inKernelCols, NdArray<dtype>& outArray, Filter::Boundary::Mode inMode, dtype inConstantValue)
+        {
+            typedef std::complex<double> Complex;
+
+            const BoundaryView view(inImageArray, inRows, inCols, inKernelRows, inKernelCols, inMode, inConstantValue);
+            const uint32 paddedRows = view.paddedRows();
+            const uint32 paddedCols = view.paddedCols();
+            const uint32 blockRows = fftBlockSize(inKernelRows, paddedRows, 512);
+            const uint32 blockCols = fftBlockSize(inKernelCols, paddedCols, inKernelRows == 1 ? 65536 : 512);
+            const uint32 stepRows = blockRows - inKernelRows + 1;
+            const uint32 stepCols = blockCols - inKernelCols + 1;
+            const size_t blockSize = static_cast<size_t>(blockRows) * blockCols;
+
+            std::vector<Complex> kernel(blockSize, Complex(0, 0));
+            for (uint32 row = 0; row < inKernelRows; ++row)
             {
-                // left
-                outArray.put(Slice(inBoundarySize, inBoundarySize + inShape.rows),
-                    col,
-                    inImage(Slice(0, inShape.rows), 0));
+                for (uint32 col = 0; col < inKernelCols; ++col)
+                {
+                    kernel[static_cast<size_t>(row) * blockCols + col] = static_cast<double>(inWeights[row * inKernelCols + col]);
+                }
+            }
+            FFT<double>::fft2(kernel, blockRows, blockCols);
+
+            const uint32 numBands = (inRows + stepRows - 1) / stepRows;
+            const uint32 numColBlocks = (inCols + stepCols - 1) / stepCols;
+            typename NdArray<dtype>::iterator output = outArray.begin();
+            TileExecutor::parallelFor(numBands,
+                [&](uint32 inBand)
+                {
+                    const uint32 bandStart = inBand * stepRows;
+                    const uint32 bandRows = std::min(blockRows, paddedRows - bandStart);
+                    std::vector<dtype> band(static_cast<size_t>(bandRows) * paddedCols);
+                    for (uint32 row = 0; row < bandRows; ++row)
+                    {
+                        view.paddedLine(bandStart + row, &band[static_cast<size_t>(row) * paddedCols]);
+                    }
+
+                    std::vector<Complex> block(blockSize);
+                    for (uint32 colBlock = 0; colBlock < numColBlocks; colBlock += 2)
+                    {
+                        // the second block rides along as the imaginary part
+                        const uint32 realStart = colBlock * stepCols;
+                        const uint32 imagStart = realStart + stepCols;
+                        const bool hasImag = colBlock + 1 < numColBlocks;
+                        std::fill(block.begin(), block.end(), Complex(0, 0));
+                        for (uint32 row = 0; row < bandRows; ++row)
+                        {
+                            const dtype* line = &band[static_cast<size_t>(row) * paddedCols];
+                            Complex* blockRow = &block[static_cast<size_t>(row) * blockCols];
+                            const uint32 realCols = std::min(blockCols, paddedCols - realStart);
+                            for (uint32 col = 0; col < realCols; ++col)
+                            {
+                                blockRow[col].real(static_cast<double>(line[realStart + col]));
+                            }
+
+                            if (hasImag)
+                            {
+                                const uint32 imagCols = std::min(blockCols, paddedCols - imagStart);
+                                for (uint32 col = 0; col < imagCols; ++col)
+                                {
+                                    blockRow[col].imag(static_cast<double>(line[imagStart + col]));
+                                }
+                            }
+                        }
+
+                        FFT<double>::fft2(block, blockRows, blockCols);
+                        for (size_t i = 0; i < blockSize; ++i)
+                        {
+                            const Complex value = block[i];
+                            const Complex weight = kernel[i];
+                            block[i] = Complex(value.real() * weight.real() - value.imag() * weight.imag(),
+                                value.real() * weight.imag() + value.imag() * weight.real());
+                        }
+                        FFT<double>::ifft2(block, blockRows, blockCols);
+
+                        // the valid part of the circular convolution starts one kernel less one in
+                        const uint32 outRows = std::min(stepRows, inRows - bandStart);
+                        for (uint32 row = 0; row < outRows; ++row)
+                        {
+                            const Complex* blockRow = &block[static_cast<size_t>(row + inKernelRows - 1) * blockCols + inKernelCols - 1];
+                            typename NdArray<dtype>::iterator outRow = output + static_cast<size_t>(bandStart + row) * inCols;
+                            const uint32 realCols = std::min(stepCols, inCols - realStart);
+                            for (uint32 col = 0; col < realCols; ++col)
+                            {
+                                outRow[realStart + col] = fftResult(blockRow[col].real());
+                            }
+
+                            if (hasImag)
+                            {
+                                const uint32 imagCols = std::min(stepCols, inCols - imagStart);
+                                for (uint32 col = 0; col < imagCols; ++col)
+                                {
+                                    outRow[imagStart + col] = fftResult(blockRow[col].imag());
+                                }
+                            }
+                        }
+                    }
+                });
+        }
 
-                // right
-                outArray.put(Slice(inBoundarySize, inBoundarySize + inShape.rows),
-                    col + inBoundarySize + inShape.cols,
-                    inImage(Slice(0, inShape.rows), inShape.cols - 1));
+        //============================================================================
+        // Method Description: 
+        ///						Returns the array the row tiles should read. Tiles read the
+        ///						halo rows of their neighbours, so when the output is the input
+        ///						the tiles read a copy of it instead.
+        ///		
+        /// @param				NdArray, input
+        /// @param				NdArray, output
+        /// @param				NdArray, holds the copy if one is needed
+        /// @return
+        ///				const NdArray&
+        ///
+        static const NdArray<dtype>& tileInput(const NdArray<dtype>& inImageArray, const NdArray<dtype>& inOutArray,
+            NdArray<dtype>& outCopy)
+        {
+            if (inOutArray.cbegin() != inImageArray.cbegin())
+            {
+                return inImageArray;
             }
 
-            return std::move(outArray);
+            outCopy = inImageArray;
+            return outCopy;
         }
 
         //============================================================================
         // Method Description: 
-        ///						Nearest boundary1d
+        ///						Sliding order statistic filter over one tile of output rows.
+        ///						The window snakes across the tile, left to right on even rows
+        ///						and right to left on odd rows, so every step only swaps one
+        ///						column or one row of the window and the window is never rebuilt.
         ///		
         /// @param				NdArray
-        /// @param              boundary size
-        /// @return
-        ///				NdArray
+        /// @param				first output row of the tile
+        /// @param				number of output rows in the tile
+        /// @param				square size of the kernel to apply
+        /// @param				rank
+        /// @param				fraction towards the next rank
+        /// @param				NdArray, output array
+        /// @param              boundary mode
+        /// @param				contant value if boundary = 'constant'
         ///
-        static NdArray<dtype> nearestBoundary1d(const NdArray<dtype>& inImage, uint32 inBoundarySize)
+        /// @return             None
+        ///
+        static void slidingRankTile(const NdArray<dtype>& inImageArray, uint32 inFirstRow, uint32 inNumRows, uint32 inSize,
+            uint32 inRank, double inFraction, NdArray<dtype>& outArray, Filter::Boundary::Mode inMode, dtype inConstantValue)
         {
-            uint32 outSize = inImage.size() + inBoundarySize * 2;
+            const Shape inShape = inImageArray.shape();
+            const BoundaryView view(inImageArray, inShape.rows, inShape.cols, inFirstRow, inNumRows, inSize, inSize, inMode, inConstantValue);
+            const uint32 paddedCols = view.paddedCols();
+
+            // ring of the padded lines under the window plus the one leaving it
+            const uint32 numRingLines = inSize + 1;
+            std::vector<dtype> ring(static_cast<size_t>(numRingLines) * paddedCols);
+            for (uint32 row = 0; row < inSize; ++row)
+            {
+                view.paddedLine(row, &ring[static_cast<size_t>(row) * paddedCols]);
+            }
+
+            RankWindow window;
+            for (uint32 row = 0; row < inSize; ++row)
+            {
+                for (uint32 col = 0; col < inSize; ++col)
+                {
+                    window.add(ring[static_cast<size_t>(row) * paddedCols + col]);
+                }
+            }
 
-            NdArray<dtype> outArray(1, outSize);
-            outArray.put(Slice(inBoundarySize, inBoundarySize + inImage.size()), inImage);
+            std::vector<const dtype*> windowLines(inSize);
+            std::vector<dtype> outgoing(inSize);
+            std::vector<dtype> incoming(inSize);
 
-            // left
-            outArray.put(Slice(0, inBoundarySize), inImage[0]);
+            uint32 windowCol = 0;
+            for (uint32 row = 0; row < inNumRows; ++row)
+            {
+                if (row > 0)
+                {
+                    // step down a row
+                    const uint32 newRow = row - 1 + inSize;
+                    dtype* newLine = &ring[static_cast<size_t>(newRow % numRingLines) * paddedCols];
+                    view.paddedLine(newRow, newLine);
+                    window.replace(&ring[static_cast<size_t>((row - 1) % numRingLines) * paddedCols + windowCol],
+                        newLine + windowCol, inSize);
+                }
 
-            // right
-            outArray.put(Slice(inImage.size() + inBoundarySize, outSize), inImage[-1]);
+                for (uint32 k = 0; k < inSize; ++k)
+                {
+                    windowLines[k] = &ring[static_cast<size_t>((row + k) % numRingLines) * paddedCols];
+                }
 
-            return std::move(outArray);
+                typename NdArray<dtype>::iterator outRow = outArray.begin(inFirstRow + row);
+                if (row % 2 == 0)
+                {
+                    outRow[0] = rankValue(window, inRank, inFraction);
+                    for (windowCol = 1; windowCol < inShape.cols; ++windowCol)
+                    {
+                        for (uint32 k = 0; k < inSize; ++k)
+                        {
+                            outgoing[k] = windowLines[k][windowCol - 1];
+                            incoming[k] = windowLines[k][windowCol + inSize - 1];
+                        }
+                        window.replace(&outgoing[0], &incoming[0], inSize);
+                        outRow[windowCol] = rankValue(window, inRank, inFraction);
+                    }
+                    windowCol = inShape.cols - 1;
+                }
+                else
+                {
+                    outRow[windowCol] = rankValue(window, inRank, inFraction);
+                    while (windowCol > 0)
+                    {
+                        --windowCol;
+                        for (uint32 k = 0; k < inSize; ++k)
+                        {
+                            outgoing[k] = windowLines[k][windowCol + inSize];
+                            incoming[k] = windowLines[k][windowCol];
+                        }
+                        window.replace(&outgoing[0], &incoming[0], inSize);
+                        outRow[windowCol] = rankValue(window, inRank, inFraction);
+                    }
+                }
+            }
         }
 
         //============================================================================
         // Method Description: 
-        ///						Mirror boundary
+        ///						Sliding order statistic filter behind the median, percentile
+        ///						and rank filters, run over parallel row tiles.
         ///		
         /// @param				NdArray
-        /// @param              boundary size
-        /// @return
-        ///				NdArray
+        /// @param				square size of the kernel to apply
+        /// @param				rank
+        /// @param				fraction towards the next rank
+        /// @param				NdArray, output array
+        /// @param              boundary mode
+        /// @param				contant value if boundary = 'constant'
+        ///
+        /// @return             None
+        ///
+        static void slidingRankFilter(const NdArray<dtype>& inImageArray, uint32 inSize, uint32 inRank, double inFraction,
+            NdArray<dtype>& outArray, Filter::Boundary::Mode inMode, dtype inConstantValue)
+        {
+            const Shape inShape = inImageArray.shape();
+            if (inShape.size() == 0)
+            {
+                return;
+            }
+
+            NdArray<dtype> inputCopy;
+            const NdArray<dtype>& input = tileInput(inImageArray, outArray, inputCopy);
+            TileExecutor::forEachRowTile(inShape.rows, TileExecutor::tileRows(inShape.cols * sizeof(dtype), inSize),
+                [&](uint32 inFirstRow, uint32 inNumRows)
+                {
+                    slidingRankTile(input, inFirstRow, inNumRows, inSize, inRank, inFraction, outArray, inMode, inConstantValue);
+                });
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						One-dimensional sliding order statistic filter behind the
+        ///						median, percentile and rank filters.
+        ///		
+        /// @param				NdArray
+        /// @param				size of the kernel to apply
+        /// @param				rank
+        /// @param				fraction towards the next rank
+        /// @param				NdArray, output array
+        /// @param              boundary mode
+        /// @param				contant value if boundary = 'constant'
         ///
-        static NdArray<dtype> mirrorBoundary(const NdArray<dtype>& inImage, uint32 inBoundarySize)
+        /// @return             None
+        ///
+        static void slidingRankFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize, uint32 inRank, double inFraction,
+            NdArray<dtype>& outArray, Filter::Boundary::Mode inMode, dtype inConstantValue)
         {
-            Shape inShape = inImage.shape();
-            Shape outShape(inShape);
-            outShape.rows += inBoundarySize * 2;
-            outShape.cols += inBoundarySize * 2;
+            const uint32 numValues = inImageArray.size();
+            if (numValues == 0)
+            {
+                return;
+            }
 
-            NdArray<dtype> outArray(outShape);
-            outArray.put(Slice(inBoundarySize, inBoundarySize + inShape.rows), Slice(inBoundarySize, inBoundarySize + inShape.cols), inImage);
+            const BoundaryView view(inImageArray, 1, numValues, 1, inSize, inMode, inConstantValue);
+            std::vector<dtype> padded(view.paddedCols());
+            view.paddedLine(0, &padded[0]);
 
-            for (uint32 row = 0; row < inBoundarySize; ++row)
+            RankWindow window;
+            for (uint32 i = 0; i < inSize; ++i)
             {
-                // bottom
-                outArray.put(row,
-                    Slice(inBoundarySize, inBoundarySize + inShape.cols),
-                    inImage(inBoundarySize - row, Slice(0, inShape.cols)));
+                window.add(padded[i]);
+            }
 
-                // top
-                outArray.put(row + inBoundarySize + inShape.rows,
-                    Slice(inBoundarySize, inBoundarySize + inShape.cols),
-                    inImage(inShape.rows - row - 2, Slice(0, inShape.cols)));
+            outArray[0] = rankValue(window, inRank, inFraction);
+            for (uint32 i = 1; i < numValues; ++i)
+            {
+                window.replace(&padded[i - 1], &padded[i + inSize - 1], 1);
+                outArray[i] = rankValue(window, inRank, inFraction);
             }
+        }
 
-            for (uint32 col = 0; col < inBoundarySize; ++col)
+        //============================================================================
+        // Method Description: 
+        ///						van Herk/Gil-Werman running extremum along one line. The line
+        ///						is cut into blocks of the kernel size; a prefix extremum runs
+        ///						forward within each block and a suffix extremum runs backward.
+        ///						Every window straddles at most two blocks, so its extremum is a
+        ///						single comparison of the two, independent of the kernel size.
+        ///						Compare is std::less for a maximum and std::greater for a minimum.
+        ///		
+        /// @param				first value of the line
+        /// @param				number of values in the line
+        /// @param				size of the kernel
+        /// @param				output, inLength - inSize + 1 values
+        /// @param				scratch buffer of at least inLength values
+        /// @param				scratch buffer of at least inLength values
+        /// @param				comparison functor
+        ///
+        /// @return             None
+        ///
+        template<typename Compare>
+        static void vanHerkLine(const dtype* inLine, uint32 inLength, uint32 inSize, dtype* outLine,
+            std::vector<dtype>& prefix, std::vector<dtype>& suffix, Compare inCompare)
+        {
+            for (uint32 i = 0; i < inLength; ++i)
             {
-                // left
-                outArray.put(Slice(inBoundarySize, inBoundarySize + inShape.rows),
-                    col,
-                    inImage(Slice(0, inShape.rows), inBoundarySize - col));
+                prefix[i] = i % inSize == 0 || inCompare(prefix[i - 1], inLine[i]) ? inLine[i] : prefix[i - 1];
+            }
 
-                // right
-                outArray.put(Slice(inBoundarySize, inBoundarySize + inShape.rows),
-                    col + inBoundarySize + inShape.cols,
-                    inImage(Slice(0, inShape.rows), inShape.cols - col - 2));
+            for (uint32 i = inLength; i-- > 0; )
+            {
+                suffix[i] = i == inLength - 1 || (i + 1) % inSize == 0 || inCompare(suffix[i + 1], inLine[i]) ?
+                    inLine[i] : suffix[i + 1];
             }
 
-            // now fill in the corners
-            NdArray<dtype> lowerLeft = Methods<dtype>::flipud(outArray(Slice(inBoundarySize + 1, 2 * inBoundarySize + 1), Slice(0, inBoundarySize)));
-            NdArray<dtype> lowerRight = Methods<dtype>::flipud(outArray(Slice(inBoundarySize + 1, 2 * inBoundarySize + 1), Slice(outShape.cols - inBoundarySize, outShape.cols)));
+            const uint32 numOut = inLength - inSize + 1;
+            for (uint32 i = 0; i < numOut; ++i)
+            {
+                outLine[i] = inCompare(suffix[i], prefix[i + inSize - 1]) ? prefix[i + inSize - 1] : suffix[i];
+            }
+        }
 
-            uint32 upperRowStart = outShape.rows - 2 * inBoundarySize - 1;
-            NdArray<dtype> upperLeft = Methods<dtype>::flipud(outArray(Slice(upperRowStart, upperRowStart + inBoundarySize), Slice(0, inBoundarySize)));
-            NdArray<dtype> upperRight = Methods<dtype>::flipud(outArray(Slice(upperRowStart, upperRowStart + inBoundarySize), Slice(outShape.cols - inBoundarySize, outShape.cols)));
+        //============================================================================
+        // Method Description: 
+        ///						Square maximum/minimum filter as a van Herk/Gil-Werman pass
+        ///						along the rows followed by one down the columns. The column pass
+        ///						keeps the block prefixes and suffixes as whole rows so the inner
+        ///						loops stay contiguous, and only holds two blocks of them. Both
+        ///						passes run over parallel row tiles.
+        ///		
+        /// @param				NdArray
+        /// @param				square size of the kernel to apply
+        /// @param				NdArray, output array
+        /// @param              boundary mode
+        /// @param				contant value if boundary = 'constant'
+        /// @param				comparison functor
+        ///
+        /// @return             None
+        ///
+        template<typename Compare>
+        static void vanHerkFilter(const NdArray<dtype>& inImageArray, uint32 inSize, NdArray<dtype>& outArray,
+            Filter::Boundary::Mode inMode, dtype inConstantValue, Compare inCompare)
+        {
+            const Shape inShape = inImageArray.shape();
+            if (inShape.size() == 0)
+            {
+                return;
+            }
 
-            outArray.put(Slice(0, inBoundarySize), Slice(0, inBoundarySize), lowerLeft);
-            outArray.put(Slice(0, inBoundarySize), Slice(outShape.cols - inBoundarySize, outShape.cols), lowerRight);
-            outArray.put(Slice(outShape.rows - inBoundarySize, outShape.rows), Slice(0, inBoundarySize), upperLeft);
-            outArray.put(Slice(outShape.rows - inBoundarySize, outShape.rows), Slice(outShape.cols - inBoundarySize, outShape.cols), upperRight);
+            const BoundaryView view(inImageArray, inShape.rows, inShape.cols, inSize, inSize, inMode, inConstantValue);
+            const uint32 paddedRows = view.paddedRows();
+            const uint32 paddedCols = view.paddedCols();
+            const uint32 numCols = inShape.cols;
 
-            return std::move(outArray);
+            // row pass once per distinct line
+            const uint32 numLines = view.numLines();
+            std::vector<dtype> horizontal(static_cast<size_t>(numLines) * numCols);
+            TileExecutor::forEachRowTile(numLines, TileExecutor::tileRows(paddedCols * sizeof(dtype)),
+                [&](uint32 inFirstLine, uint32 inNumLines)
+                {
+                    std::vector<dtype> line(paddedCols);
+                    std::vector<dtype> prefix(paddedCols);
+                    std::vector<dtype> suffix(paddedCols);
+                    for (uint32 lineIdx = inFirstLine; lineIdx < inFirstLine + inNumLines; ++lineIdx)
+                    {
+                        view.distinctLine(lineIdx, &line[0]);
+                        vanHerkLine(&line[0], paddedCols, inSize, &horizontal[static_cast<size_t>(lineIdx) * numCols],
+                            prefix, suffix, inCompare);
+                    }
+                });
+
+            // column pass one block of inSize padded rows at a time, the block
+            // suffixes of this block meet the block prefixes of the next
+            TileExecutor::forEachRowTile(inShape.rows, TileExecutor::tileRows(numCols * sizeof(dtype), inSize),
+                [&](uint32 inFirstRow, uint32 inNumRows)
+                {
+                    const uint32 endRow = inFirstRow + inNumRows;
+
+                    std::vector<dtype> blockSuffix(static_cast<size_t>(inSize) * numCols);
+                    std::vector<dtype> blockPrefix(static_cast<size_t>(inSize) * numCols);
+                    for (uint32 blockStart = inFirstRow; blockStart < endRow; blockStart += inSize)
+                    {
+                        const uint32 blockEnd = std::min(blockStart + inSize, paddedRows);
+                        for (uint32 row = blockEnd; row-- > blockStart; )
+                        {
+                            const dtype* current = &horizontal[static_cast<size_t>(view.lineIndex(row)) * numCols];
+                            dtype* suffixRow = &blockSuffix[static_cast<size_t>(row - blockStart) * numCols];
+                            if (row == blockEnd - 1)
+                            {
+                                std::copy(current, current + numCols, suffixRow);
+                                continue;
+                            }
+
+                            const dtype* suffixNext = suffixRow + numCols;
+                            for (uint32 col = 0; col < numCols; ++col)
+                            {
+                                suffixRow[col] = inCompare(suffixNext[col], current[col]) ? current[col] : suffixNext[col];
+                            }
+                        }
+
+                        const uint32 nextEnd = std::min(blockEnd + inSize, paddedRows);
+                        for (uint32 row = blockEnd; row < nextEnd; ++row)
+                        {
+                            const dtype* current = &horizontal[static_cast<size_t>(view.lineIndex(row)) * numCols];
+                            dtype* prefixRow = &blockPrefix[static_cast<size_t>(row - blockEnd) * numCols];
+                            if (row == blockEnd)
+                            {
+                                std::copy(current, current + numCols, prefixRow);
+                                continue;
+                            }
+
+                            const dtype* prefixPrev = prefixRow - numCols;
+                            for (uint32 col = 0; col < numCols; ++col)
+                            {
+                                prefixRow[col] = inCompare(prefixPrev[col], current[col]) ? current[col] : prefixPrev[col];
+                            }
+                        }
+
+                        const uint32 outEnd = std::min(blockStart + inSize, endRow);
+                        for (uint32 row = blockStart; row < outEnd; ++row)
+                        {
+                            // a window starting on the block boundary is the whole block
+                            const dtype* suffixRow = &blockSuffix[static_cast<size_t>(row - blockStart) * numCols];
+                            typename NdArray<dtype>::iterator outRow = outArray.begin(row);
+                            if (row == blockStart)
+                            {
+                                std::copy(suffixRow, suffixRow + numCols, outRow);
+                                continue;
+                            }
+
+                            const dtype* prefixRow = &blockPrefix[static_cast<size_t>(row - blockStart - 1) * numCols];
+                            for (uint32 col = 0; col < numCols; ++col)
+                            {
+                                outRow[col] = inCompare(suffixRow[col], prefixRow[col]) ? prefixRow[col] : suffixRow[col];
+                            }
+                        }
+                    }
+                });
         }
 
+
         //============================================================================
         // Method Description: 
-        ///						Mirror boundary1d
+        ///						One-dimensional maximum/minimum filter as a single van
+        ///						Herk/Gil-Werman pass.
         ///		
         /// @param				NdArray
-        /// @param              boundary size
-        /// @return
-        ///				NdArray
+        /// @param				size of the kernel to apply
+        /// @param				NdArray, output array
+        /// @param              boundary mode
+        /// @param				contant value if boundary = 'constant'
+        /// @param				comparison functor
         ///
-        static NdArray<dtype> mirrorBoundary1d(const NdArray<dtype>& inImage, uint32 inBoundarySize)
+        /// @return             None
+        ///
+        template<typename Compare>
+        static void vanHerkFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize, NdArray<dtype>& outArray,
+            Filter::Boundary::Mode inMode, dtype inConstantValue, Compare inCompare)
         {
-            uint32 outSize = inImage.size() + inBoundarySize * 2;
+            if (inImageArray.size() == 0)
+            {
+                return;
+            }
+
+            const BoundaryView view(inImageArray, 1, inImageArray.size(), 1, inSize, inMode, inConstantValue);
+            const uint32 paddedSize = view.paddedCols();
+
+            std::vector<dtype> padded(paddedSize);
+            view.paddedLine(0, &padded[0]);
+
+            std::vector<dtype> prefix(paddedSize);
+            std::vector<dtype> suffix(paddedSize);
+            std::vector<dtype> line(inImageArray.size());
+            vanHerkLine(&padded[0], paddedSize, inSize, &line[0], prefix, suffix, inCompare);
+
+            std::copy(line.begin(), line.end(), outArray.begin());
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Direct uniform filter over one tile of output rows. Each window
+        ///						is summed row by row in double and divided by its size, the
+        ///						same as taking the mean of the window.
+        ///		
+        /// @param				NdArray
+        /// @param				first output row of the tile
+        /// @param				number of output rows in the tile
+        /// @param				square size of the kernel to apply
+        /// @param				NdArray, output array
+        /// @param              boundary mode
+        /// @param				contant value if boundary = 'constant'
+        ///
+        /// @return             None
+        ///
+        static void uniformTile(const NdArray<dtype>& inImageArray, uint32 inFirstRow, uint32 inNumRows, uint32 inSize,
+            NdArray<dtype>& outArray, Filter::Boundary::Mode inMode, dtype inConstantValue)
+        {
+            const Shape inShape = inImageArray.shape();
+            const BoundaryView view(inImageArray, inShape.rows, inShape.cols, inFirstRow, inNumRows, inSize, inSize, inMode, inConstantValue);
+            const uint32 paddedCols = view.paddedCols();
+            const double numElements = static_cast<double>(inSize) * static_cast<double>(inSize);
+
+            // ring of the padded lines under the kernel, one new line per output row
+            std::vector<dtype> ring(static_cast<size_t>(inSize) * paddedCols);
+            for (uint32 row = 0; row < inSize - 1; ++row)
+            {
+                view.paddedLine(row, &ring[static_cast<size_t>(row) * paddedCols]);
+            }
 
-            NdArray<dtype> outArray(1, outSize);
-            outArray.put(Slice(inBoundarySize, inBoundarySize + inImage.size()), inImage);
+            std::vector<const dtype*> windowLines(inSize);
+            for (uint32 row = 0; row < inNumRows; ++row)
+            {
+                const uint32 newRow = row + inSize - 1;
+                view.paddedLine(newRow, &ring[static_cast<size_t>(newRow % inSize) * paddedCols]);
+                for (uint32 k = 0; k < inSize; ++k)
+                {
+                    windowLines[k] = &ring[static_cast<size_t>((row + k) % inSize) * paddedCols];
+                }
 
-            // left
-            outArray.put(Slice(0, inBoundarySize), Methods<dtype>::fliplr(inImage[Slice(1, inBoundarySize + 1)]));
+                typename NdArray<dtype>::iterator outRow = outArray.begin(inFirstRow + row);
+                for (uint32 col = 0; col < inShape.cols; ++col)
+                {
+                    double sum = 0;
+                    for (uint32 k = 0; k < inSize; ++k)
+                    {
+                        const dtype* inData = windowLines[k] + col;
+                        for (uint32 i = 0; i < inSize; ++i)
+                        {
+                            sum += static_cast<double>(inData[i]);
+                        }
+                    }
+                    outRow[col] = static_cast<dtype>(sum / numElements);
+                }
+            }
+        }
 
-            // right
-            outArray.put(Slice(inImage.size() + inBoundarySize, outSize), Methods<dtype>::fliplr(inImage[Slice(-static_cast<int32>(inBoundarySize) - 1, -1)]));
+        //============================================================================
+        // Method Description: 
+        ///						Window sums along one line from running sums that restart at
+        ///						every block of the kernel size, a prefix sum running forward
+        ///						within each block and a suffix sum running backward. As in
+        ///						vanHerkLine every window is one suffix plus one prefix, so no
+        ///						sample is ever subtracted back out: a large or non-finite
+        ///						sample only reaches the windows that hold it, and the rounding
+        ///						error does not build up along the line.
+        ///		
+        /// @param				first value of the line
+        /// @param				number of values in the line
+        /// @param				size of the kernel
+        /// @param				output, inLength - inSize + 1 sums
+        /// @param				scratch buffer of at least inLength values
+        /// @param				scratch buffer of at least inLength values
+        ///
+        /// @return             None
+        ///
+        static void runningSumLine(const dtype* inLine, uint32 inLength, uint32 inSize, double* outSums,
+            std::vector<double>& prefix, std::vector<double>& suffix)
+        {
+            for (uint32 i = 0; i < inLength; ++i)
+            {
+                prefix[i] = i % inSize == 0 ? static_cast<double>(inLine[i]) : prefix[i - 1] + static_cast<double>(inLine[i]);
+            }
 
-            return std::move(outArray);
+            for (uint32 i = inLength; i-- > 0; )
+            {
+                suffix[i] = i == inLength - 1 || (i + 1) % inSize == 0 ? static_cast<double>(inLine[i]) :
+                    suffix[i + 1] + static_cast<double>(inLine[i]);
+            }
+
+            // a window starting on a block boundary is the whole block
+            const uint32 numOut = inLength - inSize + 1;
+            for (uint32 i = 0; i < numOut; ++i)
+            {
+                outSums[i] = i % inSize == 0 ? suffix[i] : suffix[i] + prefix[i + inSize - 1];
+            }
         }
 
         //============================================================================
         // Method Description: 
-        ///						Wrap boundary
+        ///						Square uniform filter from block running sums, a runningSumLine
+        ///						pass along the rows followed by the same block scheme down the
+        ///						columns, laid out as vanHerkFilter. The cost does not depend on
+        ///						the kernel size.
         ///		
         /// @param				NdArray
-        /// @param              boundary size
-        /// @return
-        ///				NdArray
+        /// @param				square size of the kernel to apply
+        /// @param				NdArray, output array
+        /// @param              boundary mode
+        /// @param				contant value if boundary = 'constant'
+        ///
+        /// @return             None
         ///
-        static NdArray<dtype> wrapBoundary(const NdArray<dtype>& inImage, uint32 inBoundarySize)
+        static void runningSumFilter(const NdArray<dtype>& inImageArray, uint32 inSize, NdArray<dtype>& outArray,
+            Filter::Boundary::Mode inMode, dtype inConstantValue)
         {
-            Shape inShape = inImage.shape();
-            Shape outShape(inShape);
-            outShape.rows += inBoundarySize * 2;
-            outShape.cols += inBoundarySize * 2;
-
-            NdArray<dtype> outArray(outShape);
-            outArray.put(Slice(inBoundarySize, inBoundarySize + inShape.rows), Slice(inBoundarySize, inBoundarySize + inShape.cols), inImage);
-
-            // bottom
-            outArray.put(Slice(0, inBoundarySize),
-                Slice(inBoundarySize, inBoundarySize + inShape.cols),
-                inImage(Slice(inShape.rows - inBoundarySize, inShape.rows), Slice(0, inShape.cols)));
-
-            // top
-            outArray.put(Slice(inShape.rows + inBoundarySize, outShape.rows),
-                Slice(inBoundarySize, inBoundarySize + inShape.cols),
-                inImage(Slice(0, inBoundarySize), Slice(0, inShape.cols)));
-
-            // left
-            outArray.put(Slice(inBoundarySize, inBoundarySize + inShape.rows),
-                Slice(0, inBoundarySize),
-                inImage(Slice(0, inShape.rows), Slice(inShape.cols - inBoundarySize, inShape.cols)));
-
-            // right
-            outArray.put(Slice(inBoundarySize, inBoundarySize + inShape.rows),
-                Slice(inShape.cols + inBoundarySize, outShape.cols),
-                inImage(Slice(0, inShape.rows), Slice(0, inBoundarySize)));
-
-            // now fill in the corners
-            NdArray<dtype> lowerLeft = outArray(Slice(inBoundarySize, 2 * inBoundarySize), Slice(0, inBoundarySize));
-            NdArray<dtype> lowerRight = outArray(Slice(inBoundarySize, 2 * inBoundarySize), Slice(outShape.cols - inBoundarySize, outShape.cols));
-
-            uint32 upperRowStart = outShape.rows - 2 * inBoundarySize;
-            NdArray<dtype> upperLeft = outArray(Slice(upperRowStart, upperRowStart + inBoundarySize), Slice(0, inBoundarySize));
-            NdArray<dtype> upperRight = outArray(Slice(upperRowStart, upperRowStart + inBoundarySize), Slice(outShape.cols - inBoundarySize, outShape.cols));
+            const Shape inShape = inImageArray.shape();
+            if (inShape.size() == 0)
+            {
+                return;
+            }
 
-            outArray.put(Slice(0, inBoundarySize), Slice(0, inBoundarySize), upperLeft);
-            outArray.put(Slice(0, inBoundarySize), Slice(outShape.cols - inBoundarySize, outShape.cols), upperRight);
-            outArray.put(Slice(outShape.rows - inBoundarySize, outShape.rows), Slice(0, inBoundarySize), lowerLeft);
-            outArray.put(Slice(outShape.rows - inBoundarySize, outShape.rows), Slice(outShape.cols - inBoundarySize, outShape.cols), lowerRight);
+            const BoundaryView view(inImageArray, inShape.rows, inShape.cols, inSize, inSize, inMode, inConstantValue);
+            const uint32 paddedRows = view.paddedRows();
+            const uint32 paddedCols = view.paddedCols();
+            const uint32 numCols = inShape.cols;
 
-            return std::move(outArray);
+            // row pass once per distinct line
+            const uint32 numLines = view.numLines();
+            std::vector<double> horizontal(static_cast<size_t>(numLines) * numCols);
+            TileExecutor::forEachRowTile(numLines, TileExecutor::tileRows(paddedCols * sizeof(dtype)),
+                [&](uint32 inFirstLine, uint32 inNumLines)
+                {
+                    std::vector<dtype> line(paddedCols);
+                    std::vector<double> prefix(paddedCols);
+                    std::vector<double> suffix(paddedCols);
+                    for (uint32 lineIdx = inFirstLine; lineIdx < inFirstLine + inNumLines; ++lineIdx)
+                    {
+                        view.distinctLine(lineIdx, &line[0]);
+                        runningSumLine(&line[0], paddedCols, inSize, &horizontal[static_cast<size_t>(lineIdx) * numCols],
+                            prefix, suffix);
+                    }
+                });
+
+            // column pass one block of inSize padded rows at a time, the block
+            // suffixes of this block meet the block prefixes of the next
+            const double numElements = static_cast<double>(inSize) * static_cast<double>(inSize);
+            TileExecutor::forEachRowTile(inShape.rows, TileExecutor::tileRows(numCols * sizeof(double), inSize),
+                [&](uint32 inFirstRow, uint32 inNumRows)
+                {
+                    const uint32 endRow = inFirstRow + inNumRows;
+
+                    std::vector<double> blockSuffix(static_cast<size_t>(inSize) * numCols);
+                    std::vector<double> blockPrefix(static_cast<size_t>(inSize) * numCols);
+                    for (uint32 blockStart = inFirstRow; blockStart < endRow; blockStart += inSize)
+                    {
+                        const uint32 blockEnd = std::min(blockStart + inSize, paddedRows);
+                        for (uint32 row = blockEnd; row-- > blockStart; )
+                        {
+                            const double* current = &horizontal[static_cast<size_t>(view.lineIndex(row)) * numCols];
+                            double* suffixRow = &blockSuffix[static_cast<size_t>(row - blockStart) * numCols];
+                            if (row == blockEnd - 1)
+                            {
+                                std::copy(current, current + numCols, suffixRow);
+                                continue;
+                            }
+
+                            const double* suffixNext = suffixRow + numCols;
+                            for (uint32 col = 0; col < numCols; ++col)
+                            {
+                                suffixRow[col] = suffixNext[col] + current[col];
+                            }
+                        }
+
+                        const uint32 nextEnd = std::min(blockEnd + inSize, paddedRows);
+                        for (uint32 row = blockEnd; row < nextEnd; ++row)
+                        {
+                            const double* current = &horizontal[static_cast<size_t>(view.lineIndex(row)) * numCols];
+                            double* prefixRow = &blockPrefix[static_cast<size_t>(row - blockEnd) * numCols];
+                            if (row == blockEnd)
+                            {
+                                std::copy(current, current + numCols, prefixRow);
+                                continue;
+                            }
+
+                            const double* prefixPrev = prefixRow - numCols;
+                            for (uint32 col = 0; col < numCols; ++col)
+                            {
+                                prefixRow[col] = prefixPrev[col] + current[col];
+                            }
+                        }
+
+                        const uint32 outEnd = std::min(blockStart + inSize, endRow);
+                        for (uint32 row = blockStart; row < outEnd; ++row)
+                        {
+                            // a window starting on the block boundary is the whole block
+                            const double* suffixRow = &blockSuffix[static_cast<size_t>(row - blockStart) * numCols];
+                            typename NdArray<dtype>::iterator outRow = outArray.begin(row);
+                            if (row == blockStart)
+                            {
+                                for (uint32 col = 0; col < numCols; ++col)
+                                {
+                                    outRow[col] = static_cast<dtype>(suffixRow[col] / numElements);
+                                }
+                                continue;
+                            }
+
+                            const double* prefixRow = &blockPrefix[static_cast<size_t>(row - blockStart - 1) * numCols];
+                            for (uint32 col = 0; col < numCols; ++col)
+                            {
+                                outRow[col] = static_cast<dtype>((suffixRow[col] + prefixRow[col]) / numElements);
+                            }
+                        }
+                    }
+                });
         }
 
         //============================================================================
         // Method Description: 
-        ///						Wrap boundary1d
+        ///						One-dimensional uniform filter as a single runningSumLine pass.
         ///		
         /// @param				NdArray
-        /// @param              boundary size
-        /// @return
-        ///				NdArray
+        /// @param				size of the kernel to apply
+        /// @param				NdArray, output array
+        /// @param              boundary mode
+        /// @param				contant value if boundary = 'constant'
+        ///
+        /// @return             None
         ///
-        static NdArray<dtype> wrapBoundary1d(const NdArray<dtype>& inImage, uint32 inBoundarySize)
+        static void runningSumFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize, NdArray<dtype>& outArray,
+            Filter::Boundary::Mode inMode, dtype inConstantValue)
         {
-            uint32 outSize = inImage.size() + inBoundarySize * 2;
+            if (inImageArray.size() == 0)
+            {
+                return;
+            }
 
-            NdArray<dtype> outArray(1, outSize);
-            outArray.put(Slice(inBoundarySize, inBoundarySize + inImage.size()), inImage);
+            const BoundaryView view(inImageArray, 1, inImageArray.size(), 1, inSize, inMode, inConstantValue);
+            const uint32 paddedSize = view.paddedCols();
 
-            // left
-            outArray.put(Slice(0, inBoundarySize), inImage[Slice(inImage.size() - inBoundarySize, inImage.size())]);
+            std::vector<dtype> padded(paddedSize);
+            view.paddedLine(0, &padded[0]);
 
-            // right
-            outArray.put(Slice(inImage.size() + inBoundarySize, outSize), inImage[Slice(0, inBoundarySize)]);
+            std::vector<double> prefix(paddedSize);
+            std::vector<double> suffix(paddedSize);
+            std::vector<double> sums(inImageArray.size());
+            runningSumLine(&padded[0], paddedSize, inSize, &sums[0], prefix, suffix);
 
-            return std::move(outArray);
+            for (uint32 i = 0; i < inImageArray.size(); ++i)
+            {
+                outArray[i] = static_cast<dtype>(sums[i] / static_cast<double>(inSize));
+            }
         }
 
         //============================================================================
         // Method Description: 
-        ///						Wrap boundary
+        ///						Maps an index up to a kernel half width outside of [0, inSize)
+        ///						back into the array for the boundary mode.
         ///		
-        /// @param				NdArray
-        /// @param              Boundary::Mode
-        /// @param              kernel window size
-        /// @param              (optional) constant value used for constant boundary condition
+        /// @param				index, may be negative or past the end
+        /// @param				size of the dimension
+        /// @param              boundary mode
         /// @return
-        ///				NdArray
+        ///				int32, the source index, or -1 for a constant boundary value
         ///
-        static NdArray<dtype> addBoundary(const NdArray<dtype>& inImage, Filter::Boundary::Mode inMode, uint32 inKernalSize, dtype inConstantValue = 0)
+        static int32 boundaryIndex(int32 inIndex, uint32 inSize, Filter::Boundary::Mode inMode)
         {
-            if (inKernalSize % 2 == 0)
+            const int32 size = static_cast<int32>(inSize);
+            if (inIndex >= 0 && inIndex < size)
             {
-                throw std::invalid_argument("ERROR: ImageProcessing::Filter::addBoundary: input kernal size must be an odd value.");
+                return inIndex;
             }
 
-            uint32 boundarySize = inKernalSize / 2; // integer division
-
             switch (inMode)
             {
                 case Filter::Boundary::REFLECT:
                 {
-                    return std::move(reflectBoundary(inImage, boundarySize));
+                    // d c b a | a b c d | d c b a
+                    const int32 period = 2 * size;
+                    const int32 index = ((inIndex % period) + period) % period;
+                    return index < size ? index : period - 1 - index;
                 }
-                case Filter::Boundary::CONSTANT:
+                case Filter::Boundary::MIRROR:
                 {
-                    return std::move(constantBoundary(inImage, boundarySize, inConstantValue));
+                    // d c b | a b c d | c b a
+                    if (size == 1)
+                    {
+                        return 0;
+                    }
+
+                    const int32 period = 2 * size - 2;
+                    const int32 index = ((inIndex % period) + period) % period;
+                    return index < size ? index : period - index;
                 }
                 case Filter::Boundary::NEAREST:
                 {
-                    return std::move(nearestBoundary(inImage, boundarySize));
-                }
-                case Filter::Boundary::MIRROR:
-                {
-                    return std::move(mirrorBoundary(inImage, boundarySize));
+                    return inIndex < 0 ? 0 : size - 1;
                 }
                 case Filter::Boundary::WRAP:
                 {
-                    return std::move(wrapBoundary(inImage, boundarySize));
+                    return ((inIndex % size) + size) % size;
                 }
                 default:
                 {
-                    // This can't actually happen but just adding to get rid of compiler warning
-                    throw std::invalid_argument("ERROR!");
+                    return -1;
                 }
             }
         }
 
         //============================================================================
-        // Method Description: 
-        ///						Wrap boundary
-        ///		
-        /// @param				NdArray
-        /// @param              Boundary::Mode
-        /// @param              kernel window size
-        /// @param              (optional) constant value used for constant boundary condition
-        /// @return
-        ///				NdArray
+        // Class Description:
+        ///						Boundary extended view of an image. Rather than allocating a
+        ///						padded copy, the padded row and column indices are mapped back
+        ///						into the source once, and a padded line is written on request by
+        ///						copying the interior straight from the source row and remapping
+        ///						only the two edge bands. A 1d signal is viewed as a single row
+        ///						with a row kernel size of 1.
         ///
-        static NdArray<dtype> addBoundary1d(const NdArray<dtype>& inImage, Filter::Boundary::Mode inMode, uint32 inKernalSize, dtype inConstantValue = 0)
+        class BoundaryView
         {
-            if (inKernalSize % 2 == 0)
+        public:
+            //============================================================================
+            // Method Description: 
+            ///						Constructor
+            ///		
+            /// @param				NdArray
+            /// @param				number of rows to view the data as
+            /// @param				number of columns to view the data as
+            /// @param				kernel size along the rows, must be odd
+            /// @param				kernel size along the columns, must be odd
+            /// @param              boundary mode
+            /// @param				contant value if boundary = 'constant'
+            ///
+            BoundaryView(const NdArray<dtype>& inImage, uint32 inRows, uint32 inCols, uint32 inRowKernelSize,
+                uint32 inColKernelSize, Filter::Boundary::Mode inMode, dtype inConstantValue) :
+                BoundaryView(inImage, inRows, inCols, 0, inRows, inRowKernelSize, inColKernelSize, inMode, inConstantValue)
+            {}
+
+            //============================================================================
+            // Method Description: 
+            ///						Constructor for a band of rows, padded rows are then
+            ///						counted from the boundary above the first row of the band.
+            ///		
+            /// @param				NdArray
+            /// @param				number of rows to view the data as
+            /// @param				number of columns to view the data as
+            /// @param				first row of the band
+            /// @param				number of rows in the band
+            /// @param				kernel size along the rows, must be odd
+            /// @param				kernel size along the columns, must be odd
+            /// @param              boundary mode
+            /// @param				contant value if boundary = 'constant'
+            ///
+            BoundaryView(const NdArray<dtype>& inImage, uint32 inRows, uint32 inCols, uint32 inFirstRow, uint32 inNumBandRows,
+                uint32 inRowKernelSize, uint32 inColKernelSize, Filter::Boundary::Mode inMode, dtype inConstantValue) :
+                data_(inImage.cbegin()),
+                rows_(inRows),
+                cols_(inCols),
+                colBoundary_(inColKernelSize / 2), // integer division
+                constantValue_(inConstantValue)
             {
-                throw std::invalid_argument("ERROR: ImageProcessing::Filter::addBoundary1d: input kernal size must be an odd value.");
-            }
-
-            uint32 boundarySize = inKernalSize / 2; // integer division
-
-            switch (inMode)
-            {
-                case Filter::Boundary::REFLECT:
-                {
-                    return std::move(reflectBoundary1d(inImage, boundarySize));
-                }
-                case Filter::Boundary::CONSTANT:
+                if (inRowKernelSize % 2 == 0 || inColKernelSize % 2 == 0)
                 {
-                    return std::move(constantBoundary1d(inImage, boundarySize, inConstantValue));
+                    throw std::invalid_argument("ERROR: NumCpp::Filters: input kernal size must be an odd value.");
                 }
-                case Filter::Boundary::NEAREST:
+
+                const int32 rowBoundary = static_cast<int32>(inRowKernelSize / 2); // integer division
+                rowIndex_.resize(inNumBandRows + 2 * rowBoundary);
+                for (uint32 row = 0; row < rowIndex_.size(); ++row)
                 {
-                    return std::move(nearestBoundary1d(inImage, boundarySize));
+                    rowIndex_[row] = boundaryIndex(static_cast<int32>(inFirstRow + row) - rowBoundary, inRows, inMode);
                 }
-                case Filter::Boundary::MIRROR:
+
+                colIndex_.resize(inCols + 2 * colBoundary_);
+                for (uint32 col = 0; col < colIndex_.size(); ++col)
                 {
-                    return std::move(mirrorBoundary1d(inImage, boundarySize));
+                    colIndex_[col] = boundaryIndex(static_cast<int32>(col) - static_cast<int32>(colBoundary_), inCols, inMode);
                 }
-                case Filter::Boundary::WRAP:
+            }
+
+            //============================================================================
+            // Method Description: 
+            ///						number of rows including the boundary
+            ///		
+            /// @return
+            ///				uint32
+            ///
+            uint32 paddedRows() const
+            {
+                return static_cast<uint32>(rowIndex_.size());
+            }
+
+            //============================================================================
+            // Method Description: 
+            ///						number of columns including the boundary
+            ///		
+            /// @return
+            ///				uint32
+            ///
+            uint32 paddedCols() const
+            {
+                return static_cast<uint32>(colIndex_.size());
+            }
+
+            //============================================================================
+            // Method Description: 
+            ///						Number of distinct padded lines, the source rows plus one
+            ///						line of the constant value if any padded row is constant.
+            ///		
+            /// @return
+            ///				uint32
+            ///
+            uint32 numLines() const
+            {
+                return rows_ + (std::find(rowIndex_.begin(), rowIndex_.end(), -1) != rowIndex_.end() ? 1 : 0);
+            }
+
+            //============================================================================
+            // Method Description: 
+            ///						Index of the distinct line a padded row shows, in [0, numLines())
+            ///		
+            /// @param				padded row index
+            /// @return
+            ///				uint32
+            ///
+            uint32 lineIndex(uint32 inPaddedRow) const
+            {
+                return rowIndex_[inPaddedRow] < 0 ? rows_ : static_cast<uint32>(rowIndex_[inPaddedRow]);
+            }
+
+            //============================================================================
+            // Method Description: 
+            ///						Writes a distinct line, see lineIndex()
+            ///		
+            /// @param				line index
+            /// @param				output, paddedCols() values
+            ///
+            void distinctLine(uint32 inLineIndex, dtype* outLine) const
+            {
+                line(inLineIndex < rows_ ? static_cast<int32>(inLineIndex) : -1, outLine);
+            }
+
+            //============================================================================
+            // Method Description: 
+            ///						Writes the padded line of a source row
+            ///		
+            /// @param				source row, -1 for a row of the constant boundary value
+            /// @param				output, paddedCols() values
+            ///
+            void line(int32 inSourceRow, dtype* outLine) const
+            {
+                if (inSourceRow < 0)
                 {
-                    return std::move(wrapBoundary1d(inImage, boundarySize));
+                    std::fill(outLine, outLine + colIndex_.size(), constantValue_);
+                    return;
                 }
-                default:
+
+                const dtype* sourceLine = data_ + static_cast<size_t>(inSourceRow) * cols_;
+                for (uint32 col = 0; col < colBoundary_; ++col)
                 {
-                    // This can't actually happen but just adding to get rid of compiler warning
-                    throw std::invalid_argument("ERROR!");
+                    const int32 left = colIndex_[col];
+                    const int32 right = colIndex_[col + colBoundary_ + cols_];
+                    outLine[col] = left < 0 ? constantValue_ : sourceLine[left];
+                    outLine[col + colBoundary_ + cols_] = right < 0 ? constantValue_ : sourceLine[right];
                 }
+
+                std::copy(sourceLine, sourceLine + cols_, outLine + colBoundary_);
+            }
+
+            //============================================================================
+            // Method Description: 
+            ///						Writes a padded line
+            ///		
+            /// @param				padded row index
+            /// @param				output, paddedCols() values
+            ///
+            void paddedLine(uint32 inPaddedRow, dtype* outLine) const
+            {
+                line(rowIndex_[inPaddedRow], outLine);
             }
-        }
 
+        private:
+            const dtype*        data_;
+            uint32              rows_;
+            uint32              cols_;
+            uint32              colBoundary_;
+            dtype               constantValue_;
+            std::vector<int32>  rowIndex_;
+            std::vector<int32>  colIndex_;
+        };
+
+    public:
         //============================================================================
         // Method Description: 
-        ///						trims the boundary off to make the image back to the original size
+        ///						Calculates a multidimensional complemenatry median filter.
         ///		
         /// @param				NdArray
-        /// @param              boundary size
+        /// @param				square size of the kernel to apply
+        /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param				contant value if boundary = 'constant'
         /// @return
         ///				NdArray
         ///
-        static NdArray<dtype> trimBoundary(const NdArray<dtype>& inImageWithBoundary, uint32 inSize)
+        static NdArray<dtype> complementaryMedianFilter(const NdArray<dtype>& inImageArray, uint32 inSize,
+            Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
         {
-            Shape inShape = inImageWithBoundary.shape();
-            uint32 boundarySize = inSize / 2; /// integer division
-
-            inShape.rows -= boundarySize * 2;
-            inShape.cols -= boundarySize * 2;
+            NdArray<dtype> inImageArrayCopy(inImageArray);
+            inImageArrayCopy -= medianFilter(inImageArray, inSize, inMode, inConstantValue);
 
-            return std::move(inImageWithBoundary(Slice(boundarySize, boundarySize + inShape.rows), Slice(boundarySize, boundarySize + inShape.cols)));
+            return std::move(inImageArrayCopy);
         }
 
         //============================================================================
         // Method Description: 
-        ///						trims the boundary off to make the image back to the original size
+        ///						Calculates a multidimensional complemenatry median filter.
+        ///						The result is written into outArray, which must be preallocated
+        ///						to the output shape. outArray may be the input array itself.
         ///		
         /// @param				NdArray
-        /// @param              boundary size
+        /// @param				square size of the kernel to apply
+        /// @param				NdArray, output array
+        /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param				contant value if boundary = 'constant'
         /// @return
-        ///				NdArray
+        ///				NdArray&
         ///
-        static NdArray<dtype> trimBoundary1d(const NdArray<dtype>& inImageWithBoundary, uint32 inSize)
+        static NdArray<dtype>& complementaryMedianFilter(const NdArray<dtype>& inImageArray, uint32 inSize,
+            NdArray<dtype>& outArray, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
         {
-            uint32 boundarySize = inSize / 2; // integer division
-            uint32 imageSize = inImageWithBoundary.size() - boundarySize * 2;
+            if (outArray.shape() != inImageArray.shape())
+            {
+                throw std::invalid_argument("ERROR: NumCpp::Filters::complementaryMedianFilter: output array shape does not match the input.");
+            }
+
+            // the median has to be held separately so that outArray can alias the input
+            NdArray<dtype> median = medianFilter(inImageArray, inSize, inMode, inConstantValue);
+            std::transform(inImageArray.cbegin(), inImageArray.cend(), median.cbegin(), outArray.begin(),
+                [](dtype inValue, dtype inMedian) { return inValue - inMedian; });
 
-            return std::move(inImageWithBoundary[Slice(boundarySize, boundarySize + imageSize)]);
+            return outArray;
         }
 
-    public:
         //============================================================================
         // Method Description: 
-        ///						Calculates a multidimensional complemenatry median filter.
+        ///						Calculate a one-dimensional complemenatry median filter.
         ///		
         /// @param				NdArray
-        /// @param				square size of the kernel to apply
+        /// @param				size of the kernel to apply
         /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
         /// @param				contant value if boundary = 'constant'
         /// @return
         ///				NdArray
         ///
-        static NdArray<dtype> complementaryMedianFilter(const NdArray<dtype>& inImageArray, uint32 inSize,
+        static NdArray<dtype> complementaryMedianFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize,
             Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
         {
             NdArray<dtype> inImageArrayCopy(inImageArray);
-            inImageArrayCopy -= medianFilter(inImageArray, inSize, inMode, inConstantValue);
+            inImageArrayCopy -= medianFilter1d(inImageArray, inSize, inMode, inConstantValue);
 
             return std::move(inImageArrayCopy);
         }
@@ -670,21 +2001,31 @@ namespace NumCpp
         //============================================================================
         // Method Description: 
         ///						Calculate a one-dimensional complemenatry median filter.
+        ///						The result is written into outArray, which must be preallocated
+        ///						to the output shape. outArray may be the input array itself.
         ///		
         /// @param				NdArray
         /// @param				size of the kernel to apply
+        /// @param				NdArray, output array
         /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
         /// @param				contant value if boundary = 'constant'
         /// @return
-        ///				NdArray
+        ///				NdArray&
         ///
-        static NdArray<dtype> complementaryMedianFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize,
-            Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        static NdArray<dtype>& complementaryMedianFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize,
+            NdArray<dtype>& outArray, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
         {
-            NdArray<dtype> inImageArrayCopy(inImageArray);
-            inImageArrayCopy -= medianFilter1d(inImageArray, inSize, inMode, inConstantValue);
+            if (outArray.shape() != Shape(1, inImageArray.size()))
+            {
+                throw std::invalid_argument("ERROR: NumCpp::Filters::complementaryMedianFilter1d: output array shape does not match the input.");
+            }
 
-            return std::move(inImageArrayCopy);
+            // the median has to be held separately so that outArray can alias the input
+            NdArray<dtype> median = medianFilter1d(inImageArray, inSize, inMode, inConstantValue);
+            std::transform(inImageArray.cbegin(), inImageArray.cend(), median.cbegin(), outArray.begin(),
+                [](dtype inValue, dtype inMedian) { return inValue - inMedian; });
+
+            return outArray;
         }
 
         //============================================================================
@@ -698,38 +2039,79 @@ namespace NumCpp
         /// @param				NdArray, weights
         /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
         /// @param				contant value if boundary = 'constant'
+        /// @param				(Optional) Method, DIRECT (default), FFT or AUTO
         /// @return
         ///				NdArray
         ///
         static NdArray<dtype> convolve(const NdArray<dtype>& inImageArray, uint32 inSize,
-            const NdArray<dtype>& inWeights, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+            const NdArray<dtype>& inWeights, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0,
+            Filter::Method::Type inMethod = Filter::Method::DIRECT)
+        {
+            NdArray<dtype> output(inImageArray.shape());
+            convolve(inImageArray, inSize, inWeights, output, inMode, inConstantValue, inMethod);
+
+            return std::move(output);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Calculates a multidimensional kernel convolution.
+        ///						The result is written into outArray, which must be preallocated
+        ///						to the output shape. outArray may be the input array itself.
+        ///
+        ///                     SciPy Reference: https://docs.scipy.org/doc/scipy/reference/generated/scipy.ndimage.convolve.html#scipy.ndimage.convolve
+        ///		
+        /// @param				NdArray
+        /// @param				square size of the kernel to apply
+        /// @param				NdArray, weights
+        /// @param				NdArray, output array
+        /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param				contant value if boundary = 'constant'
+        /// @param				(Optional) Method, DIRECT (default), FFT or AUTO
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& convolve(const NdArray<dtype>& inImageArray, uint32 inSize,
+            const NdArray<dtype>& inWeights, NdArray<dtype>& outArray, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0,
+            Filter::Method::Type inMethod = Filter::Method::DIRECT)
         {
+            if (outArray.shape() != inImageArray.shape())
+            {
+                throw std::invalid_argument("ERROR: NumCpp::Filters::convolve: output array shape does not match the input.");
+            }
+
             if (inWeights.size() != Utils<uint32>::sqr(inSize))
             {
                 throw std::invalid_argument("ERROR: NumCpp::Filters::convolve: input weights do no match input kernal size.");
             }
 
-            NdArray<dtype> arrayWithBoundary = addBoundary(inImageArray, inMode, inSize, inConstantValue);
-            NdArray<dtype> output(inImageArray.shape());
-
-            NdArray<dtype> weightsFlat = Methods<dtype>::rot90(inWeights, 2).flatten();
-            Shape inShape = inImageArray.shape();
-            uint32 boundarySize = inSize / 2; // integer division
-            uint32 endPointRow = boundarySize + inShape.rows;
-            uint32 endPointCol = boundarySize + inShape.cols;
+            if (inMethod == Filter::Method::RECURSIVE)
+            {
+                throw std::invalid_argument("ERROR: NumCpp::Filters::convolve: input method must be DIRECT, FFT, or AUTO.");
+            }
 
-            for (uint32 row = boundarySize; row < endPointRow; ++row)
+            const Shape inShape = inImageArray.shape();
+            if (inShape.size() == 0)
             {
-                for (uint32 col = boundarySize; col < endPointCol; ++col)
-                {
-                    NdArray<dtype> window = arrayWithBoundary(Slice(row - boundarySize, row + boundarySize + 1),
-                        Slice(col - boundarySize, col + boundarySize + 1)).flatten();
+                return outArray;
+            }
 
-                    output(row - boundarySize, col - boundarySize) = Methods<dtype>::dot(window, weightsFlat).item();
-                }
+            NdArray<dtype> inputCopy;
+            const NdArray<dtype>& input = tileInput(inImageArray, outArray, inputCopy);
+            if (inMethod == Filter::Method::FFT || (inMethod == Filter::Method::AUTO && useFFT(inImageArray, inSize, inSize)))
+            {
+                fftConvolve(input, inShape.rows, inShape.cols, inWeights, inSize, inSize, outArray, inMode, inConstantValue);
+                return outArray;
             }
 
-            return std::move(output);
+            const NdArray<dtype> weightsFlat = Methods<dtype>::rot90(inWeights, 2).flatten();
+            TileExecutor::forEachRowTile(inShape.rows, TileExecutor::tileRows(inShape.cols * sizeof(dtype), inSize),
+                [&](uint32 inFirstRow, uint32 inNumRows)
+                {
+                    convolveTile(input, inFirstRow, inNumRows, inSize, weightsFlat, outArray, inMode, inConstantValue);
+                });
+
+            return outArray;
         }
 
         //============================================================================
@@ -742,28 +2124,79 @@ namespace NumCpp
         /// @param				NdArray, weights
         /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
         /// @param				contant value if boundary = 'constant'
+        /// @param				(Optional) Method, DIRECT (default), FFT or AUTO
         /// @return
         ///				NdArray
         ///
         static NdArray<dtype> convolve1d(const NdArray<dtype>& inImageArray, const NdArray<dtype>& inWeights,
-            Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+            Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0,
+            Filter::Method::Type inMethod = Filter::Method::DIRECT)
         {
-            uint32 boundarySize = inWeights.size() / 2; // integer division
-            NdArray<dtype> arrayWithBoundary = addBoundary1d(inImageArray, inMode, inWeights.size(), inConstantValue);
             NdArray<dtype> output(1, inImageArray.size());
+            convolve1d(inImageArray, inWeights, output, inMode, inConstantValue, inMethod);
+
+            return std::move(output);
+        }
 
-            NdArray<dtype> weightsFlat = Methods<dtype>::fliplr(inWeights.flatten());
+        //============================================================================
+        // Method Description: 
+        ///						Calculates a one-dimensional kernel convolution.
+        ///						The result is written into outArray, which must be preallocated
+        ///						to the output shape. outArray may be the input array itself.
+        ///
+        ///                     SciPy Reference: https://docs.scipy.org/doc/scipy/reference/generated/scipy.ndimage.convolve1d.html#scipy.ndimage.convolve1d
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, weights
+        /// @param				NdArray, output array
+        /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param				contant value if boundary = 'constant'
+        /// @param				(Optional) Method, DIRECT (default), FFT or AUTO
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& convolve1d(const NdArray<dtype>& inImageArray, const NdArray<dtype>& inWeights,
+            NdArray<dtype>& outArray, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0,
+            Filter::Method::Type inMethod = Filter::Method::DIRECT)
+        {
+            if (outArray.shape() != Shape(1, inImageArray.size()))
+            {
+                throw std::invalid_argument("ERROR: NumCpp::Filters::convolve1d: output array shape does not match the input.");
+            }
 
-            uint32 endPointRow = boundarySize + inImageArray.size();
+            if (inMethod == Filter::Method::RECURSIVE)
+            {
+                throw std::invalid_argument("ERROR: NumCpp::Filters::convolve1d: input method must be DIRECT, FFT, or AUTO.");
+            }
 
-            for (uint32 i = boundarySize; i < endPointRow; ++i)
+            const uint32 kernelSize = inWeights.size();
+            if (inImageArray.size() > 0 && (inMethod == Filter::Method::FFT || (inMethod == Filter::Method::AUTO && useFFT(inImageArray, 1, kernelSize))))
             {
-                NdArray<dtype> window = arrayWithBoundary[Slice(i - boundarySize, i + boundarySize + 1)].flatten();
+                NdArray<dtype> inputCopy;
+                const NdArray<dtype>& input = tileInput(inImageArray, outArray, inputCopy);
+                fftConvolve(input, 1, inImageArray.size(), inWeights.flatten(), 1, kernelSize, outArray, inMode, inConstantValue);
+                return outArray;
+            }
+
+            const BoundaryView view(inImageArray, 1, inImageArray.size(), 1, kernelSize, inMode, inConstantValue);
+            std::vector<dtype> padded(view.paddedCols());
+            view.paddedLine(0, &padded[0]);
 
-                output[i - boundarySize] = Methods<dtype>::dot(window, weightsFlat).item();
+            const NdArray<dtype> weightsFlat = Methods<dtype>::fliplr(inWeights.flatten());
+            typename NdArray<dtype>::const_iterator weights = weightsFlat.cbegin();
+
+            const uint32 numElements = inImageArray.size();
+            for (uint32 i = 0; i < numElements; ++i)
+            {
+                double sum = 0;
+                for (uint32 k = 0; k < kernelSize; ++k)
+                {
+                    sum += static_cast<double>(padded[i + k]) * static_cast<double>(weights[k]);
+                }
+                outArray[i] = static_cast<dtype>(sum);
             }
 
-            return std::move(output);
+            return outArray;
         }
 
         //============================================================================
@@ -776,48 +2209,62 @@ namespace NumCpp
         /// @param				double, Standard deviation for Gaussian kernel
         /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
         /// @param				contant value if boundary = 'constant'
+        /// @param				(Optional) Method, DIRECT (default) or RECURSIVE
         /// @return
         ///				NdArray
         ///
         static NdArray<dtype> gaussianFilter(const NdArray<dtype>& inImageArray, double inSigma,
-            Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+            Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0, Filter::Method::Type inMethod = Filter::Method::DIRECT)
         {
-            if (inSigma <= 0)
+            NdArray<dtype> output(inImageArray.shape());
+            gaussianFilter(inImageArray, inSigma, output, inMode, inConstantValue, inMethod);
+
+            return std::move(output);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Calculates a multidimensional gaussian filter.
+        ///						The result is written into outArray, which must be preallocated
+        ///						to the output shape. outArray may be the input array itself.
+        ///
+        ///                     SciPy Reference: https://docs.scipy.org/doc/scipy/reference/generated/scipy.ndimage.gaussian_filter.html#scipy.ndimage.gaussian_filter
+        ///		
+        /// @param				NdArray
+        /// @param				double, Standard deviation for Gaussian kernel
+        /// @param				NdArray, output array
+        /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param				contant value if boundary = 'constant'
+        /// @param				(Optional) Method, DIRECT (default) or RECURSIVE
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& gaussianFilter(const NdArray<dtype>& inImageArray, double inSigma,
+            NdArray<dtype>& outArray, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0,
+            Filter::Method::Type inMethod = Filter::Method::DIRECT)
+        {
+            if (outArray.shape() != inImageArray.shape())
             {
-                throw std::invalid_argument("ERROR: NumCpp::Filters::gaussianFilter: input sigma value must be greater than zero.");
+                throw std::invalid_argument("ERROR: NumCpp::Filters::gaussianFilter: output array shape does not match the input.");
             }
 
-            // calculate the kernel size based off of the input sigma value
-            const uint32 MIN_KERNEL_SIZE = 5;
-            uint32 kernelSize = std::max(static_cast<uint32>(std::ceil(inSigma * 2.0 * 4.0)), MIN_KERNEL_SIZE); // 4 standard deviations
-            if (kernelSize % 2 == 0)
+            if (inSigma <= 0)
             {
-                ++kernelSize; // make sure the kernel is an odd size
+                throw std::invalid_argument("ERROR: NumCpp::Filters::gaussianFilter: input sigma value must be greater than zero.");
             }
 
-            double kernalHalfSize = static_cast<double>(kernelSize / 2); // integer division
-
-            // calculate the gaussian kernel
-            NdArray<double> kernel(kernelSize);
-            for (double row = 0; row < kernelSize; ++row)
+            if (inMethod == Filter::Method::RECURSIVE)
             {
-                for (double col = 0; col < kernelSize; ++col)
-                {
-                    kernel(static_cast<uint32>(row), static_cast<uint32>(col)) = gaussian(row - kernalHalfSize, col - kernalHalfSize, inSigma);
-                }
+                recursiveGaussian(inImageArray, inSigma, outArray, inMode, inConstantValue);
+                return outArray;
             }
 
-            // normalize the kernel
-            kernel /= kernel.sum().item();
-
-            // perform the convolution
-            NdArray<dtype> output = convolve(inImageArray.template astype<double>(),
-                kernelSize,
-                kernel,
-                inMode,
-                inConstantValue).template astype<dtype>();
+            // the gaussian is separable, so filter with the 1d kernel along
+            // the columns and then along the rows
+            const std::vector<double> kernel = gaussianKernel(inSigma);
+            separableCorrelate(inImageArray, kernel, kernel, outArray, inMode, inConstantValue);
 
-            return std::move(output);
+            return outArray;
         }
 
         //============================================================================
@@ -830,42 +2277,103 @@ namespace NumCpp
         /// @param				double, Standard deviation for Gaussian kernel
         /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
         /// @param				contant value if boundary = 'constant'
+        /// @param				(Optional) Method, DIRECT (default) or RECURSIVE
         /// @return
         ///				NdArray
         ///
         static NdArray<dtype> gaussianFilter1d(const NdArray<dtype>& inImageArray, double inSigma,
-            Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+            Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0, Filter::Method::Type inMethod = Filter::Method::DIRECT)
+        {
+            NdArray<dtype> output(1, inImageArray.size());
+            gaussianFilter1d(inImageArray, inSigma, output, inMode, inConstantValue, inMethod);
+
+            return std::move(output);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Calculate a one-dimensional gaussian filter.
+        ///						The result is written into outArray, which must be preallocated
+        ///						to the output shape. outArray may be the input array itself.
+        ///
+        ///                     SciPy Reference: https://docs.scipy.org/doc/scipy/reference/generated/scipy.ndimage.generic_filter1d.html#scipy.ndimage.generic_filter1d
+        ///		
+        /// @param				NdArray
+        /// @param				double, Standard deviation for Gaussian kernel
+        /// @param				NdArray, output array
+        /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param				contant value if boundary = 'constant'
+        /// @param				(Optional) Method, DIRECT (default) or RECURSIVE
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& gaussianFilter1d(const NdArray<dtype>& inImageArray, double inSigma,
+            NdArray<dtype>& outArray, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0,
+            Filter::Method::Type inMethod = Filter::Method::DIRECT)
         {
+            if (outArray.shape() != Shape(1, inImageArray.size()))
+            {
+                throw std::invalid_argument("ERROR: NumCpp::Filters::gaussianFilter1d: output array shape does not match the input.");
+            }
+
             if (inSigma <= 0)
             {
                 throw std::invalid_argument("ERROR: NumCpp::Filters::gaussianFilter: input sigma value must be greater than zero.");
             }
 
-            // calculate the kernel size based off of the input sigma value
-            const uint32 MIN_KERNEL_SIZE = 5;
-            uint32 kernelSize = std::max(static_cast<uint32>(std::ceil(inSigma * 2.0 * 4.0)), MIN_KERNEL_SIZE); // 4 standard deviations
-            if (kernelSize % 2 == 0)
+            const std::vector<double> kernel = gaussianKernel(inSigma);
+            const uint32 kernelSize = static_cast<uint32>(kernel.size());
+            const BoundaryView view(inImageArray, 1, inImageArray.size(), 1, kernelSize, inMode, inConstantValue);
+            std::vector<dtype> padded(view.paddedCols());
+            view.paddedLine(0, &padded[0]);
+
+            if (inMethod == Filter::Method::RECURSIVE)
             {
-                ++kernelSize; // make sure the kernel is an odd size
-            }
+                const uint32 boundarySize = kernelSize / 2; // integer division
+                std::vector<double> line(padded.begin(), padded.end());
+                recursiveGaussianLine(&line[0], static_cast<uint32>(line.size()), recursiveGaussianCoefficients(inSigma));
+                for (uint32 i = 0; i < inImageArray.size(); ++i)
+                {
+                    outArray[i] = static_cast<dtype>(line[i + boundarySize]);
+                }
 
-            double kernalHalfSize = static_cast<double>(kernelSize / 2); // integer division
+                return outArray;
+            }
 
-            // calculate the gaussian kernel
-            NdArray<double> kernel(1, kernelSize);
-            for (double i = 0; i < kernelSize; ++i)
+            // accumulate in double so integer images are not truncated per tap
+            const dtype* inData = &padded[0];
+            const uint32 numElements = inImageArray.size();
+            for (uint32 i = 0; i < numElements; ++i)
             {
-                kernel[static_cast<int32>(i)] = gaussian(i - kernalHalfSize, 0.0, inSigma);
+                double sum = 0;
+                for (uint32 k = 0; k < kernelSize; ++k)
+                {
+                    sum += kernel[k] * static_cast<double>(inData[i + k]);
+                }
+                outArray[i] = static_cast<dtype>(sum);
             }
 
-            // normalize the kernel
-            kernel /= kernel.sum().item();
+            return outArray;
+        }
 
-            // perform the convolution
-            NdArray<dtype> output = convolve1d(inImageArray.template astype<double>(),
-                kernel,
-                inMode,
-                inConstantValue).template astype<dtype>();
+        //============================================================================
+        // Method Description: 
+        ///						Calculates a multidimensional maximum filter.
+        ///
+        ///                     SciPy Reference: https://docs.scipy.org/doc/scipy/reference/generated/scipy.ndimage.maximum_filter.html#scipy.ndimage.maximum_filter
+        ///		
+        /// @param				NdArray
+        /// @param				square size of the kernel to apply
+        /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param				contant value if boundary = 'constant'
+        /// @return
+        ///				NdArray
+        ///
+        static NdArray<dtype> maximumFilter(const NdArray<dtype>& inImageArray, uint32 inSize,
+            Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            NdArray<dtype> output(inImageArray.shape());
+            maximumFilter(inImageArray, inSize, output, inMode, inConstantValue);
 
             return std::move(output);
         }
@@ -873,39 +2381,30 @@ namespace NumCpp
         //============================================================================
         // Method Description: 
         ///						Calculates a multidimensional maximum filter.
+        ///						The result is written into outArray, which must be preallocated
+        ///						to the output shape. outArray may be the input array itself.
         ///
         ///                     SciPy Reference: https://docs.scipy.org/doc/scipy/reference/generated/scipy.ndimage.maximum_filter.html#scipy.ndimage.maximum_filter
         ///		
         /// @param				NdArray
         /// @param				square size of the kernel to apply
+        /// @param				NdArray, output array
         /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
         /// @param				contant value if boundary = 'constant'
         /// @return
-        ///				NdArray
+        ///				NdArray&
         ///
-        static NdArray<dtype> maximumFilter(const NdArray<dtype>& inImageArray, uint32 inSize,
-            Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        static NdArray<dtype>& maximumFilter(const NdArray<dtype>& inImageArray, uint32 inSize,
+            NdArray<dtype>& outArray, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
         {
-            NdArray<dtype> arrayWithBoundary = addBoundary(inImageArray, inMode, inSize, inConstantValue);
-            NdArray<dtype> output(inImageArray.shape());
-
-            Shape inShape = inImageArray.shape();
-            uint32 boundarySize = inSize / 2; // integer division
-            uint32 endPointRow = boundarySize + inShape.rows;
-            uint32 endPointCol = boundarySize + inShape.cols;
-
-            for (uint32 row = boundarySize; row < endPointRow; ++row)
+            if (outArray.shape() != inImageArray.shape())
             {
-                for (uint32 col = boundarySize; col < endPointCol; ++col)
-                {
-                    NdArray<dtype> window = arrayWithBoundary(Slice(row - boundarySize, row + boundarySize + 1),
-                        Slice(col - boundarySize, col + boundarySize + 1));
-
-                    output(row - boundarySize, col - boundarySize) = window.max().item();
-                }
+                throw std::invalid_argument("ERROR: NumCpp::Filters::maximumFilter: output array shape does not match the input.");
             }
 
-            return std::move(output);
+            vanHerkFilter(inImageArray, inSize, outArray, inMode, inConstantValue, std::less<dtype>());
+
+            return outArray;
         }
 
         //============================================================================
@@ -924,20 +2423,39 @@ namespace NumCpp
         static NdArray<dtype> maximumFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize,
             Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
         {
-            NdArray<dtype> arrayWithBoundary = addBoundary1d(inImageArray, inMode, inSize, inConstantValue);
             NdArray<dtype> output(1, inImageArray.size());
+            maximumFilter1d(inImageArray, inSize, output, inMode, inConstantValue);
 
-            uint32 boundarySize = inSize / 2; // integer division
-            uint32 endPoint = boundarySize + inImageArray.size();
+            return std::move(output);
+        }
 
-            for (uint32 i = boundarySize; i < endPoint; ++i)
+        //============================================================================
+        // Method Description: 
+        ///						Calculates a one-dimensional maximum filter.
+        ///						The result is written into outArray, which must be preallocated
+        ///						to the output shape. outArray may be the input array itself.
+        ///
+        ///                     SciPy Reference: https://docs.scipy.org/doc/scipy/reference/generated/scipy.ndimage.maximum_filter1d.html#scipy.ndimage.maximum_filter1d
+        ///		
+        /// @param				NdArray
+        /// @param				size of the kernel to apply
+        /// @param				NdArray, output array
+        /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param				contant value if boundary = 'constant'
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& maximumFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize,
+            NdArray<dtype>& outArray, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            if (outArray.shape() != Shape(1, inImageArray.size()))
             {
-                NdArray<dtype> window = arrayWithBoundary[Slice(i - boundarySize, i + boundarySize + 1)];
-
-                output[i - boundarySize] = window.max().item();
+                throw std::invalid_argument("ERROR: NumCpp::Filters::maximumFilter1d: output array shape does not match the input.");
             }
 
-            return std::move(output);
+            vanHerkFilter1d(inImageArray, inSize, outArray, inMode, inConstantValue, std::less<dtype>());
+
+            return outArray;
         }
 
         //============================================================================
@@ -956,26 +2474,39 @@ namespace NumCpp
         static NdArray<dtype> medianFilter(const NdArray<dtype>& inImageArray, uint32 inSize,
             Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
         {
-            NdArray<dtype> arrayWithBoundary = addBoundary(inImageArray, inMode, inSize, inConstantValue);
             NdArray<dtype> output(inImageArray.shape());
+            medianFilter(inImageArray, inSize, output, inMode, inConstantValue);
 
-            Shape inShape = inImageArray.shape();
-            uint32 boundarySize = inSize / 2; // integer division
-            uint32 endPointRow = boundarySize + inShape.rows;
-            uint32 endPointCol = boundarySize + inShape.cols;
+            return std::move(output);
+        }
 
-            for (uint32 row = boundarySize; row < endPointRow; ++row)
+        //============================================================================
+        // Method Description: 
+        ///						Calculates a multidimensional median filter.
+        ///						The result is written into outArray, which must be preallocated
+        ///						to the output shape. outArray may be the input array itself.
+        ///
+        ///                     SciPy Reference: https://docs.scipy.org/doc/scipy/reference/generated/scipy.ndimage.median_filter.html#scipy.ndimage.median_filter
+        ///		
+        /// @param				NdArray
+        /// @param				square size of the kernel to apply
+        /// @param				NdArray, output array
+        /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param				contant value if boundary = 'constant'
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& medianFilter(const NdArray<dtype>& inImageArray, uint32 inSize,
+            NdArray<dtype>& outArray, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            if (outArray.shape() != inImageArray.shape())
             {
-                for (uint32 col = boundarySize; col < endPointCol; ++col)
-                {
-                    NdArray<dtype> window = arrayWithBoundary(Slice(row - boundarySize, row + boundarySize + 1),
-                        Slice(col - boundarySize, col + boundarySize + 1));
-
-                    output(row - boundarySize, col - boundarySize) = window.median().item();
-                }
+                throw std::invalid_argument("ERROR: NumCpp::Filters::medianFilter: output array shape does not match the input.");
             }
 
-            return std::move(output);
+            slidingRankFilter(inImageArray, inSize, Utils<uint32>::sqr(inSize) / 2, 0, outArray, inMode, inConstantValue);
+
+            return outArray;
         }
 
         //============================================================================
@@ -994,20 +2525,39 @@ namespace NumCpp
         static NdArray<dtype> medianFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize,
             Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
         {
-            NdArray<dtype> arrayWithBoundary = addBoundary1d(inImageArray, inMode, inSize, inConstantValue);
             NdArray<dtype> output(1, inImageArray.size());
+            medianFilter1d(inImageArray, inSize, output, inMode, inConstantValue);
 
-            uint32 boundarySize = inSize / 2; // integer division
-            uint32 endPoint = boundarySize + inImageArray.size();
+            return std::move(output);
+        }
 
-            for (uint32 i = boundarySize; i < endPoint; ++i)
+        //============================================================================
+        // Method Description: 
+        ///						Calculates a one-dimensional median filter.
+        ///						The result is written into outArray, which must be preallocated
+        ///						to the output shape. outArray may be the input array itself.
+        ///
+        ///                     SciPy Reference: https://docs.scipy.org/doc/scipy/reference/generated/scipy.ndimage.median_filter.html#scipy.ndimage.median_filter
+        ///		
+        /// @param				NdArray
+        /// @param				linear size of the kernel to apply
+        /// @param				NdArray, output array
+        /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param				contant value if boundary = 'constant'
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& medianFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize,
+            NdArray<dtype>& outArray, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            if (outArray.shape() != Shape(1, inImageArray.size()))
             {
-                NdArray<dtype> window = arrayWithBoundary[Slice(i - boundarySize, i + boundarySize + 1)];
-
-                output[i - boundarySize] = window.median().item();
+                throw std::invalid_argument("ERROR: NumCpp::Filters::medianFilter1d: output array shape does not match the input.");
             }
 
-            return std::move(output);
+            slidingRankFilter1d(inImageArray, inSize, inSize / 2, 0, outArray, inMode, inConstantValue);
+
+            return outArray;
         }
 
         //============================================================================
@@ -1026,26 +2576,39 @@ namespace NumCpp
         static NdArray<dtype> minimumFilter(const NdArray<dtype>& inImageArray, uint32 inSize,
             Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
         {
-            NdArray<dtype> arrayWithBoundary = addBoundary(inImageArray, inMode, inSize, inConstantValue);
             NdArray<dtype> output(inImageArray.shape());
+            minimumFilter(inImageArray, inSize, output, inMode, inConstantValue);
 
-            Shape inShape = inImageArray.shape();
-            uint32 boundarySize = inSize / 2; // integer division
-            uint32 endPointRow = boundarySize + inShape.rows;
-            uint32 endPointCol = boundarySize + inShape.cols;
+            return std::move(output);
+        }
 
-            for (uint32 row = boundarySize; row < endPointRow; ++row)
+        //============================================================================
+        // Method Description: 
+        ///						Calculates a multidimensional minimum filter.
+        ///						The result is written into outArray, which must be preallocated
+        ///						to the output shape. outArray may be the input array itself.
+        ///
+        ///                     SciPy Reference: https://docs.scipy.org/doc/scipy/reference/generated/scipy.ndimage.minimum_filter.html#scipy.ndimage.minimum_filter
+        ///		
+        /// @param				NdArray
+        /// @param				square size of the kernel to apply
+        /// @param				NdArray, output array
+        /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param				contant value if boundary = 'constant'
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& minimumFilter(const NdArray<dtype>& inImageArray, uint32 inSize,
+            NdArray<dtype>& outArray, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            if (outArray.shape() != inImageArray.shape())
             {
-                for (uint32 col = boundarySize; col < endPointCol; ++col)
-                {
-                    NdArray<dtype> window = arrayWithBoundary(Slice(row - boundarySize, row + boundarySize + 1),
-                        Slice(col - boundarySize, col + boundarySize + 1));
-
-                    output(row - boundarySize, col - boundarySize) = window.min().item();
-                }
+                throw std::invalid_argument("ERROR: NumCpp::Filters::minimumFilter: output array shape does not match the input.");
             }
 
-            return std::move(output);
+            vanHerkFilter(inImageArray, inSize, outArray, inMode, inConstantValue, std::greater<dtype>());
+
+            return outArray;
         }
 
         //============================================================================
@@ -1064,20 +2627,39 @@ namespace NumCpp
         static NdArray<dtype> minumumFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize,
             Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
         {
-            NdArray<dtype> arrayWithBoundary = addBoundary1d(inImageArray, inMode, inSize, inConstantValue);
             NdArray<dtype> output(1, inImageArray.size());
+            minumumFilter1d(inImageArray, inSize, output, inMode, inConstantValue);
 
-            uint32 boundarySize = inSize / 2; // integer division
-            uint32 endPoint = boundarySize + inImageArray.size();
+            return std::move(output);
+        }
 
-            for (uint32 i = boundarySize; i < endPoint; ++i)
+        //============================================================================
+        // Method Description: 
+        ///						Calculates a one-dimensional minumum filter.
+        ///						The result is written into outArray, which must be preallocated
+        ///						to the output shape. outArray may be the input array itself.
+        ///
+        ///                     SciPy Reference: https://docs.scipy.org/doc/scipy/reference/generated/scipy.ndimage.minimum_filter1d.html#scipy.ndimage.minimum_filter1d
+        ///		
+        /// @param				NdArray
+        /// @param				size of the kernel to apply
+        /// @param				NdArray, output array
+        /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param				contant value if boundary = 'constant'
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& minumumFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize,
+            NdArray<dtype>& outArray, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            if (outArray.shape() != Shape(1, inImageArray.size()))
             {
-                NdArray<dtype> window = arrayWithBoundary[Slice(i - boundarySize, i + boundarySize + 1)];
-
-                output[i - boundarySize] = window.min().item();
+                throw std::invalid_argument("ERROR: NumCpp::Filters::minumumFilter1d: output array shape does not match the input.");
             }
 
-            return std::move(output);
+            vanHerkFilter1d(inImageArray, inSize, outArray, inMode, inConstantValue, std::greater<dtype>());
+
+            return outArray;
         }
 
         //============================================================================
@@ -1097,26 +2679,49 @@ namespace NumCpp
         static NdArray<dtype> percentileFilter(const NdArray<dtype>& inImageArray, uint32 inSize, uint8 inPercentile,
             Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
         {
-            NdArray<dtype> arrayWithBoundary = addBoundary(inImageArray, inMode, inSize, inConstantValue);
             NdArray<dtype> output(inImageArray.shape());
+            percentileFilter(inImageArray, inSize, inPercentile, output, inMode, inConstantValue);
 
-            Shape inShape = inImageArray.shape();
-            uint32 boundarySize = inSize / 2; // integer division
-            uint32 endPointRow = boundarySize + inShape.rows;
-            uint32 endPointCol = boundarySize + inShape.cols;
+            return std::move(output);
+        }
 
-            for (uint32 row = boundarySize; row < endPointRow; ++row)
+        //============================================================================
+        // Method Description: 
+        ///						Calculates a multidimensional percentile filter.
+        ///						The result is written into outArray, which must be preallocated
+        ///						to the output shape. outArray may be the input array itself.
+        ///
+        ///                     SciPy Reference: https://docs.scipy.org/doc/scipy/reference/generated/scipy.ndimage.percentile_filter.html#scipy.ndimage.percentile_filter
+        ///		
+        /// @param				NdArray
+        /// @param				square size of the kernel to apply
+        /// @param			    percentile [0, 100]
+        /// @param				NdArray, output array
+        /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param				contant value if boundary = 'constant'
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& percentileFilter(const NdArray<dtype>& inImageArray, uint32 inSize, uint8 inPercentile,
+            NdArray<dtype>& outArray, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            if (outArray.shape() != inImageArray.shape())
             {
-                for (uint32 col = boundarySize; col < endPointCol; ++col)
-                {
-                    NdArray<dtype> window = arrayWithBoundary(Slice(row - boundarySize, row + boundarySize + 1),
-                        Slice(col - boundarySize, col + boundarySize + 1));
+                throw std::invalid_argument("ERROR: NumCpp::Filters::percentileFilter: output array shape does not match the input.");
+            }
 
-                    output(row - boundarySize, col - boundarySize) = Methods<dtype>::percentile(window, inPercentile, Axis::NONE, "nearest").item();
-                }
+            if (inPercentile > 100)
+            {
+                throw std::invalid_argument("ERROR: NumCpp::Filters::percentileFilter: input percentile value must be of the range [0, 100].");
             }
 
-            return std::move(output);
+            uint32 rank = 0;
+            double fraction = 0;
+            percentileRank(Utils<uint32>::sqr(inSize), static_cast<double>(inPercentile), true, rank, fraction);
+
+            slidingRankFilter(inImageArray, inSize, rank, fraction, outArray, inMode, inConstantValue);
+
+            return outArray;
         }
 
         //============================================================================
@@ -1136,20 +2741,49 @@ namespace NumCpp
         static NdArray<dtype> percentileFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize, uint8 inPercentile,
             Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
         {
-            NdArray<dtype> arrayWithBoundary = addBoundary1d(inImageArray, inMode, inSize, inConstantValue);
             NdArray<dtype> output(1, inImageArray.size());
+            percentileFilter1d(inImageArray, inSize, inPercentile, output, inMode, inConstantValue);
 
-            uint32 boundarySize = inSize / 2; // integer division
-            uint32 endPoint = boundarySize + inImageArray.size();
+            return std::move(output);
+        }
 
-            for (uint32 i = boundarySize; i < endPoint; ++i)
+        //============================================================================
+        // Method Description: 
+        ///						Calculates a one-dimensional percentile filter.
+        ///						The result is written into outArray, which must be preallocated
+        ///						to the output shape. outArray may be the input array itself.
+        ///
+        ///                     SciPy Reference: https://docs.scipy.org/doc/scipy/reference/generated/scipy.ndimage.percentile_filter.html#scipy.ndimage.percentile_filter
+        ///		
+        /// @param				NdArray
+        /// @param				size of the kernel to apply
+        /// @param				percentile [0, 100]
+        /// @param				NdArray, output array
+        /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param				contant value if boundary = 'constant'
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& percentileFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize, uint8 inPercentile,
+            NdArray<dtype>& outArray, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            if (outArray.shape() != Shape(1, inImageArray.size()))
             {
-                NdArray<dtype> window = arrayWithBoundary[Slice(i - boundarySize, i + boundarySize + 1)];
+                throw std::invalid_argument("ERROR: NumCpp::Filters::percentileFilter1d: output array shape does not match the input.");
+            }
 
-                output[i - boundarySize] = Methods<dtype>::percentile(window, inPercentile).item();
+            if (inPercentile > 100)
+            {
+                throw std::invalid_argument("ERROR: NumCpp::Filters::percentileFilter1d: input percentile value must be of the range [0, 100].");
             }
 
-            return std::move(output);
+            uint32 rank = 0;
+            double fraction = 0;
+            percentileRank(inSize, static_cast<double>(inPercentile), false, rank, fraction);
+
+            slidingRankFilter1d(inImageArray, inSize, rank, fraction, outArray, inMode, inConstantValue);
+
+            return outArray;
         }
 
         //============================================================================
@@ -1169,31 +2803,45 @@ namespace NumCpp
         static NdArray<dtype> rankFilter(const NdArray<dtype>& inImageArray, uint32 inSize, uint32 inRank,
             Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
         {
-            if (inRank < 0 || inRank >= Utils<uint32>::sqr(inSize))
-            {
-                std::invalid_argument("ERROR: NumCpp::Filters::rankFilter: rank not within filter footprint size.");
-            }
-
-            NdArray<dtype> arrayWithBoundary = addBoundary(inImageArray, inMode, inSize, inConstantValue);
             NdArray<dtype> output(inImageArray.shape());
+            rankFilter(inImageArray, inSize, inRank, output, inMode, inConstantValue);
 
-            Shape inShape = inImageArray.shape();
-            uint32 boundarySize = inSize / 2; // integer division
-            uint32 endPointRow = boundarySize + inShape.rows;
-            uint32 endPointCol = boundarySize + inShape.cols;
+            return std::move(output);
+        }
 
-            for (uint32 row = boundarySize; row < endPointRow; ++row)
+        //============================================================================
+        // Method Description: 
+        ///						Calculates a multidimensional rank filter.
+        ///						The result is written into outArray, which must be preallocated
+        ///						to the output shape. outArray may be the input array itself.
+        ///
+        ///                     SciPy Reference: https://docs.scipy.org/doc/scipy/reference/generated/scipy.ndimage.rank_filter.html#scipy.ndimage.rank_filter
+        ///		
+        /// @param				NdArray
+        /// @param				square size of the kernel to apply
+        /// @param				rank [0, inSize^2 - 1]
+        /// @param				NdArray, output array
+        /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param				contant value if boundary = 'constant'
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& rankFilter(const NdArray<dtype>& inImageArray, uint32 inSize, uint32 inRank,
+            NdArray<dtype>& outArray, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            if (outArray.shape() != inImageArray.shape())
             {
-                for (uint32 col = boundarySize; col < endPointCol; ++col)
-                {
-                    NdArray<dtype> window = arrayWithBoundary(Slice(row - boundarySize, row + boundarySize + 1),
-                        Slice(col - boundarySize, col + boundarySize + 1));
+                throw std::invalid_argument("ERROR: NumCpp::Filters::rankFilter: output array shape does not match the input.");
+            }
 
-                    output(row - boundarySize, col - boundarySize) = Methods<dtype>::sort(window)[inRank];
-                }
+            if (inRank >= Utils<uint32>::sqr(inSize))
+            {
+                throw std::invalid_argument("ERROR: NumCpp::Filters::rankFilter: rank not within filter footprint size.");
             }
 
-            return std::move(output);
+            slidingRankFilter(inImageArray, inSize, inRank, 0, outArray, inMode, inConstantValue);
+
+            return outArray;
         }
 
         //============================================================================
@@ -1213,20 +2861,45 @@ namespace NumCpp
         static NdArray<dtype> rankFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize, uint8 inRank,
             Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
         {
-            NdArray<dtype> arrayWithBoundary = addBoundary1d(inImageArray, inMode, inSize, inConstantValue);
             NdArray<dtype> output(1, inImageArray.size());
+            rankFilter1d(inImageArray, inSize, inRank, output, inMode, inConstantValue);
 
-            uint32 boundarySize = inSize / 2; // integer division
-            uint32 endPoint = boundarySize + inImageArray.size();
+            return std::move(output);
+        }
 
-            for (uint32 i = boundarySize; i < endPoint; ++i)
+        //============================================================================
+        // Method Description: 
+        ///						Calculates a one-dimensional rank filter.
+        ///						The result is written into outArray, which must be preallocated
+        ///						to the output shape. outArray may be the input array itself.
+        ///
+        ///                     SciPy Reference: https://docs.scipy.org/doc/scipy/reference/generated/scipy.ndimage.rank_filter.html#scipy.ndimage.rank_filter
+        ///		
+        /// @param				NdArray
+        /// @param				size of the kernel to apply
+        /// @param				rank [0, 100]
+        /// @param				NdArray, output array
+        /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param				contant value if boundary = 'constant'
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& rankFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize, uint8 inRank,
+            NdArray<dtype>& outArray, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            if (outArray.shape() != Shape(1, inImageArray.size()))
             {
-                NdArray<dtype> window = arrayWithBoundary[Slice(i - boundarySize, i + boundarySize + 1)];
+                throw std::invalid_argument("ERROR: NumCpp::Filters::rankFilter1d: output array shape does not match the input.");
+            }
 
-                output[i - boundarySize] = Methods<dtype>::sort(window)[inRank];
+            if (inRank >= inSize)
+            {
+                throw std::invalid_argument("ERROR: NumCpp::Filters::rankFilter1d: rank not within filter footprint size.");
             }
 
-            return std::move(output);
+            slidingRankFilter1d(inImageArray, inSize, inRank, 0, outArray, inMode, inConstantValue);
+
+            return outArray;
         }
 
         //============================================================================
@@ -1239,32 +2912,66 @@ namespace NumCpp
         /// @param				square size of the kernel to apply
         /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
         /// @param				contant value if boundary = 'constant'
+        /// @param				(Optional) Method, DIRECT (default) or RECURSIVE
         /// @return
         ///				NdArray
         ///
         static NdArray<dtype> uniformFilter(const NdArray<dtype>& inImageArray, uint32 inSize,
-            Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+            Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0, Filter::Method::Type inMethod = Filter::Method::DIRECT)
         {
-            NdArray<dtype> arrayWithBoundary = addBoundary(inImageArray, inMode, inSize, inConstantValue);
             NdArray<dtype> output(inImageArray.shape());
+            uniformFilter(inImageArray, inSize, output, inMode, inConstantValue, inMethod);
 
-            Shape inShape = inImageArray.shape();
-            uint32 boundarySize = inSize / 2; // integer division
-            uint32 endPointRow = boundarySize + inShape.rows;
-            uint32 endPointCol = boundarySize + inShape.cols;
+            return std::move(output);
+        }
 
-            for (uint32 row = boundarySize; row < endPointRow; ++row)
+        //============================================================================
+        // Method Description: 
+        ///						Calculates a multidimensional uniform filter.
+        ///						The result is written into outArray, which must be preallocated
+        ///						to the output shape. outArray may be the input array itself.
+        ///
+        ///                     SciPy Reference: https://docs.scipy.org/doc/scipy/reference/generated/scipy.ndimage.uniform_filter.html#scipy.ndimage.uniform_filter
+        ///		
+        /// @param				NdArray
+        /// @param				square size of the kernel to apply
+        /// @param				NdArray, output array
+        /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param				contant value if boundary = 'constant'
+        /// @param				(Optional) Method, DIRECT (default) or RECURSIVE
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& uniformFilter(const NdArray<dtype>& inImageArray, uint32 inSize,
+            NdArray<dtype>& outArray, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0,
+            Filter::Method::Type inMethod = Filter::Method::DIRECT)
+        {
+            if (outArray.shape() != inImageArray.shape())
             {
-                for (uint32 col = boundarySize; col < endPointCol; ++col)
-                {
-                    NdArray<dtype> window = arrayWithBoundary(Slice(row - boundarySize, row + boundarySize + 1),
-                        Slice(col - boundarySize, col + boundarySize + 1));
+                throw std::invalid_argument("ERROR: NumCpp::Filters::uniformFilter: output array shape does not match the input.");
+            }
 
-                    output(row - boundarySize, col - boundarySize) = window.mean().item();
-                }
+            if (inMethod == Filter::Method::RECURSIVE)
+            {
+                runningSumFilter(inImageArray, inSize, outArray, inMode, inConstantValue);
+                return outArray;
             }
 
-            return std::move(output);
+            const Shape inShape = inImageArray.shape();
+            if (inShape.size() == 0)
+            {
+                return outArray;
+            }
+
+            NdArray<dtype> inputCopy;
+            const NdArray<dtype>& input = tileInput(inImageArray, outArray, inputCopy);
+            TileExecutor::forEachRowTile(inShape.rows, TileExecutor::tileRows(inShape.cols * sizeof(dtype), inSize),
+                [&](uint32 inFirstRow, uint32 inNumRows)
+                {
+                    uniformTile(input, inFirstRow, inNumRows, inSize, outArray, inMode, inConstantValue);
+                });
+
+            return outArray;
         }
 
         //============================================================================
@@ -1277,26 +2984,73 @@ namespace NumCpp
         /// @param				size of the kernel to apply
         /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
         /// @param				contant value if boundary = 'constant'
+        /// @param				(Optional) Method, DIRECT (default) or RECURSIVE
         /// @return
         ///				NdArray
         ///
         static NdArray<dtype> uniformFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize,
-            Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+            Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0, Filter::Method::Type inMethod = Filter::Method::DIRECT)
         {
-            NdArray<dtype> arrayWithBoundary = addBoundary1d(inImageArray, inMode, inSize, inConstantValue);
             NdArray<dtype> output(1, inImageArray.size());
+            uniformFilter1d(inImageArray, inSize, output, inMode, inConstantValue, inMethod);
+
+            return std::move(output);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Calculates a one-dimensional uniform filter.
+        ///						The result is written into outArray, which must be preallocated
+        ///						to the output shape. outArray may be the input array itself.
+        ///
+        ///                     SciPy Reference: https://docs.scipy.org/doc/scipy/reference/generated/scipy.ndimage.uniform_filter1d.html#scipy.ndimage.uniform_filter1d
+        ///		
+        /// @param				NdArray
+        /// @param				size of the kernel to apply
+        /// @param				NdArray, output array
+        /// @param              boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param				contant value if boundary = 'constant'
+        /// @param				(Optional) Method, DIRECT (default) or RECURSIVE
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& uniformFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize,
+            NdArray<dtype>& outArray, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0,
+            Filter::Method::Type inMethod = Filter::Method::DIRECT)
+        {
+            if (outArray.shape() != Shape(1, inImageArray.size()))
+            {
+                throw std::invalid_argument("ERROR: NumCpp::Filters::uniformFilter1d: output array shape does not match the input.");
+            }
 
-            uint32 boundarySize = inSize / 2; // integer division
-            uint32 endPoint = boundarySize + inImageArray.size();
+            if (inMethod == Filter::Method::RECURSIVE)
+            {
+                runningSumFilter1d(inImageArray, inSize, outArray, inMode, inConstantValue);
+                return outArray;
+            }
 
-            for (uint32 i = boundarySize; i < endPoint; ++i)
+            if (inImageArray.size() == 0)
             {
-                NdArray<dtype> window = arrayWithBoundary[Slice(i - boundarySize, i + boundarySize + 1)];
+                return outArray;
+            }
+
+            const BoundaryView view(inImageArray, 1, inImageArray.size(), 1, inSize, inMode, inConstantValue);
+            std::vector<dtype> padded(view.paddedCols());
+            view.paddedLine(0, &padded[0]);
+            const dtype* inData = &padded[0];
 
-                output[i - boundarySize] = window.mean().item();
+            const uint32 numElements = inImageArray.size();
+            for (uint32 i = 0; i < numElements; ++i)
+            {
+                double sum = 0;
+                for (uint32 k = 0; k < inSize; ++k)
+                {
+                    sum += static_cast<double>(inData[i + k]);
+                }
+                outArray[i] = static_cast<dtype>(sum / static_cast<double>(inSize));
             }
 
-            return std::move(output);
+            return outArray;
         }
     };
 }
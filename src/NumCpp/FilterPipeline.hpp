@@ -0,0 +1,916 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+/// @version 1.0
+///
+/// @section LICENSE
+/// Copyright 2018 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software 
+/// without restriction, including without limitation the rights to use, copy, modify, 
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to 
+/// permit persons to whom the Software is furnished to do so, subject to the following 
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies 
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+/// DEALINGS IN THE SOFTWARE.
+///
+/// @section DESCRIPTION
+/// Runs a chain of image filters row by row without intermediate frames
+///
+#pragma once
+
+#include"NumCpp/Filter.hpp"
+#include"NumCpp/Methods.hpp"
+#include"NumCpp/NdArray.hpp"
+#include"NumCpp/TileExecutor.hpp"
+#include"NumCpp/Types.hpp"
+#include"NumCpp/Utils.hpp"
+
+#include<algorithm>
+#include<functional>
+#include<stdexcept>
+#include<string>
+#include<vector>
+
+namespace NumCpp
+{
+    //================================================================================
+    ///						An ordered chain of image filters run as one pass. Each stage
+    ///						keeps a ring of the few rows of its input that its kernel
+    ///						covers and pulls new rows from the stage before it as it needs
+    ///						them, so the intermediate images are never materialized and
+    ///						the working set is a handful of rows per stage. The image is
+    ///						split into row bands that run in parallel, each band repeating
+    ///						the rows its stages need above and below it.
+    ///
+    ///						Each stage gives the same result as the matching Filters
+    ///						function: convolve always takes the DIRECT path, and the
+    ///						uniform filter sums along the rows with the block running sums
+    ///						of its RECURSIVE method so it may differ in the last bits. A
+    ///						stage after the first with a WRAP boundary needs its whole
+    ///						input and makes the pipeline run as a single band.
+    ///
+    ///						eg FilterPipeline<double>().gaussianFilter(2.0).complementaryMedianFilter(7).threshold(50).run(image)
+    template<typename dtype>
+    class FilterPipeline
+    {
+    private:
+        //==============================Enums=========================================
+        enum Kind { GAUSSIAN = 0, UNIFORM, MAXIMUM, MINIMUM, RANK, COMPLEMENTARY_MEDIAN, CONVOLVE, THRESHOLD };
+
+        //============================================================================
+        ///						The parameters of one stage
+        struct Stage
+        {
+            Kind                    kind;
+            uint32                  size;
+            std::vector<double>     weights;
+            uint32                  rank;
+            double                  fraction;
+            dtype                   threshold;
+            Filter::Boundary::Mode  mode;
+            dtype                   constantValue;
+
+            Stage(Kind inKind, uint32 inSize, Filter::Boundary::Mode inMode, dtype inConstantValue) :
+                kind(inKind),
+                size(inSize),
+                rank(0),
+                fraction(0),
+                threshold(0),
+                mode(inMode),
+                constantValue(inConstantValue)
+            {}
+
+            uint32 halo() const
+            {
+                return size / 2; // integer division
+            }
+        };
+
+        //============================================================================
+        ///						One stage running over one band of rows. Input rows are
+        ///						padded along the row and reduced to the form the stage
+        ///						filters down the columns: the horizontal pass of the
+        ///						separable filters, the padded line for the others. These
+        ///						prepared rows are kept in a ring indexed by padded row, and
+        ///						the stage's output rows in a ring the next stage reads from.
+        class StageState
+        {
+        public:
+            //============================================================================
+            ///						Constructor
+            ///		
+            /// @param      Stage
+            /// @param      number of image rows
+            /// @param      number of image columns
+            ///
+            /// @return     None
+            ///
+            StageState(const Stage& inStage, uint32 inRows, uint32 inCols) :
+                stage_(inStage),
+                rows_(inRows),
+                cols_(inCols),
+                halo_(inStage.halo()),
+                paddedCols_(inCols + 2 * inStage.halo()),
+                image_(nullptr),
+                upstream_(nullptr),
+                firstRow_(0),
+                nextOutputRow_(0),
+                outputCapacity_(0),
+                nextPaddedRow_(0),
+                windowCol_(0)
+            {
+                // the rank filters also keep the row leaving the window
+                const uint32 numPrepared = 2 * halo_ + (stage_.kind == RANK || stage_.kind == COMPLEMENTARY_MEDIAN ? 2 : 1);
+                preparedRows_.resize(numPrepared);
+                if (usesDoubleRows())
+                {
+                    doubleRing_.resize(static_cast<size_t>(numPrepared) * cols_);
+                }
+                else
+                {
+                    dtypeRing_.resize(static_cast<size_t>(numPrepared) * preparedCols());
+                }
+
+                colIndex_.resize(paddedCols_);
+                for (uint32 col = 0; col < paddedCols_; ++col)
+                {
+                    colIndex_[col] = Filters<dtype>::boundaryIndex(static_cast<int32>(col) - static_cast<int32>(halo_), cols_, stage_.mode);
+                }
+                line_.resize(paddedCols_);
+                prefix_.resize(paddedCols_);
+                suffix_.resize(paddedCols_);
+                prefixSums_.resize(paddedCols_);
+                suffixSums_.resize(paddedCols_);
+                sums_.resize(cols_);
+
+                if (stage_.mode == Filter::Boundary::CONSTANT)
+                {
+                    std::fill(line_.begin(), line_.end(), stage_.constantValue);
+                    constantDouble_.resize(cols_);
+                    constantDtype_.resize(preparedCols());
+                    prepareLine(&constantDouble_[0], &constantDtype_[0]);
+                }
+            }
+
+            //============================================================================
+            ///						Sets where the input rows come from and the rows this
+            ///						state produces, returns the input rows it will read
+            ///		
+            /// @param      source image for the first stage, nullptr otherwise
+            /// @param      previous stage, nullptr for the first stage
+            /// @param      first output row
+            /// @param      one past the last output row
+            /// @param      size of the output ring, 0 for the last stage
+            /// @param      returned first input row
+            /// @param      returned one past the last input row
+            ///
+            /// @return     None
+            ///
+            void start(const NdArray<dtype>* inImage, StageState* inUpstream, uint32 inFirstRow, uint32 inEndRow,
+                uint32 inOutputCapacity, uint32& outFirstInputRow, uint32& outEndInputRow)
+            {
+                image_ = inImage;
+                upstream_ = inUpstream;
+                firstRow_ = inFirstRow;
+                nextOutputRow_ = inFirstRow;
+                outputCapacity_ = inOutputCapacity;
+                outputRing_.resize(static_cast<size_t>(inOutputCapacity) * cols_);
+                nextPaddedRow_ = static_cast<int32>(inFirstRow) - static_cast<int32>(halo_);
+
+                if (halo_ > 0 && stage_.mode == Filter::Boundary::WRAP)
+                {
+                    outFirstInputRow = 0;
+                    outEndInputRow = rows_;
+                }
+                else
+                {
+                    outFirstInputRow = inFirstRow >= halo_ ? inFirstRow - halo_ : 0;
+                    outEndInputRow = std::min(inEndRow + halo_, rows_);
+                }
+            }
+
+            //============================================================================
+            ///						Returns an output row, producing the rows up to it. Rows
+            ///						must be asked for no further back than the output ring holds.
+            ///		
+            /// @param      row
+            ///
+            /// @return     pointer to the row
+            ///
+            const dtype* row(uint32 inRow)
+            {
+                while (nextOutputRow_ <= inRow)
+                {
+                    produce(nextOutputRow_, &outputRing_[static_cast<size_t>(nextOutputRow_ % outputCapacity_) * cols_]);
+                    ++nextOutputRow_;
+                }
+
+                return &outputRing_[static_cast<size_t>(inRow % outputCapacity_) * cols_];
+            }
+
+            //============================================================================
+            ///						Filters one output row, rows must be produced in order
+            ///		
+            /// @param      row
+            /// @param      output
+            ///
+            /// @return     None
+            ///
+            void produce(uint32 inOutputRow, dtype* outRow)
+            {
+                const int32 lastPaddedRow = static_cast<int32>(inOutputRow + halo_);
+                while (nextPaddedRow_ <= lastPaddedRow)
+                {
+                    prepare(nextPaddedRow_++);
+                }
+
+                const int32 firstPaddedRow = static_cast<int32>(inOutputRow) - static_cast<int32>(halo_);
+                const uint32 size = stage_.size;
+                switch (stage_.kind)
+                {
+                    case GAUSSIAN:
+                    {
+                        std::fill(sums_.begin(), sums_.end(), 0.0);
+                        for (uint32 k = 0; k < size; ++k)
+                        {
+                            const double weight = stage_.weights[k];
+                            const double* inRow = doubleRow(firstPaddedRow + static_cast<int32>(k));
+                            for (uint32 col = 0; col < cols_; ++col)
+                            {
+                                sums_[col] += weight * inRow[col];
+                            }
+                        }
+
+                        for (uint32 col = 0; col < cols_; ++col)
+                        {
+                            outRow[col] = static_cast<dtype>(sums_[col]);
+                        }
+                        break;
+                    }
+                    case UNIFORM:
+                    {
+                        std::fill(sums_.begin(), sums_.end(), 0.0);
+                        for (uint32 k = 0; k < size; ++k)
+                        {
+                            const double* inRow = doubleRow(firstPaddedRow + static_cast<int32>(k));
+                            for (uint32 col = 0; col < cols_; ++col)
+                            {
+                                sums_[col] += inRow[col];
+                            }
+                        }
+
+                        const double numElements = static_cast<double>(size) * static_cast<double>(size);
+                        for (uint32 col = 0; col < cols_; ++col)
+                        {
+                            outRow[col] = static_cast<dtype>(sums_[col] / numElements);
+                        }
+                        break;
+                    }
+                    case MAXIMUM:
+                    {
+                        columnExtreme(firstPaddedRow, outRow, std::less<dtype>());
+                        break;
+                    }
+                    case MINIMUM:
+                    {
+                        columnExtreme(firstPaddedRow, outRow, std::greater<dtype>());
+                        break;
+                    }
+                    case RANK:
+                    case COMPLEMENTARY_MEDIAN:
+                    {
+                        rankRow(inOutputRow, firstPaddedRow, outRow);
+                        if (stage_.kind == COMPLEMENTARY_MEDIAN)
+                        {
+                            const dtype* center = dtypeRow(static_cast<int32>(inOutputRow)) + halo_;
+                            for (uint32 col = 0; col < cols_; ++col)
+                            {
+                                outRow[col] = center[col] - outRow[col];
+                            }
+                        }
+                        break;
+                    }
+                    case CONVOLVE:
+                    {
+                        windowLines_.resize(size);
+                        for (uint32 k = 0; k < size; ++k)
+                        {
+                            windowLines_[k] = dtypeRow(firstPaddedRow + static_cast<int32>(k));
+                        }
+                        Filters<dtype>::convolveRow(&windowLines_[0], &stage_.weights[0], size, cols_, outRow);
+                        break;
+                    }
+                    case THRESHOLD:
+                    {
+                        const dtype* inRow = dtypeRow(static_cast<int32>(inOutputRow));
+                        for (uint32 col = 0; col < cols_; ++col)
+                        {
+                            outRow[col] = inRow[col] > stage_.threshold ? static_cast<dtype>(1) : static_cast<dtype>(0);
+                        }
+                        break;
+                    }
+                }
+            }
+
+        private:
+            //==============================Attributes====================================
+            const Stage&                    stage_;
+            uint32                          rows_;
+            uint32                          cols_;
+            uint32                          halo_;
+            uint32                          paddedCols_;
+            const NdArray<dtype>*           image_;
+            StageState*                     upstream_;
+            uint32                          firstRow_;
+            uint32                          nextOutputRow_;
+            uint32                          outputCapacity_;
+            std::vector<dtype>              outputRing_;
+            int32                           nextPaddedRow_;
+            std::vector<const void*>        preparedRows_;
+            std::vector<double>             doubleRing_;
+            std::vector<dtype>              dtypeRing_;
+            std::vector<double>             constantDouble_;
+            std::vector<dtype>              constantDtype_;
+            std::vector<int32>              colIndex_;
+            std::vector<dtype>              line_;
+            std::vector<dtype>              prefix_;
+            std::vector<dtype>              suffix_;
+            std::vector<double>             prefixSums_;
+            std::vector<double>             suffixSums_;
+            std::vector<double>             sums_;
+            std::vector<const dtype*>       windowLines_;
+            std::vector<dtype>              outgoing_;
+            std::vector<dtype>              incoming_;
+            typename Filters<dtype>::RankWindow window_;
+            uint32                          windowCol_;
+
+            //============================================================================
+            ///						True if the prepared rows are double sums
+            ///		
+            /// @return     bool
+            ///
+            bool usesDoubleRows() const
+            {
+                return stage_.kind == GAUSSIAN || stage_.kind == UNIFORM;
+            }
+
+            //============================================================================
+            ///						Length of a prepared dtype row, the padded line for the
+            ///						stages that slide along it
+            ///		
+            /// @return     uint32
+            ///
+            uint32 preparedCols() const
+            {
+                return stage_.kind == MAXIMUM || stage_.kind == MINIMUM ? cols_ : paddedCols_;
+            }
+
+            //============================================================================
+            ///						Ring slot of a padded row
+            ///		
+            /// @param      padded row, -halo at the top of the image
+            ///
+            /// @return     slot
+            ///
+            uint32 slot(int32 inPaddedRow) const
+            {
+                return static_cast<uint32>(inPaddedRow + static_cast<int32>(halo_)) % static_cast<uint32>(preparedRows_.size());
+            }
+
+            const double* doubleRow(int32 inPaddedRow) const
+            {
+                return static_cast<const double*>(preparedRows_[slot(inPaddedRow)]);
+            }
+
+            const dtype* dtypeRow(int32 inPaddedRow) const
+            {
+                return static_cast<const dtype*>(preparedRows_[slot(inPaddedRow)]);
+            }
+
+            //============================================================================
+            ///						Reduces the padded line in line_ to a prepared row
+            ///		
+            /// @param      output for the double stages
+            /// @param      output for the dtype stages
+            ///
+            /// @return     None
+            ///
+            void prepareLine(double* outDouble, dtype* outDtype)
+            {
+                const dtype* inLine = &line_[0];
+                const uint32 size = stage_.size;
+                switch (stage_.kind)
+                {
+                    case GAUSSIAN:
+                    {
+                        std::fill(outDouble, outDouble + cols_, 0.0);
+                        for (uint32 k = 0; k < size; ++k)
+                        {
+                            const double weight = stage_.weights[k];
+                            const dtype* inData = inLine + k;
+                            for (uint32 col = 0; col < cols_; ++col)
+                            {
+                                outDouble[col] += weight * static_cast<double>(inData[col]);
+                            }
+                        }
+                        break;
+                    }
+                    case UNIFORM:
+                    {
+                        // block running sums as Filters::uniformFilter's RECURSIVE method, a
+                        // non-finite sample only reaches the windows that hold it
+                        Filters<dtype>::runningSumLine(inLine, paddedCols_, size, outDouble, prefixSums_, suffixSums_);
+                        break;
+                    }
+                    case MAXIMUM:
+                    {
+                        Filters<dtype>::vanHerkLine(inLine, paddedCols_, size, outDtype, prefix_, suffix_, std::less<dtype>());
+                        break;
+                    }
+                    case MINIMUM:
+                    {
+                        Filters<dtype>::vanHerkLine(inLine, paddedCols_, size, outDtype, prefix_, suffix_, std::greater<dtype>());
+                        break;
+                    }
+                    default:
+                    {
+                        std::copy(line_.begin(), line_.end(), outDtype);
+                        break;
+                    }
+                }
+            }
+
+            //============================================================================
+            ///						Prepares the next padded row into the ring
+            ///		
+            /// @param      padded row
+            ///
+            /// @return     None
+            ///
+            void prepare(int32 inPaddedRow)
+            {
+                const uint32 ringSlot = slot(inPaddedRow);
+                const int32 sourceRow = Filters<dtype>::boundaryIndex(inPaddedRow, rows_, stage_.mode);
+                if (sourceRow < 0)
+                {
+                    preparedRows_[ringSlot] = usesDoubleRows() ? static_cast<const void*>(&constantDouble_[0]) :
+                        static_cast<const void*>(&constantDtype_[0]);
+                    return;
+                }
+
+                const dtype* inRow = image_ != nullptr ? image_->cbegin() + static_cast<size_t>(sourceRow) * cols_ :
+                    upstream_->row(static_cast<uint32>(sourceRow));
+                for (uint32 col = 0; col < paddedCols_; ++col)
+                {
+                    const int32 sourceCol = colIndex_[col];
+                    line_[col] = sourceCol < 0 ? stage_.constantValue : inRow[sourceCol];
+                }
+
+                if (usesDoubleRows())
+                {
+                    double* outRow = &doubleRing_[static_cast<size_t>(ringSlot) * cols_];
+                    prepareLine(outRow, nullptr);
+                    preparedRows_[ringSlot] = outRow;
+                }
+                else
+                {
+                    dtype* outRow = &dtypeRing_[static_cast<size_t>(ringSlot) * preparedCols()];
+                    prepareLine(nullptr, outRow);
+                    preparedRows_[ringSlot] = outRow;
+                }
+            }
+
+            //============================================================================
+            ///						Maximum or minimum down the columns of the row pass
+            ///		
+            /// @param      first padded row under the kernel
+            /// @param      output
+            /// @param      comparison functor
+            ///
+            /// @return     None
+            ///
+            template<typename Compare>
+            void columnExtreme(int32 inFirstPaddedRow, dtype* outRow, Compare inCompare) const
+            {
+                std::copy(dtypeRow(inFirstPaddedRow), dtypeRow(inFirstPaddedRow) + cols_, outRow);
+                for (uint32 k = 1; k < stage_.size; ++k)
+                {
+                    const dtype* inRow = dtypeRow(inFirstPaddedRow + static_cast<int32>(k));
+                    for (uint32 col = 0; col < cols_; ++col)
+                    {
+                        outRow[col] = inCompare(outRow[col], inRow[col]) ? inRow[col] : outRow[col];
+                    }
+                }
+            }
+
+            //============================================================================
+            ///						Order statistic of one output row. The window snakes
+            ///						across the band exactly as Filters::slidingRankFilter does.
+            ///		
+            /// @param      row
+            /// @param      first padded row under the kernel
+            /// @param      output
+            ///
+            /// @return     None
+            ///
+            void rankRow(uint32 inRow, int32 inFirstPaddedRow, dtype* outRow)
+            {
+                const uint32 size = stage_.size;
+                if (inRow == firstRow_)
+                {
+                    for (uint32 k = 0; k < size; ++k)
+                    {
+                        const dtype* inLine = dtypeRow(inFirstPaddedRow + static_cast<int32>(k));
+                        for (uint32 col = 0; col < size; ++col)
+                        {
+                            window_.add(inLine[col]);
+                        }
+                    }
+                    windowCol_ = 0;
+                    outgoing_.resize(size);
+                    incoming_.resize(size);
+                    windowLines_.resize(size);
+                }
+                else
+                {
+                    // step down a row
+                    window_.replace(dtypeRow(inFirstPaddedRow - 1) + windowCol_,
+                        dtypeRow(inFirstPaddedRow + static_cast<int32>(size) - 1) + windowCol_, size);
+                }
+
+                for (uint32 k = 0; k < size; ++k)
+                {
+                    windowLines_[k] = dtypeRow(inFirstPaddedRow + static_cast<int32>(k));
+                }
+
+                if ((inRow - firstRow_) % 2 == 0)
+                {
+                    outRow[0] = Filters<dtype>::rankValue(window_, stage_.rank, stage_.fraction);
+                    for (windowCol_ = 1; windowCol_ < cols_; ++windowCol_)
+                    {
+                        for (uint32 k = 0; k < size; ++k)
+                        {
+                            outgoing_[k] = windowLines_[k][windowCol_ - 1];
+                            incoming_[k] = windowLines_[k][windowCol_ + size - 1];
+                        }
+                        window_.replace(&outgoing_[0], &incoming_[0], size);
+                        outRow[windowCol_] = Filters<dtype>::rankValue(window_, stage_.rank, stage_.fraction);
+                    }
+                    windowCol_ = cols_ - 1;
+                }
+                else
+                {
+                    outRow[windowCol_] = Filters<dtype>::rankValue(window_, stage_.rank, stage_.fraction);
+                    while (windowCol_ > 0)
+                    {
+                        --windowCol_;
+                        for (uint32 k = 0; k < size; ++k)
+                        {
+                            outgoing_[k] = windowLines_[k][windowCol_ + size];
+                            incoming_[k] = windowLines_[k][windowCol_];
+                        }
+                        window_.replace(&outgoing_[0], &incoming_[0], size);
+                        outRow[windowCol_] = Filters<dtype>::rankValue(window_, stage_.rank, stage_.fraction);
+                    }
+                }
+            }
+        };
+
+        //==============================Attributes====================================
+        std::vector<Stage>  stages_;
+
+        //============================================================================
+        ///						Checks a kernel size and adds the stage
+        ///		
+        /// @param      Stage
+        /// @param      name of the calling function for the error message
+        ///
+        /// @return     FilterPipeline&
+        ///
+        FilterPipeline<dtype>& addStage(const Stage& inStage, const std::string& inFunctionName)
+        {
+            if (inStage.size % 2 == 0)
+            {
+                throw std::invalid_argument("ERROR: NumCpp::FilterPipeline::" + inFunctionName + ": input kernal size must be an odd value.");
+            }
+
+            stages_.push_back(inStage);
+            return *this;
+        }
+
+        //============================================================================
+        ///						Runs all stages over one band of output rows
+        ///		
+        /// @param      NdArray, input
+        /// @param      first output row
+        /// @param      one past the last output row
+        /// @param      NdArray, output
+        ///
+        /// @return     None
+        ///
+        void runBand(const NdArray<dtype>& inImageArray, uint32 inFirstRow, uint32 inEndRow, NdArray<dtype>& outArray) const
+        {
+            const Shape inShape = inImageArray.shape();
+            std::vector<StageState> states;
+            states.reserve(stages_.size());
+            for (const Stage& stage : stages_)
+            {
+                states.emplace_back(stage, inShape.rows, inShape.cols);
+            }
+
+            // work back from the last stage to find the rows each stage produces
+            uint32 firstRow = inFirstRow;
+            uint32 endRow = inEndRow;
+            for (uint32 i = static_cast<uint32>(stages_.size()); i-- > 0; )
+            {
+                uint32 outputCapacity = 0;
+                if (i + 1 < stages_.size())
+                {
+                    // the next stage reads back at most its kernel's rows, or all of them to wrap
+                    const Stage& next = stages_[i + 1];
+                    outputCapacity = next.halo() > 0 && next.mode == Filter::Boundary::WRAP ? inShape.rows :
+                        std::min(2 * next.halo() + 1, inShape.rows);
+                }
+
+                states[i].start(i == 0 ? &inImageArray : nullptr, i == 0 ? nullptr : &states[i - 1],
+                    firstRow, endRow, outputCapacity, firstRow, endRow);
+            }
+
+            StageState& last = states.back();
+            for (uint32 row = inFirstRow; row < inEndRow; ++row)
+            {
+                last.produce(row, outArray.begin(row));
+            }
+        }
+
+    public:
+        //============================================================================
+        ///						Adds a gaussian filter, see Filters::gaussianFilter
+        ///		
+        /// @param      Standard deviation for Gaussian kernel
+        /// @param      boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param      contant value if boundary = 'constant'
+        ///
+        /// @return     FilterPipeline&
+        ///
+        FilterPipeline<dtype>& gaussianFilter(double inSigma, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            if (inSigma <= 0)
+            {
+                throw std::invalid_argument("ERROR: NumCpp::FilterPipeline::gaussianFilter: input sigma value must be greater than zero.");
+            }
+
+            Stage stage(GAUSSIAN, 0, inMode, inConstantValue);
+            stage.weights = Filters<dtype>::gaussianKernel(inSigma);
+            stage.size = static_cast<uint32>(stage.weights.size());
+            return addStage(stage, "gaussianFilter");
+        }
+
+        //============================================================================
+        ///						Adds a uniform filter, see Filters::uniformFilter
+        ///		
+        /// @param      square size of the kernel to apply
+        /// @param      boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param      contant value if boundary = 'constant'
+        ///
+        /// @return     FilterPipeline&
+        ///
+        FilterPipeline<dtype>& uniformFilter(uint32 inSize, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            return addStage(Stage(UNIFORM, inSize, inMode, inConstantValue), "uniformFilter");
+        }
+
+        //============================================================================
+        ///						Adds a maximum filter, see Filters::maximumFilter
+        ///		
+        /// @param      square size of the kernel to apply
+        /// @param      boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param      contant value if boundary = 'constant'
+        ///
+        /// @return     FilterPipeline&
+        ///
+        FilterPipeline<dtype>& maximumFilter(uint32 inSize, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            return addStage(Stage(MAXIMUM, inSize, inMode, inConstantValue), "maximumFilter");
+        }
+
+        //============================================================================
+        ///						Adds a minimum filter, see Filters::minimumFilter
+        ///		
+        /// @param      square size of the kernel to apply
+        /// @param      boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param      contant value if boundary = 'constant'
+        ///
+        /// @return     FilterPipeline&
+        ///
+        FilterPipeline<dtype>& minimumFilter(uint32 inSize, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            return addStage(Stage(MINIMUM, inSize, inMode, inConstantValue), "minimumFilter");
+        }
+
+        //============================================================================
+        ///						Adds a median filter, see Filters::medianFilter
+        ///		
+        /// @param      square size of the kernel to apply
+        /// @param      boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param      contant value if boundary = 'constant'
+        ///
+        /// @return     FilterPipeline&
+        ///
+        FilterPipeline<dtype>& medianFilter(uint32 inSize, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            Stage stage(RANK, inSize, inMode, inConstantValue);
+            stage.rank = Utils<uint32>::sqr(inSize) / 2;
+            return addStage(stage, "medianFilter");
+        }
+
+        //============================================================================
+        ///						Adds a complementary median filter, the input less its
+        ///						median, see Filters::complementaryMedianFilter
+        ///		
+        /// @param      square size of the kernel to apply
+        /// @param      boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param      contant value if boundary = 'constant'
+        ///
+        /// @return     FilterPipeline&
+        ///
+        FilterPipeline<dtype>& complementaryMedianFilter(uint32 inSize, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            Stage stage(COMPLEMENTARY_MEDIAN, inSize, inMode, inConstantValue);
+            stage.rank = Utils<uint32>::sqr(inSize) / 2;
+            return addStage(stage, "complementaryMedianFilter");
+        }
+
+        //============================================================================
+        ///						Adds a rank filter, see Filters::rankFilter
+        ///		
+        /// @param      square size of the kernel to apply
+        /// @param      rank, 0 being the smallest value in the kernel
+        /// @param      boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param      contant value if boundary = 'constant'
+        ///
+        /// @return     FilterPipeline&
+        ///
+        FilterPipeline<dtype>& rankFilter(uint32 inSize, uint32 inRank, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            if (inRank >= Utils<uint32>::sqr(inSize))
+            {
+                throw std::invalid_argument("ERROR: NumCpp::FilterPipeline::rankFilter: rank not within filter footprint size.");
+            }
+
+            Stage stage(RANK, inSize, inMode, inConstantValue);
+            stage.rank = inRank;
+            return addStage(stage, "rankFilter");
+        }
+
+        //============================================================================
+        ///						Adds a percentile filter, see Filters::percentileFilter
+        ///		
+        /// @param      square size of the kernel to apply
+        /// @param      percentile [0, 100]
+        /// @param      boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param      contant value if boundary = 'constant'
+        ///
+        /// @return     FilterPipeline&
+        ///
+        FilterPipeline<dtype>& percentileFilter(uint32 inSize, uint8 inPercentile, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            if (inPercentile > 100)
+            {
+                throw std::invalid_argument("ERROR: NumCpp::FilterPipeline::percentileFilter: input percentile value must be of the range [0, 100].");
+            }
+
+            Stage stage(RANK, inSize, inMode, inConstantValue);
+            Filters<dtype>::percentileRank(Utils<uint32>::sqr(inSize), static_cast<double>(inPercentile), true, stage.rank, stage.fraction);
+            return addStage(stage, "percentileFilter");
+        }
+
+        //============================================================================
+        ///						Adds a kernel convolution, see Filters::convolve. The
+        ///						stage always convolves directly.
+        ///		
+        /// @param      square size of the kernel to apply
+        /// @param      NdArray, weights
+        /// @param      boundary mode, default Reflect, options (reflect, constant, nearest, mirror, wrap)
+        /// @param      contant value if boundary = 'constant'
+        ///
+        /// @return     FilterPipeline&
+        ///
+        FilterPipeline<dtype>& convolve(uint32 inSize, const NdArray<dtype>& inWeights, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            if (inWeights.size() != Utils<uint32>::sqr(inSize))
+            {
+                throw std::invalid_argument("ERROR: NumCpp::FilterPipeline::convolve: input weights do no match input kernal size.");
+            }
+
+            Stage stage(CONVOLVE, inSize, inMode, inConstantValue);
+            const NdArray<dtype> weightsFlat = Methods<dtype>::rot90(inWeights, 2).flatten();
+            stage.weights.assign(weightsFlat.cbegin(), weightsFlat.cend());
+            return addStage(stage, "convolve");
+        }
+
+        //============================================================================
+        ///						Adds a threshold, pixels above the threshold become 1 and
+        ///						the others 0, as in ImageProcessing::applyThreshold
+        ///		
+        /// @param      threshold value
+        ///
+        /// @return     FilterPipeline&
+        ///
+        FilterPipeline<dtype>& threshold(dtype inThreshold)
+        {
+            Stage stage(THRESHOLD, 1, Filter::Boundary::REFLECT, 0);
+            stage.threshold = inThreshold;
+            return addStage(stage, "threshold");
+        }
+
+        //============================================================================
+        ///						Returns the number of stages
+        ///		
+        /// @return     uint32
+        ///
+        uint32 numStages() const
+        {
+            return static_cast<uint32>(stages_.size());
+        }
+
+        //============================================================================
+        ///						Runs the stages over an image
+        ///		
+        /// @param      NdArray
+        ///
+        /// @return     NdArray
+        ///
+        NdArray<dtype> run(const NdArray<dtype>& inImageArray) const
+        {
+            NdArray<dtype> output(inImageArray.shape());
+            run(inImageArray, output);
+
+            return std::move(output);
+        }
+
+        //============================================================================
+        ///						Runs the stages over an image. The result is written into
+        ///						outArray, which must be preallocated to the input shape.
+        ///						outArray may be the input array itself.
+        ///		
+        /// @param      NdArray
+        /// @param      NdArray, output array
+        ///
+        /// @return     NdArray&
+        ///
+        NdArray<dtype>& run(const NdArray<dtype>& inImageArray, NdArray<dtype>& outArray) const
+        {
+            if (outArray.shape() != inImageArray.shape())
+            {
+                throw std::invalid_argument("ERROR: NumCpp::FilterPipeline::run: output array shape does not match the input.");
+            }
+
+            const Shape inShape = inImageArray.shape();
+            if (stages_.empty() || inShape.size() == 0)
+            {
+                if (outArray.cbegin() != inImageArray.cbegin())
+                {
+                    std::copy(inImageArray.cbegin(), inImageArray.cend(), outArray.begin());
+                }
+                return outArray;
+            }
+
+            // the bands read the input rows around them, so an in place run reads a copy
+            NdArray<dtype> inputCopy;
+            const NdArray<dtype>& input = Filters<dtype>::tileInput(inImageArray, outArray, inputCopy);
+
+            // each band repeats the rows its stages need around it, so the bands
+            // are kept several times taller than that
+            uint32 totalHalo = 0;
+            bool singleBand = false;
+            for (uint32 i = 0; i < stages_.size(); ++i)
+            {
+                totalHalo += stages_[i].halo();
+                singleBand = singleBand || (i > 0 && stages_[i].halo() > 0 && stages_[i].mode == Filter::Boundary::WRAP);
+            }
+
+            const uint32 minBandRows = std::max(8 * totalHalo, static_cast<uint32>(16));
+            const uint32 numBands = singleBand ? 1 :
+                std::max(std::min(TileExecutor::numThreads(), inShape.rows / minBandRows), static_cast<uint32>(1));
+            const uint32 bandRows = (inShape.rows + numBands - 1) / numBands;
+            TileExecutor::forEachRowTile(inShape.rows, bandRows,
+                [&](uint32 inFirstRow, uint32 inNumRows)
+                {
+                    runBand(input, inFirstRow, inFirstRow + inNumRows, outArray);
+                });
+
+            return outArray;
+        }
+    };
+}
@@ -0,0 +1,592 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+/// @version 1.0
+///
+/// @section LICENSE
+/// Copyright 2018 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software 
+/// without restriction, including without limitation the rights to use, copy, modify, 
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to 
+/// permit persons to whom the Software is furnished to do so, subject to the following 
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies 
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+/// DEALINGS IN THE SOFTWARE.
+///
+/// @section DESCRIPTION
+/// Lazily evaluated arange/linspace/eye/identity/tri arrays
+///
+#pragma once
+
+#include"NumCpp/NdArray.hpp"
+#include"NumCpp/Shape.hpp"
+#include"NumCpp/Types.hpp"
+
+#include<cmath>
+#include<iostream>
+#include<stdexcept>
+#include<string>
+
+namespace NumCpp
+{
+    //================================================================================
+    ///						A lazily evaluated arange, linspace, eye, identity or tri
+    ///						array. Only the parameters of the sequence are stored and
+    ///						each element is computed from its index when it is needed,
+    ///						so combining a generator with an NdArray element-wise (eg
+    ///						x * Generator<double>::linspace(0, 1, x.size())) allocates
+    ///						only the result. Call toNdArray to materialize the values.
+    template<typename dtype>
+    class Generator
+    {
+    private:
+        //==============================Enums=========================================
+        enum Kind { LINEAR = 0, DIAGONAL, TRIANGLE };
+
+        //==============================Attributes====================================
+        Kind            kind_;
+        Shape           shape_;
+        double          start_;
+        double          step_;
+        double          stop_;
+        bool            endPoint_;
+        int32           offset_;
+
+        //============================================================================
+        ///						Constructor, only used by the factory functions
+        ///		
+        /// @param      kind of sequence
+        /// @param      Shape
+        ///
+        /// @return     None
+        ///
+        Generator(Kind inKind, const Shape& inShape) :
+            kind_(inKind),
+            shape_(inShape),
+            start_(0),
+            step_(0),
+            stop_(0),
+            endPoint_(false),
+            offset_(0)
+        {}
+
+        //============================================================================
+        ///						Value of the LINEAR sequence at the flat index
+        ///		
+        /// @param      flat index
+        ///
+        /// @return     value
+        ///
+        dtype linearValue(uint32 inIndex) const
+        {
+            // linspace pins its last value to stop, like numpy
+            if (endPoint_ && inIndex == shape_.cols - 1)
+            {
+                return static_cast<dtype>(stop_);
+            }
+
+            return static_cast<dtype>(start_ + step_ * static_cast<double>(inIndex));
+        }
+
+        //============================================================================
+        ///						Value of the DIAGONAL or TRIANGLE array at the row and column
+        ///		
+        /// @param      row
+        /// @param      col
+        ///
+        /// @return     value
+        ///
+        dtype matrixValue(uint32 inRow, uint32 inCol) const
+        {
+            const int64 diagonal = static_cast<int64>(inCol) - static_cast<int64>(inRow);
+            const bool isOne = kind_ == Kind::DIAGONAL ? diagonal == offset_ : diagonal <= offset_;
+            return isOne ? static_cast<dtype>(1) : static_cast<dtype>(0);
+        }
+
+    public:
+        //============================================================================
+        ///						Return evenly spaced values within the half-open interval
+        ///						[start, stop).
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.arange.html
+        ///		
+        /// @param      start value
+        /// @param      stop value
+        /// @param      (Optional) step value, defaults to 1
+        ///
+        /// @return     Generator
+        ///
+        static Generator<dtype> arange(dtype inStart, dtype inStop, dtype inStep = 1)
+        {
+            if (inStep > 0 && inStop < inStart)
+            {
+                throw std::invalid_argument("ERROR: Generator::arange: stop value must be larger than the start value for positive step.");
+            }
+
+            if (inStep < 0 && inStop > inStart)
+            {
+                throw std::invalid_argument("ERROR: Generator::arange: start value must be larger than the stop value for negative step.");
+            }
+
+            if (inStep == 0)
+            {
+                throw std::invalid_argument("ERROR: Generator::arange: step value must be non-zero.");
+            }
+
+            const double numValues = std::ceil((static_cast<double>(inStop) - static_cast<double>(inStart)) / static_cast<double>(inStep));
+            Generator<dtype> returnGenerator(Kind::LINEAR, Shape(1, static_cast<uint32>(numValues)));
+            returnGenerator.start_ = static_cast<double>(inStart);
+            returnGenerator.step_ = static_cast<double>(inStep);
+
+            return returnGenerator;
+        }
+
+        //============================================================================
+        ///						Return evenly spaced values within [0, stop) with a step of 1.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.arange.html
+        ///		
+        /// @param      stop value
+        ///
+        /// @return     Generator
+        ///
+        static Generator<dtype> arange(dtype inStop)
+        {
+            if (inStop <= 0)
+            {
+                throw std::invalid_argument("ERROR: Generator::arange: stop value must ge greater than 0.");
+            }
+
+            return arange(0, inStop, 1);
+        }
+
+        //============================================================================
+        ///						Return evenly spaced numbers over a specified interval.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.linspace.html
+        ///		
+        /// @param      start point
+        /// @param      end point
+        /// @param      number of points, default = 50
+        /// @param      include endPoint, default = true
+        ///
+        /// @return     Generator
+        ///
+        static Generator<dtype> linspace(dtype inStart, dtype inStop, uint32 inNum = 50, bool endPoint = true)
+        {
+            if (inNum > 1 && inStop <= inStart)
+            {
+                throw std::invalid_argument("ERROR: Generator::linspace: stop value must be greater than the start value.");
+            }
+
+            Generator<dtype> returnGenerator(Kind::LINEAR, Shape(1, inNum));
+            returnGenerator.start_ = static_cast<double>(inStart);
+            returnGenerator.stop_ = static_cast<double>(inStop);
+            returnGenerator.endPoint_ = endPoint && inNum > 1;
+            if (inNum > 1)
+            {
+                const double numSteps = static_cast<double>(endPoint ? inNum - 1 : inNum);
+                returnGenerator.step_ = (static_cast<double>(inStop) - static_cast<double>(inStart)) / numSteps;
+            }
+
+            return returnGenerator;
+        }
+
+        //============================================================================
+        ///						Return a 2-D array with ones on the diagonal and zeros elsewhere.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.eye.html
+        ///		
+        /// @param      number of rows (N)
+        /// @param      number of columns (M)
+        /// @param      (Optional) K - Index of the diagonal, positive values are above the main diagonal
+        ///
+        /// @return     Generator
+        ///
+        static Generator<dtype> eye(uint32 inN, uint32 inM, int32 inK = 0)
+        {
+            Generator<dtype> returnGenerator(Kind::DIAGONAL, Shape(inN, inM));
+            returnGenerator.offset_ = inK;
+
+            return returnGenerator;
+        }
+
+        //============================================================================
+        ///						Return a square 2-D array with ones on the diagonal and zeros elsewhere.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.eye.html
+        ///		
+        /// @param      number of rows and columns (N)
+        /// @param      (Optional) K - Index of the diagonal, positive values are above the main diagonal
+        ///
+        /// @return     Generator
+        ///
+        static Generator<dtype> eye(uint32 inN, int32 inK = 0)
+        {
+            return eye(inN, inN, inK);
+        }
+
+        //============================================================================
+        ///						Return a 2-D array with ones on the diagonal and zeros elsewhere.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.eye.html
+        ///		
+        /// @param      Shape
+        /// @param      (Optional) K - Index of the diagonal, positive values are above the main diagonal
+        ///
+        /// @return     Generator
+        ///
+        static Generator<dtype> eye(const Shape& inShape, int32 inK = 0)
+        {
+            return eye(inShape.rows, inShape.cols, inK);
+        }
+
+        //============================================================================
+        ///						Return the identity array, a square array with ones on the
+        ///						main diagonal.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.identity.html
+        ///		
+        /// @param      matrix square size
+        ///
+        /// @return     Generator
+        ///
+        static Generator<dtype> identity(uint32 inSquareSize)
+        {
+            return eye(inSquareSize, inSquareSize, 0);
+        }
+
+        //============================================================================
+        ///						An array with ones at and below the given diagonal and zeros elsewhere.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.tri.html
+        ///		
+        /// @param      N, number of rows
+        /// @param      M, number of columns
+        /// @param      (Optional) Offset, the sub-diagonal at and below which the array is filled
+        ///
+        /// @return     Generator
+        ///
+        static Generator<dtype> tri(uint32 inN, uint32 inM, int32 inOffset = 0)
+        {
+            Generator<dtype> returnGenerator(Kind::TRIANGLE, Shape(inN, inM));
+            returnGenerator.offset_ = inOffset;
+
+            return returnGenerator;
+        }
+
+        //============================================================================
+        ///						A square array with ones at and below the given diagonal and
+        ///						zeros elsewhere.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.tri.html
+        ///		
+        /// @param      N, number of rows and cols
+        /// @param      (Optional) Offset, the sub-diagonal at and below which the array is filled
+        ///
+        /// @return     Generator
+        ///
+        static Generator<dtype> tri(uint32 inN, int32 inOffset = 0)
+        {
+            return tri(inN, inN, inOffset);
+        }
+
+        //============================================================================
+        ///						Returns the value at the row and column
+        ///		
+        /// @param      row
+        /// @param      col
+        ///
+        /// @return     value
+        ///
+        dtype operator()(uint32 inRow, uint32 inCol) const
+        {
+            if (inRow >= shape_.rows || inCol >= shape_.cols)
+            {
+                throw std::invalid_argument("ERROR: Generator::operator(): input index is out of bounds.");
+            }
+
+            return kind_ == Kind::LINEAR ? linearValue(inCol) : matrixValue(inRow, inCol);
+        }
+
+        //============================================================================
+        ///						Returns the value at the flat index
+        ///		
+        /// @param      flat index
+        ///
+        /// @return     value
+        ///
+        dtype operator[](uint32 inIndex) const
+        {
+            if (inIndex >= shape_.size())
+            {
+                throw std::invalid_argument("ERROR: Generator::operator[]: input index is out of bounds.");
+            }
+
+            return kind_ == Kind::LINEAR ? linearValue(inIndex) : matrixValue(inIndex / shape_.cols, inIndex % shape_.cols);
+        }
+
+        //============================================================================
+        ///						Returns the shape of the generated array
+        ///		
+        /// @param      None
+        ///
+        /// @return     Shape
+        ///
+        Shape shape() const
+        {
+            return shape_;
+        }
+
+        //============================================================================
+        ///						Returns the number of generated values
+        ///		
+        /// @param      None
+        ///
+        /// @return     size
+        ///
+        uint32 size() const
+        {
+            return shape_.size();
+        }
+
+        //============================================================================
+        ///						Combines an array with the generated values element-wise,
+        ///						outArray[i] = inFunction(inArray[i], generated[i]). The
+        ///						generated values are never stored. outArray may be inArray.
+        ///		
+        /// @param      NdArray
+        /// @param      NdArray, output array
+        /// @param      function(array value, generated value)
+        ///
+        /// @return     NdArray&
+        ///
+        template<typename Function>
+        NdArray<dtype>& apply(const NdArray<dtype>& inArray, NdArray<dtype>& outArray, Function inFunction) const
+        {
+            if (inArray.shape() != shape_ || outArray.shape() != shape_)
+            {
+                throw std::invalid_argument("ERROR: Generator::apply: input array shape is not consistant with the generator.");
+            }
+
+            typename NdArray<dtype>::const_iterator inData = inArray.cbegin();
+            typename NdArray<dtype>::iterator outData = outArray.begin();
+            if (kind_ == Kind::LINEAR)
+            {
+                for (uint32 i = 0; i < shape_.cols; ++i)
+                {
+                    outData[i] = inFunction(inData[i], linearValue(i));
+                }
+
+                return outArray;
+            }
+
+            for (uint32 row = 0; row < shape_.rows; ++row)
+            {
+                const uint32 rowStart = row * shape_.cols;
+                for (uint32 col = 0; col < shape_.cols; ++col)
+                {
+                    outData[rowStart + col] = inFunction(inData[rowStart + col], matrixValue(row, col));
+                }
+            }
+
+            return outArray;
+        }
+
+        //============================================================================
+        ///						Combines an array with the generated values element-wise
+        ///		
+        /// @param      NdArray
+        /// @param      function(array value, generated value)
+        ///
+        /// @return     NdArray
+        ///
+        template<typename Function>
+        NdArray<dtype> apply(const NdArray<dtype>& inArray, Function inFunction) const
+        {
+            NdArray<dtype> returnArray(shape_);
+            apply(inArray, returnArray, inFunction);
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        ///						Materializes the generated values
+        ///		
+        /// @param      None
+        ///
+        /// @return     NdArray
+        ///
+        NdArray<dtype> toNdArray() const
+        {
+            NdArray<dtype> returnArray(shape_);
+            typename NdArray<dtype>::iterator outData = returnArray.begin();
+            for (uint32 i = 0; i < returnArray.size(); ++i)
+            {
+                outData[i] = kind_ == Kind::LINEAR ? linearValue(i) : matrixValue(i / shape_.cols, i % shape_.cols);
+            }
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        ///						Returns the generated values as a string representation
+        ///		
+        /// @param      None
+        ///
+        /// @return     string
+        ///
+        std::string str() const
+        {
+            return toNdArray().str();
+        }
+
+        //============================================================================
+        ///						Prints the generated values to the console
+        ///		
+        /// @param      None
+        ///
+        /// @return     None
+        ///
+        void print() const
+        {
+            std::cout << *this;
+        }
+
+        //============================================================================
+        ///						IO operator for the Generator class
+        ///		
+        /// @param      output stream
+        /// @param      Generator
+        ///
+        /// @return     std::ostream
+        ///
+        friend std::ostream& operator<<(std::ostream& inOStream, const Generator<dtype>& inGenerator)
+        {
+            inOStream << inGenerator.str();
+            return inOStream;
+        }
+    };
+
+    //============================================================================
+    ///						Adds the generated values to an array element-wise
+    ///		
+    /// @param      NdArray
+    /// @param      Generator
+    ///
+    /// @return     NdArray
+    ///
+    template<typename dtype>
+    NdArray<dtype> operator+(const NdArray<dtype>& inArray, const Generator<dtype>& inGenerator)
+    {
+        return std::move(inGenerator.apply(inArray, [](dtype inValue, dtype inGenerated) -> dtype { return inValue + inGenerated; }));
+    }
+
+    //============================================================================
+    ///						Adds the generated values to an array element-wise
+    ///		
+    /// @param      Generator
+    /// @param      NdArray
+    ///
+    /// @return     NdArray
+    ///
+    template<typename dtype>
+    NdArray<dtype> operator+(const Generator<dtype>& inGenerator, const NdArray<dtype>& inArray)
+    {
+        return std::move(inArray + inGenerator);
+    }
+
+    //============================================================================
+    ///						Subtracts the generated values from an array element-wise
+    ///		
+    /// @param      NdArray
+    /// @param      Generator
+    ///
+    /// @return     NdArray
+    ///
+    template<typename dtype>
+    NdArray<dtype> operator-(const NdArray<dtype>& inArray, const Generator<dtype>& inGenerator)
+    {
+        return std::move(inGenerator.apply(inArray, [](dtype inValue, dtype inGenerated) -> dtype { return inValue - inGenerated; }));
+    }
+
+    //============================================================================
+    ///						Subtracts an array from the generated values element-wise
+    ///		
+    /// @param      Generator
+    /// @param      NdArray
+    ///
+    /// @return     NdArray
+    ///
+    template<typename dtype>
+    NdArray<dtype> operator-(const Generator<dtype>& inGenerator, const NdArray<dtype>& inArray)
+    {
+        return std::move(inGenerator.apply(inArray, [](dtype inValue, dtype inGenerated) -> dtype { return inGenerated - inValue; }));
+    }
+
+    //============================================================================
+    ///						Multiplies an array by the generated values element-wise
+    ///		
+    /// @param      NdArray
+    /// @param      Generator
+    ///
+    /// @return     NdArray
+    ///
+    template<typename dtype>
+    NdArray<dtype> operator*(const NdArray<dtype>& inArray, const Generator<dtype>& inGenerator)
+    {
+        return std::move(inGenerator.apply(inArray, [](dtype inValue, dtype inGenerated) -> dtype { return inValue * inGenerated; }));
+    }
+
+    //============================================================================
+    ///						Multiplies an array by the generated values element-wise
+    ///		
+    /// @param      Generator
+    /// @param      NdArray
+    ///
+    /// @return     NdArray
+    ///
+    template<typename dtype>
+    NdArray<dtype> operator*(const Generator<dtype>& inGenerator, const NdArray<dtype>& inArray)
+    {
+        return std::move(inArray * inGenerator);
+    }
+
+    //============================================================================
+    ///						Divides an array by the generated values element-wise
+    ///		
+    /// @param      NdArray
+    /// @param      Generator
+    ///
+    /// @return     NdArray
+    ///
+    template<typename dtype>
+    NdArray<dtype> operator/(const NdArray<dtype>& inArray, const Generator<dtype>& inGenerator)
+    {
+        return std::move(inGenerator.apply(inArray, [](dtype inValue, dtype inGenerated) -> dtype { return inValue / inGenerated; }));
+    }
+
+    //============================================================================
+    ///						Divides the generated values by an array element-wise
+    ///		
+    /// @param      Generator
+    /// @param      NdArray
+    ///
+    /// @return     NdArray
+    ///
+    template<typename dtype>
+    NdArray<dtype> operator/(const Generator<dtype>& inGenerator, const NdArray<dtype>& inArray)
+    {
+        return std::move(inGenerator.apply(inArray, [](dtype inValue, dtype inGenerated) -> dtype { return inGenerated / inValue; }));
+    }
+}
@@ -30,6 +30,8 @@
 #pragma once
 #include<NumCpp/NdArray.hpp>
 #include<NumCpp/Methods.hpp>
+#include<NumCpp/Morphology.hpp>
+#include<NumCpp/TileExecutor.hpp>
 #include<NumCpp/Types.hpp>
 #include<NumCpp/Utils.hpp>
 
@@ -706,130 +708,654 @@ namespace NumCpp
         };
 
         private:
-        //=============================================================================
+        class ClusterMaker;
+
+        public:
+        //================================================================================
         // Class Description:
-        ///              Clusters exceedance data into contiguous groups
-        class ClusterMaker
+        ///						Holds the clusters of a frame as a structure of arrays. The
+        ///						rows, columns and intensities of all of the pixels are kept in
+        ///						flat arrays with the pixels of each cluster stored contiguously,
+        ///						found through per-cluster offsets the way a CSR sparse matrix
+        ///						finds its rows. Each cluster also keeps a bitmap over its
+        ///						bounding box for constant time membership tests. The exceedance
+        ///						pixels of a cluster come first, followed by any border pixels.
+        class ClusterStore
         {
         private:
-            //==================================Attributes=================================
-            const NdArray<bool>* const      xcds_;
-            const NdArray<dtype>* const     intensities_;
-            std::vector<Pixel>              xcdsVec_;
+            friend class ClusterMaker;
 
-            Shape                           shape_;
+            //================================Attributes===============================
+            std::vector<uint32>     offsets_;
+            std::vector<uint32>     rows_;
+            std::vector<uint32>     cols_;
+            std::vector<dtype>      intensities_;
+            std::vector<uint32>     numExceedances_;
+
+            std::vector<uint32>     rowMins_;
+            std::vector<uint32>     rowMaxs_;
+            std::vector<uint32>     colMins_;
+            std::vector<uint32>     colMaxs_;
+            std::vector<dtype>      clusterIntensities_;
+            std::vector<dtype>      peakPixelIntensities_;
+
+            std::vector<uint32>     bitOffsets_;
+            std::vector<uint64>     bits_;
 
-            std::vector<Cluster>            clusters_;
+            //=============================================================================
+            // Description:
+            ///              splits the clusters into contiguous chunks and calls
+            ///              inFunction(firstCluster, endCluster) for each, in parallel
+            ///              on the TileExecutor if requested
+            ///
+            /// @param               number of clusters
+            /// @param               run the chunks in parallel
+            /// @param               function taking the uint32 first and 1 past the last cluster
+            ///
+            /// @return
+            ///              None
+            ///
+            template<typename Function>
+            static void forEachClusterChunk(uint32 inNumClusters, bool inParallel, const Function& inFunction)
+            {
+                const uint32 numChunks = inParallel ? std::min(inNumClusters, 4 * TileExecutor::numThreads()) : 1;
+                TileExecutor::parallelFor(numChunks,
+                    [&](uint32 inChunk)
+                    {
+                        inFunction(static_cast<uint32>(static_cast<uint64>(inChunk) * inNumClusters / numChunks),
+                            static_cast<uint32>((static_cast<uint64>(inChunk) + 1) * inNumClusters / numChunks));
+                    });
+            }
 
             //=============================================================================
             // Description:
-            ///              checks that the input row and column have not fallen off of the edge
-            /// 
-            /// @param              pixel row, 
-            /// @param              pixel column
-            /// 
-            /// @return 
-            ///              returns a pixel object clipped to the image boundaries
+            ///              computes the bounds, intensities and membership bitmaps of
+            ///              the clusters from the pixel arrays. The intensities are summed
+            ///              in pixel order, as Cluster::addPixel does.
+            ///
+            /// @param               compute the clusters in parallel
+            ///
+            /// @return
+            ///              None
+            ///
+            void finalize(bool inParallel)
+            {
+                const uint32 numClusters = size();
+                rowMins_.resize(numClusters);
+                rowMaxs_.resize(numClusters);
+                colMins_.resize(numClusters);
+                colMaxs_.resize(numClusters);
+                clusterIntensities_.resize(numClusters);
+                peakPixelIntensities_.resize(numClusters);
+
+                forEachClusterChunk(numClusters, inParallel,
+                    [&](uint32 inFirstCluster, uint32 inEndCluster)
+                    {
+                        for (uint32 clusterIdx = inFirstCluster; clusterIdx < inEndCluster; ++clusterIdx)
+                        {
+                            uint32 rowMin = std::numeric_limits<uint32>::max();
+                            uint32 rowMax = 0;
+                            uint32 colMin = std::numeric_limits<uint32>::max();
+                            uint32 colMax = 0;
+                            dtype intensity = 0;
+                            dtype peakPixelIntensity = 0;
+                            for (uint32 i = offsets_[clusterIdx]; i < offsets_[clusterIdx + 1]; ++i)
+                            {
+                                rowMin = std::min(rowMin, rows_[i]);
+                                rowMax = std::max(rowMax, rows_[i]);
+                                colMin = std::min(colMin, cols_[i]);
+                                colMax = std::max(colMax, cols_[i]);
+                                intensity += intensities_[i];
+                                if (intensities_[i] > peakPixelIntensity)
+                                {
+                                    peakPixelIntensity = intensities_[i];
+                                }
+                            }
+
+                            rowMins_[clusterIdx] = rowMin;
+                            rowMaxs_[clusterIdx] = rowMax;
+                            colMins_[clusterIdx] = colMin;
+                            colMaxs_[clusterIdx] = colMax;
+                            clusterIntensities_[clusterIdx] = intensity;
+                            peakPixelIntensities_[clusterIdx] = peakPixelIntensity;
+                        }
+                    });
+
+                // each bitmap starts on a word of its own so the clusters can be filled in parallel
+                bitOffsets_.resize(numClusters + 1);
+                bitOffsets_[0] = 0;
+                for (uint32 clusterIdx = 0; clusterIdx < numClusters; ++clusterIdx)
+                {
+                    const uint64 numBits = static_cast<uint64>(height(clusterIdx)) * static_cast<uint64>(width(clusterIdx));
+                    bitOffsets_[clusterIdx + 1] = bitOffsets_[clusterIdx] + static_cast<uint32>((numBits + 63) / 64);
+                }
+                bits_.assign(bitOffsets_[numClusters], 0);
+
+                forEachClusterChunk(numClusters, inParallel,
+                    [&](uint32 inFirstCluster, uint32 inEndCluster)
+                    {
+                        for (uint32 clusterIdx = inFirstCluster; clusterIdx < inEndCluster; ++clusterIdx)
+                        {
+                            uint64* bits = &bits_[bitOffsets_[clusterIdx]];
+                            const uint32 clusterWidth = width(clusterIdx);
+                            for (uint32 i = offsets_[clusterIdx]; i < offsets_[clusterIdx + 1]; ++i)
+                            {
+                                const uint64 bit = static_cast<uint64>(rows_[i] - rowMins_[clusterIdx]) * clusterWidth + (cols_[i] - colMins_[clusterIdx]);
+                                bits[bit / 64] |= static_cast<uint64>(1) << (bit % 64);
+                            }
+                        }
+                    });
+            }
+
+        public:
+            //=============================================================================
+            // Description:
+            ///              default constructor, an empty store
+            ///
+            /// @param
+            ///              None
+            ///
+            /// @return
+            ///              None
+            ///
+            ClusterStore() :
+                offsets_(1, 0)
+            {}
+
+            //=============================================================================
+            // Description:
+            ///              returns the number of clusters in the store
+            ///
+            /// @param
+            ///              None
             ///
-            Pixel makePixel(int32 inRow, int32 inCol)
+            /// @return
+            ///              number of clusters
+            ///
+            uint32 size() const
             {
-                // Make sure that on the edges after i've added or subtracted 1 from the row and col that 
-                // i haven't gone over the edge
-                uint32 row = std::min(static_cast<uint32>(std::max<int32>(inRow, 0)), shape_.rows - 1);
-                uint32 col = std::min(static_cast<uint32>(std::max<int32>(inCol, 0)), shape_.cols - 1);
-                dtype intensity = intensities_->operator()(row, col);
+                return static_cast<uint32>(offsets_.size()) - 1;
+            }
 
-                return Pixel(row, col, intensity);
+            //=============================================================================
+            // Description:
+            ///              returns the total number of pixels of all of the clusters
+            ///
+            /// @param
+            ///              None
+            ///
+            /// @return
+            ///              number of pixels
+            ///
+            uint32 numPixels() const
+            {
+                return offsets_.back();
             }
 
             //=============================================================================
             // Description:
-            ///              finds all of the neighboring pixels to the input pixel 
-            /// 
-            /// @param               Pixel
-            /// @param               std::set<Pixel> neighbors
-            /// @return 
+            ///              returns the number of pixels in a cluster
+            ///
+            /// @param
+            ///              cluster index
+            ///
+            /// @return
+            ///              number of pixels in the cluster
+            ///
+            uint32 clusterSize(uint32 inIndex) const
+            {
+                return offsets_[inIndex + 1] - offsets_[inIndex];
+            }
+
+            //=============================================================================
+            // Description:
+            ///              returns the number of exceedance pixels in a cluster, the
+            ///              pixels after them are the border pixels
+            ///
+            /// @param
+            ///              cluster index
+            ///
+            /// @return
+            ///              number of exceedance pixels
+            ///
+            uint32 numExceedances(uint32 inIndex) const
+            {
+                return numExceedances_[inIndex];
+            }
+
+            //=============================================================================
+            // Description:
+            ///              returns the minimum row number of a cluster
+            ///
+            /// @param
+            ///              cluster index
+            ///
+            /// @return
+            ///              minimum row number of the cluster
+            ///
+            uint32 rowMin(uint32 inIndex) const
+            {
+                return rowMins_[inIndex];
+            }
+
+            //=============================================================================
+            // Description:
+            ///              returns the maximum row number of a cluster
+            ///
+            /// @param
+            ///              cluster index
+            ///
+            /// @return
+            ///              maximum row number of the cluster
+            ///
+            uint32 rowMax(uint32 inIndex) const
+            {
+                return rowMaxs_[inIndex];
+            }
+
+            //=============================================================================
+            // Description:
+            ///              returns the minimum column number of a cluster
+            ///
+            /// @param
+            ///              cluster index
+            ///
+            /// @return
+            ///              minimum column number of the cluster
+            ///
+            uint32 colMin(uint32 inIndex) const
+            {
+                return colMins_[inIndex];
+            }
+
+            //=============================================================================
+            // Description:
+            ///              returns the maximum column number of a cluster
+            ///
+            /// @param
+            ///              cluster index
+            ///
+            /// @return
+            ///              maximum column number of the cluster
+            ///
+            uint32 colMax(uint32 inIndex) const
+            {
+                return colMaxs_[inIndex];
+            }
+
+            //=============================================================================
+            // Description:
+            ///              returns the number of rows a cluster spans
+            ///
+            /// @param
+            ///              cluster index
+            ///
+            /// @return
+            ///              number of rows
+            ///
+            uint32 height(uint32 inIndex) const
+            {
+                return rowMaxs_[inIndex] - rowMins_[inIndex] + 1;
+            }
+
+            //=============================================================================
+            // Description:
+            ///              returns the number of columns a cluster spans
+            ///
+            /// @param
+            ///              cluster index
+            ///
+            /// @return
+            ///              number of columns
+            ///
+            uint32 width(uint32 inIndex) const
+            {
+                return colMaxs_[inIndex] - colMins_[inIndex] + 1;
+            }
+
+            //=============================================================================
+            // Description:
+            ///              returns the summed intensity of a cluster
+            ///
+            /// @param
+            ///              cluster index
+            ///
+            /// @return
+            ///              summed cluster intensity
+            ///
+            dtype intensity(uint32 inIndex) const
+            {
+                return clusterIntensities_[inIndex];
+            }
+
+            //=============================================================================
+            // Description:
+            ///              returns the intensity of the peak pixel in a cluster
+            ///
+            /// @param
+            ///              cluster index
+            ///
+            /// @return
+            ///              peak pixel intensity
+            ///
+            dtype peakPixelIntensity(uint32 inIndex) const
+            {
+                return peakPixelIntensities_[inIndex];
+            }
+
+            //=============================================================================
+            // Description:
+            ///              returns the estimated energy on detector (EOD) of a cluster
+            ///
+            /// @param
+            ///              cluster index
+            ///
+            /// @return
+            ///              eod
+            ///
+            double eod(uint32 inIndex) const
+            {
+                return static_cast<double>(peakPixelIntensities_[inIndex]) / static_cast<double>(clusterIntensities_[inIndex]);
+            }
+
+            //=============================================================================
+            // Description:
+            ///              returns whether a pixel belongs to a cluster
+            ///
+            /// @param               cluster index
+            /// @param               pixel row
+            /// @param               pixel column
+            ///
+            /// @return
+            ///              bool
+            ///
+            bool contains(uint32 inIndex, uint32 inRow, uint32 inCol) const
+            {
+                if (inRow < rowMins_[inIndex] || inRow > rowMaxs_[inIndex] || inCol < colMins_[inIndex] || inCol > colMaxs_[inIndex])
+                {
+                    return false;
+                }
+
+                const uint64 bit = static_cast<uint64>(inRow - rowMins_[inIndex]) * width(inIndex) + (inCol - colMins_[inIndex]);
+                return ((bits_[bitOffsets_[inIndex] + bit / 64] >> (bit % 64)) & 1) != 0;
+            }
+
+            //=============================================================================
+            // Description:
+            ///              returns the offsets of the clusters into the pixel arrays,
+            ///              the pixels of cluster i are [offsets[i], offsets[i + 1])
+            ///
+            /// @param
             ///              None
             ///
-            void findNeighbors(const Pixel& inPixel, std::set<Pixel>& outNeighbors)
+            /// @return
+            ///              std::vector<uint32>
+            ///
+            const std::vector<uint32>& offsets() const
             {
-                // using a set will auto take care of adding duplicate pixels on the edges
+                return offsets_;
+            }
 
-                // the 8 surrounding neighbors
-                int32 row = static_cast<int32>(inPixel.row());
-                int32 col = static_cast<int32>(inPixel.col());
+            //=============================================================================
+            // Description:
+            ///              returns the rows of all of the pixels
+            ///
+            /// @param
+            ///              None
+            ///
+            /// @return
+            ///              std::vector<uint32>
+            ///
+            const std::vector<uint32>& rows() const
+            {
+                return rows_;
+            }
 
-                outNeighbors.insert(outNeighbors.end(), makePixel(row - 1, col - 1));
-                outNeighbors.insert(outNeighbors.end(), makePixel(row - 1, col));
-                outNeighbors.insert(outNeighbors.end(), makePixel(row - 1, col + 1));
-                outNeighbors.insert(outNeighbors.end(), makePixel(row, col - 1));
-                outNeighbors.insert(outNeighbors.end(), makePixel(row, col + 1));
-                outNeighbors.insert(outNeighbors.end(), makePixel(row + 1, col - 1));
-                outNeighbors.insert(outNeighbors.end(), makePixel(row + 1, col));
-                outNeighbors.insert(outNeighbors.end(), makePixel(row + 1, col + 1));
+            //=============================================================================
+            // Description:
+            ///              returns the columns of all of the pixels
+            ///
+            /// @param
+            ///              None
+            ///
+            /// @return
+            ///              std::vector<uint32>
+            ///
+            const std::vector<uint32>& cols() const
+            {
+                return cols_;
             }
 
             //=============================================================================
             // Description:
-            ///              finds all of the neighboring pixels to the input pixel that are NOT exceedances
-            ///  
-            /// @param       Pixel
-            /// @param       std::vector<Pixel> neighbors
-            /// 
-            /// @return 
-            ///              vector of non exceedance neighboring pixels
+            ///              returns the intensities of all of the pixels
+            ///
+            /// @param
+            ///              None
+            ///
+            /// @return
+            ///              std::vector<dtype>
             ///
-            void findNeighborNotXcds(const Pixel& inPixel, std::vector<Pixel>& outNeighbors)
+            const std::vector<dtype>& intensities() const
             {
-                std::set<Pixel> neighbors;
-                findNeighbors(inPixel, neighbors);
+                return intensities_;
+            }
+
+            //=============================================================================
+            // Description:
+            ///              builds the Cluster object of a cluster, the same as
+            ///              clusterPixels returns it
+            ///
+            /// @param
+            ///              cluster index
+            ///
+            /// @return
+            ///              Cluster
+            ///
+            Cluster cluster(uint32 inIndex) const
+            {
+                if (inIndex >= size())
+                {
+                    throw std::invalid_argument("ERROR: ImageProcessing::ClusterStore::cluster: index exceeds the number of clusters.");
+                }
 
-                // check if the neighboring pixels are exceedances and insert into the xcd vector
-                for (auto pixelIter = neighbors.begin(); pixelIter != neighbors.end(); ++pixelIter)
+                Cluster theCluster(inIndex);
+                const uint32 exceedanceEnd = offsets_[inIndex] + numExceedances_[inIndex];
+                for (uint32 i = offsets_[inIndex]; i < offsets_[inIndex + 1]; ++i)
                 {
-                    if (!xcds_->operator()(pixelIter->row(), pixelIter->col()))
+                    Pixel thePixel(rows_[i], cols_[i], intensities_[i]);
+                    if (i < exceedanceEnd)
                     {
-                        outNeighbors.push_back(*pixelIter);
+                        thePixel.setClusterId(static_cast<int32>(inIndex));
                     }
+                    theCluster.addPixel(thePixel);
                 }
+
+                return std::move(theCluster);
             }
 
             //=============================================================================
             // Description:
-            ///              finds the pixel index of neighboring pixels
+            ///              builds the Cluster objects of all of the clusters
+            ///
+            /// @param
+            ///              build the clusters in parallel on the TileExecutor, default false
+            ///
+            /// @return
+            ///              std::vector<Cluster>
+            ///
+            std::vector<Cluster> clusters(bool inParallel = false) const
+            {
+                const uint32 numClusters = size();
+                std::vector<Cluster> theClusters;
+                theClusters.reserve(numClusters);
+                for (uint32 clusterIdx = 0; clusterIdx < numClusters; ++clusterIdx)
+                {
+                    theClusters.push_back(Cluster(clusterIdx));
+                }
+
+                forEachClusterChunk(numClusters, inParallel,
+                    [&](uint32 inFirstCluster, uint32 inEndCluster)
+                    {
+                        for (uint32 clusterIdx = inFirstCluster; clusterIdx < inEndCluster; ++clusterIdx)
+                        {
+                            theClusters[clusterIdx] = cluster(clusterIdx);
+                        }
+                    });
+
+                return std::move(theClusters);
+            }
+        };
+
+        private:
+        //============================================================================
+        // Method Description: 
+        ///						Finds the root label of a provisional label, halving the
+        ///						path to it along the way
+        ///		
+        /// @param				union-find parent of each provisional label
+        /// @param				provisional label
+        /// @return
+        ///				root label
+        ///
+        static uint32 findRoot(std::vector<uint32>& ioParents, uint32 inLabel)
+        {
+            while (ioParents[inLabel] != inLabel)
+            {
+                ioParents[inLabel] = ioParents[ioParents[inLabel]];
+                inLabel = ioParents[inLabel];
+            }
+
+            return inLabel;
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Merges the sets of two provisional labels, the smaller root
+        ///						becomes the root of both
+        ///		
+        /// @param				union-find parent of each provisional label
+        /// @param				provisional label
+        /// @param				provisional label
+        /// @return
+        ///				root label of the merged set
+        ///
+        static uint32 unite(std::vector<uint32>& ioParents, uint32 inLabel1, uint32 inLabel2)
+        {
+            const uint32 root1 = findRoot(ioParents, inLabel1);
+            const uint32 root2 = findRoot(ioParents, inLabel2);
+            if (root1 < root2)
+            {
+                ioParents[root2] = root1;
+                return root1;
+            }
+
+            ioParents[root1] = root2;
+            return root2;
+        }
+
+        //=============================================================================
+        // Class Description:
+        ///              Clusters exceedance data into contiguous groups
+        class ClusterMaker
+        {
+        private:
+            //==================================Attributes=================================
+            const NdArray<bool>* const      xcds_;
+            const NdArray<dtype>* const     intensities_;
+            const bool                      parallel_;
+
+            Shape                           shape_;
+
+            ClusterStore                    store_;
+            mutable std::vector<Cluster>    clusters_;
+            mutable bool                    clustersBuilt_;
+
+            //=============================================================================
+            // Description:
+            ///              labels the exceedances of a band of rows 8-connected with 
+            ///              provisional labels local to the band, counted from 1 in 
+            ///              raster order
             ///  
-            /// @param       Pixel
-            /// @param       std::vector<uint32> neigbhors
+            /// @param       first row of the band
+            /// @param       number of rows in the band
+            /// @param       labels of every pixel, 0 for the background
+            /// @param       union-find parent of each provisional label, starting with 
+            ///              the background label 0
+            /// @param       index of the pixel that started each provisional label
+            /// @param       number of pixels given each provisional label
             /// 
             /// @return 
-            ///              vector of neighboring pixel indices
+            ///              None
             ///
-            void findNeighborXcds(const Pixel& inPixel, std::vector<uint32>& outNeighbors)
-            {
-                std::set<Pixel> neighbors;
-                findNeighbors(inPixel, neighbors);
-                std::vector<Pixel> neighborXcds;
-
-                // check if the neighboring pixels are exceedances and insert into the xcd vector
-                for (auto pixelIter = neighbors.begin(); pixelIter != neighbors.end(); ++pixelIter)
+            void labelBand(uint32 inFirstRow, uint32 inNumRows, std::vector<uint32>& ioLabels,
+                std::vector<uint32>& outParents, std::vector<uint32>& outFirstPixels, std::vector<uint32>& outSizes) const
+            {
+                const uint32 numCols = shape_.cols;
+                outParents.assign(1, 0);
+                outFirstPixels.assign(1, 0);
+                outSizes.assign(1, 0);
+                for (uint32 row = inFirstRow; row < inFirstRow + inNumRows; ++row)
                 {
-                    if (xcds_->operator()(pixelIter->row(), pixelIter->col()))
+                    for (uint32 col = 0; col < numCols; ++col)
                     {
-                        neighborXcds.push_back(*pixelIter);
-                    }
-                }
+                        const uint32 index = row * numCols + col;
+                        if (!xcds_->operator[](index))
+                        {
+                            ioLabels[index] = 0;
+                            continue;
+                        }
 
-                // loop through the neighbors and find the cooresponding index into exceedances_
-                for (auto pixelIter = neighborXcds.begin(); pixelIter < neighborXcds.end(); ++pixelIter)
-                {
-                    auto theExceedanceIter = find(xcdsVec_.begin(), xcdsVec_.end(), *pixelIter);
-                    outNeighbors.push_back(static_cast<uint32>(theExceedanceIter - xcdsVec_.begin()));
+                        // merge with the labeled neighbors above and to the left
+                        uint32 label = 0;
+                        if (row > inFirstRow)
+                        {
+                            const uint32 colBegin = col > 0 ? col - 1 : col;
+                            const uint32 colEnd = std::min(col + 2, numCols);
+                            for (uint32 neighborCol = colBegin; neighborCol < colEnd; ++neighborCol)
+                            {
+                                const uint32 neighborLabel = ioLabels[index - numCols - col + neighborCol];
+                                if (neighborLabel != 0)
+                                {
+                                    label = label == 0 ? findRoot(outParents, neighborLabel) : unite(outParents, label, neighborLabel);
+                                }
+                            }
+                        }
+
+                        if (col > 0 && ioLabels[index - 1] != 0)
+                        {
+                            label = label == 0 ? findRoot(outParents, ioLabels[index - 1]) : unite(outParents, label, ioLabels[index - 1]);
+                        }
+
+                        if (label == 0)
+                        {
+                            label = static_cast<uint32>(outParents.size());
+                            outParents.push_back(label);
+                            outFirstPixels.push_back(index);
+                            outSizes.push_back(0);
+                        }
+                        ioLabels[index] = label;
+                        ++outSizes[label];
+                    }
                 }
             }
 
             //=============================================================================
             // Description:
-            ///              workhorse method that performs the clustering algorithm
+            ///              workhorse method that performs the clustering algorithm. The 
+            ///              exceedances are labeled 8-connected with a union-find of 
+            ///              provisional labels, so the cost is linear in the number of 
+            ///              pixels. Labels are only ever merged into the smaller one and
+            ///              are handed out in raster order, so the root of each cluster 
+            ///              is the label of its first pixel and the clusters are numbered
+            ///              in the order of their first pixels. Each cluster is then 
+            ///              walked breadth first from its first pixel, which lists its 
+            ///              pixels in the same order as they have always been.
+            ///
+            ///              In parallel the rows are labeled in bands on the TileExecutor,
+            ///              the equivalences along the seams between the bands are merged,
+            ///              and the clusters are walked in parallel. The clusters come out
+            ///              the same either way.
             /// 
             /// @param 
             ///              None
@@ -839,96 +1365,307 @@ namespace NumCpp
             ///
             void runClusterMaker()
             {
-                uint32 clusterId = 0;
+                const uint32 numRows = shape_.rows;
+                const uint32 numCols = shape_.cols;
+                if (shape_.size() == 0)
+                {
+                    return;
+                }
 
-                for (uint32 xcdIdx = 0; xcdIdx < xcdsVec_.size(); ++xcdIdx)
+                // a few bands per thread keeps the threads busy while the seams stay few
+                uint32 rowsPerBand = numRows;
+                if (parallel_)
                 {
-                    Pixel& currentPixel = xcdsVec_[xcdIdx];
+                    const uint32 numBands = std::max(4 * TileExecutor::numThreads(), static_cast<uint32>(1));
+                    rowsPerBand = std::max((numRows + numBands - 1) / numBands, static_cast<uint32>(16));
+                }
+                const uint32 numBands = (numRows + rowsPerBand - 1) / rowsPerBand;
+
+                std::vector<uint32> labels(shape_.size());
+                std::vector<std::vector<uint32> > bandParents(numBands);
+                std::vector<std::vector<uint32> > bandFirstPixels(numBands);
+                std::vector<std::vector<uint32> > bandSizes(numBands);
+                TileExecutor::forEachRowTile(numRows, rowsPerBand,
+                    [&](uint32 inFirstRow, uint32 inNumRows)
+                    {
+                        const uint32 band = inFirstRow / rowsPerBand;
+                        labelBand(inFirstRow, inNumRows, labels, bandParents[band], bandFirstPixels[band], bandSizes[band]);
+                    });
+
+                // gather the provisional labels of all of the bands, band by band in raster order
+                std::vector<uint32> labelOffsets(numBands, 0);
+                std::vector<uint32> parents(1, 0);
+                std::vector<uint32> firstPixels(1, 0);
+                std::vector<uint32> sizes(1, 0);
+                for (uint32 band = 0; band < numBands; ++band)
+                {
+                    const uint32 offset = static_cast<uint32>(parents.size()) - 1;
+                    labelOffsets[band] = offset;
+                    for (uint32 label = 1; label < bandParents[band].size(); ++label)
+                    {
+                        parents.push_back(bandParents[band][label] + offset);
+                        firstPixels.push_back(bandFirstPixels[band][label]);
+                        sizes.push_back(bandSizes[band][label]);
+                    }
+                    std::vector<uint32>().swap(bandParents[band]);
+                    std::vector<uint32>().swap(bandFirstPixels[band]);
+                    std::vector<uint32>().swap(bandSizes[band]);
+                }
 
-                    // not already visited
-                    if (currentPixel.clusterId() == -1)
+                // merge the equivalences along the seams between the bands
+                for (uint32 band = 1; band < numBands; ++band)
+                {
+                    const uint32 seamIndex = band * rowsPerBand * numCols;
+                    for (uint32 col = 0; col < numCols; ++col)
                     {
-                        Cluster newCluster(clusterId);    // a new cluster
-                        currentPixel.setClusterId(clusterId);
-                        newCluster.addPixel(currentPixel);  // assign pixel to cluster
-
-                        // get the neighbors
-                        std::vector<uint32> neighborIds;
-                        findNeighborXcds(currentPixel, neighborIds);
-                        if (neighborIds.empty())
+                        if (labels[seamIndex + col] == 0)
                         {
-                            clusters_.push_back(newCluster);
-                            ++clusterId;
                             continue;
                         }
 
-                        // loop through the neighbors
-                        for (uint32 neighborsIdx = 0; neighborsIdx < neighborIds.size(); ++neighborsIdx)
+                        const uint32 label = labels[seamIndex + col] + labelOffsets[band];
+                        const uint32 colBegin = col > 0 ? col - 1 : col;
+                        const uint32 colEnd = std::min(col + 2, numCols);
+                        for (uint32 neighborCol = colBegin; neighborCol < colEnd; ++neighborCol)
                         {
-                            Pixel& currentNeighborPixel = xcdsVec_[neighborIds[neighborsIdx]];
+                            const uint32 neighborLabel = labels[seamIndex - numCols + neighborCol];
+                            if (neighborLabel != 0)
+                            {
+                                unite(parents, label, neighborLabel + labelOffsets[band - 1]);
+                            }
+                        }
+                    }
+                }
 
-                            // go to neighbors
-                            std::vector<uint32> newNeighborIds;
-                            findNeighborXcds(currentNeighborPixel, newNeighborIds);
+                // a parent is always a smaller label, so one ascending pass resolves every root
+                // and totals the sizes of the clusters
+                std::vector<uint32> clusterLabels(parents.size(), 0);
+                std::vector<uint32> clusterFirstPixels;
+                std::vector<uint32>& clusterSizes = store_.numExceedances_;
+                for (uint32 label = 1; label < parents.size(); ++label)
+                {
+                    if (parents[label] == label)
+                    {
+                        clusterFirstPixels.push_back(firstPixels[label]);
+                        clusterSizes.push_back(0);
+                        clusterLabels[label] = static_cast<uint32>(clusterFirstPixels.size());
+                    }
+                    else
+                    {
+                        parents[label] = parents[parents[label]];
+                        clusterLabels[label] = clusterLabels[parents[label]];
+                    }
+                    clusterSizes[clusterLabels[label] - 1] += sizes[label];
+                }
 
-                            // loop through the new neighbors and add them to neighbors
-                            for (uint32 newNeighborsIdx = 0; newNeighborsIdx < newNeighborIds.size(); ++newNeighborsIdx)
+                TileExecutor::forEachRowTile(numRows, rowsPerBand,
+                    [&](uint32 inFirstRow, uint32 inNumRows)
+                    {
+                        const uint32 offset = labelOffsets[inFirstRow / rowsPerBand];
+                        const uint32 endIndex = (inFirstRow + inNumRows) * numCols;
+                        for (uint32 index = inFirstRow * numCols; index < endIndex; ++index)
+                        {
+                            if (labels[index] != 0)
                             {
-                                // not already in neighbors
-                                if (find(neighborIds.begin(), neighborIds.end(), newNeighborIds[newNeighborsIdx]) == neighborIds.end())
-                                {
-                                    neighborIds.push_back(newNeighborIds[newNeighborsIdx]);
-                                }
+                                labels[index] = clusterLabels[labels[index] + offset];
                             }
+                        }
+                    });
 
-                            // not already assigned to a cluster
-                            if (currentNeighborPixel.clusterId() == -1)
+                // lay the clusters out back to back in the store
+                const uint32 numClusters = static_cast<uint32>(clusterFirstPixels.size());
+                std::vector<uint32>& offsets = store_.offsets_;
+                offsets.resize(numClusters + 1);
+                for (uint32 clusterIdx = 0; clusterIdx < numClusters; ++clusterIdx)
+                {
+                    offsets[clusterIdx + 1] = offsets[clusterIdx] + clusterSizes[clusterIdx];
+                }
+                store_.rows_.resize(offsets[numClusters]);
+                store_.cols_.resize(offsets[numClusters]);
+                store_.intensities_.resize(offsets[numClusters]);
+
+                // walk the clusters, clearing the labels of the pixels as they are queued. The
+                // cluster's own span of the store is the queue. A pixel's labeled neighbors are
+                // all in its own cluster, so the walks of different clusters never touch the
+                // same pixels.
+                ClusterStore::forEachClusterChunk(numClusters, parallel_,
+                    [&](uint32 inFirstCluster, uint32 inEndCluster)
+                    {
+                        uint32* const rows = store_.rows_.data();
+                        uint32* const cols = store_.cols_.data();
+                        for (uint32 clusterIdx = inFirstCluster; clusterIdx < inEndCluster; ++clusterIdx)
+                        {
+                            uint32 queueEnd = offsets[clusterIdx];
+                            rows[queueEnd] = clusterFirstPixels[clusterIdx] / numCols;
+                            cols[queueEnd++] = clusterFirstPixels[clusterIdx] % numCols;
+                            labels[clusterFirstPixels[clusterIdx]] = 0;
+                            for (uint32 queueIdx = offsets[clusterIdx]; queueIdx < queueEnd; ++queueIdx)
                             {
-                                currentNeighborPixel.setClusterId(clusterId);
-                                newCluster.addPixel(currentNeighborPixel);
+                                const uint32 row = rows[queueIdx];
+                                const uint32 col = cols[queueIdx];
+                                store_.intensities_[queueIdx] = intensities_->operator()(row, col);
+
+                                // the neighbors in raster order
+                                const uint32 rowEnd = std::min(row + 2, numRows);
+                                const uint32 colBegin = col > 0 ? col - 1 : col;
+                                const uint32 colEnd = std::min(col + 2, numCols);
+                                for (uint32 neighborRow = row > 0 ? row - 1 : row; neighborRow < rowEnd; ++neighborRow)
+                                {
+                                    for (uint32 neighborCol = colBegin; neighborCol < colEnd; ++neighborCol)
+                                    {
+                                        const uint32 neighborIndex = neighborRow * numCols + neighborCol;
+                                        if (labels[neighborIndex] != 0)
+                                        {
+                                            labels[neighborIndex] = 0;
+                                            rows[queueEnd] = neighborRow;
+                                            cols[queueEnd++] = neighborCol;
+                                        }
+                                    }
+                                }
                             }
                         }
+                    });
 
-                        clusters_.push_back(newCluster);
-                        ++clusterId;
-                    }
-                }
+                store_.finalize(parallel_);
             }
 
             //=============================================================================
             // Description:
-            ///              3x3 dialates the clusters
+            ///              grows each cluster by the border width. Each step visits the 
+            ///              pixels the previous step added, the exceedances for the first 
+            ///              step, and adds their 8 neighbors in raster order that are not 
+            ///              exceedances and not yet in the cluster, so a border never grows 
+            ///              through another cluster. A bit mask over the cluster's bounding 
+            ///              box plus the border tracks membership. The pixels come out in 
+            ///              the same order the original one pixel at a time expansion 
+            ///              added them, so the clusters and their sums are unchanged.
             /// 
             /// @param 
-            ///              None
+            ///              border width
             /// 
             /// @return 
             ///              None
             ///
-            void expandClusters()
-            {
-                // loop through the clusters 
-                for (auto clusterIter = clusters_.begin(); clusterIter < clusters_.end(); ++clusterIter)
-                {
-                    // loop through the pixels of the cluster 
-                    Cluster& theCluster = *clusterIter;
-                    uint32 clusterSize = static_cast<uint32>(theCluster.size());
-                    for (uint32 iPixel = 0; iPixel < clusterSize; ++iPixel)
+            void expandClusters(uint8 inBorderWidth)
+            {
+                const uint32 numRows = shape_.rows;
+                const uint32 numCols = shape_.cols;
+                const uint32 numClusters = store_.size();
+                const std::vector<uint32>& offsets = store_.offsets_;
+                const std::vector<uint32>& rows = store_.rows_;
+                const std::vector<uint32>& cols = store_.cols_;
+
+                std::vector<std::vector<uint32> > borders(numClusters);
+                ClusterStore::forEachClusterChunk(numClusters, parallel_,
+                    [&](uint32 inFirstCluster, uint32 inEndCluster)
                     {
-                        const Pixel& thePixel = theCluster[iPixel];
-                        std::vector<Pixel> neighborsNotXcds;
-                        findNeighborNotXcds(thePixel, neighborsNotXcds);
+                        for (uint32 clusterIdx = inFirstCluster; clusterIdx < inEndCluster; ++clusterIdx)
+                        {
+                            const uint32 rowBegin = store_.rowMin(clusterIdx) - std::min<uint32>(store_.rowMin(clusterIdx), inBorderWidth);
+                            const uint32 colBegin = store_.colMin(clusterIdx) - std::min<uint32>(store_.colMin(clusterIdx), inBorderWidth);
+                            const uint32 boxRows = std::min(store_.rowMax(clusterIdx) + inBorderWidth + 1, numRows) - rowBegin;
+                            const uint32 boxCols = std::min(store_.colMax(clusterIdx) + inBorderWidth + 1, numCols) - colBegin;
 
-                        // loop through the neighbors and if they haven't already been added to the cluster, add them
-                        for (auto newPixelIter = neighborsNotXcds.begin(); newPixelIter < neighborsNotXcds.end(); ++newPixelIter)
+                            Morphology::BitMask cluster(boxRows, boxCols);
+                            for (uint32 i = offsets[clusterIdx]; i < offsets[clusterIdx + 1]; ++i)
+                            {
+                                cluster.set(rows[i] - rowBegin, cols[i] - colBegin);
+                            }
+
+                            // the pixels added before the last step have no neighbors left
+                            // to add, so each step only visits the last step's pixels
+                            std::vector<uint32>& border = borders[clusterIdx];
+                            const uint32 numExceedances = store_.clusterSize(clusterIdx);
+                            uint32 stepBegin = 0;
+                            uint32 stepEnd = numExceedances;
+                            for (uint8 step = 0; step < inBorderWidth && stepBegin < stepEnd; ++step)
+                            {
+                                for (uint32 pixelIdx = stepBegin; pixelIdx < stepEnd; ++pixelIdx)
+                                {
+                                    const uint32 pixelRow = pixelIdx < numExceedances ? rows[offsets[clusterIdx] + pixelIdx] : border[pixelIdx - numExceedances] / numCols;
+                                    const uint32 pixelCol = pixelIdx < numExceedances ? cols[offsets[clusterIdx] + pixelIdx] : border[pixelIdx - numExceedances] % numCols;
+
+                                    const uint32 rowEnd = std::min(pixelRow + 2, numRows);
+                                    const uint32 colEnd = std::min(pixelCol + 2, numCols);
+                                    for (uint32 row = pixelRow - std::min<uint32>(pixelRow, 1); row < rowEnd; ++row)
+                                    {
+                                        for (uint32 col = pixelCol - std::min<uint32>(pixelCol, 1); col < colEnd; ++col)
+                                        {
+                                            if (!cluster.get(row - rowBegin, col - colBegin) && !xcds_->operator()(row, col))
+                                            {
+                                                cluster.set(row - rowBegin, col - colBegin);
+                                                border.push_back(row * numCols + col);
+                                            }
+                                        }
+                                    }
+                                }
+
+                                stepBegin = stepEnd;
+                                stepEnd = numExceedances + static_cast<uint32>(border.size());
+                            }
+                        }
+                    });
+
+                // append the border of each cluster after its pixels
+                std::vector<uint32> newOffsets(numClusters + 1, 0);
+                for (uint32 clusterIdx = 0; clusterIdx < numClusters; ++clusterIdx)
+                {
+                    newOffsets[clusterIdx + 1] = newOffsets[clusterIdx] + store_.clusterSize(clusterIdx) + static_cast<uint32>(borders[clusterIdx].size());
+                }
+
+                std::vector<uint32> newRows(newOffsets[numClusters]);
+                std::vector<uint32> newCols(newOffsets[numClusters]);
+                std::vector<dtype> newIntensities(newOffsets[numClusters]);
+                ClusterStore::forEachClusterChunk(numClusters, parallel_,
+                    [&](uint32 inFirstCluster, uint32 inEndCluster)
+                    {
+                        for (uint32 clusterIdx = inFirstCluster; clusterIdx < inEndCluster; ++clusterIdx)
                         {
-                            if (find(theCluster.begin(), theCluster.end(), *newPixelIter) == theCluster.end())
+                            uint32 newIdx = newOffsets[clusterIdx];
+                            for (uint32 i = offsets[clusterIdx]; i < offsets[clusterIdx + 1]; ++i, ++newIdx)
                             {
-                                theCluster.addPixel(*newPixelIter);
+                                newRows[newIdx] = rows[i];
+                                newCols[newIdx] = cols[i];
+                                newIntensities[newIdx] = store_.intensities_[i];
+                            }
+
+                            const std::vector<uint32>& border = borders[clusterIdx];
+                            for (uint32 i = 0; i < border.size(); ++i, ++newIdx)
+                            {
+                                newRows[newIdx] = border[i] / numCols;
+                                newCols[newIdx] = border[i] % numCols;
+                                newIntensities[newIdx] = intensities_->operator[](border[i]);
                             }
                         }
-                    }
+                    });
+
+                store_.offsets_.swap(newOffsets);
+                store_.rows_.swap(newRows);
+                store_.cols_.swap(newCols);
+                store_.intensities_.swap(newIntensities);
+                store_.finalize(parallel_);
+            }
+
+            //=============================================================================
+            // Description:
+            ///              builds the Cluster objects from the store the first time
+            ///              they are asked for
+            ///
+            /// @param
+            ///              None
+            ///
+            /// @return
+            ///              std::vector<Cluster>
+            ///
+            const std::vector<Cluster>& clusters() const
+            {
+                if (!clustersBuilt_)
+                {
+                    clusters_ = store_.clusters(parallel_);
+                    clustersBuilt_ = true;
                 }
+
+                return clusters_;
             }
 
         public:
@@ -942,13 +1679,17 @@ namespace NumCpp
             /// @param              NdArray<bool>*, pointer to exceedance array
             /// @param              NdArray<dtype>*, pointer to intensity array
             /// @param				border to apply around exceedance pixels post clustering, default 0
+            /// @param				label the exceedances in parallel tiles, default false
             /// 
             /// @return 
             ///              None
             ///
-            ClusterMaker(const NdArray<bool>* const inXcdArrayPtr, const NdArray<dtype>* const inIntensityArrayPtr, uint8 inBorderWidth = 0) :
+            ClusterMaker(const NdArray<bool>* const inXcdArrayPtr, const NdArray<dtype>* const inIntensityArrayPtr, uint8 inBorderWidth = 0,
+                bool inParallel = false) :
                 xcds_(inXcdArrayPtr),
-                intensities_(inIntensityArrayPtr)
+                intensities_(inIntensityArrayPtr),
+                parallel_(inParallel),
+                clustersBuilt_(false)
             {
                 if (xcds_->shape() != intensities_->shape())
                 {
@@ -957,24 +1698,11 @@ namespace NumCpp
 
                 shape_ = xcds_->shape();
 
-                // convert the NdArray of booleans to a vector of exceedances
-                for (uint32 row = 0; row < shape_.rows; ++row)
-                {
-                    for (uint32 col = 0; col < shape_.cols; ++col)
-                    {
-                        if (xcds_->operator()(row, col))
-                        {
-                            Pixel thePixel(row, col, intensities_->operator()(row, col));
-                            xcdsVec_.push_back(thePixel);
-                        }
-                    }
-                }
-
                 runClusterMaker();
 
-                for (uint8 i = 0; i < inBorderWidth; ++i)
+                if (inBorderWidth > 0)
                 {
-                    expandClusters();
+                    expandClusters(inBorderWidth);
                 }
             }
 
@@ -988,9 +1716,9 @@ namespace NumCpp
             /// @return 
             ///              number of clusters
             ///
-            uint32 size()
+            uint32 size() const
             {
-                return static_cast<uint32>(clusters_.size());
+                return store_.size();
             }
 
             //=============================================================================
@@ -1005,7 +1733,7 @@ namespace NumCpp
             ///
             const Cluster& operator[](uint32 inIndex) const
             {
-                return clusters_[inIndex];
+                return clusters()[inIndex];
             }
 
             //=============================================================================
@@ -1020,11 +1748,11 @@ namespace NumCpp
             ///
             const Cluster& at(uint32 inIndex) const
             {
-                if (inIndex >= clusters_.size())
+                if (inIndex >= size())
                 {
                     throw std::invalid_argument("ERROR: ImageProcessing::ClusterMaker::at: index exceeds cluster size.");
                 }
-                return clusters_[inIndex];
+                return clusters()[inIndex];
             }
 
             //=============================================================================
@@ -1039,7 +1767,7 @@ namespace NumCpp
             ///
             const_iterator begin() const
             {
-                return clusters_.cbegin();
+                return clusters().cbegin();
             }
 
             //=============================================================================
@@ -1054,7 +1782,42 @@ namespace NumCpp
             ///
             const_iterator end() const
             {
-                return clusters_.cend();
+                return clusters().cend();
+            }
+
+            //=============================================================================
+            // Description:
+            ///              returns the clusters in structure of arrays form
+            ///
+            /// @param
+            ///              None
+            ///
+            /// @return
+            ///              ClusterStore
+            ///
+            const ClusterStore& store() const
+            {
+                return store_;
+            }
+
+            //=============================================================================
+            // Description:
+            ///              moves the clusters out in structure of arrays form, leaving
+            ///              the ClusterMaker empty
+            ///
+            /// @param
+            ///              None
+            ///
+            /// @return
+            ///              ClusterStore
+            ///
+            ClusterStore releaseStore()
+            {
+                ClusterStore store;
+                std::swap(store, store_);
+                clusters_.clear();
+                clustersBuilt_ = false;
+                return std::move(store);
             }
         };
 
@@ -1082,22 +1845,70 @@ namespace NumCpp
             /// @return 
             ///              None
             ///
-            void centerOfMass(const Cluster& inCluster)
+            void centerOfMass(const Cluster& inCluster)
+            {
+                Shape clusterShape(inCluster.height(), inCluster.width());
+                NdArray<dtype> clusterArray(clusterShape);
+                clusterArray.zeros();
+
+                uint32 rowMin = inCluster.rowMin();
+                uint32 colMin = inCluster.colMin();
+                dtype intensity = inCluster.intensity();
+
+                auto iter = inCluster.begin();
+                for (; iter < inCluster.end(); ++iter)
+                {
+                    clusterArray(iter->row() - rowMin, iter->col() - colMin) = iter->intensity();
+                }
+
+                centerOfMass(clusterArray, rowMin, colMin, intensity);
+            }
+
+            //=============================================================================
+            // Description:
+            ///              center of mass algorithm for a cluster of a ClusterStore
+            /// 
+            /// @param               ClusterStore
+            /// @param               cluster index
+            /// 
+            /// @return 
+            ///              None
+            ///
+            void centerOfMass(const ClusterStore& inStore, uint32 inIndex)
             {
-                Shape clusterShape(inCluster.height(), inCluster.width());
+                Shape clusterShape(inStore.height(inIndex), inStore.width(inIndex));
                 NdArray<dtype> clusterArray(clusterShape);
                 clusterArray.zeros();
 
-                uint32 rowMin = inCluster.rowMin();
-                uint32 colMin = inCluster.colMin();
-                dtype intensity = inCluster.intensity();
-
-                auto iter = inCluster.begin();
-                for (; iter < inCluster.end(); ++iter)
+                const uint32 rowMin = inStore.rowMin(inIndex);
+                const uint32 colMin = inStore.colMin(inIndex);
+                const std::vector<uint32>& rows = inStore.rows();
+                const std::vector<uint32>& cols = inStore.cols();
+                const std::vector<dtype>& intensities = inStore.intensities();
+                for (uint32 i = inStore.offsets()[inIndex]; i < inStore.offsets()[inIndex + 1]; ++i)
                 {
-                    clusterArray(iter->row() - rowMin, iter->col() - colMin) = iter->intensity();
+                    clusterArray(rows[i] - rowMin, cols[i] - colMin) = intensities[i];
                 }
 
+                centerOfMass(clusterArray, rowMin, colMin, inStore.intensity(inIndex));
+            }
+
+            //=============================================================================
+            // Description:
+            ///              center of mass of a cluster laid out over its bounding box
+            /// 
+            /// @param               cluster pixel intensities over the bounding box
+            /// @param               minimum row of the bounding box
+            /// @param               minimum column of the bounding box
+            /// @param               summed cluster intensity
+            /// 
+            /// @return 
+            ///              None
+            ///
+            void centerOfMass(const NdArray<dtype>& clusterArray, uint32 rowMin, uint32 colMin, dtype intensity)
+            {
+                const Shape clusterShape = clusterArray.shape();
+
                 // first get the row center
                 row_ = 0;
                 uint32 row = rowMin;
@@ -1170,6 +1981,44 @@ namespace NumCpp
                 centerOfMass(inCluster);
             }
 
+            //=============================================================================
+            // Description:
+            ///              constructor from a cluster of a ClusterStore
+            /// 
+            /// @param               ClusterStore
+            /// @param               cluster index
+            /// 
+            /// @return 
+            ///              None
+            ///
+            Centroid(const ClusterStore& inStore, uint32 inIndex) :
+                row_(0),
+                col_(0),
+                intensity_(inStore.intensity(inIndex)),
+                eod_(inStore.eod(inIndex))
+            {
+                centerOfMass(inStore, inIndex);
+            }
+
+            //=============================================================================
+            // Description:
+            ///              constructor from an already computed center of mass
+            /// 
+            /// @param               FP row,
+            /// @param               FP column,
+            /// @param               centroid intensity
+            /// @param               cluster EOD
+            /// 
+            /// @return 
+            ///              None
+            ///
+            Centroid(double inRow, double inCol, dtype inIntensity, double inEod) :
+                row_(inRow),
+                col_(inCol),
+                intensity_(inIntensity),
+                eod_(inEod)
+            {}
+
             //=============================================================================
             // Description:
             ///              gets the centroid row
@@ -1327,6 +2176,311 @@ namespace NumCpp
             }
         };
 
+        private:
+        //=============================================================================
+        // Class Description:
+        ///              Running center of mass sums of a cluster, everything a Centroid 
+        ///              needs without keeping the pixels
+        struct Moments
+        {
+            dtype       intensity;
+            dtype       peakPixelIntensity;
+            double      rowSum;
+            double      colSum;
+
+            //=============================================================================
+            // Description:
+            ///              constructor from the first pixel of a cluster
+            /// 
+            /// @param               pixel row,
+            /// @param               pixel column,
+            /// @param               pixel intensity
+            /// 
+            /// @return 
+            ///              None
+            ///
+            Moments(uint32 inRow, uint32 inCol, dtype inIntensity) :
+                intensity(0),
+                peakPixelIntensity(0),
+                rowSum(0),
+                colSum(0)
+            {
+                addPixel(inRow, inCol, inIntensity);
+            }
+
+            //=============================================================================
+            // Description:
+            ///              adds a pixel, with the same arithmetic as Cluster::addPixel
+            /// 
+            /// @param               pixel row,
+            /// @param               pixel column,
+            /// @param               pixel intensity
+            /// 
+            /// @return 
+            ///              None
+            ///
+            void addPixel(uint32 inRow, uint32 inCol, dtype inIntensity)
+            {
+                intensity += inIntensity;
+                if (inIntensity > peakPixelIntensity)
+                {
+                    peakPixelIntensity = inIntensity;
+                }
+                rowSum += static_cast<double>(inIntensity) * static_cast<double>(inRow);
+                colSum += static_cast<double>(inIntensity) * static_cast<double>(inCol);
+            }
+
+            //=============================================================================
+            // Description:
+            ///              adds the sums of another part of the same cluster
+            /// 
+            /// @param               Moments
+            /// 
+            /// @return 
+            ///              None
+            ///
+            void merge(const Moments& inOther)
+            {
+                intensity += inOther.intensity;
+                if (inOther.peakPixelIntensity > peakPixelIntensity)
+                {
+                    peakPixelIntensity = inOther.peakPixelIntensity;
+                }
+                rowSum += inOther.rowSum;
+                colSum += inOther.colSum;
+            }
+
+            //=============================================================================
+            // Description:
+            ///              the centroid of the cluster
+            /// 
+            /// @param 
+            ///              None
+            /// 
+            /// @return 
+            ///              Centroid
+            ///
+            Centroid centroid() const
+            {
+                const double dIntensity = static_cast<double>(intensity);
+                return Centroid(rowSum / dIntensity, colSum / dIntensity, intensity,
+                    static_cast<double>(peakPixelIntensity) / dIntensity);
+            }
+        };
+
+        //============================================================================
+        // Method Description: 
+        ///						Merges the sets of two provisional labels and their moments,
+        ///						the smaller root becomes the root of both
+        ///		
+        /// @param				union-find parent of each provisional label
+        /// @param				moments of each root label
+        /// @param				provisional label
+        /// @param				provisional label
+        /// @return
+        ///				root label of the merged set
+        ///
+        static uint32 mergeLabels(std::vector<uint32>& ioParents, std::vector<Moments>& ioMoments, uint32 inLabel1, uint32 inLabel2)
+        {
+            uint32 root1 = findRoot(ioParents, inLabel1);
+            uint32 root2 = findRoot(ioParents, inLabel2);
+            if (root1 == root2)
+            {
+                return root1;
+            }
+
+            if (root2 < root1)
+            {
+                std::swap(root1, root2);
+            }
+            ioParents[root2] = root1;
+            ioMoments[root1].merge(ioMoments[root2]);
+            return root1;
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Labels a band of rows 8-connected in one streaming pass,
+        ///						keeping only the labels of the previous row, and sums the
+        ///						moments of each provisional label as it goes. The labels of
+        ///						the first and last rows are kept to stitch the bands together.
+        ///		
+        /// @param				NdArray
+        /// @param				function filling the exceedance flags of a row
+        /// @param				first row of the band
+        /// @param				number of rows in the band
+        /// @param				union-find parent of each provisional label
+        /// @param				moments of each provisional label
+        /// @param				labels of the first row of the band
+        /// @param				labels of the last row of the band
+        /// @return
+        ///				None
+        ///
+        template<typename RowMask>
+        static void momentsBand(const NdArray<dtype>& inImageArray, const RowMask& inRowMask, uint32 inFirstRow, uint32 inNumRows,
+            std::vector<uint32>& outParents, std::vector<Moments>& outMoments, std::vector<uint32>& outFirstRowLabels,
+            std::vector<uint32>& outLastRowLabels)
+        {
+            const uint32 numCols = inImageArray.shape().cols;
+            std::vector<uint8> xcds(numCols);
+            std::vector<uint32> previousLabels(numCols, 0);
+            std::vector<uint32> labels(numCols, 0);
+
+            // label 0 is the background
+            outParents.assign(1, 0);
+            outMoments.assign(1, Moments(0, 0, 0));
+            for (uint32 row = inFirstRow; row < inFirstRow + inNumRows; ++row)
+            {
+                inRowMask(row, &xcds[0]);
+                typename NdArray<dtype>::const_iterator intensities = inImageArray.cbegin() + row * numCols;
+                for (uint32 col = 0; col < numCols; ++col)
+                {
+                    if (!xcds[col])
+                    {
+                        labels[col] = 0;
+                        continue;
+                    }
+
+                    // merge with the labeled neighbors above and to the left
+                    uint32 label = 0;
+                    if (row > inFirstRow)
+                    {
+                        const uint32 colEnd = std::min(col + 2, numCols);
+                        for (uint32 neighborCol = col > 0 ? col - 1 : col; neighborCol < colEnd; ++neighborCol)
+                        {
+                            if (previousLabels[neighborCol] != 0)
+                            {
+                                label = label == 0 ? findRoot(outParents, previousLabels[neighborCol]) :
+                                    mergeLabels(outParents, outMoments, label, previousLabels[neighborCol]);
+                            }
+                        }
+                    }
+
+                    if (col > 0 && labels[col - 1] != 0)
+                    {
+                        label = label == 0 ? findRoot(outParents, labels[col - 1]) :
+                            mergeLabels(outParents, outMoments, label, labels[col - 1]);
+                    }
+
+                    if (label == 0)
+                    {
+                        label = static_cast<uint32>(outParents.size());
+                        outParents.push_back(label);
+                        outMoments.push_back(Moments(row, col, intensities[col]));
+                    }
+                    else
+                    {
+                        outMoments[label].addPixel(row, col, intensities[col]);
+                    }
+                    labels[col] = label;
+                }
+
+                if (row == inFirstRow)
+                {
+                    outFirstRowLabels = labels;
+                }
+                previousLabels.swap(labels);
+            }
+            outLastRowLabels.swap(previousLabels);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Centroids the 8-connected clusters of exceedances without
+        ///						building their pixel lists. The rows are labeled in bands,
+        ///						on the TileExecutor if parallel, and the bands are stitched
+        ///						together along their seams. Labels are only ever merged into
+        ///						the smaller one, so the surviving roots come out in the order
+        ///						of the clusters' first pixels, the same order clusterPixels
+        ///						numbers them in.
+        ///		
+        /// @param				NdArray
+        /// @param				function filling the exceedance flags of a row
+        /// @param				label the rows in parallel bands
+        /// @return
+        ///				std::vector<Centroid>
+        ///
+        template<typename RowMask>
+        static std::vector<Centroid> fusedCentroids(const NdArray<dtype>& inImageArray, const RowMask& inRowMask, bool inParallel)
+        {
+            const Shape inShape = inImageArray.shape();
+            std::vector<Centroid> centroids;
+            if (inShape.size() == 0)
+            {
+                return centroids;
+            }
+
+            uint32 rowsPerBand = inShape.rows;
+            if (inParallel)
+            {
+                const uint32 numBands = std::max(4 * TileExecutor::numThreads(), static_cast<uint32>(1));
+                rowsPerBand = std::max((inShape.rows + numBands - 1) / numBands, static_cast<uint32>(16));
+            }
+            const uint32 numBands = (inShape.rows + rowsPerBand - 1) / rowsPerBand;
+
+            std::vector<std::vector<uint32> > bandParents(numBands);
+            std::vector<std::vector<Moments> > bandMoments(numBands);
+            std::vector<std::vector<uint32> > firstRowLabels(numBands);
+            std::vector<std::vector<uint32> > lastRowLabels(numBands);
+            TileExecutor::forEachRowTile(inShape.rows, rowsPerBand,
+                [&](uint32 inFirstRow, uint32 inNumRows)
+                {
+                    const uint32 band = inFirstRow / rowsPerBand;
+                    momentsBand(inImageArray, inRowMask, inFirstRow, inNumRows, bandParents[band], bandMoments[band],
+                        firstRowLabels[band], lastRowLabels[band]);
+                });
+
+            // gather the provisional labels of all of the bands, band by band in raster order
+            std::vector<uint32> labelOffsets(numBands, 0);
+            std::vector<uint32> parents(1, 0);
+            std::vector<Moments> moments(1, Moments(0, 0, 0));
+            for (uint32 band = 0; band < numBands; ++band)
+            {
+                const uint32 offset = static_cast<uint32>(parents.size()) - 1;
+                labelOffsets[band] = offset;
+                for (uint32 label = 1; label < bandParents[band].size(); ++label)
+                {
+                    parents.push_back(bandParents[band][label] + offset);
+                }
+                moments.insert(moments.end(), bandMoments[band].begin() + 1, bandMoments[band].end());
+            }
+
+            // merge the clusters that cross the seams between the bands
+            for (uint32 band = 1; band < numBands; ++band)
+            {
+                const std::vector<uint32>& above = lastRowLabels[band - 1];
+                const std::vector<uint32>& below = firstRowLabels[band];
+                for (uint32 col = 0; col < inShape.cols; ++col)
+                {
+                    if (below[col] == 0)
+                    {
+                        continue;
+                    }
+
+                    const uint32 colEnd = std::min(col + 2, inShape.cols);
+                    for (uint32 neighborCol = col > 0 ? col - 1 : col; neighborCol < colEnd; ++neighborCol)
+                    {
+                        if (above[neighborCol] != 0)
+                        {
+                            mergeLabels(parents, moments, below[col] + labelOffsets[band], above[neighborCol] + labelOffsets[band - 1]);
+                        }
+                    }
+                }
+            }
+
+            for (uint32 label = 1; label < parents.size(); ++label)
+            {
+                if (parents[label] == label)
+                {
+                    centroids.push_back(moments[label].centroid());
+                }
+            }
+
+            return std::move(centroids);
+        }
+
+        public:
+
         //============================================================================
         // Method Description: 
         ///						Applies a threshold to an image
@@ -1363,6 +2517,95 @@ namespace NumCpp
             return std::move(centroids);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Center of Mass centroids the clusters of a ClusterStore, the
+        ///						same centroids as centroidClusters gives for its Clusters
+        ///		
+        /// @param				ClusterStore
+        /// @param				centroid the clusters in parallel on the TileExecutor, default false
+        /// @return
+        ///				std::vector<Centroid>
+        ///
+        static std::vector<Centroid> centroidClusterStore(const ClusterStore& inStore, bool inParallel = false)
+        {
+            const uint32 numClusters = inStore.size();
+            std::vector<Centroid> centroids(numClusters);
+
+            const uint32 numTasks = inParallel ? std::min(numClusters, 4 * TileExecutor::numThreads()) : 1;
+            TileExecutor::parallelFor(numTasks,
+                [&](uint32 inTask)
+                {
+                    const uint32 clusterEnd = static_cast<uint32>((static_cast<uint64>(inTask) + 1) * numClusters / numTasks);
+                    for (uint32 i = static_cast<uint32>(static_cast<uint64>(inTask) * numClusters / numTasks); i < clusterEnd; ++i)
+                    {
+                        centroids[i] = Centroid(inStore, i);
+                    }
+                });
+
+            return std::move(centroids);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Centroids the clusters of exceedance pixels directly, the
+        ///						same as centroidClusters(clusterPixels(...)) without building
+        ///						the Cluster pixel lists. Only the running center of mass sums
+        ///						of each cluster are kept, so for floating point images the
+        ///						centroids may differ in the last bits.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray of exceedances
+        /// @param				label the exceedances in parallel tiles on the TileExecutor, default false
+        /// @return
+        ///				std::vector<Centroid>
+        ///
+        static std::vector<Centroid> centroidExceedances(const NdArray<dtype>& inImageArray, const NdArray<bool>& inExceedances,
+            bool inParallel = false)
+        {
+            if (inExceedances.shape() != inImageArray.shape())
+            {
+                throw std::invalid_argument("ERROR: ImageProcessing::centroidExceedances: input xcd and intensity arrays must be the same shape.");
+            }
+
+            const uint32 numCols = inImageArray.shape().cols;
+            return std::move(fusedCentroids(inImageArray,
+                [&](uint32 inRow, uint8* outXcds)
+                {
+                    typename NdArray<bool>::const_iterator xcds = inExceedances.cbegin() + inRow * numCols;
+                    for (uint32 col = 0; col < numCols; ++col)
+                    {
+                        outXcds[col] = xcds[col] ? 1 : 0;
+                    }
+                }, inParallel));
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Thresholds an image, clusters the exceedances and centroids
+        ///						the clusters in a single streaming pass, without an exceedance
+        ///						array or Cluster objects. See centroidExceedances.
+        ///		
+        /// @param				NdArray
+        /// @param				threshold value
+        /// @param				label the exceedances in parallel tiles on the TileExecutor, default false
+        /// @return
+        ///				std::vector<Centroid>
+        ///
+        static std::vector<Centroid> centroidThreshold(const NdArray<dtype>& inImageArray, dtype inThreshold, bool inParallel = false)
+        {
+            const uint32 numCols = inImageArray.shape().cols;
+            return std::move(fusedCentroids(inImageArray,
+                [&](uint32 inRow, uint8* outXcds)
+                {
+                    typename NdArray<dtype>::const_iterator intensities = inImageArray.cbegin() + inRow * numCols;
+                    for (uint32 col = 0; col < numCols; ++col)
+                    {
+                        outXcds[col] = intensities[col] > inThreshold ? 1 : 0;
+                    }
+                }, inParallel));
+        }
+
         //============================================================================
         // Method Description: 
         ///						Clusters exceedance pixels from an image
@@ -1370,13 +2613,35 @@ namespace NumCpp
         /// @param				NdArray
         /// @param				NdArray of exceedances
         /// @param				border to apply around exceedance pixels post clustering, default 0
+        /// @param				label the exceedances in parallel tiles on the TileExecutor, default false
         /// @return
         ///				std::vector<Cluster>
         ///
-        static std::vector<Cluster> clusterPixels(const NdArray<dtype>& inImageArray, const NdArray<bool>& inExceedances, uint8 inBorderWidth = 0)
+        static std::vector<Cluster> clusterPixels(const NdArray<dtype>& inImageArray, const NdArray<bool>& inExceedances, uint8 inBorderWidth = 0,
+            bool inParallel = false)
+        {
+            ClusterMaker clusterMaker(&inExceedances, &inImageArray, inBorderWidth, inParallel);
+            return std::move(clusterMaker.store().clusters(inParallel));
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Clusters exceedance pixels from an image into a ClusterStore,
+        ///						the same clusters as clusterPixels without a Pixel object
+        ///						per pixel
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray of exceedances
+        /// @param				border to apply around exceedance pixels post clustering, default 0
+        /// @param				label the exceedances in parallel tiles on the TileExecutor, default false
+        /// @return
+        ///				ClusterStore
+        ///
+        static ClusterStore clusterStore(const NdArray<dtype>& inImageArray, const NdArray<bool>& inExceedances, uint8 inBorderWidth = 0,
+            bool inParallel = false)
         {
-            ClusterMaker clusterMaker(&inExceedances, &inImageArray, inBorderWidth);
-            return std::move(std::vector<Cluster>(clusterMaker.begin(), clusterMaker.end()));
+            ClusterMaker clusterMaker(&inExceedances, &inImageArray, inBorderWidth, inParallel);
+            return std::move(clusterMaker.releaseStore());
         }
 
         //============================================================================
@@ -1388,10 +2653,12 @@ namespace NumCpp
         /// @param				exceedance rate
         /// @param              string "pre", or "post" for where to apply the exceedance windowing
         /// @param				border to apply, default 0
+        /// @param				label the exceedances in parallel tiles on the TileExecutor, default false
         /// @return
         ///				std::vector<Centroid>
         ///
-        static std::vector<Centroid> generateCentroids(const NdArray<dtype>& inImageArray, double inRate, const std::string inWindowType, uint8 inBorderWidth = 0)
+        static std::vector<Centroid> generateCentroids(const NdArray<dtype>& inImageArray, double inRate, const std::string inWindowType, uint8 inBorderWidth = 0,
+            bool inParallel = false)
         {
             uint8 borderWidthPre = 0;
             uint8 borderWidthPost = 0;
@@ -1411,6 +2678,12 @@ namespace NumCpp
             // generate the threshold
             dtype threshold = generateThreshold(inImageArray, inRate);
 
+            // without a border the threshold, clustering and centroiding are one pass
+            if (inBorderWidth == 0)
+            {
+                return std::move(centroidThreshold(inImageArray, threshold, inParallel));
+            }
+
             // apply the threshold to get xcds
             NdArray<bool> xcds = applyThreshold(inImageArray, threshold);
 
@@ -1418,13 +2691,14 @@ namespace NumCpp
             if (borderWidthPre > 0)
             {
                 xcds = windowExceedances(xcds, borderWidthPre);
+                return std::move(centroidExceedances(inImageArray, xcds, inParallel));
             }
 
-            // cluster the exceedances
-            std::vector<Cluster> clusters = clusterPixels(inImageArray, xcds, borderWidthPost);
+            // the post border grows each cluster from its own pixels, so it needs the clusters
+            ClusterStore clusters = clusterStore(inImageArray, xcds, borderWidthPost, inParallel);
 
             // centroid the clusters
-            return std::move(centroidClusters(clusters));
+            return std::move(centroidClusterStore(clusters, inParallel));
         }
 
         //============================================================================
@@ -1530,7 +2804,8 @@ namespace NumCpp
 
         //============================================================================
         // Method Description: 
-        ///						Window expand around exceedance pixels
+        ///						Window expand around exceedance pixels, every pixel within
+        ///						a (2 * border + 1) square of an exceedance is set
         ///		
         /// @param				NdArray<bool>
         /// @param				border width
@@ -1539,33 +2814,7 @@ namespace NumCpp
         ///
         static NdArray<bool> windowExceedances(const NdArray<bool>& inExceedances, uint8 inBorderWidth)
         {
-            // not the most efficient way to do things, but the easist...
-            NdArray<bool> xcds(inExceedances);
-            Shape inShape = xcds.shape();
-            for (uint8 border = 0; border < inBorderWidth; ++border)
-            {
-                for (int32 row = 0; row < static_cast<int32>(inShape.rows); ++row)
-                {
-                    for (int32 col = 0; col < static_cast<int32>(inShape.cols); ++col)
-                    {
-                        if (inExceedances(row, col))
-                        {
-                            xcds(std::max(row - 1, 0), std::max(col - 1, 0)) = true;
-                            xcds(std::max(row - 1, 0), col) = true;
-                            xcds(std::max(row - 1, 0), std::min<int32>(col + 1, inShape.cols - 1)) = true;
-
-                            xcds(row, std::max<int32>(col - 1, 0)) = true;
-                            xcds(row, std::min<int32>(col + 1, inShape.cols - 1)) = true;
-
-                            xcds(std::min<int32>(row + 1, inShape.rows - 1), std::max(col - 1, 0)) = true;
-                            xcds(std::min<int32>(row + 1, inShape.rows - 1), col) = true;
-                            xcds(std::min<int32>(row + 1, inShape.rows - 1), std::min<int32>(col + 1, inShape.cols - 1)) = true;
-                        }
-                    }
-                }
-            }
-
-            return std::move(xcds);
+            return std::move(Morphology::dilate(inExceedances, inBorderWidth));
         }
     };
 }
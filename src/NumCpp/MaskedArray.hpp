@@ -0,0 +1,609 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+/// @version 1.0
+///
+/// @section LICENSE
+/// Copyright 2018 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software 
+/// without restriction, including without limitation the rights to use, copy, modify, 
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to 
+/// permit persons to whom the Software is furnished to do so, subject to the following 
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies 
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+/// DEALINGS IN THE SOFTWARE.
+///
+/// @section DESCRIPTION
+/// An NdArray paired with a validity bitmap
+///
+#pragma once
+
+#include"NumCpp/NdArray.hpp"
+#include"NumCpp/Shape.hpp"
+#include"NumCpp/Types.hpp"
+
+#include<algorithm>
+#include<bitset>
+#include<cmath>
+#include<limits>
+#include<stdexcept>
+#include<string>
+#include<utility>
+#include<vector>
+
+namespace NumCpp
+{
+    //================================================================================
+    ///						An NdArray paired with a validity bitmap, one bit per element.
+    ///						Reductions only consider the valid elements, similar to
+    ///						numpy.ma.MaskedArray. Following numpy, a mask value of true
+    ///						marks an element as invalid. The data is held by value;
+    ///						pass the NdArray as an rvalue to move it in without a copy.
+    template<typename dtype>
+    class MaskedArray
+    {
+    private:
+        //==============================Attributes====================================
+        NdArray<dtype>          data_;
+        std::vector<uint64>     validBits_;
+
+        static const uint64     ALL_VALID = ~static_cast<uint64>(0);
+
+        //============================================================================
+        ///						Allocates a bitmap with every element valid. The unused
+        ///						bits of the last word are kept cleared.
+        ///		
+        /// @param      None
+        ///
+        /// @return     None
+        ///
+        void initBits()
+        {
+            const uint32 size = data_.size();
+            validBits_.assign((size + 63) / 64, ~static_cast<uint64>(0));
+            if (size % 64 != 0)
+            {
+                validBits_.back() = (static_cast<uint64>(1) << (size % 64)) - 1;
+            }
+        }
+
+        //============================================================================
+        ///						Allocates the bitmap and marks the elements where the mask
+        ///						is true invalid
+        ///		
+        /// @param      mask, true where the element is invalid
+        ///
+        /// @return     None
+        ///
+        void applyMask(const NdArray<bool>& inMask)
+        {
+            if (inMask.shape() != data_.shape())
+            {
+                throw std::invalid_argument("ERROR: MaskedArray: input mask shape is not consistant with the input array.");
+            }
+
+            initBits();
+            for (uint32 i = 0; i < inMask.size(); ++i)
+            {
+                if (inMask[i])
+                {
+                    setValid(i, false);
+                }
+            }
+        }
+
+        //============================================================================
+        ///						Marks the NaN and inf elements invalid
+        ///		
+        /// @param      None
+        ///
+        /// @return     None
+        ///
+        void maskInvalid()
+        {
+            for (uint32 i = 0; i < data_.size(); ++i)
+            {
+                const double value = static_cast<double>(data_[i]);
+                if (value != value || std::abs(value) == std::numeric_limits<double>::infinity())
+                {
+                    setValid(i, false);
+                }
+            }
+        }
+
+        //============================================================================
+        ///						Reduces the valid elements of [inBegin, inEnd) into
+        ///						inAccumulator. Fully valid words are reduced without
+        ///						looking at the bits, fully invalid words are skipped.
+        ///		
+        /// @param      begin flat index
+        /// @param      end flat index
+        /// @param      lane passed through to the function
+        /// @param      accumulator
+        /// @param      function(lane, accumulator, value) returning the new accumulator
+        ///
+        /// @return     accumulator
+        ///
+        template<typename dtypeAcc, typename Function>
+        dtypeAcc reduceRange(uint32 inBegin, uint32 inEnd, uint32 inLane, dtypeAcc inAccumulator, Function inFunction) const
+        {
+            typename NdArray<dtype>::const_iterator data = data_.cbegin();
+            uint32 i = inBegin;
+            while (i < inEnd)
+            {
+                const uint64 word = validBits_[i / 64];
+                const uint32 wordEnd = std::min((i / 64 + 1) * 64, inEnd);
+                if (word == ALL_VALID)
+                {
+                    for (; i < wordEnd; ++i)
+                    {
+                        inAccumulator = inFunction(inLane, inAccumulator, data[i]);
+                    }
+                }
+                else if (word == 0)
+                {
+                    i = wordEnd;
+                }
+                else
+                {
+                    for (; i < wordEnd; ++i)
+                    {
+                        inAccumulator = ((word >> (i % 64)) & 1) ? inFunction(inLane, inAccumulator, data[i]) : inAccumulator;
+                    }
+                }
+            }
+
+            return inAccumulator;
+        }
+
+        //============================================================================
+        ///						Reduces the valid elements of each lane (the whole array,
+        ///						each row, or each column depending on the axis).
+        ///		
+        /// @param      Axis
+        /// @param      initial accumulator value for every lane
+        /// @param      function(lane, accumulator, value) returning the new accumulator
+        ///
+        /// @return     std::vector of the lane accumulators
+        ///
+        template<typename dtypeAcc, typename Function>
+        std::vector<dtypeAcc> reduce(Axis::Type inAxis, dtypeAcc inInitValue, Function inFunction) const
+        {
+            const Shape inShape = data_.shape();
+            switch (inAxis)
+            {
+                case Axis::NONE:
+                {
+                    return std::vector<dtypeAcc>(1, reduceRange(0, data_.size(), 0, inInitValue, inFunction));
+                }
+                case Axis::COL:
+                {
+                    std::vector<dtypeAcc> accumulators(inShape.rows);
+                    for (uint32 row = 0; row < inShape.rows; ++row)
+                    {
+                        accumulators[row] = reduceRange(row * inShape.cols, (row + 1) * inShape.cols, row, inInitValue, inFunction);
+                    }
+
+                    return std::move(accumulators);
+                }
+                case Axis::ROW:
+                {
+                    std::vector<dtypeAcc> accumulators(inShape.cols, inInitValue);
+                    typename NdArray<dtype>::const_iterator data = data_.cbegin();
+                    for (uint32 row = 0; row < inShape.rows; ++row)
+                    {
+                        const uint32 rowStart = row * inShape.cols;
+                        for (uint32 col = 0; col < inShape.cols; ++col)
+                        {
+                            const uint32 i = rowStart + col;
+                            accumulators[col] = ((validBits_[i / 64] >> (i % 64)) & 1) ?
+                                inFunction(col, accumulators[col], data[i]) : accumulators[col];
+                        }
+                    }
+
+                    return std::move(accumulators);
+                }
+                default:
+                {
+                    // this isn't actually possible, just putting this here to get rid
+                    // of the compiler warning.
+                    return std::vector<dtypeAcc>();
+                }
+            }
+        }
+
+        //============================================================================
+        ///						Divides the lane sums by the lane counts
+        ///		
+        /// @param      lane (sum, count) pairs
+        ///
+        /// @return     NdArray
+        ///
+        static NdArray<double> divide(const std::vector<std::pair<double, double> >& inSumCounts)
+        {
+            NdArray<double> returnArray(1, static_cast<uint32>(inSumCounts.size()));
+            for (uint32 i = 0; i < returnArray.size(); ++i)
+            {
+                returnArray[i] = inSumCounts[i].first / inSumCounts[i].second;
+            }
+
+            return std::move(returnArray);
+        }
+
+    public:
+        //============================================================================
+        ///						Constructor, every element is valid
+        ///		
+        /// @param      NdArray
+        ///
+        /// @return     None
+        ///
+        explicit MaskedArray(const NdArray<dtype>& inData) :
+            data_(inData)
+        {
+            initBits();
+        }
+
+        //============================================================================
+        ///						Constructor
+        ///		
+        /// @param      NdArray
+        /// @param      mask, true where the element is invalid
+        ///
+        /// @return     None
+        ///
+        MaskedArray(const NdArray<dtype>& inData, const NdArray<bool>& inMask) :
+            data_(inData)
+        {
+            applyMask(inMask);
+        }
+
+        //============================================================================
+        ///						Constructor, every element is valid. Takes over the
+        ///						input's buffer instead of copying it.
+        ///		
+        /// @param      NdArray, left empty
+        ///
+        /// @return     None
+        ///
+        explicit MaskedArray(NdArray<dtype>&& inData) :
+            data_(std::move(inData))
+        {
+            initBits();
+        }
+
+        //============================================================================
+        ///						Constructor. Takes over the input's buffer instead of
+        ///						copying it.
+        ///		
+        /// @param      NdArray, left empty
+        /// @param      mask, true where the element is invalid
+        ///
+        /// @return     None
+        ///
+        MaskedArray(NdArray<dtype>&& inData, const NdArray<bool>& inMask) :
+            data_(std::move(inData))
+        {
+            applyMask(inMask);
+        }
+
+        //============================================================================
+        ///						Returns a MaskedArray with the NaN and inf elements of the
+        ///						input marked invalid.
+        ///
+        ///                     NumPy Reference: https://docs.scipy.org/doc/numpy/reference/generated/numpy.ma.masked_invalid.html
+        ///		
+        /// @param      NdArray
+        ///
+        /// @return     MaskedArray
+        ///
+        static MaskedArray<dtype> maskedInvalid(const NdArray<dtype>& inData)
+        {
+            MaskedArray<dtype> returnArray(inData);
+            returnArray.maskInvalid();
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        ///						As above, taking over the input's buffer instead of
+        ///						copying it.
+        ///		
+        /// @param      NdArray, left empty
+        ///
+        /// @return     MaskedArray
+        ///
+        static MaskedArray<dtype> maskedInvalid(NdArray<dtype>&& inData)
+        {
+            MaskedArray<dtype> returnArray(std::move(inData));
+            returnArray.maskInvalid();
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        ///						Returns the underlying data
+        ///		
+        /// @param      None
+        ///
+        /// @return     NdArray
+        ///
+        const NdArray<dtype>& data() const
+        {
+            return data_;
+        }
+
+        //============================================================================
+        ///						Returns the shape of the array
+        ///		
+        /// @param      None
+        ///
+        /// @return     Shape
+        ///
+        Shape shape() const
+        {
+            return data_.shape();
+        }
+
+        //============================================================================
+        ///						Returns the size of the array
+        ///		
+        /// @param      None
+        ///
+        /// @return     size
+        ///
+        uint32 size() const
+        {
+            return data_.size();
+        }
+
+        //============================================================================
+        ///						Returns whether the element at the flat index is valid
+        ///		
+        /// @param      flat index
+        ///
+        /// @return     bool
+        ///
+        bool isValid(uint32 inIndex) const
+        {
+            if (inIndex >= data_.size())
+            {
+                throw std::invalid_argument("ERROR: MaskedArray::isValid: input index is greater than the size of the array.");
+            }
+
+            return ((validBits_[inIndex / 64] >> (inIndex % 64)) & 1) != 0;
+        }
+
+        //============================================================================
+        ///						Returns whether the element is valid
+        ///		
+        /// @param      row
+        /// @param      col
+        ///
+        /// @return     bool
+        ///
+        bool isValid(uint32 inRow, uint32 inCol) const
+        {
+            return isValid(inRow * data_.shape().cols + inCol);
+        }
+
+        //============================================================================
+        ///						Marks the element at the flat index valid or invalid
+        ///		
+        /// @param      flat index
+        /// @param      valid
+        ///
+        /// @return     None
+        ///
+        void setValid(uint32 inIndex, bool inValid)
+        {
+            if (inIndex >= data_.size())
+            {
+                throw std::invalid_argument("ERROR: MaskedArray::setValid: input index is greater than the size of the array.");
+            }
+
+            const uint64 bit = static_cast<uint64>(1) << (inIndex % 64);
+            if (inValid)
+            {
+                validBits_[inIndex / 64] |= bit;
+            }
+            else
+            {
+                validBits_[inIndex / 64] &= ~bit;
+            }
+        }
+
+        //============================================================================
+        ///						Marks the element valid or invalid
+        ///		
+        /// @param      row
+        /// @param      col
+        /// @param      valid
+        ///
+        /// @return     None
+        ///
+        void setValid(uint32 inRow, uint32 inCol, bool inValid)
+        {
+            setValid(inRow * data_.shape().cols + inCol, inValid);
+        }
+
+        //============================================================================
+        ///						Returns the mask, true where the element is invalid
+        ///		
+        /// @param      None
+        ///
+        /// @return     NdArray
+        ///
+        NdArray<bool> mask() const
+        {
+            NdArray<bool> returnArray(data_.shape());
+            for (uint32 i = 0; i < returnArray.size(); ++i)
+            {
+                returnArray[i] = ((validBits_[i / 64] >> (i % 64)) & 1) == 0;
+            }
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        ///						Returns a copy of the data with the invalid elements
+        ///						replaced by the fill value.
+        ///
+        ///                     NumPy Reference: https://docs.scipy.org/doc/numpy/reference/generated/numpy.ma.filled.html
+        ///		
+        /// @param      fill value
+        ///
+        /// @return     NdArray
+        ///
+        NdArray<dtype> filled(dtype inFillValue) const
+        {
+            NdArray<dtype> returnArray(data_);
+            for (uint32 i = 0; i < returnArray.size(); ++i)
+            {
+                returnArray[i] = ((validBits_[i / 64] >> (i % 64)) & 1) ? returnArray[i] : inFillValue;
+            }
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        ///						Counts the valid elements along the axis
+        ///		
+        /// @param      (Optional) axis
+        ///
+        /// @return     NdArray
+        ///
+        NdArray<uint32> count(Axis::Type inAxis = Axis::NONE) const
+        {
+            if (inAxis == Axis::NONE)
+            {
+                // the unused bits of the last word are always clear
+                uint32 numValid = 0;
+                for (uint32 i = 0; i < validBits_.size(); ++i)
+                {
+                    numValid += static_cast<uint32>(std::bitset<64>(validBits_[i]).count());
+                }
+
+                NdArray<uint32> returnArray = { numValid };
+                return std::move(returnArray);
+            }
+
+            return std::move(NdArray<uint32>(reduce(inAxis, static_cast<uint32>(0),
+                [](uint32, uint32 inCount, dtype) -> uint32 { return inCount + 1; })));
+        }
+
+        //============================================================================
+        ///						Sum of the valid elements along the axis
+        ///		
+        /// @param      (Optional) axis
+        ///
+        /// @return     NdArray
+        ///
+        template<typename dtypeOut = double>
+        NdArray<dtypeOut> sum(Axis::Type inAxis = Axis::NONE) const
+        {
+            return std::move(NdArray<dtypeOut>(reduce(inAxis, static_cast<dtypeOut>(0),
+                [](uint32, dtypeOut inSum, dtype inValue) -> dtypeOut { return inSum + static_cast<dtypeOut>(inValue); })));
+        }
+
+        //============================================================================
+        ///						Mean of the valid elements along the axis. Lanes without
+        ///						any valid elements are NaN.
+        ///		
+        /// @param      (Optional) axis
+        ///
+        /// @return     NdArray
+        ///
+        NdArray<double> mean(Axis::Type inAxis = Axis::NONE) const
+        {
+            typedef std::pair<double, double> SumCount;
+            return std::move(divide(reduce(inAxis, SumCount(0.0, 0.0),
+                [](uint32, const SumCount& inSumCount, dtype inValue) -> SumCount
+                { return SumCount(inSumCount.first + static_cast<double>(inValue), inSumCount.second + 1.0); })));
+        }
+
+        //============================================================================
+        ///						Variance of the valid elements along the axis. Lanes
+        ///						without any valid elements are NaN.
+        ///		
+        /// @param      (Optional) axis
+        ///
+        /// @return     NdArray
+        ///
+        NdArray<double> var(Axis::Type inAxis = Axis::NONE) const
+        {
+            typedef std::pair<double, double> SumCount;
+            const NdArray<double> meanValues = mean(inAxis);
+            return std::move(divide(reduce(inAxis, SumCount(0.0, 0.0),
+                [&meanValues](uint32 inLane, const SumCount& inSumCount, dtype inValue) -> SumCount
+                {
+                    const double diff = static_cast<double>(inValue) - meanValues[inLane];
+                    return SumCount(inSumCount.first + diff * diff, inSumCount.second + 1.0);
+                })));
+        }
+
+        //============================================================================
+        ///						Standard deviation of the valid elements along the axis.
+        ///						Lanes without any valid elements are NaN.
+        ///		
+        /// @param      (Optional) axis
+        ///
+        /// @return     NdArray
+        ///
+        NdArray<double> std(Axis::Type inAxis = Axis::NONE) const
+        {
+            NdArray<double> returnArray = var(inAxis);
+            for (uint32 i = 0; i < returnArray.size(); ++i)
+            {
+                returnArray[i] = std::sqrt(returnArray[i]);
+            }
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        ///						Minimum of the valid elements along the axis. Lanes
+        ///						without any valid elements are NaN.
+        ///		
+        /// @param      (Optional) axis
+        ///
+        /// @return     NdArray
+        ///
+        NdArray<dtype> min(Axis::Type inAxis = Axis::NONE) const
+        {
+            // a NaN seed fails every comparison so the first valid value replaces it
+            const dtype initValue = std::numeric_limits<dtype>::has_quiet_NaN ?
+                std::numeric_limits<dtype>::quiet_NaN() : std::numeric_limits<dtype>::max();
+
+            return std::move(NdArray<dtype>(reduce(inAxis, initValue,
+                [](uint32, dtype inMin, dtype inValue) -> dtype { return !(inMin <= inValue) ? inValue : inMin; })));
+        }
+
+        //============================================================================
+        ///						Maximum of the valid elements along the axis. Lanes
+        ///						without any valid elements are NaN.
+        ///		
+        /// @param      (Optional) axis
+        ///
+        /// @return     NdArray
+        ///
+        NdArray<dtype> max(Axis::Type inAxis = Axis::NONE) const
+        {
+            const dtype initValue = std::numeric_limits<dtype>::has_quiet_NaN ?
+                std::numeric_limits<dtype>::quiet_NaN() : std::numeric_limits<dtype>::lowest();
+
+            return std::move(NdArray<dtype>(reduce(inAxis, initValue,
+                [](uint32, dtype inMax, dtype inValue) -> dtype { return !(inMax >= inValue) ? inValue : inMax; })));
+        }
+    };
+}
@@ -29,7 +29,10 @@
 #pragma once
 
 #include"NumCpp/Constants.hpp"
+#include"NumCpp/Description.hpp"
+#include"NumCpp/FastMath.hpp"
 #include"NumCpp/NdArray.hpp"
+#include"NumCpp/StridedView.hpp"
 #include"NumCpp/Types.hpp"
 
 #include"boost/filesystem.hpp"
@@ -39,6 +42,9 @@
 #include<fstream>
 #include<initializer_list>
 #include<iostream>
+#include<iterator>
+#include<limits>
+#include<numeric>
 #include<set>
 #include<sstream>
 #include<stdexcept>
@@ -54,6 +60,397 @@ namespace NumCpp
     template<typename dtype>
     class Methods
     {
+    private:
+        //============================================================================
+        // Method Description: 
+        ///						Reduces each lane of the array (the whole array, each row,
+        ///						or each column depending on the axis) with inFunction.
+        ///						Axis::ROW lanes are updated a row at a time so the input is
+        ///						always read contiguously and never transposed or copied.
+        ///		
+        /// @param				NdArray
+        /// @param				Axis
+        /// @param				initial accumulator value for every lane
+        /// @param				function(lane, accumulator, value) returning the new accumulator
+        /// @return
+        ///				std::vector of the lane accumulators
+        ///
+        template<typename dtypeAcc, typename Function>
+        static std::vector<dtypeAcc> reduceLanes(const NdArray<dtype>& inArray, Axis::Type inAxis, dtypeAcc inInitValue, Function inFunction)
+        {
+            const Shape inShape = inArray.shape();
+            switch (inAxis)
+            {
+                case Axis::NONE:
+                {
+                    dtypeAcc accumulator = inInitValue;
+                    typename NdArray<dtype>::const_iterator data = inArray.cbegin();
+                    for (uint32 i = 0; i < inArray.size(); ++i)
+                    {
+                        accumulator = inFunction(0, accumulator, data[i]);
+                    }
+
+                    return std::vector<dtypeAcc>(1, accumulator);
+                }
+                case Axis::COL:
+                {
+                    std::vector<dtypeAcc> accumulators(inShape.rows, inInitValue);
+                    for (uint32 row = 0; row < inShape.rows; ++row)
+                    {
+                        typename NdArray<dtype>::const_iterator rowData = inArray.cbegin(row);
+                        dtypeAcc accumulator = inInitValue;
+                        for (uint32 col = 0; col < inShape.cols; ++col)
+                        {
+                            accumulator = inFunction(row, accumulator, rowData[col]);
+                        }
+                        accumulators[row] = accumulator;
+                    }
+
+                    return std::move(accumulators);
+                }
+                case Axis::ROW:
+                {
+                    std::vector<dtypeAcc> accumulators(inShape.cols, inInitValue);
+                    for (uint32 row = 0; row < inShape.rows; ++row)
+                    {
+                        typename NdArray<dtype>::const_iterator rowData = inArray.cbegin(row);
+                        for (uint32 col = 0; col < inShape.cols; ++col)
+                        {
+                            accumulators[col] = inFunction(col, accumulators[col], rowData[col]);
+                        }
+                    }
+
+                    return std::move(accumulators);
+                }
+                default:
+                {
+                    // this isn't actually possible, just putting this here to get rid
+                    // of the compiler warning.
+                    return std::vector<dtypeAcc>();
+                }
+            }
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Checks that outArray has the reduced shape of the axis: 1x1
+        ///						for Axis::NONE, 1xrows for Axis::COL and 1xcols for Axis::ROW.
+        ///		
+        /// @param				name of the calling function, for the error message
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				Axis
+        /// @return
+        ///				None
+        ///
+        template<typename dtypeOut>
+        static void checkReducedShape(const char* inFunctionName, const NdArray<dtype>& inArray, const NdArray<dtypeOut>& outArray, Axis::Type inAxis)
+        {
+            const Shape inShape = inArray.shape();
+            const uint32 numLanes = inAxis == Axis::COL ? inShape.rows : (inAxis == Axis::ROW ? inShape.cols : 1);
+            if (outArray.shape() != Shape(1, numLanes))
+            {
+                throw std::invalid_argument(std::string("ERROR: ") + inFunctionName + ": output array shape is not consistant with the reduction axis.");
+            }
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						reduceLanes for the output array overloads, each lane's
+        ///						accumulator is passed through inFinish into outArray.
+        ///		
+        /// @param				name of the calling function, for the error message
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				Axis
+        /// @param				initial accumulator value for every lane
+        /// @param				function(lane, accumulator, value) returning the new accumulator
+        /// @param				function(accumulator) returning the lane's result
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut, typename dtypeAcc, typename Function, typename Finish>
+        static NdArray<dtypeOut>& reduceLanes(const char* inFunctionName, const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray,
+            Axis::Type inAxis, dtypeAcc inInitValue, Function inFunction, Finish inFinish)
+        {
+            checkReducedShape(inFunctionName, inArray, outArray, inAxis);
+
+            const std::vector<dtypeAcc> lanes = reduceLanes(inArray, inAxis, inInitValue, inFunction);
+            std::transform(lanes.begin(), lanes.end(), outArray.begin(), inFinish);
+
+            return outArray;
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Calls inFunction(first, last) on the elements of each lane and
+        ///						writes the results into outArray, for reductions that need a
+        ///						lane as a whole. The whole array and its rows are passed in
+        ///						place; the columns are gathered one at a time into a single
+        ///						scratch buffer instead of transposing the input.
+        ///		
+        /// @param				name of the calling function, for the error message
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				Axis
+        /// @param				function(const dtype* first, const dtype* last) returning the lane's result
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut, typename Function>
+        static NdArray<dtypeOut>& reduceLaneRanges(const char* inFunctionName, const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray,
+            Axis::Type inAxis, Function inFunction)
+        {
+            checkReducedShape(inFunctionName, inArray, outArray, inAxis);
+
+            const Shape inShape = inArray.shape();
+            switch (inAxis)
+            {
+                case Axis::NONE:
+                {
+                    outArray[0] = inFunction(inArray.cbegin(), inArray.cend());
+                    return outArray;
+                }
+                case Axis::COL:
+                {
+                    for (uint32 row = 0; row < inShape.rows; ++row)
+                    {
+                        outArray[row] = inFunction(inArray.cbegin(row), inArray.cend(row));
+                    }
+
+                    return outArray;
+                }
+                case Axis::ROW:
+                {
+                    std::vector<dtype> column(inShape.rows);
+                    for (uint32 col = 0; col < inShape.cols; ++col)
+                    {
+                        for (uint32 row = 0; row < inShape.rows; ++row)
+                        {
+                            column[row] = inArray(row, col);
+                        }
+                        outArray[col] = inFunction(column.data(), column.data() + column.size());
+                    }
+
+                    return outArray;
+                }
+                default:
+                {
+                    // this isn't actually possible, just putting this here to get rid
+                    // of the compiler warning.
+                    return outArray;
+                }
+            }
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Population variance of [inFirst, inLast), the mean first and
+        ///						then the squared differences, as NdArray::std does.
+        ///		
+        /// @param				first element
+        /// @param				one past the last element
+        /// @return
+        ///				variance
+        ///
+        static double laneVariance(const dtype* inFirst, const dtype* inLast)
+        {
+            const double size = static_cast<double>(inLast - inFirst);
+            const double meanValue = std::accumulate(inFirst, inLast, 0.0) / size;
+
+            double sum = 0;
+            for (const dtype* value = inFirst; value != inLast; ++value)
+            {
+                sum += Utils<double>::sqr(static_cast<double>(*value) - meanValue);
+            }
+
+            return sum / size;
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Checks the percentile and interpolation method arguments.
+        ///		
+        /// @param				percentile
+        /// @param				interpolation method
+        /// @return
+        ///				None
+        ///
+        static void checkPercentileArgs(double inPercentile, const std::string& inInterpMethod)
+        {
+            if (inPercentile < 0 || inPercentile > 100)
+            {
+                throw std::invalid_argument("ERROR: percentile: input percentile value must be of the range [0, 100].");
+            }
+
+            if (inInterpMethod.compare("linear") != 0 &&
+                inInterpMethod.compare("lower") != 0 &&
+                inInterpMethod.compare("higher") != 0 &&
+                inInterpMethod.compare("nearest") != 0 &&
+                inInterpMethod.compare("midpoint") != 0)
+            {
+                std::string errStr = "ERROR: percentile: input interpolation method is not a vaid option.\n";
+                errStr += "\tValid options are 'linear', 'lower', 'higher', 'nearest', 'midpoint'.";
+                throw std::invalid_argument(errStr);
+            }
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Percentile of values that are already sorted, interpolated
+        ///						between the two values around it as percentile() does.
+        ///		
+        /// @param				sorted values, at least one
+        /// @param				percentile, in the range [0, 100]
+        /// @param				interpolation method
+        /// @return
+        ///				percentile value
+        ///
+        static double sortedPercentile(const std::vector<double>& inSorted, double inPercentile, const std::string& inInterpMethod)
+        {
+            const uint32 size = static_cast<uint32>(inSorted.size());
+            if (size == 1)
+            {
+                return inSorted[0];
+            }
+
+            const int32 i = static_cast<int32>(std::floor(static_cast<double>(size - 1) * inPercentile / 100.0));
+            const uint32 indexLower = static_cast<uint32>(std::min(std::max(i, 0), static_cast<int32>(size) - 2));
+            const double lower = inSorted[indexLower];
+            const double upper = inSorted[indexLower + 1];
+
+            const double percent = inPercentile / 100.0;
+            const double percentLower = static_cast<double>(indexLower) / static_cast<double>(size - 1);
+            const double percentUpper = static_cast<double>(indexLower + 1) / static_cast<double>(size - 1);
+
+            if (inInterpMethod.compare("linear") == 0)
+            {
+                const double fraction = (percent - percentLower) / (percentUpper - percentLower);
+                return lower + (upper - lower) * fraction;
+            }
+            else if (inInterpMethod.compare("higher") == 0)
+            {
+                return upper;
+            }
+            else if (inInterpMethod.compare("nearest") == 0)
+            {
+                // ties go to the lower value
+                return percentUpper - percent < percent - percentLower ? upper : lower;
+            }
+            else if (inInterpMethod.compare("midpoint") == 0)
+            {
+                return (lower + upper) / 2.0;
+            }
+
+            return lower;
+        }
+
+
+        //============================================================================
+        // Method Description: 
+        ///						Returns the shape of the arrays in [inFirst, inLast) joined
+        ///						along the axis, checking that they line up.
+        ///		
+        /// @param				iterator to the first NdArray
+        /// @param				iterator one past the last NdArray
+        /// @param				Axis
+        /// @return
+        ///				Shape
+        ///
+        template<typename Iterator>
+        static Shape stackedShape(Iterator inFirst, Iterator inLast, Axis::Type inAxis)
+        {
+            Shape finalShape;
+            for (Iterator iter = inFirst; iter != inLast; ++iter)
+            {
+                const Shape theShape = iter->shape();
+                switch (inAxis)
+                {
+                    case Axis::NONE:
+                    {
+                        finalShape = Shape(1, finalShape.cols + theShape.size());
+                        break;
+                    }
+                    case Axis::ROW:
+                    {
+                        if (finalShape.isnull())
+                        {
+                            finalShape = theShape;
+                        }
+                        else if (theShape.cols != finalShape.cols)
+                        {
+                            throw std::invalid_argument("ERROR: row_stack: input arrays must have the same number of columns.");
+                        }
+                        else
+                        {
+                            finalShape.rows += theShape.rows;
+                        }
+                        break;
+                    }
+                    case Axis::COL:
+                    {
+                        if (finalShape.isnull())
+                        {
+                            finalShape = theShape;
+                        }
+                        else if (theShape.rows != finalShape.rows)
+                        {
+                            throw std::invalid_argument("ERROR: column_stack: input arrays must have the same number of rows.");
+                        }
+                        else
+                        {
+                            finalShape.cols += theShape.cols;
+                        }
+                        break;
+                    }
+                }
+            }
+
+            return finalShape;
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Copies the arrays in [inFirst, inLast) into outArray, which
+        ///						has already been sized with stackedShape. Every input array is
+        ///						one contiguous block of the output for Axis::NONE and
+        ///						Axis::ROW; for Axis::COL each input row is a contiguous run
+        ///						of an output row.
+        ///		
+        /// @param				iterator to the first NdArray
+        /// @param				iterator one past the last NdArray
+        /// @param				NdArray, output array
+        /// @param				Axis
+        /// @return
+        ///				None
+        ///
+        template<typename Iterator>
+        static void stackCopy(Iterator inFirst, Iterator inLast, NdArray<dtype>& outArray, Axis::Type inAxis)
+        {
+            typename NdArray<dtype>::iterator outData = outArray.begin();
+            if (inAxis != Axis::COL)
+            {
+                for (Iterator iter = inFirst; iter != inLast; ++iter)
+                {
+                    outData = std::copy(iter->cbegin(), iter->cend(), outData);
+                }
+                return;
+            }
+
+            const uint32 outCols = outArray.shape().cols;
+            uint32 colStart = 0;
+            for (Iterator iter = inFirst; iter != inLast; ++iter)
+            {
+                const Shape theShape = iter->shape();
+                typename NdArray<dtype>::const_iterator inData = iter->cbegin();
+                for (uint32 row = 0; row < theShape.rows; ++row)
+                {
+                    std::copy(inData + row * theShape.cols, inData + (row + 1) * theShape.cols, outData + row * outCols + colStart);
+                }
+                colStart += theShape.cols;
+            }
+        }
+
     public:
         //============================================================================
         // Method Description: 
@@ -90,6 +487,33 @@ namespace NumCpp
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Calculate the absolute value element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.absolute.html
+        ///		
+        /// @param
+        ///				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& abs(const NdArray<dtype>& inArray, NdArray<dtype>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: abs: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return static_cast<dtype>(std::abs(inValue)); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Add arguments element-wise.
@@ -107,6 +531,39 @@ namespace NumCpp
             return std::move(inArray1.astype<dtypeOut>() + inArray2.astype<dtypeOut>());
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Add arguments element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the input arrays.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.add.html
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& add(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<dtypeOut>& outArray)
+        {
+            if (inArray1.shape() != inArray2.shape())
+            {
+                throw std::invalid_argument("ERROR: add: input array shapes are not consistant.");
+            }
+
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: add: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
+                [](dtype inValue1, dtype inValue2) { return static_cast<dtypeOut>(inValue1) + static_cast<dtypeOut>(inValue2); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return the length of the first dimension of the input array.
@@ -184,6 +641,26 @@ namespace NumCpp
             return std::move(inArray.max(inAxis));
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Return the maximum of an array or maximum along an axis.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.amax.html
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) Axis
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& amax(const NdArray<dtype>& inArray, NdArray<dtype>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            return max(inArray, outArray, inAxis);
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return the minimum of an array or minimum along an axis.
@@ -200,6 +677,26 @@ namespace NumCpp
             return std::move(inArray.min(inAxis));
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Return the minimum of an array or minimum along an axis.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.amin.html
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) Axis
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& amin(const NdArray<dtype>& inArray, NdArray<dtype>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            return min(inArray, outArray, inAxis);
+        }
+
         //============================================================================
         // Method Description: 
         ///						Test whether any array element along a given axis evaluates to True.
@@ -396,14 +893,43 @@ namespace NumCpp
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> arccos(const NdArray<dtype>& inArray)
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> arccos(const NdArray<dtype>& inArray)
         {
-            NdArray<double> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(), [](dtype inValue) { return std::acos(static_cast<double>(inValue)); });
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            arccos(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Trigonometric inverse cosine, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.arccos.html
+        ///		
+        /// @param
+        ///				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& arccos(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: arccos: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return std::acos(static_cast<dtypeOut>(inValue)); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Trigonometric inverse hyperbolic cosine.
@@ -431,14 +957,43 @@ namespace NumCpp
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> arccosh(const NdArray<dtype>& inArray)
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> arccosh(const NdArray<dtype>& inArray)
         {
-            NdArray<double> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(), [](dtype inValue) { return std::acosh(static_cast<double>(inValue)); });
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            arccosh(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Trigonometric inverse hyperbolic cosine, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.arccosh.html
+        ///		
+        /// @param
+        ///				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& arccosh(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: arccosh: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return std::acosh(static_cast<dtypeOut>(inValue)); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Trigonometric inverse sine.
@@ -466,14 +1021,43 @@ namespace NumCpp
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> arcsin(const NdArray<dtype>& inArray)
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> arcsin(const NdArray<dtype>& inArray)
         {
-            NdArray<double> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(), [](dtype inValue) { return std::asin(static_cast<double>(inValue)); });
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            arcsin(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Trigonometric inverse sine, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.arcsin.html
+        ///		
+        /// @param
+        ///				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& arcsin(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: arcsin: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return std::asin(static_cast<dtypeOut>(inValue)); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Trigonometric inverse hyperbolic sine.
@@ -501,14 +1085,43 @@ namespace NumCpp
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> arcsinh(const NdArray<dtype>& inArray)
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> arcsinh(const NdArray<dtype>& inArray)
         {
-            NdArray<double> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(), [](dtype inValue) { return std::asinh(static_cast<double>(inValue)); });
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            arcsinh(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Trigonometric inverse hyperbolic sine, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.arcsinh.html
+        ///		
+        /// @param
+        ///				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& arcsinh(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: arcsinh: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return std::asinh(static_cast<dtypeOut>(inValue)); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Trigonometric inverse tangent.
@@ -536,14 +1149,44 @@ namespace NumCpp
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> arctan(const NdArray<dtype>& inArray)
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> arctan(const NdArray<dtype>& inArray)
         {
-            NdArray<double> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(), [](dtype inValue) { return std::atan(static_cast<double>(inValue)); });
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            arctan(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Trigonometric inverse tangent, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.arctan.html
+        ///		
+        /// @param
+        ///				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& arctan(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: arctan: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return static_cast<dtypeOut>(inValue); });
+            FastMath<dtypeOut>::arctan(outArray.cbegin(), outArray.cend(), outArray.begin());
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Trigonometric inverse tangent.
@@ -571,18 +1214,68 @@ namespace NumCpp
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> arctan2(const NdArray<dtype>& inY, const NdArray<dtype>& inX)
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> arctan2(const NdArray<dtype>& inY, const NdArray<dtype>& inX)
+        {
+            NdArray<dtypeOut> returnArray(inY.shape());
+            arctan2(inY, inX, returnArray);
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Trigonometric inverse tangent, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the input arrays.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.arctan2.html
+        ///		
+        /// @param				NdArray y
+        /// @param				NdArray x
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& arctan2(const NdArray<dtype>& inY, const NdArray<dtype>& inX, NdArray<dtypeOut>& outArray)
         {
             if (inX.shape() != inY.shape())
             {
                 throw std::invalid_argument("Error: arctan2: input array shapes are not consistant.");
             }
 
-            NdArray<double> returnArray(inY.shape());
-            std::transform(inY.cbegin(), inY.cend(), inX.cbegin(), returnArray.begin(),
-                [](dtype y, dtype x) { return std::atan2(static_cast<double>(y), static_cast<double>(x)); });
+            if (outArray.shape() != inY.shape())
+            {
+                throw std::invalid_argument("ERROR: arctan2: output array shape is not consistant with the input arrays.");
+            }
+
+            // both inputs are converted a block at a time onto the stack before that block of
+            // outArray is written, so outArray may be either input and nothing is allocated
+            const uint32 BLOCK_SIZE = 256;
+            dtypeOut blockY[BLOCK_SIZE];
+            dtypeOut blockX[BLOCK_SIZE];
 
-            return std::move(returnArray);
+            typename NdArray<dtype>::const_iterator yIter = inY.cbegin();
+            typename NdArray<dtype>::const_iterator xIter = inX.cbegin();
+            typename NdArray<dtypeOut>::iterator outIter = outArray.begin();
+            for (uint32 remaining = inY.size(); remaining > 0; )
+            {
+                const uint32 count = std::min(remaining, BLOCK_SIZE);
+                for (uint32 i = 0; i < count; ++i)
+                {
+                    blockY[i] = static_cast<dtypeOut>(yIter[i]);
+                    blockX[i] = static_cast<dtypeOut>(xIter[i]);
+                }
+                FastMath<dtypeOut>::arctan2(blockY, blockY + count, blockX, outIter);
+
+                yIter += count;
+                xIter += count;
+                outIter += count;
+                remaining -= count;
+            }
+
+            return outArray;
         }
 
         //============================================================================
@@ -610,14 +1303,43 @@ namespace NumCpp
         /// @param
         ///				NdArray
         /// @return
-        ///				NdArray
+        ///				NdArray
+        ///
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> arctanh(const NdArray<dtype>& inArray)
+        {
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            arctanh(inArray, returnArray);
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Trigonometric inverse hyperbolic tangent, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.arctanh.html
+        ///		
+        /// @param
+        ///				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
         ///
-        static NdArray<double> arctanh(const NdArray<dtype>& inArray)
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& arctanh(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
         {
-            NdArray<double> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(), [](dtype inValue) { return std::atanh(static_cast<double>(inValue)); });
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: arctanh: output array shape is not consistant with the input array.");
+            }
 
-            return std::move(returnArray);
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return std::atanh(static_cast<dtypeOut>(inValue)); });
+
+            return outArray;
         }
 
         //============================================================================
@@ -636,6 +1358,25 @@ namespace NumCpp
             return std::move(inArray.argmax(inAxis));
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Returns the indices of the maximum values along an axis.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<uint32>& argmax(const NdArray<dtype>& inArray, NdArray<uint32>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            return reduceLaneRanges("argmax", inArray, outArray, inAxis,
+                [](const dtype* inFirst, const dtype* inLast) -> uint32 { return static_cast<uint32>(std::max_element(inFirst, inLast) - inFirst); });
+        }
+
         //============================================================================
         // Method Description: 
         ///						Returns the indices of the minimum values along an axis.
@@ -652,6 +1393,25 @@ namespace NumCpp
             return std::move(inArray.argmin(inAxis));
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Returns the indices of the minimum values along an axis.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<uint32>& argmin(const NdArray<dtype>& inArray, NdArray<uint32>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            return reduceLaneRanges("argmin", inArray, outArray, inAxis,
+                [](const dtype* inFirst, const dtype* inLast) -> uint32 { return static_cast<uint32>(std::min_element(inFirst, inLast) - inFirst); });
+        }
+
         //============================================================================
         // Method Description: 
         ///						Returns the indices that would sort an array.
@@ -717,6 +1477,23 @@ namespace NumCpp
             return std::move(inArray.round(inNumDecimals));
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Evenly round to the given number of decimals.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) number of decimals
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& around(const NdArray<dtype>& inArray, NdArray<dtype>& outArray, uint8 inNumDecimals = 0)
+        {
+            return round(inArray, inNumDecimals, outArray);
+        }
+
         //============================================================================
         // Method Description: 
         ///						True if two arrays have the same shape and elements, False otherwise.
@@ -809,16 +1586,45 @@ namespace NumCpp
         //============================================================================
         // Method Description: 
         ///						Returns a copy of the array, cast to a specified type.
+        ///						Floating point values converted to integers can be rounded to
+        ///						the nearest integer, and out of range values can be saturated
+        ///						to the min/max of the new type.
         ///		
-        /// @param
-        ///				NdArray
+        /// @param				NdArray
+        /// @param				(Optional) rounding, default Rounding::TRUNCATE
+        /// @param				(Optional) saturate, default false
         /// @return
         ///				NdArray
         ///
         template<typename dtypeOut = double>
-        static NdArray<dtypeOut> astype(const NdArray<dtype> inArray)
+        static NdArray<dtypeOut> astype(const NdArray<dtype>& inArray, Rounding::Type inRounding = Rounding::TRUNCATE, bool inSaturate = false)
+        {
+            return std::move(inArray.astype<dtypeOut>(inRounding, inSaturate));
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Returns a copy of the array, cast to a specified type.
+        ///						The values are written into outArray, which must be preallocated to the
+        ///						shape of the input.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) rounding, default Rounding::TRUNCATE
+        /// @param				(Optional) saturate, default false
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& astype(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray,
+            Rounding::Type inRounding = Rounding::TRUNCATE, bool inSaturate = false)
         {
-            return std::move(inArray.astype<dtypeOut>());
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: astype: output array shape is not consistant with the input array.");
+            }
+
+            return inArray.astype(outArray, inRounding, inSaturate);
         }
 
         //============================================================================
@@ -921,6 +1727,38 @@ namespace NumCpp
             }
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Compute the weighted average along the specified axis.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray of weights
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<double>& average(const NdArray<dtype>& inArray, const NdArray<dtype>& inWeights, NdArray<double>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            const Shape inShape = inArray.shape();
+            const bool consistant = inAxis == Axis::NONE ? inWeights.shape() == inShape :
+                inWeights.size() == (inAxis == Axis::COL ? inShape.cols : inShape.rows);
+            if (!consistant)
+            {
+                throw std::invalid_argument("ERROR: average: input array and weight values are not consistant.");
+            }
+
+            const double weightSum = inWeights.sum().item();
+            return reduceLaneRanges("average", inArray, outArray, inAxis,
+                [&inWeights, weightSum](const dtype* inFirst, const dtype* inLast) -> double
+                {
+                    return std::inner_product(inFirst, inLast, inWeights.cbegin(), 0.0, std::plus<double>(), std::multiplies<double>()) / weightSum;
+                });
+        }
+
         //============================================================================
         // Method Description: 
         ///						Count number of occurrences of each value in array of non-negative ints.
@@ -1041,6 +1879,39 @@ namespace NumCpp
             return std::move(inArray1 & inArray2);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Compute the bit-wise AND of two arrays element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the input arrays.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& bitwise_and(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<dtype>& outArray)
+        {
+            // can only be called on integer types
+            static_assert(DtypeInfo<dtype>::isInteger(), "ERROR: bitwise_and can only be compiled with integer types.");
+
+            if (inArray1.shape() != inArray2.shape())
+            {
+                throw std::invalid_argument("ERROR: bitwise_and: input array shapes are not consistant.");
+            }
+
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: bitwise_and: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
+                [](dtype inValue1, dtype inValue2) { return static_cast<dtype>(inValue1 & inValue2); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Compute the bit-wise NOT the input array element-wise.
@@ -1054,6 +1925,33 @@ namespace NumCpp
             return std::move(~inArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Compute the bit-wise NOT the input array element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& bitwise_not(const NdArray<dtype>& inArray, NdArray<dtype>& outArray)
+        {
+            // can only be called on integer types
+            static_assert(DtypeInfo<dtype>::isInteger(), "ERROR: bitwise_not can only be compiled with integer types.");
+
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: bitwise_not: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return static_cast<dtype>(~inValue); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Compute the bit-wise OR of two arrays element-wise.
@@ -1070,6 +1968,39 @@ namespace NumCpp
             return std::move(inArray1 | inArray2);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Compute the bit-wise OR of two arrays element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the input arrays.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& bitwise_or(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<dtype>& outArray)
+        {
+            // can only be called on integer types
+            static_assert(DtypeInfo<dtype>::isInteger(), "ERROR: bitwise_or can only be compiled with integer types.");
+
+            if (inArray1.shape() != inArray2.shape())
+            {
+                throw std::invalid_argument("ERROR: bitwise_or: input array shapes are not consistant.");
+            }
+
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: bitwise_or: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
+                [](dtype inValue1, dtype inValue2) { return static_cast<dtype>(inValue1 | inValue2); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Compute the bit-wise XOR of two arrays element-wise.
@@ -1086,6 +2017,39 @@ namespace NumCpp
             return std::move(inArray1 ^ inArray2);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Compute the bit-wise XOR of two arrays element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the input arrays.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& bitwise_xor(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<dtype>& outArray)
+        {
+            // can only be called on integer types
+            static_assert(DtypeInfo<dtype>::isInteger(), "ERROR: bitwise_xor can only be compiled with integer types.");
+
+            if (inArray1.shape() != inArray2.shape())
+            {
+                throw std::invalid_argument("ERROR: bitwise_xor: input array shapes are not consistant.");
+            }
+
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: bitwise_xor: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
+                [](dtype inValue1, dtype inValue2) { return static_cast<dtype>(inValue1 ^ inValue2); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return a new array with the bytes of the array elements
@@ -1129,14 +2093,42 @@ namespace NumCpp
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> cbrt(const NdArray<dtype>& inArray)
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> cbrt(const NdArray<dtype>& inArray)
         {
-            NdArray<double> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(), [](dtype inValue) { return std::cbrt(static_cast<double>(inValue)); });
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            cbrt(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Return the cube-root of an array, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.cbrt.html
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& cbrt(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: cbrt: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return std::cbrt(static_cast<dtypeOut>(inValue)); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return the ceiling of the input.
@@ -1170,6 +2162,32 @@ namespace NumCpp
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Return the ceiling of the input, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.ceil.html
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& ceil(const NdArray<dtype>& inArray, NdArray<dtype>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: ceil: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return static_cast<dtype>(std::ceil(inValue)); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Clip (limit) the value.
@@ -1205,6 +2223,34 @@ namespace NumCpp
             return std::move(inArray.clip(inMinValue, inMaxValue));
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Clip (limit) the values in an array.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.clip.html
+        ///		
+        /// @param				NdArray
+        /// @param				min Value
+        /// @param				max Value
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& clip(const NdArray<dtype>& inArray, dtype inMinValue, dtype inMaxValue, NdArray<dtype>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: clip: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [inMinValue, inMaxValue](dtype inValue) { return inValue < inMinValue ? inMinValue : (inValue > inMaxValue ? inMaxValue : inValue); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Stack 1-D arrays as columns into a 2-D array.
@@ -1218,94 +2264,108 @@ namespace NumCpp
         ///
         static NdArray<dtype> column_stack(const std::initializer_list<NdArray<dtype> >& inArrayList)
         {
-            // first loop through to calculate the final size of the array
-            typename std::initializer_list<NdArray<dtype> >::iterator iter;
-            Shape finalShape;
-            for (iter = inArrayList.begin(); iter < inArrayList.end(); ++iter)
-            {
-                if (finalShape.isnull())
-                {
-                    finalShape = iter->shape();
-                }
-                else if (iter->shape().rows != finalShape.rows)
-                {
-                    throw std::invalid_argument("ERROR: column_stack: input arrays must have the same number of rows.");
-                }
-                else
-                {
-                    finalShape.cols += iter->shape().cols;
-                }
-            }
+            return std::move(column_stack(inArrayList.begin(), inArrayList.end()));
+        }
 
-            // now that we know the final size, contruct the output array
-            NdArray<dtype> returnArray(finalShape);
-            uint32 colStart = 0;
-            for (iter = inArrayList.begin(); iter < inArrayList.end(); ++iter)
-            {
-                Shape theShape = iter->shape();
-                for (uint32 row = 0; row < theShape.rows; ++row)
-                {
-                    for (uint32 col = 0; col < theShape.cols; ++col)
-                    {
-                        returnArray(row, colStart + col) = iter->operator()(row, col);
-                    }
-                }
-                colStart += theShape.cols;
-            }
+        //============================================================================
+        // Method Description: 
+        ///						Stack 1-D arrays as columns into a 2-D array.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.column_stack.html
+        ///		
+        /// @param				iterator to the first NdArray to stack
+        /// @param				iterator one past the last NdArray to stack
+        /// @return
+        ///				NdArray
+        ///
+        template<typename Iterator>
+        static NdArray<dtype> column_stack(Iterator inFirst, Iterator inLast)
+        {
+            NdArray<dtype> returnArray(stackedShape(inFirst, inLast, Axis::COL));
+            stackCopy(inFirst, inLast, returnArray, Axis::COL);
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Join a sequence of arrays along an existing axis.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.concatenate.html
+        ///		
+        /// @param				{list} of arrays to join
+        /// @param				(Optional) Axis (Default NONE)
+        /// @return
+        ///				NdArray
+        ///
+        static NdArray<dtype> concatenate(const std::initializer_list<NdArray<dtype> >& inArrayList, Axis::Type inAxis = Axis::NONE)
+        {
+            return std::move(concatenate(inArrayList.begin(), inArrayList.end(), inAxis));
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Join a sequence of arrays along an existing axis.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.concatenate.html
+        ///		
+        /// @param				iterator to the first NdArray to join
+        /// @param				iterator one past the last NdArray to join
+        /// @param				(Optional) Axis (Default NONE)
+        /// @return
+        ///				NdArray
+        ///
+        template<typename Iterator>
+        static NdArray<dtype> concatenate(Iterator inFirst, Iterator inLast, Axis::Type inAxis = Axis::NONE)
+        {
+            NdArray<dtype> returnArray(stackedShape(inFirst, inLast, inAxis));
+            stackCopy(inFirst, inLast, returnArray, inAxis);
 
             return std::move(returnArray);
         }
 
         //============================================================================
         // Method Description: 
-        ///						Join a sequence of arrays along an existing axis.
+        ///						Join a sequence of arrays along an existing axis, writing the
+        ///						result into outArray which must already have the joined shape.
+        ///						outArray must not be one of the input arrays.
+        ///		
+        /// @param				{list} of arrays to join
+        /// @param				NdArray, output array
+        /// @param				(Optional) Axis (Default NONE)
+        /// @return
+        ///				NdArray&
         ///
-        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.concatenate.html
+        static NdArray<dtype>& concatenate_into(const std::initializer_list<NdArray<dtype> >& inArrayList, NdArray<dtype>& outArray,
+            Axis::Type inAxis = Axis::NONE)
+        {
+            return concatenate_into(inArrayList.begin(), inArrayList.end(), outArray, inAxis);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Join a sequence of arrays along an existing axis, writing the
+        ///						result into outArray which must already have the joined shape.
+        ///						outArray must not be one of the input arrays.
         ///		
-        /// @param				NdArray 1
-        /// @param				NdArray 2
+        /// @param				iterator to the first NdArray to join
+        /// @param				iterator one past the last NdArray to join
+        /// @param				NdArray, output array
         /// @param				(Optional) Axis (Default NONE)
         /// @return
-        ///				NdArray
+        ///				NdArray&
         ///
-        static NdArray<dtype> concatenate(const std::initializer_list<NdArray<dtype> >& inArrayList, Axis::Type inAxis = Axis::NONE)
+        template<typename Iterator>
+        static NdArray<dtype>& concatenate_into(Iterator inFirst, Iterator inLast, NdArray<dtype>& outArray, Axis::Type inAxis = Axis::NONE)
         {
-            switch (inAxis)
+            if (outArray.shape() != stackedShape(inFirst, inLast, inAxis))
             {
-                case Axis::NONE:
-                {
-                    uint32 finalSize = 0;
-                    typename std::initializer_list<NdArray<dtype> >::iterator iter;
-                    for (iter = inArrayList.begin(); iter < inArrayList.end(); ++iter)
-                    {
-                        finalSize += iter->size();
-                    }
+                throw std::invalid_argument("ERROR: concatenate_into: output array shape is not consistant with the input arrays.");
+            }
 
-                    NdArray<dtype> returnArray(1, finalSize);
-                    uint32 offset = 0;
-                    for (iter = inArrayList.begin(); iter < inArrayList.end(); ++iter)
-                    {
-                        std::copy(iter->cbegin(), iter->cend(), returnArray.begin() + offset);
-                        offset += iter->size();
-                    }
+            stackCopy(inFirst, inLast, outArray, inAxis);
 
-                    return std::move(returnArray);
-                }
-                case Axis::ROW:
-                {
-                    return std::move(row_stack(inArrayList));
-                }
-                case Axis::COL:
-                {
-                    return std::move(column_stack(inArrayList));
-                }
-                default:
-                {
-                    // this isn't actually possible, just putting this here to get rid
-                    // of the compiler warning.
-                    return std::move(NdArray<dtype>(0));
-                }
-            }
+            return outArray;
         }
 
         //============================================================================
@@ -1351,17 +2411,41 @@ namespace NumCpp
         ///				NdArray
         ///
         static NdArray<dtype> copySign(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
+        {
+            NdArray<dtype> returnArray(inArray1.shape());
+            copySign(inArray1, inArray2, returnArray);
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Change the sign of x1 to that of x2, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the input arrays.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& copySign(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<dtype>& outArray)
         {
             if (inArray1.shape() != inArray2.shape())
             {
                 throw std::invalid_argument("ERROR: copysign: input arrays are not consistant.");
             }
 
-            NdArray<dtype> returnArray(inArray1.shape());
-            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), returnArray.begin(),
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: copysign: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
                 [](dtype inValue1, dtype inValue2) { return inValue2 < 0 ? std::abs(inValue1) * -1 : std::abs(inValue1); });
 
-            return std::move(returnArray);
+            return outArray;
         }
 
         //============================================================================
@@ -1408,14 +2492,44 @@ namespace NumCpp
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> cos(const NdArray<dtype>& inArray)
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> cos(const NdArray<dtype>& inArray)
         {
-            NdArray<double> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(), [](dtype inValue) { return std::cos(static_cast<double>(inValue)); });
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            cos(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Cosine element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.cos.html
+        ///		
+        /// @param
+        ///				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& cos(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: cos: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return static_cast<dtypeOut>(inValue); });
+            FastMath<dtypeOut>::cos(outArray.cbegin(), outArray.cend(), outArray.begin());
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Hyperbolic Cosine.
@@ -1443,14 +2557,43 @@ namespace NumCpp
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> cosh(const NdArray<dtype>& inArray)
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> cosh(const NdArray<dtype>& inArray)
         {
-            NdArray<double> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(), [](dtype inValue) { return std::cosh(static_cast<double>(inValue)); });
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            cosh(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Hyperbolic Cosine element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.cosh.html
+        ///		
+        /// @param
+        ///				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& cosh(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: cosh: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return std::cosh(static_cast<dtypeOut>(inValue)); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Counts the number of non-zero values in the array.
@@ -1518,6 +2661,28 @@ namespace NumCpp
             }
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Counts the number of non-zero values in the array.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<uint32>& count_nonzero(const NdArray<dtype>& inArray, NdArray<uint32>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            return reduceLaneRanges("count_nonzero", inArray, outArray, inAxis,
+                [](const dtype* inFirst, const dtype* inLast) -> uint32
+                {
+                    return static_cast<uint32>(std::count_if(inFirst, inLast, [](dtype inValue) { return inValue != static_cast<dtype>(0); }));
+                });
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return the cross product of two (arrays of) vectors.
@@ -1732,11 +2897,35 @@ namespace NumCpp
         static NdArray<double> deg2rad(const NdArray<dtype>& inArray)
         {
             NdArray<double> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(), [](dtype inValue) { return deg2rad(inValue); });
+            deg2rad(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Convert angles from degrees to radians.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<double>& deg2rad(const NdArray<dtype>& inArray, NdArray<double>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: deg2rad: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return deg2rad(inValue); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return a new array with sub-arrays along an axis deleted.
@@ -1893,6 +3082,227 @@ namespace NumCpp
             return std::move(deleteIndices(inArray, inIndices, inAxis));
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Computes any combination of min, max, sum, mean, std,
+        ///						count_nonzero, argmin and argmax in a single pass over the
+        ///						array. Along Axis::ROW the per column results are accumulated
+        ///						a row at a time, so the input is never transposed or copied.
+        ///						std is the population standard deviation, as in Methods::std.
+        ///						Lanes with no valid values report NaN statistics.
+        ///		
+        /// @param				NdArray
+        /// @param				(Optional) Axis
+        /// @param				(Optional) statistics to compute, Stat::Type values or'd together
+        /// @param				(Optional) bool, skip NaN values
+        /// @return
+        ///				Description
+        ///
+        static Description<dtype> describe(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE,
+            uint32 inStats = Stat::ALL, bool inIgnoreNan = false)
+        {
+            const Shape inShape = inArray.shape();
+            uint32 numLanes = 1;
+            if (inAxis == Axis::COL)
+            {
+                numLanes = inShape.rows;
+            }
+            else if (inAxis == Axis::ROW)
+            {
+                numLanes = inShape.cols;
+            }
+
+            std::vector<uint32> count(numLanes, 0);
+            std::vector<uint32> nonzero(numLanes, 0);
+            std::vector<double> shift(numLanes, 0.0);
+            std::vector<double> shiftedSum(numLanes, 0.0);
+            std::vector<double> shiftedSumSq(numLanes, 0.0);
+            std::vector<dtype> minValue(numLanes, dtype(0));
+            std::vector<dtype> maxValue(numLanes, dtype(0));
+            std::vector<uint32> minIdx(numLanes, 0);
+            std::vector<uint32> maxIdx(numLanes, 0);
+
+            // seed each lane with its first valid value. The moments are accumulated
+            // about this value so that the one pass variance does not lose precision
+            // to cancellation when the mean is large compared to the spread.
+            for (uint32 lane = 0; lane < numLanes; ++lane)
+            {
+                const uint32 laneLength = inAxis == Axis::NONE ? inShape.size() : (inAxis == Axis::COL ? inShape.cols : inShape.rows);
+                for (uint32 pos = 0; pos < laneLength; ++pos)
+                {
+                    uint32 idx = pos;
+                    if (inAxis == Axis::COL)
+                    {
+                        idx = lane * inShape.cols + pos;
+                    }
+                    else if (inAxis == Axis::ROW)
+                    {
+                        idx = pos * inShape.cols + lane;
+                    }
+
+                    const dtype value = inArray[idx];
+                    if (!(inIgnoreNan && value != value))
+                    {
+                        shift[lane] = static_cast<double>(value);
+                        minValue[lane] = value;
+                        maxValue[lane] = value;
+                        minIdx[lane] = pos;
+                        maxIdx[lane] = pos;
+                        break;
+                    }
+                }
+            }
+
+            const bool doMinMax = (inStats & (Stat::MIN | Stat::MAX | Stat::ARGMIN | Stat::ARGMAX)) != 0;
+            const bool doMoments = (inStats & (Stat::SUM | Stat::MEAN | Stat::STD)) != 0;
+            const bool doNonzero = (inStats & Stat::COUNT_NONZERO) != 0;
+
+            auto accumulate = [&](uint32 inLane, uint32 inPos, dtype inValue)
+            {
+                if (inIgnoreNan && inValue != inValue)
+                {
+                    return;
+                }
+
+                ++count[inLane];
+                if (doMoments)
+                {
+                    const double delta = static_cast<double>(inValue) - shift[inLane];
+                    shiftedSum[inLane] += delta;
+                    shiftedSumSq[inLane] += delta * delta;
+                }
+                if (doNonzero)
+                {
+                    nonzero[inLane] += inValue != dtype(0) ? 1 : 0;
+                }
+                if (doMinMax)
+                {
+                    if (inValue < minValue[inLane])
+                    {
+                        minValue[inLane] = inValue;
+                        minIdx[inLane] = inPos;
+                    }
+                    if (inValue > maxValue[inLane])
+                    {
+                        maxValue[inLane] = inValue;
+                        maxIdx[inLane] = inPos;
+                    }
+                }
+            };
+
+            switch (inAxis)
+            {
+                case Axis::NONE:
+                {
+                    for (uint32 i = 0; i < inShape.size(); ++i)
+                    {
+                        accumulate(0, i, inArray[i]);
+                    }
+                    break;
+                }
+                case Axis::COL:
+                {
+                    for (uint32 row = 0; row < inShape.rows; ++row)
+                    {
+                        for (uint32 col = 0; col < inShape.cols; ++col)
+                        {
+                            accumulate(row, col, inArray(row, col));
+                        }
+                    }
+                    break;
+                }
+                case Axis::ROW:
+                {
+                    for (uint32 row = 0; row < inShape.rows; ++row)
+                    {
+                        for (uint32 col = 0; col < inShape.cols; ++col)
+                        {
+                            accumulate(col, row, inArray(row, col));
+                        }
+                    }
+                    break;
+                }
+                default:
+                {
+                    break;
+                }
+            }
+
+            const double nan = std::numeric_limits<double>::quiet_NaN();
+            const dtype nanDtype = std::numeric_limits<dtype>::quiet_NaN();
+
+            Description<dtype> description;
+            description.count = NdArray<uint32>(1, numLanes);
+            std::copy(count.begin(), count.end(), description.count.begin());
+
+            if (inStats & Stat::MIN)
+            {
+                description.min = NdArray<dtype>(1, numLanes);
+                for (uint32 lane = 0; lane < numLanes; ++lane)
+                {
+                    description.min[lane] = count[lane] > 0 ? minValue[lane] : nanDtype;
+                }
+            }
+            if (inStats & Stat::MAX)
+            {
+                description.max = NdArray<dtype>(1, numLanes);
+                for (uint32 lane = 0; lane < numLanes; ++lane)
+                {
+                    description.max[lane] = count[lane] > 0 ? maxValue[lane] : nanDtype;
+                }
+            }
+            if (inStats & Stat::SUM)
+            {
+                description.sum = NdArray<double>(1, numLanes);
+                for (uint32 lane = 0; lane < numLanes; ++lane)
+                {
+                    description.sum[lane] = shiftedSum[lane] + static_cast<double>(count[lane]) * shift[lane];
+                }
+            }
+            if (inStats & Stat::MEAN)
+            {
+                description.mean = NdArray<double>(1, numLanes);
+                for (uint32 lane = 0; lane < numLanes; ++lane)
+                {
+                    description.mean[lane] = count[lane] > 0 ?
+                        shift[lane] + shiftedSum[lane] / static_cast<double>(count[lane]) : nan;
+                }
+            }
+            if (inStats & Stat::STD)
+            {
+                description.std = NdArray<double>(1, numLanes);
+                for (uint32 lane = 0; lane < numLanes; ++lane)
+                {
+                    if (count[lane] == 0)
+                    {
+                        description.std[lane] = nan;
+                        continue;
+                    }
+
+                    const double n = static_cast<double>(count[lane]);
+                    const double variance = (shiftedSumSq[lane] - shiftedSum[lane] * shiftedSum[lane] / n) / n;
+                    description.std[lane] = std::sqrt(std::max(variance, 0.0));
+                }
+            }
+            if (inStats & Stat::COUNT_NONZERO)
+            {
+                description.count_nonzero = NdArray<uint32>(1, numLanes);
+                std::copy(nonzero.begin(), nonzero.end(), description.count_nonzero.begin());
+            }
+            if (inStats & Stat::ARGMIN)
+            {
+                description.argmin = NdArray<uint32>(1, numLanes);
+                std::copy(minIdx.begin(), minIdx.end(), description.argmin.begin());
+            }
+            if (inStats & Stat::ARGMAX)
+            {
+                description.argmax = NdArray<uint32>(1, numLanes);
+                std::copy(maxIdx.begin(), maxIdx.end(), description.argmax.begin());
+            }
+
+            return std::move(description);
+        }
+
         //============================================================================
         // Method Description: 
         ///						Create a two-dimensional array with the flattened input as a diagonal.
@@ -1987,16 +3397,15 @@ namespace NumCpp
                         return std::move(NdArray<dtype>(0));
                     }
 
-                    NdArray<dtype> transArray = inArray.transpose();
-                    Shape transShape = transArray.shape();
-                    NdArray<dtype> returnArray(transShape.rows, transShape.cols - 1);
-                    for (uint32 row = 0; row < transShape.rows; ++row)
+                    // difference of consecutive rows, no need to transpose
+                    NdArray<dtype> returnArray(inShape.rows - 1, inShape.cols);
+                    for (uint32 row = 0; row < inShape.rows - 1; ++row)
                     {
-                        std::transform(transArray.cbegin(row), transArray.cend(row) - 1, transArray.cbegin(row) + 1, returnArray.begin(row),
+                        std::transform(inArray.cbegin(row), inArray.cend(row), inArray.cbegin(row + 1), returnArray.begin(row),
                             [](dtype inValue1, dtype inValue2) { return inValue2 - inValue1; });
                     }
 
-                    return std::move(returnArray.transpose());
+                    return std::move(returnArray);
                 }
                 default:
                 {
@@ -2024,6 +3433,39 @@ namespace NumCpp
             return std::move(inArray1.astype<dtypeOut>() / inArray2.astype<dtypeOut>());
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Returns a true division of the inputs, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the input arrays.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.divide.html
+        ///		
+        /// @param				NdArray 1
+        /// @param				NdArray 2
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& divide(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<dtypeOut>& outArray)
+        {
+            if (inArray1.shape() != inArray2.shape())
+            {
+                throw std::invalid_argument("ERROR: divide: input array shapes are not consistant.");
+            }
+
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: divide: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
+                [](dtype inValue1, dtype inValue2) { return static_cast<dtypeOut>(inValue1) / static_cast<dtypeOut>(inValue2); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Dot product of two arrays.
@@ -2135,6 +3577,38 @@ namespace NumCpp
             return std::move(inArray1 == inArray2);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Return (x1 == x2) element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.equal.html
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<bool>& equal(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<bool>& outArray)
+        {
+            if (inArray1.shape() != inArray2.shape())
+            {
+                throw std::invalid_argument("ERROR: equal: input array shapes are not consistant.");
+            }
+
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: equal: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
+                [](dtype inValue1, dtype inValue2) { return inValue1 == inValue2; });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Calculate the exponential of the input value.
@@ -2162,16 +3636,44 @@ namespace NumCpp
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> exp(const NdArray<dtype>& inArray)
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> exp(const NdArray<dtype>& inArray)
         {
-            NdArray<double> returnArray(inArray.shape());
-
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(),
-                [](dtype inValue) { return exp(inValue); });
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            exp(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Calculate the exponential of all elements in the input array.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.exp.html
+        ///		
+        /// @param
+        ///				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& exp(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: exp: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return static_cast<dtypeOut>(inValue); });
+            FastMath<dtypeOut>::exp(outArray.cbegin(), outArray.cend(), outArray.begin());
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Calculate 2**p for all p in the input value.
@@ -2199,16 +3701,44 @@ namespace NumCpp
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> exp2(const NdArray<dtype>& inArray)
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> exp2(const NdArray<dtype>& inArray)
         {
-            NdArray<double> returnArray(inArray.shape());
-
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(),
-                [](dtype inValue) { return exp2(inValue); });
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            exp2(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Calculate 2**p for all p in the input array.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.exp2.html
+        ///		
+        /// @param
+        ///				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& exp2(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: exp2: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return static_cast<dtypeOut>(inValue); });
+            FastMath<dtypeOut>::exp2(outArray.cbegin(), outArray.cend(), outArray.begin());
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Calculate exp(x) - 1 for the input value.
@@ -2236,16 +3766,43 @@ namespace NumCpp
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> expm1(const NdArray<dtype>& inArray)
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> expm1(const NdArray<dtype>& inArray)
         {
-            NdArray<double> returnArray(inArray.shape());
-
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(),
-                [](dtype inValue) { return expm1(inValue); });
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            expm1(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Calculate exp(x) - 1 for all elements in the array.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.expm1.html
+        ///		
+        /// @param
+        ///				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& expm1(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: expm1: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return std::exp(static_cast<dtypeOut>(inValue)) - static_cast<dtypeOut>(1); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return a 2-D array with ones on the diagonal and zeros elsewhere.
@@ -2368,6 +3925,33 @@ namespace NumCpp
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Round to nearest integer towards zero.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.fix.html
+        ///		
+        /// @param
+        ///				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& fix(const NdArray<dtype>& inArray, NdArray<dtype>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: fix: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return static_cast<dtype>(fix(inValue)); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return a copy of the array collapsed into one dimension.
@@ -2416,27 +4000,28 @@ namespace NumCpp
             {
                 case Axis::NONE:
                 {
-                    NdArray<dtype> returnArray(inArray);
-                    std::reverse(returnArray.begin(), returnArray.end());
+                    NdArray<dtype> returnArray(inArray.shape());
+                    std::reverse_copy(inArray.cbegin(), inArray.cend(), returnArray.begin());
                     return std::move(returnArray);
                 }
                 case Axis::COL:
                 {
-                    NdArray<dtype> returnArray(inArray);
+                    NdArray<dtype> returnArray(inArray.shape());
                     for (uint32 row = 0; row < inArray.shape().rows; ++row)
                     {
-                        std::reverse(returnArray.begin(row), returnArray.end(row));
+                        std::reverse_copy(inArray.cbegin(row), inArray.cend(row), returnArray.begin(row));
                     }
                     return std::move(returnArray);
                 }
                 case Axis::ROW:
                 {
-                    NdArray<dtype> returnArray = inArray.transpose();
-                    for (uint32 row = 0; row < returnArray.shape().rows; ++row)
+                    const uint32 numRows = inArray.shape().rows;
+                    NdArray<dtype> returnArray(inArray.shape());
+                    for (uint32 row = 0; row < numRows; ++row)
                     {
-                        std::reverse(returnArray.begin(row), returnArray.end(row));
+                        std::copy(inArray.cbegin(row), inArray.cend(row), returnArray.begin(numRows - 1 - row));
                     }
-                    return std::move(returnArray.transpose());
+                    return std::move(returnArray);
                 }
                 default:
                 {
@@ -2514,6 +4099,33 @@ namespace NumCpp
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Return the floor of the input, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.floor.html
+        ///		
+        /// @param
+        ///				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& floor(const NdArray<dtype>& inArray, NdArray<dtype>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: floor: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return static_cast<dtype>(std::floor(inValue)); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return the largest integer smaller or equal to the division of the inputs.
@@ -2546,6 +4158,36 @@ namespace NumCpp
             return std::move(floor(inArray1 / inArray2));
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Return the largest integer smaller or equal to the division of the inputs.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the input arrays.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& floor_divide(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<dtype>& outArray)
+        {
+            if (inArray1.shape() != inArray2.shape())
+            {
+                throw std::invalid_argument("ERROR: floor_divide: input array shapes are not consistant.");
+            }
+
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: floor_divide: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
+                [](dtype inValue1, dtype inValue2) { return static_cast<dtype>(std::floor(inValue1 / inValue2)); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						maximum of inputs.
@@ -2594,6 +4236,41 @@ namespace NumCpp
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Element-wise maximum of array elements.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the input arrays.
+        ///
+        ///						Compare two arrays and returns a new array containing the 
+        ///						element - wise maxima
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.fmax.html
+        ///		
+        /// @param				NdArray 1
+        /// @param				NdArray 2
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& fmax(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<dtype>& outArray)
+        {
+            if (inArray1.shape() != inArray2.shape())
+            {
+                throw std::invalid_argument("ERROR: fmax: input array shapes are not consistant.");
+            }
+
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: fmax: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
+                [](dtype inValue1, dtype inValue2) { return std::max(inValue1, inValue2); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						minimum of inputs.
@@ -2642,6 +4319,41 @@ namespace NumCpp
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Element-wise minimum of array elements.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the input arrays.
+        ///
+        ///						Compare two arrays and returns a new array containing the 
+        ///						element - wise minima
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.fmin.html
+        ///		
+        /// @param				NdArray 1
+        /// @param				NdArray 2
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& fmin(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<dtype>& outArray)
+        {
+            if (inArray1.shape() != inArray2.shape())
+            {
+                throw std::invalid_argument("ERROR: fmin: input array shapes are not consistant.");
+            }
+
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: fmin: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
+                [](dtype inValue1, dtype inValue2) { return std::min(inValue1, inValue2); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return the remainder of division.
@@ -2692,6 +4404,39 @@ namespace NumCpp
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Return the element-wise remainder of division.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the input arrays.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& fmod(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<dtype>& outArray)
+        {
+            // can only be called on integer types
+            static_assert(DtypeInfo<dtype>::isInteger(), "ERROR: fmod can only be compiled with integer types.");
+
+            if (inArray1.shape() != inArray2.shape())
+            {
+                throw std::invalid_argument("ERROR: fmod: input array shapes are not consistant.");
+            }
+
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: fmod: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
+                [](dtype inValue1, dtype inValue2) { return static_cast<dtype>(inValue1 % inValue2); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Construct an array from data in a text or binary file.
@@ -2847,9 +4592,59 @@ namespace NumCpp
 
         //============================================================================
         // Method Description: 
-        ///						Return the truth value of (x1 > x2) element-wise.
+        ///						Return the truth value of (x1 > x2) element-wise.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.greater.html
+        ///
+        ///		
+        /// @param				NdArray 1
+        /// @param				NdArray 2
+        /// @return
+        ///				NdArray
+        ///
+        static NdArray<bool> greater(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
+        {
+            return std::move(inArray1 > inArray2);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Return the truth value of (x1 > x2) element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.greater.html
+        ///
+        ///		
+        /// @param				NdArray 1
+        /// @param				NdArray 2
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<bool>& greater(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<bool>& outArray)
+        {
+            if (inArray1.shape() != inArray2.shape())
+            {
+                throw std::invalid_argument("ERROR: greater: input array shapes are not consistant.");
+            }
+
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: greater: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
+                [](dtype inValue1, dtype inValue2) { return inValue1 > inValue2; });
+
+            return outArray;
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Return the truth value of (x1 >= x2) element-wise.
         ///
-        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.greater.html
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.greater_equal.html
         ///
         ///		
         /// @param				NdArray 1
@@ -2857,26 +4652,42 @@ namespace NumCpp
         /// @return
         ///				NdArray
         ///
-        static NdArray<bool> greater(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
+        static NdArray<bool> greater_equal(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
         {
-            return std::move(inArray1 > inArray2);
+            return std::move(inArray1 >= inArray2);
         }
 
         //============================================================================
         // Method Description: 
         ///						Return the truth value of (x1 >= x2) element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs.
         ///
         ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.greater_equal.html
         ///
         ///		
         /// @param				NdArray 1
         /// @param				NdArray 2
+        /// @param				NdArray, output array
         /// @return
-        ///				NdArray
+        ///				NdArray&
         ///
-        static NdArray<bool> greater_equal(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
+        static NdArray<bool>& greater_equal(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<bool>& outArray)
         {
-            return std::move(inArray1 >= inArray2);
+            if (inArray1.shape() != inArray2.shape())
+            {
+                throw std::invalid_argument("ERROR: greater_equal: input array shapes are not consistant.");
+            }
+
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: greater_equal: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
+                [](dtype inValue1, dtype inValue2) { return inValue1 >= inValue2; });
+
+            return outArray;
         }
 
         //============================================================================
@@ -2959,6 +4770,23 @@ namespace NumCpp
             return std::move(column_stack(inArrayList));
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Stack arrays in sequence horizontally (column wise).
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.hstack.html
+        ///		
+        /// @param				iterator to the first NdArray to stack
+        /// @param				iterator one past the last NdArray to stack
+        /// @return
+        ///				NdArray
+        ///
+        template<typename Iterator>
+        static NdArray<dtype> hstack(Iterator inFirst, Iterator inLast)
+        {
+            return std::move(column_stack(inFirst, inLast));
+        }
+
         //============================================================================
         // Method Description: 
         ///						Given the "legs" of a right triangle, return its hypotenuse.
@@ -2997,18 +4825,48 @@ namespace NumCpp
         ///
         template<typename dtypeOut = double>
         static NdArray<dtypeOut> hypot(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
+        {
+            NdArray<dtypeOut> returnArray(inArray1.shape());
+            hypot(inArray1, inArray2, returnArray);
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Given the "legs" of a right triangle, return its hypotenuse.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the input arrays.
+        ///
+        ///						Equivalent to sqrt(x1**2 + x2 * *2), element - wise.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.hypot.html
+        ///
+        ///		
+        /// @param				NdArray 1
+        /// @param				NdArray 2
+        ///				
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& hypot(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<dtypeOut>& outArray)
         {
             if (inArray1.shape() != inArray2.shape())
             {
                 throw std::invalid_argument("ERROR: hypot: input array shapes are not consistant.");
             }
 
-            NdArray<dtypeOut> returnArray(inArray1.shape());
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: hypot: output array shape is not consistant with the input array.");
+            }
 
-            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), returnArray.begin(),
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
                 [](dtype inValue1, dtype inValue2) { return std::hypot(static_cast<dtypeOut>(inValue1), static_cast<dtypeOut>(inValue2)); });
 
-            return std::move(returnArray);
+            return outArray;
         }
 
         //============================================================================
@@ -3080,6 +4938,33 @@ namespace NumCpp
             return std::move(~inArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Compute bit-wise inversion, or bit-wise NOT, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& invert(const NdArray<dtype>& inArray, NdArray<dtype>& outArray)
+        {
+            // can only be called on integer types
+            static_assert(DtypeInfo<dtype>::isInteger(), "ERROR: invert can only be compiled with integer types.");
+
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: invert: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return static_cast<dtype>(~inValue); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Returns a boolean array where two arrays are element-wise 
@@ -3144,12 +5029,35 @@ namespace NumCpp
         static NdArray<bool> isnan(const NdArray<dtype>& inArray)
         {
             NdArray<bool> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(),
-                [](dtype inValue) { return std::isnan(inValue); });
+            isnan(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Test element-wise for NaN and return result as a boolean array.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<bool>& isnan(const NdArray<dtype>& inArray, NdArray<bool>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: isnan: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return std::isnan(inValue); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Returns x1 * 2^x2.
@@ -3180,17 +5088,41 @@ namespace NumCpp
         ///				NdArray
         ///
         static NdArray<dtype> ldexp(const NdArray<dtype>& inArray1, const NdArray<uint8>& inArray2)
+        {
+            NdArray<dtype> returnArray(inArray1.shape());
+            ldexp(inArray1, inArray2, returnArray);
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Returns x1 * 2^x2, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the input arrays.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& ldexp(const NdArray<dtype>& inArray1, const NdArray<uint8>& inArray2, NdArray<dtype>& outArray)
         {
             if (inArray1.shape() != inArray2.shape())
             {
                 throw std::invalid_argument("ERROR: ldexp: input array shapes are not consistant.");
             }
 
-            NdArray<dtype> returnArray(inArray1.shape());
-            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), returnArray.begin(),
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: ldexp: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
                 [](dtype inValue1, uint8 inValue2) { return static_cast<dtype>(std::ldexp(static_cast<double>(inValue1), inValue2)); });
 
-            return std::move(returnArray);
+            return outArray;
         }
 
         //============================================================================
@@ -3227,6 +5159,39 @@ namespace NumCpp
             return std::move(inArray1 < inArray2);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Return the truth value of (x1 < x2) element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.less.html
+        ///		
+        /// @param				NdArray 1
+        /// @param				NdArray 2
+        ///				
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<bool>& less(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<bool>& outArray)
+        {
+            if (inArray1.shape() != inArray2.shape())
+            {
+                throw std::invalid_argument("ERROR: less: input array shapes are not consistant.");
+            }
+
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: less: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
+                [](dtype inValue1, dtype inValue2) { return inValue1 < inValue2; });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return the truth value of (x1 <= x2) element-wise.
@@ -3244,6 +5209,39 @@ namespace NumCpp
             return std::move(inArray1 <= inArray2);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Return the truth value of (x1 <= x2) element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.less_equal.html
+        ///		
+        /// @param				NdArray 1
+        /// @param				NdArray 2
+        ///				
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<bool>& less_equal(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<bool>& outArray)
+        {
+            if (inArray1.shape() != inArray2.shape())
+            {
+                throw std::invalid_argument("ERROR: less_equal: input array shapes are not consistant.");
+            }
+
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: less_equal: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
+                [](dtype inValue1, dtype inValue2) { return inValue1 <= inValue2; });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return evenly spaced numbers over a specified interval.
@@ -3375,15 +5373,45 @@ namespace NumCpp
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> log(const NdArray<dtype>& inArray)
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> log(const NdArray<dtype>& inArray)
         {
-            NdArray<double> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(),
-                [](dtype inValue) { return std::log(static_cast<double>(inValue)); });
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            log(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Natural logarithm, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.log.html
+        ///		
+        /// @param
+        ///				NdArray
+        ///				
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& log(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: log: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return static_cast<dtypeOut>(inValue); });
+            FastMath<dtypeOut>::log(outArray.cbegin(), outArray.cend(), outArray.begin());
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return the base 10 logarithm of the input array.
@@ -3413,15 +5441,45 @@ namespace NumCpp
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> log10(const NdArray<dtype>& inArray)
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> log10(const NdArray<dtype>& inArray)
         {
-            NdArray<double> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(),
-                [](dtype inValue) { return std::log10(static_cast<double>(inValue)); });
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            log10(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Return the base 10 logarithm of the input array, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.log10.html
+        ///		
+        /// @param
+        ///				NdArray
+        ///				
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& log10(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: log10: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return static_cast<dtypeOut>(inValue); });
+            FastMath<dtypeOut>::log10(outArray.cbegin(), outArray.cend(), outArray.begin());
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return the natural logarithm of one plus the input array.
@@ -3455,11 +5513,80 @@ namespace NumCpp
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> log1p(const NdArray<dtype>& inArray)
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> log1p(const NdArray<dtype>& inArray)
+        {
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            log1p(inArray, returnArray);
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Return the natural logarithm of one plus the input array, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///						Calculates log(1 + x).
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.log1p.html
+        ///		
+        /// @param
+        ///				NdArray
+        ///				
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& log1p(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: log1p: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return std::log1p(static_cast<dtypeOut>(inValue)); });
+
+            return outArray;
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Base-2 logarithm of x.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.log2.html
+        ///		
+        /// @param
+        ///				value
+        ///				
+        /// @return
+        ///				value
+        ///
+        static double log2(dtype inValue)
+        {
+            return std::log2(static_cast<double>(inValue));
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Base-2 logarithm of x.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.log2.html
+        ///		
+        /// @param
+        ///				NdArray
+        ///				
+        /// @return
+        ///				NdArray
+        ///
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> log2(const NdArray<dtype>& inArray)
         {
-            NdArray<double> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(),
-                [](dtype inValue) { return std::log1p(static_cast<double>(inValue)); });
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            log2(inArray, returnArray);
 
             return std::move(returnArray);
         }
@@ -3467,37 +5594,49 @@ namespace NumCpp
         //============================================================================
         // Method Description: 
         ///						Base-2 logarithm of x.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
         ///
         ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.log2.html
         ///		
         /// @param
-        ///				value
+        ///				NdArray
         ///				
+        /// @param				NdArray, output array
         /// @return
-        ///				value
+        ///				NdArray&
         ///
-        static double log2(dtype inValue)
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& log2(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
         {
-            return std::log2(static_cast<double>(inValue));
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: log2: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return static_cast<dtypeOut>(inValue); });
+            FastMath<dtypeOut>::log2(outArray.cbegin(), outArray.cend(), outArray.begin());
+
+            return outArray;
         }
 
         //============================================================================
         // Method Description: 
-        ///						Base-2 logarithm of x.
+        ///						Compute the truth value of x1 AND x2 element-wise.
         ///
-        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.log2.html
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.logical_and.html
         ///		
-        /// @param
-        ///				NdArray
+        /// @param				NdArray 1
+        /// @param				NdArray 2
         ///				
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> log2(const NdArray<dtype>& inArray)
+        static NdArray<bool> logical_and(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
         {
-            NdArray<double> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(),
-                [](dtype inValue) { return std::log2(static_cast<double>(inValue)); });
+            NdArray<bool> returnArray(inArray1.shape());
+            logical_and(inArray1, inArray2, returnArray);
 
             return std::move(returnArray);
         }
@@ -3505,28 +5644,31 @@ namespace NumCpp
         //============================================================================
         // Method Description: 
         ///						Compute the truth value of x1 AND x2 element-wise.
-        ///
-        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.logical_and.html
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the input arrays.
         ///		
-        /// @param				NdArray 1
-        /// @param				NdArray 2
-        ///				
+        /// @param				NdArray
+        /// @param				NdArray
+        /// @param				NdArray, output array
         /// @return
-        ///				NdArray
+        ///				NdArray&
         ///
-        static NdArray<bool> logical_and(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
+        static NdArray<bool>& logical_and(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<bool>& outArray)
         {
             if (inArray1.shape() != inArray2.shape())
             {
                 throw std::invalid_argument("ERROR: logical_and: input array shapes are not consistant.");
+            }
 
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: logical_and: output array shape is not consistant with the input array.");
             }
 
-            NdArray<bool> returnArray(inArray1.shape());
-            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), returnArray.begin(),
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
                 [](dtype inValue1, dtype inValue2) { return (inValue1 != 0) && (inValue2 != 0); });
 
-            return std::move(returnArray);
+            return outArray;
         }
 
         //============================================================================
@@ -3544,12 +5686,35 @@ namespace NumCpp
         static NdArray<bool> logical_not(const NdArray<dtype>& inArray)
         {
             NdArray<bool> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(),
-                [](dtype inValue) { return inValue == 0; });
+            logical_not(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Compute the truth value of NOT x element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<bool>& logical_not(const NdArray<dtype>& inArray, NdArray<bool>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: logical_not: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return inValue == 0; });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Compute the truth value of x1 OR x2 element-wise.
@@ -3563,18 +5728,41 @@ namespace NumCpp
         ///				NdArray
         ///
         static NdArray<bool> logical_or(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
+        {
+            NdArray<bool> returnArray(inArray1.shape());
+            logical_or(inArray1, inArray2, returnArray);
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Compute the truth value of x1 OR x2 element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the input arrays.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<bool>& logical_or(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<bool>& outArray)
         {
             if (inArray1.shape() != inArray2.shape())
             {
                 throw std::invalid_argument("ERROR: logical_or: input array shapes are not consistant.");
+            }
 
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: logical_or: output array shape is not consistant with the input array.");
             }
 
-            NdArray<bool> returnArray(inArray1.shape());
-            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), returnArray.begin(),
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
                 [](dtype inValue1, dtype inValue2) { return (inValue1 != 0) || (inValue2 != 0); });
 
-            return std::move(returnArray);
+            return outArray;
         }
 
         //============================================================================
@@ -3590,18 +5778,41 @@ namespace NumCpp
         ///				NdArray
         ///
         static NdArray<bool> logical_xor(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
+        {
+            NdArray<bool> returnArray(inArray1.shape());
+            logical_xor(inArray1, inArray2, returnArray);
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Compute the truth value of x1 XOR x2 element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the input arrays.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<bool>& logical_xor(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<bool>& outArray)
         {
             if (inArray1.shape() != inArray2.shape())
             {
                 throw std::invalid_argument("ERROR: logical_xor: input array shapes are not consistant.");
+            }
 
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: logical_xor: output array shape is not consistant with the input array.");
             }
 
-            NdArray<bool> returnArray(inArray1.shape());
-            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), returnArray.begin(),
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
                 [](dtype inValue1, dtype inValue2) { return (inValue1 != 0) != (inValue2 != 0); });
 
-            return std::move(returnArray);
+            return outArray;
         }
 
         //============================================================================
@@ -3637,6 +5848,75 @@ namespace NumCpp
             return std::move(inArray.max(inAxis));
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Return the maximum of an array or maximum along an axis.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        ///				
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& max(const NdArray<dtype>& inArray, NdArray<dtype>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            Shape inShape = inArray.shape();
+            switch (inAxis)
+            {
+                case Axis::NONE:
+                {
+                    if (outArray.shape() != Shape(1, 1))
+                    {
+                        throw std::invalid_argument("ERROR: max: output array shape is not consistant with the reduction axis.");
+                    }
+
+                    outArray[0] = *std::max_element(inArray.cbegin(), inArray.cend());
+                    return outArray;
+                }
+                case Axis::COL:
+                {
+                    if (outArray.shape() != Shape(1, inShape.rows))
+                    {
+                        throw std::invalid_argument("ERROR: max: output array shape is not consistant with the reduction axis.");
+                    }
+
+                    for (uint32 row = 0; row < inShape.rows; ++row)
+                    {
+                        outArray[row] = *std::max_element(inArray.cbegin(row), inArray.cend(row));
+                    }
+
+                    return outArray;
+                }
+                case Axis::ROW:
+                {
+                    if (outArray.shape() != Shape(1, inShape.cols))
+                    {
+                        throw std::invalid_argument("ERROR: max: output array shape is not consistant with the reduction axis.");
+                    }
+
+                    // accumulate a row at a time so the input is walked contiguously
+                    std::copy(inArray.cbegin(0), inArray.cend(0), outArray.begin());
+                    for (uint32 row = 1; row < inShape.rows; ++row)
+                    {
+                        std::transform(outArray.cbegin(), outArray.cend(), inArray.cbegin(row), outArray.begin(),
+                            [](dtype inResult, dtype inValue) { return std::max(inResult, inValue); });
+                    }
+
+                    return outArray;
+                }
+                default:
+                {
+                    // this isn't actually possible, just putting this here to get rid
+                    // of the compiler warning.
+                    return outArray;
+                }
+            }
+        }
+
         //============================================================================
         // Method Description: 
         ///						Element-wise maximum of array elements.
@@ -3651,94 +5931,320 @@ namespace NumCpp
         ///				NdArray
         ///
         static NdArray<dtype> maximum(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
+        {
+            NdArray<dtype> returnArray(inArray1.shape());
+            maximum(inArray1, inArray2, returnArray);
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Element-wise maximum of array elements.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the input arrays.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.maximum.html
+        ///
+        ///		
+        /// @param				NdArray 1
+        /// @param				NdArray 2
+        ///				
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& maximum(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<dtype>& outArray)
         {
             if (inArray1.shape() != inArray2.shape())
             {
                 throw std::invalid_argument("ERROR: maximum: input array shapes are not consistant.");
+            }
 
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: maximum: output array shape is not consistant with the input array.");
             }
 
-            NdArray<dtype> returnArray(inArray1.shape());
-            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), returnArray.begin(),
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
                 [](dtype inValue1, dtype inValue2) { return std::max(inValue1, inValue2); });
 
-            return std::move(returnArray);
+            return outArray;
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Compute the mean along the specified axis.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.mean.html
+        ///		
+        /// @param				NdArray 
+        /// @param				(Optional) axis
+        ///				
+        /// @return
+        ///				NdArray
+        ///
+        static NdArray<double> mean(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
+        {
+            return std::move(inArray.mean(inAxis));
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Compute the mean along the specified axis.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.mean.html
+        ///		
+        /// @param				NdArray 
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        ///				
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<double>& mean(const NdArray<dtype>& inArray, NdArray<double>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            Shape inShape = inArray.shape();
+            switch (inAxis)
+            {
+                case Axis::NONE:
+                {
+                    if (outArray.shape() != Shape(1, 1))
+                    {
+                        throw std::invalid_argument("ERROR: mean: output array shape is not consistant with the reduction axis.");
+                    }
+
+                    outArray[0] = std::accumulate(inArray.cbegin(), inArray.cend(), 0.0,
+                        [](double inResult, dtype inValue) { return inResult + static_cast<double>(inValue); });
+                    outArray[0] /= static_cast<double>(inArray.size());
+                    return outArray;
+                }
+                case Axis::COL:
+                {
+                    if (outArray.shape() != Shape(1, inShape.rows))
+                    {
+                        throw std::invalid_argument("ERROR: mean: output array shape is not consistant with the reduction axis.");
+                    }
+
+                    for (uint32 row = 0; row < inShape.rows; ++row)
+                    {
+                        outArray[row] = std::accumulate(inArray.cbegin(row), inArray.cend(row), 0.0,
+                            [](double inResult, dtype inValue) { return inResult + static_cast<double>(inValue); });
+                    }
+                    outArray /= static_cast<double>(inShape.cols);
+
+                    return outArray;
+                }
+                case Axis::ROW:
+                {
+                    if (outArray.shape() != Shape(1, inShape.cols))
+                    {
+                        throw std::invalid_argument("ERROR: mean: output array shape is not consistant with the reduction axis.");
+                    }
+
+                    // accumulate a row at a time so the input is walked contiguously
+                    std::transform(inArray.cbegin(0), inArray.cend(0), outArray.begin(),
+                        [](dtype inValue) { return static_cast<double>(inValue); });
+                    for (uint32 row = 1; row < inShape.rows; ++row)
+                    {
+                        std::transform(outArray.cbegin(), outArray.cend(), inArray.cbegin(row), outArray.begin(),
+                            [](double inResult, dtype inValue) { return inResult + static_cast<double>(inValue); });
+                    }
+                    outArray /= static_cast<double>(inShape.rows);
+
+                    return outArray;
+                }
+                default:
+                {
+                    // this isn't actually possible, just putting this here to get rid
+                    // of the compiler warning.
+                    return outArray;
+                }
+            }
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Compute the median along the specified axis.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.median.html
+        ///		
+        /// @param				NdArray 
+        /// @param  			(Optional) axis
+        ///				
+        /// @return
+        ///				NdArray
+        ///
+        static NdArray<dtype> median(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
+        {
+            return std::move(inArray.median(inAxis));
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Compute the median along the specified axis.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& median(const NdArray<dtype>& inArray, NdArray<dtype>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            // a single scratch buffer is reused for every lane
+            std::vector<dtype> values;
+            return reduceLaneRanges("median", inArray, outArray, inAxis,
+                [&values](const dtype* inFirst, const dtype* inLast) -> dtype
+                {
+                    values.assign(inFirst, inLast);
+                    const uint32 middle = static_cast<uint32>(values.size()) / 2;
+                    std::nth_element(values.begin(), values.begin() + middle, values.end());
+                    return values[middle];
+                });
         }
 
         //============================================================================
         // Method Description: 
-        ///						Compute the mean along the specified axis.
-        ///
-        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.mean.html
+        ///						Return the minimum of an array or maximum along an axis.
         ///		
-        /// @param				NdArray 
+        /// @param				NdArray
         /// @param				(Optional) axis
         ///				
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> mean(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
+        static NdArray<dtype> min(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
         {
-            return std::move(inArray.mean(inAxis));
+            return std::move(inArray.min(inAxis));
         }
 
         //============================================================================
         // Method Description: 
-        ///						Compute the median along the specified axis.
-        ///
-        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.median.html
+        ///						Return the minimum of an array or maximum along an axis.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
         ///		
-        /// @param				NdArray 
-        /// @param  			(Optional) axis
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
         ///				
         /// @return
-        ///				NdArray
+        ///				NdArray&
         ///
-        static NdArray<dtype> median(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
+        static NdArray<dtype>& min(const NdArray<dtype>& inArray, NdArray<dtype>& outArray, Axis::Type inAxis = Axis::NONE)
         {
-            return std::move(inArray.median(inAxis));
+            Shape inShape = inArray.shape();
+            switch (inAxis)
+            {
+                case Axis::NONE:
+                {
+                    if (outArray.shape() != Shape(1, 1))
+                    {
+                        throw std::invalid_argument("ERROR: min: output array shape is not consistant with the reduction axis.");
+                    }
+
+                    outArray[0] = *std::min_element(inArray.cbegin(), inArray.cend());
+                    return outArray;
+                }
+                case Axis::COL:
+                {
+                    if (outArray.shape() != Shape(1, inShape.rows))
+                    {
+                        throw std::invalid_argument("ERROR: min: output array shape is not consistant with the reduction axis.");
+                    }
+
+                    for (uint32 row = 0; row < inShape.rows; ++row)
+                    {
+                        outArray[row] = *std::min_element(inArray.cbegin(row), inArray.cend(row));
+                    }
+
+                    return outArray;
+                }
+                case Axis::ROW:
+                {
+                    if (outArray.shape() != Shape(1, inShape.cols))
+                    {
+                        throw std::invalid_argument("ERROR: min: output array shape is not consistant with the reduction axis.");
+                    }
+
+                    // accumulate a row at a time so the input is walked contiguously
+                    std::copy(inArray.cbegin(0), inArray.cend(0), outArray.begin());
+                    for (uint32 row = 1; row < inShape.rows; ++row)
+                    {
+                        std::transform(outArray.cbegin(), outArray.cend(), inArray.cbegin(row), outArray.begin(),
+                            [](dtype inResult, dtype inValue) { return std::min(inResult, inValue); });
+                    }
+
+                    return outArray;
+                }
+                default:
+                {
+                    // this isn't actually possible, just putting this here to get rid
+                    // of the compiler warning.
+                    return outArray;
+                }
+            }
         }
 
         //============================================================================
         // Method Description: 
-        ///						Return the minimum of an array or maximum along an axis.
+        ///						Element-wise minimum of array elements.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.minimum.html
         ///		
-        /// @param				NdArray
-        /// @param				(Optional) axis
+        /// @param				NdArray 1
+        /// @param				NdArray 2
         ///				
         /// @return
         ///				NdArray
         ///
-        static NdArray<dtype> min(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
+        static NdArray<dtype> minimum(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
         {
-            return std::move(inArray.min(inAxis));
+            NdArray<dtype> returnArray(inArray1.shape());
+            minimum(inArray1, inArray2, returnArray);
+
+            return std::move(returnArray);
         }
 
         //============================================================================
         // Method Description: 
         ///						Element-wise minimum of array elements.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the input arrays.
         ///
         ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.minimum.html
         ///		
         /// @param				NdArray 1
         /// @param				NdArray 2
         ///				
+        /// @param				NdArray, output array
         /// @return
-        ///				NdArray
+        ///				NdArray&
         ///
-        static NdArray<dtype> minimum(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
+        static NdArray<dtype>& minimum(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<dtype>& outArray)
         {
             if (inArray1.shape() != inArray2.shape())
             {
                 throw std::invalid_argument("ERROR: minimum: input array shapes are not consistant.");
+            }
 
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: minimum: output array shape is not consistant with the input array.");
             }
 
-            NdArray<dtype> returnArray(inArray1.shape());
-            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), returnArray.begin(),
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
                 [](dtype inValue1, dtype inValue2) { return std::min(inValue1, inValue2); });
 
-            return std::move(returnArray);
+            return outArray;
         }
 
         //============================================================================
@@ -3758,6 +6264,39 @@ namespace NumCpp
             return std::move(inArray1 % inArray2);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Return element-wise remainder of division.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the input arrays.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& mod(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<dtype>& outArray)
+        {
+            // can only be called on integer types
+            static_assert(DtypeInfo<dtype>::isInteger(), "ERROR: mod can only be compiled with integer types.");
+
+            if (inArray1.shape() != inArray2.shape())
+            {
+                throw std::invalid_argument("ERROR: mod: input array shapes are not consistant.");
+            }
+
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: mod: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
+                [](dtype inValue1, dtype inValue2) { return static_cast<dtype>(inValue1 % inValue2); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Multiply arguments element-wise.
@@ -3775,6 +6314,39 @@ namespace NumCpp
             return std::move(inArray1 * inArray2);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Multiply arguments element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the input arrays.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.multiply.html
+        ///		
+        /// @param				NdArray 1
+        /// @param				NdArray 2
+        ///				
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& multiply(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<dtype>& outArray)
+        {
+            if (inArray1.shape() != inArray2.shape())
+            {
+                throw std::invalid_argument("ERROR: multiply: input array shapes are not consistant.");
+            }
+
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: multiply: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
+                [](dtype inValue1, dtype inValue2) { return inValue1 * inValue2; });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Returns the indices of the maximum values along an axis ignoring NaNs.
@@ -3800,6 +6372,41 @@ namespace NumCpp
             return std::move(argmax(arrayCopy, inAxis));
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Returns the indices of the maximum values along an axis ignoring NaNs.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<uint32>& nanargmax(const NdArray<dtype>& inArray, NdArray<uint32>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            // NaNs stand in as the lowest value, like in the allocating version
+            return reduceLaneRanges("nanargmax", inArray, outArray, inAxis,
+                [](const dtype* inFirst, const dtype* inLast) -> uint32
+                {
+                    const dtype* best = inFirst;
+                    dtype bestValue = std::isnan(*inFirst) ? DtypeInfo<dtype>::min() : *inFirst;
+                    for (const dtype* current = inFirst + 1; current < inLast; ++current)
+                    {
+                        const dtype value = std::isnan(*current) ? DtypeInfo<dtype>::min() : *current;
+                        if (bestValue < value)
+                        {
+                            best = current;
+                            bestValue = value;
+                        }
+                    }
+
+                    return static_cast<uint32>(best - inFirst);
+                });
+        }
+
         //============================================================================
         // Method Description: 
         ///						Returns the indices of the minimum values along an axis ignoring NaNs.
@@ -3825,6 +6432,41 @@ namespace NumCpp
             return std::move(argmin(arrayCopy, inAxis));
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Returns the indices of the minimum values along an axis ignoring NaNs.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<uint32>& nanargmin(const NdArray<dtype>& inArray, NdArray<uint32>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            // NaNs stand in as the highest value, like in the allocating version
+            return reduceLaneRanges("nanargmin", inArray, outArray, inAxis,
+                [](const dtype* inFirst, const dtype* inLast) -> uint32
+                {
+                    const dtype* best = inFirst;
+                    dtype bestValue = std::isnan(*inFirst) ? DtypeInfo<dtype>::max() : *inFirst;
+                    for (const dtype* current = inFirst + 1; current < inLast; ++current)
+                    {
+                        const dtype value = std::isnan(*current) ? DtypeInfo<dtype>::max() : *current;
+                        if (value < bestValue)
+                        {
+                            best = current;
+                            bestValue = value;
+                        }
+                    }
+
+                    return static_cast<uint32>(best - inFirst);
+                });
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return the cumulative product of elements along a given axis ignoring NaNs.
@@ -3839,16 +6481,9 @@ namespace NumCpp
         template<typename dtypeOut = double>
         static NdArray<dtypeOut> nancumprod(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
         {
-            NdArray<dtype> arrayCopy(inArray);
-            for (uint32 i = 0; i < arrayCopy.size(); ++i)
-            {
-                if (std::isnan(arrayCopy[i]))
-                {
-                    arrayCopy[i] = 1;
-                }
-            }
-
-            return std::move(cumprod<dtypeOut>(arrayCopy, inAxis));
+            return std::move(inArray.scan<dtypeOut>([](dtypeOut inProd, dtype inValue) -> dtypeOut
+                { return inProd * (inValue == inValue ? static_cast<dtypeOut>(inValue) : static_cast<dtypeOut>(1)); },
+                std::multiplies<dtypeOut>(), static_cast<dtypeOut>(1), inAxis));
         }
 
         //============================================================================
@@ -3865,16 +6500,9 @@ namespace NumCpp
         template<typename dtypeOut = double>
         static NdArray<dtypeOut> nancumsum(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
         {
-            NdArray<dtype> arrayCopy(inArray);
-            for (uint32 i = 0; i < arrayCopy.size(); ++i)
-            {
-                if (std::isnan(arrayCopy[i]))
-                {
-                    arrayCopy[i] = 0;
-                }
-            }
-
-            return std::move(cumsum<dtypeOut>(arrayCopy, inAxis));
+            return std::move(inArray.scan<dtypeOut>([](dtypeOut inSum, dtype inValue) -> dtypeOut
+                { return inSum + (inValue == inValue ? static_cast<dtypeOut>(inValue) : static_cast<dtypeOut>(0)); },
+                std::plus<dtypeOut>(), static_cast<dtypeOut>(0), inAxis));
         }
 
         //============================================================================
@@ -3891,16 +6519,36 @@ namespace NumCpp
         ///
         static NdArray<dtype> nanmax(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
         {
-            NdArray<dtype> arrayCopy(inArray);
-            for (uint32 i = 0; i < arrayCopy.size(); ++i)
-            {
-                if (std::isnan(arrayCopy[i]))
-                {
-                    arrayCopy[i] = DtypeInfo<dtype>::min();
-                }
-            }
+            // the lanes are seeded with NaN so that a lane without any valid values
+            // reports NaN, and the first valid value always replaces the seed
+            const dtype initValue = std::numeric_limits<dtype>::has_quiet_NaN ?
+                std::numeric_limits<dtype>::quiet_NaN() : std::numeric_limits<dtype>::lowest();
+
+            return std::move(NdArray<dtype>(reduceLanes(inArray, inAxis, initValue,
+                [](uint32, dtype inMax, dtype inValue) -> dtype { return inValue == inValue && !(inMax >= inValue) ? inValue : inMax; })));
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Return the maximum of an array or maximum along an axis ignoring NaNs.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& nanmax(const NdArray<dtype>& inArray, NdArray<dtype>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            const dtype initValue = std::numeric_limits<dtype>::has_quiet_NaN ?
+                std::numeric_limits<dtype>::quiet_NaN() : std::numeric_limits<dtype>::lowest();
 
-            return std::move(max(arrayCopy, inAxis));
+            return reduceLanes("nanmax", inArray, outArray, inAxis, initValue,
+                [](uint32, dtype inBest, dtype inValue) -> dtype { return inValue == inValue && !(inBest >= inValue) ? inValue : inBest; },
+                [](dtype inBest) { return inBest; });
         }
 
         //============================================================================
@@ -3917,62 +6565,49 @@ namespace NumCpp
         ///
         static NdArray<double> nanmean(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
         {
-            switch (inAxis)
-            {
-                case Axis::NONE:
-                {
-                    double sum = static_cast<double>(std::accumulate(inArray.cbegin(), inArray.cend(), 0.0,
-                        [](dtype inValue1, dtype inValue2) { return std::isnan(inValue2) ? inValue1 : inValue1 + inValue2; }));
-
-                    double numberNonNan = static_cast<double>(std::accumulate(inArray.cbegin(), inArray.cend(), 0.0,
-                        [](dtype inValue1, dtype inValue2) { return std::isnan(inValue2) ? inValue1 : inValue1 + 1; }));
-
-                    NdArray<double> returnArray = { sum /= numberNonNan };
-
-                    return std::move(returnArray);
-                }
-                case Axis::COL:
-                {
-                    Shape inShape = inArray.shape();
-                    NdArray<double> returnArray(1, inShape.rows);
-                    for (uint32 row = 0; row < inShape.rows; ++row)
-                    {
-                        double sum = static_cast<double>(std::accumulate(inArray.cbegin(row), inArray.cend(row), 0.0,
-                            [](dtype inValue1, dtype inValue2) { return std::isnan(inValue2) ? inValue1 : inValue1 + inValue2; }));
-
-                        double numberNonNan = static_cast<double>(std::accumulate(inArray.cbegin(row), inArray.cend(row), 0.0,
-                            [](dtype inValue1, dtype inValue2) { return std::isnan(inValue2) ? inValue1 : inValue1 + 1; }));
-
-                        returnArray(0, row) = sum / numberNonNan;
-                    }
-
-                    return std::move(returnArray);
-                }
-                case Axis::ROW:
+            // sum and number of valid values are gathered in the same pass
+            typedef std::pair<double, double> SumCount;
+            std::vector<SumCount> lanes = reduceLanes(inArray, inAxis, SumCount(0.0, 0.0),
+                [](uint32, const SumCount& inSumCount, dtype inValue) -> SumCount
                 {
-                    NdArray<dtype> transposedArray = inArray.transpose();
-                    Shape transShape = transposedArray.shape();
-                    NdArray<double> returnArray(1, transShape.rows);
-                    for (uint32 row = 0; row < transShape.rows; ++row)
-                    {
-                        double sum = static_cast<double>(std::accumulate(transposedArray.cbegin(row), transposedArray.cend(row), 0.0,
-                            [](dtype inValue1, dtype inValue2) { return std::isnan(inValue2) ? inValue1 : inValue1 + inValue2; }));
+                    const bool isValid = inValue == inValue;
+                    return SumCount(inSumCount.first + (isValid ? static_cast<double>(inValue) : 0.0),
+                        inSumCount.second + (isValid ? 1.0 : 0.0));
+                });
 
-                        double numberNonNan = static_cast<double>(std::accumulate(transposedArray.cbegin(row), transposedArray.cend(row), 0.0,
-                            [](dtype inValue1, dtype inValue2) { return std::isnan(inValue2) ? inValue1 : inValue1 + 1; }));
+            NdArray<double> returnArray(1, static_cast<uint32>(lanes.size()));
+            for (uint32 i = 0; i < returnArray.size(); ++i)
+            {
+                returnArray[i] = lanes[i].first / lanes[i].second;
+            }
 
-                        returnArray(0, row) = sum / numberNonNan;
-                    }
+            return std::move(returnArray);
+        }
 
-                    return std::move(returnArray);
-                }
-                default:
+        //============================================================================
+        // Method Description: 
+        ///						Compute the mean along the specified axis ignoring NaNs.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<double>& nanmean(const NdArray<dtype>& inArray, NdArray<double>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            typedef std::pair<double, double> SumCount;
+            return reduceLanes("nanmean", inArray, outArray, inAxis, SumCount(0.0, 0.0),
+                [](uint32, const SumCount& inSumCount, dtype inValue) -> SumCount
                 {
-                    // this isn't actually possible, just putting this here to get rid
-                    // of the compiler warning.
-                    return std::move(NdArray<double>(0));
-                }
-            }
+                    const bool isValid = inValue == inValue;
+                    return SumCount(inSumCount.first + (isValid ? static_cast<double>(inValue) : 0.0),
+                        inSumCount.second + (isValid ? 1.0 : 0.0));
+                },
+                [](const SumCount& inSumCount) { return inSumCount.first / inSumCount.second; });
         }
 
         //============================================================================
@@ -3989,66 +6624,62 @@ namespace NumCpp
         ///
         static NdArray<dtype> nanmedian(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
         {
-            switch (inAxis)
+            // a single scratch buffer is reused for every lane
+            std::vector<dtype> values;
+            auto laneMedian = [&values]() -> dtype
             {
-                case Axis::NONE:
+                if (values.empty())
                 {
-                    std::vector<dtype> values;
-                    for (uint32 i = 0; i < inArray.size(); ++i)
-                    {
-                        if (!std::isnan(inArray[i]))
-                        {
-                            values.push_back(inArray[i]);
-                        }
-                    }
+                    return std::numeric_limits<dtype>::quiet_NaN();
+                }
+
+                const uint32 middle = static_cast<uint32>(values.size()) / 2;
+                std::nth_element(values.begin(), values.begin() + middle, values.end());
+                return values[middle];
+            };
+            auto isNotNan = [](dtype inValue) -> bool { return inValue == inValue; };
+
+            Shape inShape = inArray.shape();
+            switch (inAxis)
+            {
+                case Axis::NONE:
+                {
+                    values.reserve(inArray.size());
+                    std::copy_if(inArray.cbegin(), inArray.cend(), std::back_inserter(values), isNotNan);
 
-                    uint32 middle = static_cast<uint32>(values.size()) / 2;
-                    std::nth_element(values.begin(), values.begin() + middle, values.end());
-                    NdArray<dtype> returnArray = { values[middle] };
+                    NdArray<dtype> returnArray = { laneMedian() };
 
                     return std::move(returnArray);
                 }
                 case Axis::COL:
                 {
-                    Shape inShape = inArray.shape();
+                    values.reserve(inShape.cols);
                     NdArray<dtype> returnArray(1, inShape.rows);
                     for (uint32 row = 0; row < inShape.rows; ++row)
                     {
-                        std::vector<dtype> values;
-                        for (uint32 col = 0; col < inShape.cols; ++col)
-                        {
-                            if (!std::isnan(inArray(row, col)))
-                            {
-                                values.push_back(inArray(row, col));
-                            }
-                        }
-
-                        uint32 middle = static_cast<uint32>(values.size()) / 2;
-                        std::nth_element(values.begin(), values.begin() + middle, values.end());
-                        returnArray(0, row) = values[middle];
+                        values.clear();
+                        std::copy_if(inArray.cbegin(row), inArray.cend(row), std::back_inserter(values), isNotNan);
+                        returnArray(0, row) = laneMedian();
                     }
 
                     return std::move(returnArray);
                 }
                 case Axis::ROW:
                 {
-                    NdArray<dtype> transposedArray = inArray.transpose();
-                    Shape inShape = transposedArray.shape();
-                    NdArray<dtype> returnArray(1, inShape.rows);
-                    for (uint32 row = 0; row < inShape.rows; ++row)
+                    values.reserve(inShape.rows);
+                    NdArray<dtype> returnArray(1, inShape.cols);
+                    for (uint32 col = 0; col < inShape.cols; ++col)
                     {
-                        std::vector<dtype> values;
-                        for (uint32 col = 0; col < inShape.cols; ++col)
+                        values.clear();
+                        for (uint32 row = 0; row < inShape.rows; ++row)
                         {
-                            if (!std::isnan(transposedArray(row, col)))
+                            const dtype value = inArray(row, col);
+                            if (isNotNan(value))
                             {
-                                values.push_back(transposedArray(row, col));
+                                values.push_back(value);
                             }
                         }
-
-                        uint32 middle = static_cast<uint32>(values.size()) / 2;
-                        std::nth_element(values.begin(), values.begin() + middle, values.end());
-                        returnArray(0, row) = values[middle];
+                        returnArray(0, col) = laneMedian();
                     }
 
                     return std::move(returnArray);
@@ -4062,6 +6693,39 @@ namespace NumCpp
             }
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Compute the median along the specified axis ignoring NaNs.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& nanmedian(const NdArray<dtype>& inArray, NdArray<dtype>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            // a single scratch buffer is reused for every lane
+            std::vector<dtype> values;
+            return reduceLaneRanges("nanmedian", inArray, outArray, inAxis,
+                [&values](const dtype* inFirst, const dtype* inLast) -> dtype
+                {
+                    values.clear();
+                    std::copy_if(inFirst, inLast, std::back_inserter(values), [](dtype inValue) { return inValue == inValue; });
+                    if (values.empty())
+                    {
+                        return std::numeric_limits<dtype>::quiet_NaN();
+                    }
+
+                    const uint32 middle = static_cast<uint32>(values.size()) / 2;
+                    std::nth_element(values.begin(), values.begin() + middle, values.end());
+                    return values[middle];
+                });
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return the minimum of an array or maximum along an axis ignoring NaNs.
@@ -4076,16 +6740,36 @@ namespace NumCpp
         ///
         static NdArray<dtype> nanmin(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
         {
-            NdArray<dtype> arrayCopy(inArray);
-            for (uint32 i = 0; i < arrayCopy.size(); ++i)
-            {
-                if (std::isnan(arrayCopy[i]))
-                {
-                    arrayCopy[i] = DtypeInfo<dtype>::max();
-                }
-            }
+            // the lanes are seeded with NaN so that a lane without any valid values
+            // reports NaN, and the first valid value always replaces the seed
+            const dtype initValue = std::numeric_limits<dtype>::has_quiet_NaN ?
+                std::numeric_limits<dtype>::quiet_NaN() : std::numeric_limits<dtype>::max();
+
+            return std::move(NdArray<dtype>(reduceLanes(inArray, inAxis, initValue,
+                [](uint32, dtype inMin, dtype inValue) -> dtype { return inValue == inValue && !(inMin <= inValue) ? inValue : inMin; })));
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Return the minimum of an array or maximum along an axis ignoring NaNs.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& nanmin(const NdArray<dtype>& inArray, NdArray<dtype>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            const dtype initValue = std::numeric_limits<dtype>::has_quiet_NaN ?
+                std::numeric_limits<dtype>::quiet_NaN() : std::numeric_limits<dtype>::max();
 
-            return std::move(min(arrayCopy, inAxis));
+            return reduceLanes("nanmin", inArray, outArray, inAxis, initValue,
+                [](uint32, dtype inBest, dtype inValue) -> dtype { return inValue == inValue && !(inBest <= inValue) ? inValue : inBest; },
+                [](dtype inBest) { return inBest; });
         }
 
         //============================================================================
@@ -4148,6 +6832,7 @@ namespace NumCpp
                     }
 
                     std::vector<double> arrayCopy;
+                    arrayCopy.reserve(inArray.size());
                     uint32 numNonNan = 0;
                     for (uint32 j = 0; j < inArray.size(); ++j)
                     {
@@ -4220,11 +6905,12 @@ namespace NumCpp
                 {
                     Shape inShape = inArray.shape();
 
+                    NdArray<dtype> laneArray(1, inShape.cols);
                     NdArray<dtypeOut> returnArray(1, inShape.rows);
                     for (uint32 row = 0; row < inShape.rows; ++row)
                     {
-                        NdArray<dtypeOut> outValue = nanpercentile<dtypeOut>(NdArray<dtype>(inArray.cbegin(row), inArray.cend(row)),
-                            inPercentile, Axis::NONE, inInterpMethod);
+                        std::copy(inArray.cbegin(row), inArray.cend(row), laneArray.begin());
+                        NdArray<dtypeOut> outValue = nanpercentile<dtypeOut>(laneArray, inPercentile, Axis::NONE, inInterpMethod);
 
                         if (outValue.size() == 1)
                         {
@@ -4240,22 +6926,25 @@ namespace NumCpp
                 }
                 case Axis::ROW:
                 {
-                    NdArray<dtype> arrayTrans = inArray.transpose();
-                    Shape inShape = arrayTrans.shape();
+                    Shape inShape = inArray.shape();
 
-                    NdArray<dtypeOut> returnArray(1, inShape.rows);
-                    for (uint32 row = 0; row < inShape.rows; ++row)
+                    NdArray<dtype> laneArray(1, inShape.rows);
+                    NdArray<dtypeOut> returnArray(1, inShape.cols);
+                    for (uint32 col = 0; col < inShape.cols; ++col)
                     {
-                        NdArray<dtypeOut> outValue = nanpercentile<dtypeOut>(NdArray<dtype>(arrayTrans.cbegin(row), arrayTrans.cend(row)),
-                            inPercentile, Axis::NONE, inInterpMethod);
+                        for (uint32 row = 0; row < inShape.rows; ++row)
+                        {
+                            laneArray[row] = inArray(row, col);
+                        }
+                        NdArray<dtypeOut> outValue = nanpercentile<dtypeOut>(laneArray, inPercentile, Axis::NONE, inInterpMethod);
 
                         if (outValue.size() == 1)
                         {
-                            returnArray[row] = outValue.item();
+                            returnArray[col] = outValue.item();
                         }
                         else
                         {
-                            returnArray[row] = Constants::nan;
+                            returnArray[col] = Constants::nan;
                         }
                     }
 
@@ -4270,6 +6959,52 @@ namespace NumCpp
             }
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Compute the qth percentile of the data along the specified axis, while ignoring nan values.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///		
+        /// @param				NdArray
+        /// @param				percentile, must be in the range [0, 100]
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        /// @param				(Optional) interpolation method
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& nanpercentile(const NdArray<dtype>& inArray, double inPercentile, NdArray<dtypeOut>& outArray,
+            Axis::Type inAxis = Axis::NONE, const std::string& inInterpMethod = "linear")
+        {
+            checkPercentileArgs(inPercentile, inInterpMethod);
+
+            // a single scratch buffer is reused for every lane, a lane without
+            // any valid values reports NaN
+            std::vector<double> values;
+            return reduceLaneRanges("nanpercentile", inArray, outArray, inAxis,
+                [&](const dtype* inFirst, const dtype* inLast) -> dtypeOut
+                {
+                    values.clear();
+                    for (const dtype* value = inFirst; value != inLast; ++value)
+                    {
+                        if (*value == *value)
+                        {
+                            values.push_back(static_cast<double>(*value));
+                        }
+                    }
+
+                    if (values.empty())
+                    {
+                        return static_cast<dtypeOut>(Constants::nan);
+                    }
+
+                    std::sort(values.begin(), values.end());
+                    return static_cast<dtypeOut>(sortedPercentile(values, inPercentile, inInterpMethod));
+                });
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return the product of array elements over a given axis treating Not a Numbers (NaNs) as ones.
@@ -4285,16 +7020,29 @@ namespace NumCpp
         template<typename dtypeOut = double>
         static NdArray<dtypeOut> nanprod(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
         {
-            NdArray<dtype> arrayCopy(inArray);
-            for (uint32 i = 0; i < arrayCopy.size(); ++i)
-            {
-                if (std::isnan(arrayCopy[i]))
-                {
-                    arrayCopy[i] = 1;
-                }
-            }
+            return std::move(NdArray<dtypeOut>(reduceLanes(inArray, inAxis, static_cast<dtypeOut>(1),
+                [](uint32, dtypeOut inProd, dtype inValue) -> dtypeOut { return inProd * (inValue == inValue ? static_cast<dtypeOut>(inValue) : static_cast<dtypeOut>(1)); })));
+        }
 
-            return std::move(prod<dtypeOut>(arrayCopy, inAxis));
+        //============================================================================
+        // Method Description: 
+        ///						Return the product of array elements over a given axis treating Not a Numbers (NaNs) as ones.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& nanprod(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            return reduceLanes("nanprod", inArray, outArray, inAxis, static_cast<dtypeOut>(1),
+                [](uint32, dtypeOut inResult, dtype inValue) -> dtypeOut { return inResult * (inValue == inValue ? static_cast<dtypeOut>(inValue) : static_cast<dtypeOut>(1)); },
+                [](dtypeOut inResult) { return inResult; });
         }
 
         //============================================================================
@@ -4356,82 +7104,52 @@ namespace NumCpp
         ///
         static NdArray<double> nanstd(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
         {
-            switch (inAxis)
-            {
-                case Axis::NONE:
-                {
-                    double meanValue = nanmean(inArray, inAxis).item();
-                    double sum = 0;
-                    double counter = 0;
-                    for (uint32 i = 0; i < inArray.size(); ++i)
-                    {
-                        if (std::isnan(inArray[i]))
-                        {
-                            continue;
-                        }
-
-                        sum += Utils<double>::sqr(static_cast<double>(inArray[i]) - meanValue);
-                        ++counter;
-                    }
-                    NdArray<double> returnArray = { std::sqrt(sum / counter) };
-                    return std::move(returnArray);
-                }
-                case Axis::COL:
+            typedef std::pair<double, double> SumCount;
+            const NdArray<double> meanValues = nanmean(inArray, inAxis);
+            std::vector<SumCount> lanes = reduceLanes(inArray, inAxis, SumCount(0.0, 0.0),
+                [&meanValues](uint32 inLane, const SumCount& inSumCount, dtype inValue) -> SumCount
                 {
-                    Shape inShape = inArray.shape();
-                    NdArray<double> meanValue = nanmean(inArray, inAxis);
-                    NdArray<double> returnArray(1, inShape.rows);
-                    for (uint32 row = 0; row < inShape.rows; ++row)
-                    {
-                        double sum = 0;
-                        double counter = 0;
-                        for (uint32 col = 0; col < inShape.cols; ++col)
-                        {
-                            if (std::isnan(inArray(row, col)))
-                            {
-                                continue;
-                            }
-
-                            sum += Utils<double>::sqr(static_cast<double>(inArray(row, col)) - meanValue[row]);
-                            ++counter;
-                        }
-                        returnArray(0, row) = std::sqrt(sum / counter);
-                    }
+                    const bool isValid = inValue == inValue;
+                    const double diff = isValid ? static_cast<double>(inValue) - meanValues[inLane] : 0.0;
+                    return SumCount(inSumCount.first + diff * diff, inSumCount.second + (isValid ? 1.0 : 0.0));
+                });
 
-                    return std::move(returnArray);
-                }
-                case Axis::ROW:
-                {
-                    NdArray<double> meanValue = nanmean(inArray, inAxis);
-                    NdArray<dtype> transposedArray = inArray.transpose();
-                    Shape inShape = transposedArray.shape();
-                    NdArray<double> returnArray(1, inShape.rows);
-                    for (uint32 row = 0; row < inShape.rows; ++row)
-                    {
-                        double sum = 0;
-                        double counter = 0;
-                        for (uint32 col = 0; col < inShape.cols; ++col)
-                        {
-                            if (std::isnan(transposedArray(row, col)))
-                            {
-                                continue;
-                            }
+            NdArray<double> returnArray(1, static_cast<uint32>(lanes.size()));
+            for (uint32 i = 0; i < returnArray.size(); ++i)
+            {
+                returnArray[i] = std::sqrt(lanes[i].first / lanes[i].second);
+            }
 
-                            sum += Utils<double>::sqr(static_cast<double>(transposedArray(row, col)) - meanValue[row]);
-                            ++counter;
-                        }
-                        returnArray(0, row) = std::sqrt(sum / counter);
-                    }
+            return std::move(returnArray);
+        }
 
-                    return std::move(returnArray);
-                }
-                default:
+        //============================================================================
+        // Method Description: 
+        ///						Compute the standard deviation along the specified axis, while ignoring NaNs.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<double>& nanstd(const NdArray<dtype>& inArray, NdArray<double>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            // the lane means go into outArray first, every lane is reduced
+            // before outArray is overwritten with the results
+            typedef std::pair<double, double> SumCount;
+            nanmean(inArray, outArray, inAxis);
+            return reduceLanes("nanstd", inArray, outArray, inAxis, SumCount(0.0, 0.0),
+                [&outArray](uint32 inLane, const SumCount& inSumCount, dtype inValue) -> SumCount
                 {
-                    // this isn't actually possible, just putting this here to get rid
-                    // of the compiler warning.
-                    return std::move(NdArray<double>(0));
-                }
-            }
+                    const bool isValid = inValue == inValue;
+                    const double diff = isValid ? static_cast<double>(inValue) - outArray[inLane] : 0.0;
+                    return SumCount(inSumCount.first + diff * diff, inSumCount.second + (isValid ? 1.0 : 0.0));
+                },
+                [](const SumCount& inSumCount) { return std::sqrt(inSumCount.first / inSumCount.second); });
         }
 
         //============================================================================
@@ -4449,16 +7167,31 @@ namespace NumCpp
         template<typename dtypeOut = double>
         static NdArray<dtypeOut> nansum(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
         {
-            NdArray<dtype> arrayCopy(inArray);
-            for (uint32 i = 0; i < arrayCopy.size(); ++i)
-            {
-                if (std::isnan(arrayCopy[i]))
-                {
-                    arrayCopy[i] = 0;
-                }
-            }
+            // NaNs are selected out rather than branched around (NaN != NaN) so
+            // the compiler is free to vectorize the accumulation
+            return std::move(NdArray<dtypeOut>(reduceLanes(inArray, inAxis, static_cast<dtypeOut>(0),
+                [](uint32, dtypeOut inSum, dtype inValue) -> dtypeOut { return inSum + (inValue == inValue ? static_cast<dtypeOut>(inValue) : static_cast<dtypeOut>(0)); })));
+        }
 
-            return std::move(Methods<dtypeOut>::sum(arrayCopy, inAxis));
+        //============================================================================
+        // Method Description: 
+        ///						Return the sum of array elements over a given axis treating Not a Numbers (NaNs) as zero.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& nansum(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            return reduceLanes("nansum", inArray, outArray, inAxis, static_cast<dtypeOut>(0),
+                [](uint32, dtypeOut inResult, dtype inValue) -> dtypeOut { return inResult + (inValue == inValue ? static_cast<dtypeOut>(inValue) : static_cast<dtypeOut>(0)); },
+                [](dtypeOut inResult) { return inResult; });
         }
 
         //============================================================================
@@ -4483,6 +7216,30 @@ namespace NumCpp
             return std::move(stdValues);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Compute the variance along the specified axis, while ignoring NaNs.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<double>& nanvar(const NdArray<dtype>& inArray, NdArray<double>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            nanstd(inArray, outArray, inAxis);
+            for (uint32 i = 0; i < outArray.size(); ++i)
+            {
+                outArray[i] *= outArray[i];
+            }
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Returns the number of bytes held by the array
@@ -4555,6 +7312,31 @@ namespace NumCpp
             return std::move(returnArray *= -1);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Numerical negative, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& negative(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: negative: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return static_cast<dtypeOut>(inValue) * static_cast<dtypeOut>(-1); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return the indices of the flattened array of the 
@@ -4606,6 +7388,39 @@ namespace NumCpp
             return std::move(inArray1 != inArray2);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Return (x1 != x2) element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.not_equal.html
+        ///		
+        /// @param			NdArray 1
+        /// @param			NdArray 2
+        ///				
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<bool>& not_equal(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<bool>& outArray)
+        {
+            if (inArray1.shape() != inArray2.shape())
+            {
+                throw std::invalid_argument("ERROR: not_equal: input array shapes are not consistant.");
+            }
+
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: not_equal: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
+                [](dtype inValue1, dtype inValue2) { return inValue1 != inValue2; });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return a new array of given shape and type, filled with ones.
@@ -4693,12 +7508,49 @@ namespace NumCpp
             outShape.cols += 2 * inPadWidth;
 
             NdArray<dtype> returnArray(outShape);
-            returnArray.fill(inPadValue);
-            returnArray.put(Slice(inPadWidth, inPadWidth + inShape.rows), Slice(inPadWidth, inPadWidth + inShape.cols), inArray);
+            pad(inArray, inPadWidth, inPadValue, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Pads an array into a pre-allocated output array.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.pad.html
+        ///		
+        /// @param				NdArray
+        /// @param				pad width
+        /// @param				pad value
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray
+        ///
+        static NdArray<dtype>& pad(const NdArray<dtype>& inArray, uint16 inPadWidth, dtype inPadValue, NdArray<dtype>& outArray)
+        {
+            const Shape inShape = inArray.shape();
+            const uint32 outCols = inShape.cols + 2 * inPadWidth;
+            if (outArray.shape() != Shape(inShape.rows + 2 * inPadWidth, outCols))
+            {
+                throw std::invalid_argument("ERROR: Methods::pad: output array shape is not consistant with the padded input.");
+            }
+
+            // each output row is written once: the top and bottom bands are
+            // contiguous fills and every interior row is fill/copy/fill
+            const uint32 bandSize = inPadWidth * outCols;
+            std::fill(outArray.begin(), outArray.begin() + bandSize, inPadValue);
+            for (uint32 row = 0; row < inShape.rows; ++row)
+            {
+                typename NdArray<dtype>::iterator outRow = outArray.begin(row + inPadWidth);
+                std::fill(outRow, outRow + inPadWidth, inPadValue);
+                std::copy(inArray.cbegin(row), inArray.cend(row), outRow + inPadWidth);
+                std::fill(outRow + inPadWidth + inShape.cols, outRow + outCols, inPadValue);
+            }
+            std::fill(outArray.end() - bandSize, outArray.end(), inPadValue);
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Rearranges the elements in the array in such a way that 
@@ -4864,6 +7716,38 @@ namespace NumCpp
             }
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Compute the qth percentile of the data along the specified axis.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///		
+        /// @param				NdArray
+        /// @param				percentile, must be in the range [0, 100]
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        /// @param				(Optional) interpolation method
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& percentile(const NdArray<dtype>& inArray, double inPercentile, NdArray<dtypeOut>& outArray,
+            Axis::Type inAxis = Axis::NONE, const std::string& inInterpMethod = "linear")
+        {
+            checkPercentileArgs(inPercentile, inInterpMethod);
+
+            // a single scratch buffer is reused for every lane
+            std::vector<double> values;
+            return reduceLaneRanges("percentile", inArray, outArray, inAxis,
+                [&](const dtype* inFirst, const dtype* inLast) -> dtypeOut
+                {
+                    values.assign(inFirst, inLast);
+                    std::sort(values.begin(), values.end());
+                    return static_cast<dtypeOut>(sortedPercentile(values, inPercentile, inInterpMethod));
+                });
+        }
+
         //============================================================================
         // Method Description: 
         ///						Raises the elements of the array to the input power
@@ -4879,12 +7763,37 @@ namespace NumCpp
         static NdArray<dtypeOut> power(const NdArray<dtype>& inArray, uint8 inExponent)
         {
             NdArray<dtypeOut> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(),
-                [inExponent](dtype inValue) { return Utils<dtypeOut>::power(static_cast<dtypeOut>(inValue), inExponent); });
+            power(inArray, inExponent, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Raises the elements of the array to the input power
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///		
+        /// @param				NdArray
+        /// @param				exponent
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& power(const NdArray<dtype>& inArray, uint8 inExponent, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: power: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [inExponent](dtype inValue) { return Utils<dtypeOut>::power(static_cast<dtypeOut>(inValue), inExponent); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Raises the elements of the array to the input powers
@@ -4898,17 +7807,42 @@ namespace NumCpp
         ///
         template<typename dtypeOut = double>
         static NdArray<dtypeOut> power(const NdArray<dtype>& inArray, const NdArray<uint8>& inExponents)
+        {
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            power(inArray, inExponents, returnArray);
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Raises the elements of the array to the input powers
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray of exponents
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& power(const NdArray<dtype>& inArray, const NdArray<uint8>& inExponents, NdArray<dtypeOut>& outArray)
         {
             if (inArray.shape() != inExponents.shape())
             {
                 throw std::invalid_argument("ERROR: power: input array shapes are not consistant.");
             }
 
-            NdArray<dtypeOut> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), inExponents.cbegin(), returnArray.begin(),
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: power: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), inExponents.cbegin(), outArray.begin(),
                 [](dtype inValue, uint8 inExponent) { return Utils<dtypeOut>::power(static_cast<dtypeOut>(inValue), inExponent); });
 
-            return std::move(returnArray);
+            return outArray;
         }
 
         //============================================================================
@@ -4942,6 +7876,80 @@ namespace NumCpp
             return std::move(inArray.prod<dtypeOut>(inAxis));
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Return the product of array elements over a given axis.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.prod.html
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& prod(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            Shape inShape = inArray.shape();
+            switch (inAxis)
+            {
+                case Axis::NONE:
+                {
+                    if (outArray.shape() != Shape(1, 1))
+                    {
+                        throw std::invalid_argument("ERROR: prod: output array shape is not consistant with the reduction axis.");
+                    }
+
+                    outArray[0] = std::accumulate(inArray.cbegin(), inArray.cend(), static_cast<dtypeOut>(1),
+                        [](dtypeOut inResult, dtype inValue) { return inResult * static_cast<dtypeOut>(inValue); });
+                    return outArray;
+                }
+                case Axis::COL:
+                {
+                    if (outArray.shape() != Shape(1, inShape.rows))
+                    {
+                        throw std::invalid_argument("ERROR: prod: output array shape is not consistant with the reduction axis.");
+                    }
+
+                    for (uint32 row = 0; row < inShape.rows; ++row)
+                    {
+                        outArray[row] = std::accumulate(inArray.cbegin(row), inArray.cend(row), static_cast<dtypeOut>(1),
+                            [](dtypeOut inResult, dtype inValue) { return inResult * static_cast<dtypeOut>(inValue); });
+                    }
+
+                    return outArray;
+                }
+                case Axis::ROW:
+                {
+                    if (outArray.shape() != Shape(1, inShape.cols))
+                    {
+                        throw std::invalid_argument("ERROR: prod: output array shape is not consistant with the reduction axis.");
+                    }
+
+                    // accumulate a row at a time so the input is walked contiguously
+                    std::transform(inArray.cbegin(0), inArray.cend(0), outArray.begin(),
+                        [](dtype inValue) { return static_cast<dtypeOut>(inValue); });
+                    for (uint32 row = 1; row < inShape.rows; ++row)
+                    {
+                        std::transform(outArray.cbegin(), outArray.cend(), inArray.cbegin(row), outArray.begin(),
+                            [](dtypeOut inResult, dtype inValue) { return inResult * static_cast<dtypeOut>(inValue); });
+                    }
+
+                    return outArray;
+                }
+                default:
+                {
+                    // this isn't actually possible, just putting this here to get rid
+                    // of the compiler warning.
+                    return outArray;
+                }
+            }
+        }
+
         //============================================================================
         // Method Description: 
         ///						Range of values (maximum - minimum) along an axis.
@@ -4958,6 +7966,29 @@ namespace NumCpp
             return std::move(inArray.ptp(inAxis));
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Range of values (maximum - minimum) along an axis.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& ptp(const NdArray<dtype>& inArray, NdArray<dtype>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            return reduceLaneRanges("ptp", inArray, outArray, inAxis,
+                [](const dtype* inFirst, const dtype* inLast) -> dtype
+                {
+                    std::pair<const dtype*, const dtype*> result = std::minmax_element(inFirst, inLast);
+                    return *result.second - *result.first;
+                });
+        }
+
         //============================================================================
         // Method Description: 
         ///						Replaces specified elements of an array with given values.
@@ -5080,11 +8111,35 @@ namespace NumCpp
         static NdArray<double> rad2deg(const NdArray<dtype>& inArray)
         {
             NdArray<double> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(), [](dtype inValue) { return rad2deg(inValue); });
+            rad2deg(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Convert angles from radians to degrees.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<double>& rad2deg(const NdArray<dtype>& inArray, NdArray<double>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: rad2deg: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return rad2deg(inValue); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return the reciprocal of the argument, element-wise.
@@ -5103,12 +8158,34 @@ namespace NumCpp
         static NdArray<dtypeOut> reciprocal(const NdArray<dtype>& inArray)
         {
             NdArray<dtypeOut> returnArray(inArray.shape());
-            for (uint32 i = 0; i < returnArray.size(); ++i)
+            reciprocal(inArray, returnArray);
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Return the reciprocal of the argument, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& reciprocal(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
             {
-                returnArray[i] = static_cast<dtypeOut>(1.0 / static_cast<double>(inArray[i]));
+                throw std::invalid_argument("ERROR: reciprocal: output array shape is not consistant with the input array.");
             }
 
-            return std::move(returnArray);
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return static_cast<dtypeOut>(1.0 / static_cast<double>(inValue)); });
+
+            return outArray;
         }
 
         //============================================================================
@@ -5143,17 +8220,42 @@ namespace NumCpp
         ///
         template<typename dtypeOut = double>
         static NdArray<dtypeOut> remainder(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
+        {
+            NdArray<dtypeOut> returnArray(inArray1.shape());
+            remainder(inArray1, inArray2, returnArray);
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Return element-wise remainder of division.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the input arrays.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& remainder(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, NdArray<dtypeOut>& outArray)
         {
             if (inArray1.shape() != inArray2.shape())
             {
                 throw std::invalid_argument("ERROR: remainder: input array shapes are not consistant.");
             }
 
-            NdArray<dtypeOut> returnArray(inArray1.shape());
-            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), returnArray.begin(),
+            if (outArray.shape() != inArray1.shape())
+            {
+                throw std::invalid_argument("ERROR: remainder: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray1.cbegin(), inArray1.cend(), inArray2.cbegin(), outArray.begin(),
                 [](dtype inValue1, dtype inValue2) { return std::remainder(static_cast<dtypeOut>(inValue1), static_cast<dtypeOut>(inValue2)); });
 
-            return std::move(returnArray);
+            return outArray;
         }
 
         //============================================================================
@@ -5364,6 +8466,34 @@ namespace NumCpp
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Round elements of the array to the nearest integer.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.rint.html
+        ///		
+        /// @param
+        ///				NdArray 
+        ///
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& rint(const NdArray<dtype>& inArray, NdArray<dtype>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: rint: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return static_cast<dtype>(std::rint(inValue)); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Roll array elements along a given axis.
@@ -5389,8 +8519,8 @@ namespace NumCpp
                         shift = inArray.size() - shift;
                     }
 
-                    NdArray<dtype> returnArray(inArray);
-                    std::rotate(returnArray.begin(), returnArray.begin() + shift, returnArray.end());
+                    NdArray<dtype> returnArray(inArray.shape());
+                    std::rotate_copy(inArray.cbegin(), inArray.cbegin() + shift, inArray.cend(), returnArray.begin());
 
                     return std::move(returnArray);
                 }
@@ -5404,10 +8534,10 @@ namespace NumCpp
                         shift = inShape.cols - shift;
                     }
 
-                    NdArray<dtype> returnArray(inArray);
+                    NdArray<dtype> returnArray(inShape);
                     for (uint32 row = 0; row < inShape.rows; ++row)
                     {
-                        std::rotate(returnArray.begin(row), returnArray.begin(row) + shift, returnArray.end(row));
+                        std::rotate_copy(inArray.cbegin(row), inArray.cbegin(row) + shift, inArray.cend(row), returnArray.begin(row));
                     }
 
                     return std::move(returnArray);
@@ -5422,13 +8552,12 @@ namespace NumCpp
                         shift = inShape.rows - shift;
                     }
 
-                    NdArray<dtype> returnArray = inArray.transpose();
-                    for (uint32 row = 0; row < inShape.cols; ++row)
-                    {
-                        std::rotate(returnArray.begin(row), returnArray.begin(row) + shift, returnArray.end(row));
-                    }
+                    // rows are contiguous, so rolling them is a rotation of the
+                    // flat buffer by whole rows
+                    NdArray<dtype> returnArray(inShape);
+                    std::rotate_copy(inArray.cbegin(), inArray.cbegin() + shift * inShape.cols, inArray.cend(), returnArray.begin());
 
-                    return std::move(returnArray.transpose());
+                    return std::move(returnArray);
                 }
                 default:
                 {
@@ -5453,28 +8582,7 @@ namespace NumCpp
         ///
         static NdArray<dtype> rot90(const NdArray<dtype>& inArray, uint8 inK = 1)
         {
-            inK %= 4;
-            switch (inK)
-            {
-                case 1:
-                {
-                    return std::move(flipud(inArray.transpose()));
-                }
-                case 2:
-                {
-                    return std::move(flip(inArray, Axis::NONE));
-                }
-                case 3:
-                {
-                    return std::move(fliplr(inArray.transpose()));
-                }
-                default:
-                {
-                    // this isn't actually possible, just putting this here to get rid
-                    // of the compiler warning.
-                    return std::move(NdArray<dtype>(0));
-                }
-            }
+            return std::move(StridedView<dtype>(inArray).rot90(inK).toNdArray());
         }
 
         //============================================================================
@@ -5508,6 +8616,39 @@ namespace NumCpp
             return std::move(inArray.round(inDecimals));
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Round an array to the given number of decimals.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///		
+        /// @param				NdArray
+        /// @param				number of decimals
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& round(const NdArray<dtype>& inArray, uint8 inDecimals, NdArray<dtype>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: round: output array shape is not consistant with the input array.");
+            }
+
+            if (DtypeInfo<dtype>::isInteger())
+            {
+                std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(), [](dtype inValue) { return inValue; });
+            }
+            else
+            {
+                const double multFactor = Utils<double>::power(10.0, inDecimals);
+                std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                    [multFactor](dtype inValue) { return static_cast<dtype>(std::round(static_cast<double>(inValue) * multFactor) / multFactor); });
+            }
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Stack arrays in sequence vertically (row wise).
@@ -5520,40 +8661,24 @@ namespace NumCpp
         ///
         static NdArray<dtype> row_stack(const std::initializer_list<NdArray<dtype> >& inArrayList)
         {
-            // first loop through to calculate the final size of the array
-            typename std::initializer_list<NdArray<dtype> >::iterator iter;
-            Shape finalShape;
-            for (iter = inArrayList.begin(); iter < inArrayList.end(); ++iter)
-            {
-                if (finalShape.isnull())
-                {
-                    finalShape = iter->shape();
-                }
-                else if (iter->shape().cols != finalShape.cols)
-                {
-                    throw std::invalid_argument("ERROR: row_stack: input arrays must have the same number of columns.");
-                }
-                else
-                {
-                    finalShape.rows += iter->shape().rows;
-                }
-            }
+            return std::move(row_stack(inArrayList.begin(), inArrayList.end()));
+        }
 
-            // now that we know the final size, contruct the output array
-            NdArray<dtype> returnArray(finalShape);
-            uint32 rowStart = 0;
-            for (iter = inArrayList.begin(); iter < inArrayList.end(); ++iter)
-            {
-                Shape theShape = iter->shape();
-                for (uint32 row = 0; row < theShape.rows; ++row)
-                {
-                    for (uint32 col = 0; col < theShape.cols; ++col)
-                    {
-                        returnArray(rowStart + row, col) = iter->operator()(row, col);
-                    }
-                }
-                rowStart += theShape.rows;
-            }
+        //============================================================================
+        // Method Description: 
+        ///						Stack arrays in sequence vertically (row wise).
+        ///
+        /// @param				iterator to the first NdArray to stack
+        /// @param				iterator one past the last NdArray to stack
+        ///
+        /// @return
+        ///				NdArray
+        ///
+        template<typename Iterator>
+        static NdArray<dtype> row_stack(Iterator inFirst, Iterator inLast)
+        {
+            NdArray<dtype> returnArray(stackedShape(inFirst, inLast, Axis::ROW));
+            stackCopy(inFirst, inLast, returnArray, Axis::ROW);
 
             return std::move(returnArray);
         }
@@ -5639,14 +8764,38 @@ namespace NumCpp
         /// @param
         ///				NdArray 
         /// @return
-        ///				NdArray
+        ///				NdArray
+        ///
+        static NdArray<int8> sign(const NdArray<dtype>& inArray)
+        {
+            NdArray<int8> returnArray(inArray.shape());
+            sign(inArray, returnArray);
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Returns an element-wise indication of the sign of a number.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
         ///
-        static NdArray<int8> sign(const NdArray<dtype>& inArray)
+        static NdArray<int8>& sign(const NdArray<dtype>& inArray, NdArray<int8>& outArray)
         {
-            NdArray<int8> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(), [](dtype inValue) { return sign(inValue); });
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: sign: output array shape is not consistant with the input array.");
+            }
 
-            return std::move(returnArray);
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return sign(inValue); });
+
+            return outArray;
         }
 
         //============================================================================
@@ -5711,14 +8860,44 @@ namespace NumCpp
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> sin(const NdArray<dtype>& inArray)
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> sin(const NdArray<dtype>& inArray)
         {
-            NdArray<double> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(), [](dtype inValue) { return sin(inValue); });
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            sin(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Trigonometric sine, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.sin.html
+        ///		
+        /// @param
+        ///				NdArray 
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& sin(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: sin: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return static_cast<dtypeOut>(inValue); });
+            FastMath<dtypeOut>::sin(outArray.cbegin(), outArray.cend(), outArray.begin());
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return the sinc function.
@@ -5786,14 +8965,43 @@ namespace NumCpp
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> sinh(const NdArray<dtype>& inArray)
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> sinh(const NdArray<dtype>& inArray)
         {
-            NdArray<double> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(), [](dtype inValue) { return sinh(inValue); });
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            sinh(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Hyperbolic sine, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.sinh.html
+        ///		
+        /// @param
+        ///				NdArray 
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& sinh(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: sinh: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return std::sinh(static_cast<dtypeOut>(inValue)); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return the number of elements.
@@ -5853,14 +9061,43 @@ namespace NumCpp
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> sqrt(const NdArray<dtype>& inArray)
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> sqrt(const NdArray<dtype>& inArray)
         {
-            NdArray<double> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(), [](dtype inValue) { return sqrt(inValue); });
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            sqrt(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Return the positive square-root of an array, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.sqrt.html
+        ///		
+        /// @param
+        ///				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& sqrt(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: sqrt: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return std::sqrt(static_cast<dtypeOut>(inValue)); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return the square of an array.
@@ -5896,6 +9133,33 @@ namespace NumCpp
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Return the square of an array, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.square.html
+        ///		
+        /// @param
+        ///				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& square(const NdArray<dtype>& inArray, NdArray<dtype>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: square: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return static_cast<dtype>(square(inValue)); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Compute the standard deviation along the specified axis.
@@ -5912,6 +9176,25 @@ namespace NumCpp
             return std::move(inArray.std(inAxis));
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Compute the standard deviation along the specified axis.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<double>& std(const NdArray<dtype>& inArray, NdArray<double>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            return reduceLaneRanges("std", inArray, outArray, inAxis,
+                [](const dtype* inFirst, const dtype* inLast) -> double { return std::sqrt(laneVariance(inFirst, inLast)); });
+        }
+
         //============================================================================
         // Method Description: 
         ///						Sum of array elements over a given axis.
@@ -5929,6 +9212,80 @@ namespace NumCpp
             return std::move(inArray.sum<dtypeOut>(inAxis));
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Sum of array elements over a given axis.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.sum.html
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				Axis
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& sum(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            Shape inShape = inArray.shape();
+            switch (inAxis)
+            {
+                case Axis::NONE:
+                {
+                    if (outArray.shape() != Shape(1, 1))
+                    {
+                        throw std::invalid_argument("ERROR: sum: output array shape is not consistant with the reduction axis.");
+                    }
+
+                    outArray[0] = std::accumulate(inArray.cbegin(), inArray.cend(), static_cast<dtypeOut>(0),
+                        [](dtypeOut inResult, dtype inValue) { return inResult + static_cast<dtypeOut>(inValue); });
+                    return outArray;
+                }
+                case Axis::COL:
+                {
+                    if (outArray.shape() != Shape(1, inShape.rows))
+                    {
+                        throw std::invalid_argument("ERROR: sum: output array shape is not consistant with the reduction axis.");
+                    }
+
+                    for (uint32 row = 0; row < inShape.rows; ++row)
+                    {
+                        outArray[row] = std::accumulate(inArray.cbegin(row), inArray.cend(row), static_cast<dtypeOut>(0),
+                            [](dtypeOut inResult, dtype inValue) { return inResult + static_cast<dtypeOut>(inValue); });
+                    }
+
+                    return outArray;
+                }
+                case Axis::ROW:
+                {
+                    if (outArray.shape() != Shape(1, inShape.cols))
+                    {
+                        throw std::invalid_argument("ERROR: sum: output array shape is not consistant with the reduction axis.");
+                    }
+
+                    // accumulate a row at a time so the input is walked contiguously
+                    std::transform(inArray.cbegin(0), inArray.cend(0), outArray.begin(),
+                        [](dtype inValue) { return static_cast<dtypeOut>(inValue); });
+                    for (uint32 row = 1; row < inShape.rows; ++row)
+                    {
+                        std::transform(outArray.cbegin(), outArray.cend(), inArray.cbegin(row), outArray.begin(),
+                            [](dtypeOut inResult, dtype inValue) { return inResult + static_cast<dtypeOut>(inValue); });
+                    }
+
+                    return outArray;
+                }
+                default:
+                {
+                    // this isn't actually possible, just putting this here to get rid
+                    // of the compiler warning.
+                    return outArray;
+                }
+            }
+        }
+
         //============================================================================
         // Method Description: 
         ///						Interchange two axes of an array.
@@ -5972,14 +9329,44 @@ namespace NumCpp
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> tan(const NdArray<dtype>& inArray)
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> tan(const NdArray<dtype>& inArray)
         {
-            NdArray<double> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(), [](dtype inValue) { return tan(inValue); });
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            tan(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Compute tangent element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.tan.html
+        ///		
+        /// @param
+        ///				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& tan(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: tan: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return static_cast<dtypeOut>(inValue); });
+            FastMath<dtypeOut>::tan(outArray.cbegin(), outArray.cend(), outArray.begin());
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Compute hyperbolic tangent.
@@ -6007,14 +9394,43 @@ namespace NumCpp
         /// @return
         ///				NdArray
         ///
-        static NdArray<double> tanh(const NdArray<dtype>& inArray)
+        template<typename dtypeOut = double>
+        static NdArray<dtypeOut> tanh(const NdArray<dtype>& inArray)
         {
-            NdArray<double> returnArray(inArray.shape());
-            std::transform(inArray.cbegin(), inArray.cend(), returnArray.begin(), [](dtype inValue) { return tanh(inValue); });
+            NdArray<dtypeOut> returnArray(inArray.shape());
+            tanh(inArray, returnArray);
 
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Compute hyperbolic tangent element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.tanh.html
+        ///		
+        /// @param
+        ///				NdArray
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        static NdArray<dtypeOut>& tanh(const NdArray<dtype>& inArray, NdArray<dtypeOut>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: tanh: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return std::tanh(static_cast<dtypeOut>(inValue)); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Construct an array by repeating A the number of times given by reps.
@@ -6512,6 +9928,34 @@ namespace NumCpp
             return std::move(returnArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Return the truncated value of the input, element-wise.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the input. outArray may be the input array itself.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.trunc.html
+        ///		
+        /// @param
+        ///				NdArray 
+        ///
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& trunc(const NdArray<dtype>& inArray, NdArray<dtype>& outArray)
+        {
+            if (outArray.shape() != inArray.shape())
+            {
+                throw std::invalid_argument("ERROR: trunc: output array shape is not consistant with the input array.");
+            }
+
+            std::transform(inArray.cbegin(), inArray.cend(), outArray.begin(),
+                [](dtype inValue) { return static_cast<dtype>(std::trunc(inValue)); });
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Find the union of two arrays.
@@ -6625,6 +10069,30 @@ namespace NumCpp
             return std::move(inArray.var(inAxis));
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Compute the variance along the specified axis.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						reduced shape: 1x1 for Axis::NONE, 1xrows for Axis::COL, and 1xcols for
+        ///						Axis::ROW. outArray must not be the input array.
+        ///		
+        /// @param				NdArray
+        /// @param				NdArray, output array
+        /// @param				(Optional) axis
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<double>& var(const NdArray<dtype>& inArray, NdArray<double>& outArray, Axis::Type inAxis = Axis::NONE)
+        {
+            std(inArray, outArray, inAxis);
+            for (uint32 i = 0; i < outArray.size(); ++i)
+            {
+                outArray[i] *= outArray[i];
+            }
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Compute the variance along the specified axis.
@@ -6642,6 +10110,79 @@ namespace NumCpp
             return std::move(row_stack(inArrayList));
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Stack arrays in sequence vertically (row wise).
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.vstack.html
+        ///		
+        /// @param				iterator to the first NdArray to stack
+        /// @param				iterator one past the last NdArray to stack
+        /// @return
+        ///				NdArray
+        ///
+        template<typename Iterator>
+        static NdArray<dtype> vstack(Iterator inFirst, Iterator inLast)
+        {
+            return std::move(row_stack(inFirst, inLast));
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Return elements chosen from x or y depending on condition.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.where.html
+        ///		
+        /// @param				NdArray, mask
+        /// @param				NdArray, values where the mask is true
+        /// @param				NdArray, values where the mask is false
+        /// @return
+        ///				NdArray
+        ///
+        static NdArray<dtype> where(const NdArray<bool>& inMask, const NdArray<dtype>& inA, const NdArray<dtype>& inB)
+        {
+            NdArray<dtype> returnArray(inMask.shape());
+            where(inMask, inA, inB, returnArray);
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Return elements chosen from x or y depending on condition.
+        ///						The result is written into outArray, which must be preallocated to the
+        ///						shape of the inputs. outArray may be either of the value arrays.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.where.html
+        ///		
+        /// @param				NdArray, mask
+        /// @param				NdArray, values where the mask is true
+        /// @param				NdArray, values where the mask is false
+        /// @param				NdArray, output array
+        /// @return
+        ///				NdArray&
+        ///
+        static NdArray<dtype>& where(const NdArray<bool>& inMask, const NdArray<dtype>& inA, const NdArray<dtype>& inB, NdArray<dtype>& outArray)
+        {
+            if (inA.shape() != inMask.shape() || inB.shape() != inMask.shape())
+            {
+                throw std::invalid_argument("ERROR: where: input array shapes are not consistant.");
+            }
+
+            if (outArray.shape() != inMask.shape())
+            {
+                throw std::invalid_argument("ERROR: where: output array shape is not consistant with the input arrays.");
+            }
+
+            const uint32 size = inMask.size();
+            for (uint32 i = 0; i < size; ++i)
+            {
+                outArray[i] = inMask[i] ? inA[i] : inB[i];
+            }
+
+            return outArray;
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return a new array of given shape and type, filled with zeros.
@@ -0,0 +1,630 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+/// @version 1.0
+///
+/// @section LICENSE
+/// Copyright 2018 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software 
+/// without restriction, including without limitation the rights to use, copy, modify, 
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to 
+/// permit persons to whom the Software is furnished to do so, subject to the following 
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies 
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+/// DEALINGS IN THE SOFTWARE.
+///
+/// @section DESCRIPTION
+/// Binary morphology on bit-packed masks
+///
+#pragma once
+
+#include"NumCpp/NdArray.hpp"
+#include"NumCpp/Shape.hpp"
+#include"NumCpp/Types.hpp"
+
+#include<algorithm>
+#include<stdexcept>
+#include<string>
+#include<utility>
+#include<vector>
+
+namespace NumCpp
+{
+    //================================================================================
+    ///						Binary dilation and erosion with a (2 * radius + 1) square
+    ///						structuring element. The masks are packed 64 pixels to a word
+    ///						and the square is applied separably: along the rows with
+    ///						word shifts that double the window each step, so a row costs
+    ///						log2 of the window width word passes, and down the columns with
+    ///						the van Herk/Gil-Werman running extreme, three word operations
+    ///						per word whatever the radius. Pixels off the edges of the mask
+    ///						count as not set, the same as scipy.ndimage with its default
+    ///						border_value of 0.
+    ///
+    ///						eg NdArray<bool> grown = Morphology::dilate(exceedances, 2);
+    class Morphology
+    {
+    public:
+        //================================================================================
+        ///						A binary mask packed 64 pixels to a word, least significant
+        ///						bit first. Each row starts on a word of its own and the bits
+        ///						past the last column are always clear.
+        class BitMask
+        {
+        private:
+            //==============================Attributes====================================
+            uint32                  numRows_;
+            uint32                  numCols_;
+            uint32                  wordsPerRow_;
+            std::vector<uint64>     words_;
+
+            //============================================================================
+            ///						Number of words that hold a row of inNumCols pixels
+            ///		
+            /// @param      number of columns
+            ///
+            /// @return     uint32
+            ///
+            static uint32 wordsFor(uint32 inNumCols)
+            {
+                return static_cast<uint32>((static_cast<uint64>(inNumCols) + 63) / 64);
+            }
+
+            //============================================================================
+            ///						Combines two words, OR for a dilation and AND for an erosion
+            ///		
+            /// @param      word
+            /// @param      word
+            /// @param      dilate or erode
+            ///
+            /// @return     uint64
+            ///
+            static uint64 combine(uint64 inWord1, uint64 inWord2, bool inDilate)
+            {
+                return inDilate ? inWord1 | inWord2 : inWord1 & inWord2;
+            }
+
+            //============================================================================
+            ///						Shifts a row of bits towards its start, out[i] = in[i + inShift],
+            ///						filling with clear bits past the end
+            ///		
+            /// @param      input words
+            /// @param      output words, may not be the input
+            /// @param      number of words
+            /// @param      number of bits to shift by
+            ///
+            /// @return     None
+            ///
+            static void shiftDown(const uint64* inWords, uint64* outWords, uint32 inNumWords, uint64 inShift)
+            {
+                const uint64 wordShift = inShift / 64;
+                const uint32 bitShift = static_cast<uint32>(inShift % 64);
+                for (uint32 word = 0; word < inNumWords; ++word)
+                {
+                    const uint64 source = word + wordShift;
+                    uint64 value = source < inNumWords ? inWords[source] >> bitShift : 0;
+                    if (bitShift != 0 && source + 1 < inNumWords)
+                    {
+                        value |= inWords[source + 1] << (64 - bitShift);
+                    }
+                    outWords[word] = value;
+                }
+            }
+
+            //============================================================================
+            ///						Shifts a row of bits towards its end, out[i] = in[i - inShift],
+            ///						filling with clear bits before the start
+            ///		
+            /// @param      input words
+            /// @param      number of input words
+            /// @param      output words, may not be the input
+            /// @param      number of output words
+            /// @param      number of bits to shift by
+            ///
+            /// @return     None
+            ///
+            static void shiftUp(const uint64* inWords, uint32 inNumWords, uint64* outWords, uint32 inNumOutWords, uint64 inShift)
+            {
+                const uint64 wordShift = inShift / 64;
+                const uint32 bitShift = static_cast<uint32>(inShift % 64);
+                for (uint32 word = 0; word < inNumOutWords; ++word)
+                {
+                    uint64 value = 0;
+                    if (word >= wordShift)
+                    {
+                        const uint64 source = word - wordShift;
+                        if (source < inNumWords)
+                        {
+                            value = inWords[source] << bitShift;
+                        }
+                        if (bitShift != 0 && source >= 1 && source - 1 < inNumWords)
+                        {
+                            value |= inWords[source - 1] >> (64 - bitShift);
+                        }
+                    }
+                    outWords[word] = value;
+                }
+            }
+
+            //============================================================================
+            ///						Throws if the other mask is not the same shape
+            ///		
+            /// @param      BitMask
+            /// @param      name of the calling function for the error message
+            ///
+            /// @return     None
+            ///
+            void checkShape(const BitMask& inOther, const char* inFunctionName) const
+            {
+                if (numRows_ != inOther.numRows_ || numCols_ != inOther.numCols_)
+                {
+                    throw std::invalid_argument(std::string("ERROR: NumCpp::Morphology::BitMask::") + inFunctionName + ": input masks must be the same shape.");
+                }
+            }
+
+            //============================================================================
+            ///						Clears the bits past the last column of every row
+            ///		
+            /// @return     None
+            ///
+            void clearPadding()
+            {
+                const uint32 usedBits = numCols_ % 64;
+                if (usedBits == 0)
+                {
+                    return;
+                }
+
+                const uint64 keep = (static_cast<uint64>(1) << usedBits) - 1;
+                for (uint32 row = 0; row < numRows_; ++row)
+                {
+                    words_[(static_cast<uint64>(row) + 1) * wordsPerRow_ - 1] &= keep;
+                }
+            }
+
+            //============================================================================
+            ///						Applies the window [col - inRadius, col + inRadius] along
+            ///						every row. The row is first shifted inRadius bits along so
+            ///						that the window of each output starts at its own column,
+            ///						then the window of width w is built from the ones of width
+            ///						w / 2, doubling each step.
+            ///		
+            /// @param      radius
+            /// @param      dilate or erode
+            ///
+            /// @return     None
+            ///
+            void windowRows(uint32 inRadius, bool inDilate)
+            {
+                const uint32 radius = std::min(inRadius, numCols_);
+                const uint64 windowSize = 2 * static_cast<uint64>(radius) + 1;
+                const uint32 numWords = wordsFor(numCols_ + radius);
+
+                std::vector<uint64> shifted(numWords);
+                std::vector<uint64> power(numWords);
+                std::vector<uint64> window(numWords);
+                std::vector<uint64> scratch(numWords);
+                for (uint32 row = 0; row < numRows_; ++row)
+                {
+                    uint64* rowWords = &words_[static_cast<uint64>(row) * wordsPerRow_];
+                    shiftUp(rowWords, wordsPerRow_, &shifted[0], numWords, radius);
+
+                    // power[i] combines shifted[i, i + powerSize), window[i] combines shifted[i, i + windowFilled)
+                    power = shifted;
+                    uint64 powerSize = 1;
+                    uint64 windowFilled = 0;
+                    for (uint64 remaining = windowSize; remaining > 0; remaining >>= 1)
+                    {
+                        if ((remaining & 1) != 0)
+                        {
+                            shiftDown(&power[0], &scratch[0], numWords, windowFilled);
+                            for (uint32 word = 0; word < numWords; ++word)
+                            {
+                                window[word] = windowFilled == 0 ? scratch[word] : combine(window[word], scratch[word], inDilate);
+                            }
+                            windowFilled += powerSize;
+                        }
+
+                        if (remaining > 1)
+                        {
+                            shiftDown(&power[0], &scratch[0], numWords, powerSize);
+                            for (uint32 word = 0; word < numWords; ++word)
+                            {
+                                power[word] = combine(power[word], scratch[word], inDilate);
+                            }
+                            powerSize *= 2;
+                        }
+                    }
+
+                    std::copy(window.begin(), window.begin() + wordsPerRow_, rowWords);
+                }
+                clearPadding();
+            }
+
+            //============================================================================
+            ///						Applies the window [row - inRadius, row + inRadius] down
+            ///						every column of words. With the rows padded by inRadius
+            ///						clear rows on both sides and cut into blocks of the window
+            ///						size, every window is the suffix of one block combined with
+            ///						the prefix of the next.
+            ///		
+            /// @param      radius
+            /// @param      dilate or erode
+            ///
+            /// @return     None
+            ///
+            void windowCols(uint32 inRadius, bool inDilate)
+            {
+                const uint32 radius = std::min(inRadius, numRows_);
+                const uint64 windowSize = 2 * static_cast<uint64>(radius) + 1;
+                const uint64 paddedRows = static_cast<uint64>(numRows_) + 2 * radius;
+
+                std::vector<uint64> prefix(paddedRows * wordsPerRow_);
+                std::vector<uint64> suffix(paddedRows * wordsPerRow_);
+                for (uint64 blockStart = 0; blockStart < paddedRows; blockStart += windowSize)
+                {
+                    const uint64 blockEnd = std::min(blockStart + windowSize, paddedRows);
+                    for (uint64 paddedRow = blockStart; paddedRow < blockEnd; ++paddedRow)
+                    {
+                        const bool inside = paddedRow >= radius && paddedRow < radius + static_cast<uint64>(numRows_);
+                        for (uint32 word = 0; word < wordsPerRow_; ++word)
+                        {
+                            const uint64 value = inside ? words_[(paddedRow - radius) * wordsPerRow_ + word] : 0;
+                            prefix[paddedRow * wordsPerRow_ + word] = paddedRow == blockStart ? value :
+                                combine(prefix[(paddedRow - 1) * wordsPerRow_ + word], value, inDilate);
+                        }
+                    }
+
+                    for (uint64 paddedRow = blockEnd; paddedRow-- > blockStart;)
+                    {
+                        const bool inside = paddedRow >= radius && paddedRow < radius + static_cast<uint64>(numRows_);
+                        for (uint32 word = 0; word < wordsPerRow_; ++word)
+                        {
+                            const uint64 value = inside ? words_[(paddedRow - radius) * wordsPerRow_ + word] : 0;
+                            suffix[paddedRow * wordsPerRow_ + word] = paddedRow + 1 == blockEnd ? value :
+                                combine(suffix[(paddedRow + 1) * wordsPerRow_ + word], value, inDilate);
+                        }
+                    }
+                }
+
+                // the window of row i is padded rows [i, i + windowSize)
+                for (uint32 row = 0; row < numRows_; ++row)
+                {
+                    const uint64 first = static_cast<uint64>(row) * wordsPerRow_;
+                    const uint64 last = (static_cast<uint64>(row) + windowSize - 1) * wordsPerRow_;
+                    for (uint32 word = 0; word < wordsPerRow_; ++word)
+                    {
+                        words_[first + word] = combine(suffix[first + word], prefix[last + word], inDilate);
+                    }
+                }
+            }
+
+        public:
+            //============================================================================
+            ///						Default Constructor, an empty mask
+            ///		
+            /// @return     None
+            ///
+            BitMask() :
+                numRows_(0),
+                numCols_(0),
+                wordsPerRow_(0)
+            {}
+
+            //============================================================================
+            ///						Constructor, a mask with no pixels set
+            ///		
+            /// @param      number of rows
+            /// @param      number of columns
+            ///
+            /// @return     None
+            ///
+            BitMask(uint32 inNumRows, uint32 inNumCols) :
+                numRows_(inNumRows),
+                numCols_(inNumCols),
+                wordsPerRow_(wordsFor(inNumCols)),
+                words_(static_cast<uint64>(inNumRows) * wordsFor(inNumCols), 0)
+            {}
+
+            //============================================================================
+            ///						Constructor, packs a boolean array
+            ///		
+            /// @param      NdArray<bool>
+            ///
+            /// @return     None
+            ///
+            explicit BitMask(const NdArray<bool>& inMask) :
+                numRows_(inMask.shape().rows),
+                numCols_(inMask.shape().cols),
+                wordsPerRow_(wordsFor(inMask.shape().cols)),
+                words_(static_cast<uint64>(inMask.shape().rows) * wordsFor(inMask.shape().cols), 0)
+            {
+                NdArray<bool>::const_iterator pixel = inMask.cbegin();
+                for (uint32 row = 0; row < numRows_; ++row)
+                {
+                    uint64* rowWords = &words_[static_cast<uint64>(row) * wordsPerRow_];
+                    for (uint32 col = 0; col < numCols_; ++col, ++pixel)
+                    {
+                        if (*pixel)
+                        {
+                            rowWords[col / 64] |= static_cast<uint64>(1) << (col % 64);
+                        }
+                    }
+                }
+            }
+
+            //============================================================================
+            ///						Unpacks the mask into a boolean array
+            ///		
+            /// @return     NdArray<bool>
+            ///
+            NdArray<bool> toNdArray() const
+            {
+                NdArray<bool> mask(numRows_, numCols_);
+                NdArray<bool>::iterator pixel = mask.begin();
+                for (uint32 row = 0; row < numRows_; ++row)
+                {
+                    const uint64* rowWords = &words_[static_cast<uint64>(row) * wordsPerRow_];
+                    for (uint32 col = 0; col < numCols_; ++col, ++pixel)
+                    {
+                        *pixel = ((rowWords[col / 64] >> (col % 64)) & 1) != 0;
+                    }
+                }
+
+                return std::move(mask);
+            }
+
+            //============================================================================
+            ///						Returns the number of rows
+            ///		
+            /// @return     uint32
+            ///
+            uint32 numRows() const
+            {
+                return numRows_;
+            }
+
+            //============================================================================
+            ///						Returns the number of columns
+            ///		
+            /// @return     uint32
+            ///
+            uint32 numCols() const
+            {
+                return numCols_;
+            }
+
+            //============================================================================
+            ///						Returns the shape of the mask
+            ///		
+            /// @return     Shape
+            ///
+            Shape shape() const
+            {
+                return Shape(numRows_, numCols_);
+            }
+
+            //============================================================================
+            ///						Returns whether a pixel is set, no bounds checking
+            ///		
+            /// @param      row
+            /// @param      column
+            ///
+            /// @return     bool
+            ///
+            bool get(uint32 inRow, uint32 inCol) const
+            {
+                return ((words_[static_cast<uint64>(inRow) * wordsPerRow_ + inCol / 64] >> (inCol % 64)) & 1) != 0;
+            }
+
+            //============================================================================
+            ///						Sets or clears a pixel, no bounds checking
+            ///		
+            /// @param      row
+            /// @param      column
+            /// @param      value, default true
+            ///
+            /// @return     None
+            ///
+            void set(uint32 inRow, uint32 inCol, bool inValue = true)
+            {
+                uint64& word = words_[static_cast<uint64>(inRow) * wordsPerRow_ + inCol / 64];
+                const uint64 bit = static_cast<uint64>(1) << (inCol % 64);
+                word = inValue ? word | bit : word & ~bit;
+            }
+
+            //============================================================================
+            ///						Returns the number of pixels set
+            ///		
+            /// @return     uint64
+            ///
+            uint64 count() const
+            {
+                uint64 total = 0;
+                for (auto word : words_)
+                {
+                    // parallel bit count
+                    word = word - ((word >> 1) & 0x5555555555555555ULL);
+                    word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+                    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+                    total += (word * 0x0101010101010101ULL) >> 56;
+                }
+
+                return total;
+            }
+
+            //============================================================================
+            ///						Returns whether any pixel is set
+            ///		
+            /// @return     bool
+            ///
+            bool any() const
+            {
+                for (auto word : words_)
+                {
+                    if (word != 0)
+                    {
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            //============================================================================
+            ///						Dilates the mask by a (2 * inRadius + 1) square
+            ///		
+            /// @param      radius
+            ///
+            /// @return     BitMask
+            ///
+            BitMask dilate(uint32 inRadius) const
+            {
+                BitMask out(*this);
+                if (inRadius > 0 && !words_.empty())
+                {
+                    out.windowRows(inRadius, true);
+                    out.windowCols(inRadius, true);
+                }
+
+                return std::move(out);
+            }
+
+            //============================================================================
+            ///						Erodes the mask by a (2 * inRadius + 1) square, pixels off
+            ///						the edges count as not set
+            ///		
+            /// @param      radius
+            ///
+            /// @return     BitMask
+            ///
+            BitMask erode(uint32 inRadius) const
+            {
+                BitMask out(*this);
+                if (inRadius > 0 && !words_.empty())
+                {
+                    out.windowRows(inRadius, false);
+                    out.windowCols(inRadius, false);
+                }
+
+                return std::move(out);
+            }
+
+            //============================================================================
+            ///						Pixels set in both masks
+            ///		
+            /// @param      BitMask of the same shape
+            ///
+            /// @return     BitMask
+            ///
+            BitMask operator&(const BitMask& inOther) const
+            {
+                checkShape(inOther, "operator&");
+                BitMask out(*this);
+                for (uint64 i = 0; i < words_.size(); ++i)
+                {
+                    out.words_[i] &= inOther.words_[i];
+                }
+
+                return std::move(out);
+            }
+
+            //============================================================================
+            ///						Pixels set in either mask
+            ///		
+            /// @param      BitMask of the same shape
+            ///
+            /// @return     BitMask
+            ///
+            BitMask operator|(const BitMask& inOther) const
+            {
+                checkShape(inOther, "operator|");
+                BitMask out(*this);
+                for (uint64 i = 0; i < words_.size(); ++i)
+                {
+                    out.words_[i] |= inOther.words_[i];
+                }
+
+                return std::move(out);
+            }
+
+            //============================================================================
+            ///						Pixels not set in the mask
+            ///		
+            /// @return     BitMask
+            ///
+            BitMask operator~() const
+            {
+                BitMask out(*this);
+                for (auto& word : out.words_)
+                {
+                    word = ~word;
+                }
+                out.clearPadding();
+
+                return std::move(out);
+            }
+
+            //============================================================================
+            ///						Equality operator
+            ///		
+            /// @param      BitMask
+            ///
+            /// @return     bool
+            ///
+            bool operator==(const BitMask& inOther) const
+            {
+                return numRows_ == inOther.numRows_ && numCols_ == inOther.numCols_ && words_ == inOther.words_;
+            }
+
+            //============================================================================
+            ///						Not equality operator
+            ///		
+            /// @param      BitMask
+            ///
+            /// @return     bool
+            ///
+            bool operator!=(const BitMask& inOther) const
+            {
+                return !(*this == inOther);
+            }
+        };
+
+        //============================================================================
+        ///						Dilates a mask by a (2 * inRadius + 1) square
+        ///		
+        /// @param      NdArray<bool>
+        /// @param      radius
+        ///
+        /// @return     NdArray<bool>
+        ///
+        static NdArray<bool> dilate(const NdArray<bool>& inMask, uint32 inRadius)
+        {
+            return std::move(BitMask(inMask).dilate(inRadius).toNdArray());
+        }
+
+        //============================================================================
+        ///						Erodes a mask by a (2 * inRadius + 1) square, pixels off
+        ///						the edges count as not set
+        ///		
+        /// @param      NdArray<bool>
+        /// @param      radius
+        ///
+        /// @return     NdArray<bool>
+        ///
+        static NdArray<bool> erode(const NdArray<bool>& inMask, uint32 inRadius)
+        {
+            return std::move(BitMask(inMask).erode(inRadius).toNdArray());
+        }
+    };
+}
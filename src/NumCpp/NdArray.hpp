@@ -31,6 +31,7 @@
 #include"NumCpp/DtypeInfo.hpp"
 #include"NumCpp/Shape.hpp"
 #include"NumCpp/Slice.hpp"
+#include"NumCpp/TileExecutor.hpp"
 #include"NumCpp/Types.hpp"
 #include"NumCpp/Utils.hpp"
 #include"NumCpp/Constants.hpp"
@@ -48,6 +49,7 @@
 #include<set>
 #include<stdexcept>
 #include<string>
+#include<type_traits>
 #include<utility>
 #include<vector>
 
@@ -110,6 +112,301 @@ namespace NumCpp
             array_ = new dtype[size_];
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Converts a value to dtypeOut, clamping it to the range of
+        ///						dtypeOut instead of overflowing. NaNs become 0 for integer
+        ///						outputs, infinities and NaNs pass through for floating
+        ///						point outputs.
+        ///		
+        /// @param
+        ///				value
+        /// @return
+        ///				converted value
+        ///
+        template<typename dtypeOut, typename dtypeIn>
+        static dtypeOut saturateCast(dtypeIn inValue)
+        {
+            const dtypeOut outMin = std::numeric_limits<dtypeOut>::lowest();
+            const dtypeOut outMax = std::numeric_limits<dtypeOut>::max();
+
+            if (std::is_integral<dtypeOut>::value && std::is_integral<dtypeIn>::value)
+            {
+                // compare through the widest types so mixed signedness can't wrap
+                if (std::is_signed<dtypeIn>::value && static_cast<int64>(inValue) < 0)
+                {
+                    return static_cast<int64>(inValue) < static_cast<int64>(outMin) ? outMin : static_cast<dtypeOut>(inValue);
+                }
+                return static_cast<uint64>(inValue) > static_cast<uint64>(outMax) ? outMax : static_cast<dtypeOut>(inValue);
+            }
+            else if (std::is_integral<dtypeOut>::value)
+            {
+                const double value = static_cast<double>(inValue);
+                return value != value ? static_cast<dtypeOut>(0) :
+                    value >= static_cast<double>(outMax) ? outMax :
+                    value <= static_cast<double>(outMin) ? outMin : static_cast<dtypeOut>(inValue);
+            }
+
+            // only finite values are clamped, infinities and NaNs pass through
+            const double value = static_cast<double>(inValue);
+            if (!std::isfinite(value))
+            {
+                return static_cast<dtypeOut>(inValue);
+            }
+            return value > static_cast<double>(outMax) ? outMax :
+                value < static_cast<double>(outMin) ? outMin : static_cast<dtypeOut>(inValue);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Converts the array into outData. The rounding and saturation
+        ///						options are resolved before the loops so that each loop is a
+        ///						plain conversion the compiler can vectorize.
+        ///		
+        /// @param				output data, must hold size() elements
+        /// @param				rounding of floating point values converted to integers
+        /// @param				saturate instead of overflowing
+        /// @return
+        ///				None
+        ///
+        template<typename dtypeOut>
+        void convert(dtypeOut* outData, Rounding::Type inRounding, bool inSaturate) const
+        {
+            const dtype* inData = array_;
+            const bool round = inRounding == Rounding::NEAREST &&
+                std::is_floating_point<dtype>::value && std::is_integral<dtypeOut>::value;
+
+            if (!round && !inSaturate)
+            {
+                for (uint32 i = 0; i < size_; ++i)
+                {
+                    outData[i] = static_cast<dtypeOut>(inData[i]);
+                }
+            }
+            else if (!round)
+            {
+                for (uint32 i = 0; i < size_; ++i)
+                {
+                    outData[i] = saturateCast<dtypeOut>(inData[i]);
+                }
+            }
+            else if (!inSaturate)
+            {
+                // nearbyint rounds halfway cases to even, like numpy.rint
+                for (uint32 i = 0; i < size_; ++i)
+                {
+                    outData[i] = static_cast<dtypeOut>(std::nearbyint(static_cast<double>(inData[i])));
+                }
+            }
+            else
+            {
+                for (uint32 i = 0; i < size_; ++i)
+                {
+                    outData[i] = saturateCast<dtypeOut>(std::nearbyint(static_cast<double>(inData[i])));
+                }
+            }
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Stands in for the combine function of a scan that has none,
+        ///						such a scan is never split into blocks
+        ///
+        template<typename dtypeOut>
+        struct NoCombine
+        {
+            dtypeOut operator()(dtypeOut inRunningValue, dtypeOut) const
+            {
+                return inRunningValue;
+            }
+        };
+
+        //============================================================================
+        // Method Description: 
+        ///						Inclusive scan of one contiguous line. Lines longer than a
+        ///						tile are scanned in two passes over fixed size blocks: the
+        ///						first reduces each block on its own, the block totals are
+        ///						combined in order into the running value each block starts
+        ///						from, and the second scans every block from that value.
+        ///						The blocks only depend on the line length, so the result is
+        ///						the same whatever the thread count.
+        ///		
+        /// @param				input data
+        /// @param				output data
+        /// @param				length of the line
+        /// @param				function(running value, element)
+        /// @param				function(running value, block total), nullptr for a serial scan
+        /// @param				initial running value
+        /// @return
+        ///				None
+        ///
+        template<typename dtypeOut, typename Function, typename Combine>
+        static void scanLine(const dtype* inData, dtypeOut* outData, uint32 inLength, const Function& inFunction,
+            const Combine* inCombine, dtypeOut inInitValue)
+        {
+            const uint32 blockSize = TileExecutor::tileRows(sizeof(dtypeOut));
+            auto scanBlock = [&](uint32 inFirst, uint32 inLast, dtypeOut inRunningValue)
+            {
+                for (uint32 i = inFirst; i < inLast; ++i)
+                {
+                    inRunningValue = inFunction(inRunningValue, inData[i]);
+                    outData[i] = inRunningValue;
+                }
+            };
+
+            if (inCombine == nullptr || inLength <= blockSize)
+            {
+                scanBlock(0, inLength, inInitValue);
+                return;
+            }
+
+            const uint32 numBlocks = (inLength + blockSize - 1) / blockSize;
+            auto reduceBlock = [&](uint32 inBlock) -> dtypeOut
+            {
+                const uint32 first = inBlock * blockSize;
+                dtypeOut total = inInitValue;
+                for (uint32 i = first; i < first + blockSize; ++i)
+                {
+                    total = inFunction(total, inData[i]);
+                }
+                return total;
+            };
+
+            if (TileExecutor::numThreads() == 1)
+            {
+                // same arithmetic as below, but each block is reduced right after it
+                // is scanned while it is still in cache
+                dtypeOut carry = inInitValue;
+                for (uint32 block = 0; block < numBlocks; ++block)
+                {
+                    const uint32 first = block * blockSize;
+                    scanBlock(first, std::min(first + blockSize, inLength), carry);
+                    if (block + 1 < numBlocks)
+                    {
+                        carry = (*inCombine)(carry, reduceBlock(block));
+                    }
+                }
+                return;
+            }
+
+            // carries[block] is the running value the block starts from, the last
+            // block's total is never needed
+            NdArray<dtypeOut> carries(1, numBlocks);
+            carries[0] = inInitValue;
+            TileExecutor::parallelFor(numBlocks - 1,
+                [&](uint32 inBlock)
+                {
+                    carries[inBlock + 1] = reduceBlock(inBlock);
+                });
+
+            for (uint32 block = 1; block < numBlocks; ++block)
+            {
+                carries[block] = (*inCombine)(carries[block - 1], carries[block]);
+            }
+
+            TileExecutor::parallelFor(numBlocks,
+                [&](uint32 inBlock)
+                {
+                    const uint32 first = inBlock * blockSize;
+                    scanBlock(first, std::min(first + blockSize, inLength), carries[inBlock]);
+                });
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Inclusive scan along the given axis, see scan()
+        ///		
+        /// @param				function(running value, element)
+        /// @param				function(running value, block total), nullptr for a serial scan
+        /// @param				initial running value
+        /// @param				axis
+        /// @return
+        ///				NdArray
+        ///
+        template<typename dtypeOut, typename Function, typename Combine>
+        NdArray<dtypeOut> scanAxis(const Function& inFunction, const Combine* inCombine, dtypeOut inInitValue, Axis::Type inAxis) const
+        {
+            switch (inAxis)
+            {
+                case Axis::NONE:
+                {
+                    NdArray<dtypeOut> returnArray(1, size_);
+                    scanLine(array_, returnArray.begin(), size_, inFunction, inCombine, inInitValue);
+
+                    return std::move(returnArray);
+                }
+                case Axis::COL:
+                {
+                    NdArray<dtypeOut> returnArray(shape_);
+                    dtypeOut* outData = returnArray.begin();
+                    TileExecutor::forEachRowTile(shape_.rows, TileExecutor::tileRows(shape_.cols * sizeof(dtypeOut)),
+                        [&](uint32 inFirstRow, uint32 inNumRows)
+                        {
+                            for (uint32 row = inFirstRow; row < inFirstRow + inNumRows; ++row)
+                            {
+                                const uint32 rowStart = row * shape_.cols;
+                                scanLine(array_ + rowStart, outData + rowStart, shape_.cols, inFunction, inCombine, inInitValue);
+                            }
+                        });
+
+                    return std::move(returnArray);
+                }
+                case Axis::ROW:
+                {
+                    NdArray<dtypeOut> returnArray(shape_);
+                    if (size_ == 0)
+                    {
+                        return std::move(returnArray);
+                    }
+
+                    dtypeOut* outData = returnArray.begin();
+                    if (shape_.cols == 1)
+                    {
+                        // a column is one contiguous line
+                        scanLine(array_, outData, size_, inFunction, inCombine, inInitValue);
+                        return std::move(returnArray);
+                    }
+
+                    // every column is an independent scan, so each row is combined
+                    // with the previous output row in one contiguous sweep, and the
+                    // columns are split into stripes swept in parallel
+                    const uint32 numThreads = size_ > TileExecutor::tileRows(sizeof(dtypeOut)) ? TileExecutor::numThreads() : 1;
+                    const uint32 stripeCols = std::max((shape_.cols + numThreads - 1) / numThreads, static_cast<uint32>(16));
+                    const uint32 numStripes = (shape_.cols + stripeCols - 1) / stripeCols;
+                    TileExecutor::parallelFor(numStripes,
+                        [&](uint32 inStripe)
+                        {
+                            const uint32 firstCol = inStripe * stripeCols;
+                            const uint32 lastCol = std::min(firstCol + stripeCols, shape_.cols);
+
+                            for (uint32 col = firstCol; col < lastCol; ++col)
+                            {
+                                outData[col] = inFunction(inInitValue, array_[col]);
+                            }
+
+                            for (uint32 row = 1; row < shape_.rows; ++row)
+                            {
+                                const dtype* inRow = array_ + row * shape_.cols;
+                                const dtypeOut* prevOutRow = outData + (row - 1) * shape_.cols;
+                                dtypeOut* outRow = outData + row * shape_.cols;
+                                for (uint32 col = firstCol; col < lastCol; ++col)
+                                {
+                                    outRow[col] = inFunction(prevOutRow[col], inRow[col]);
+                                }
+                            }
+                        });
+
+                    return std::move(returnArray);
+                }
+                default:
+                {
+                    // this isn't actually possible, just putting this here to get rid
+                    // of the compiler warning.
+                    return std::move(NdArray<dtypeOut>(0));
+                }
+            }
+        }
+
     public:
         //============================================================================
         // Method Description: 
@@ -1163,22 +1460,46 @@ namespace NumCpp
         // Method Description: 
         ///						Returns a copy of the array, cast to a specified type.
         ///
+        ///						By default values are converted with a static_cast, floating
+        ///						point values converted to integers can instead be rounded to
+        ///						the nearest integer, and values outside of the range of the
+        ///						new type can be saturated to its min/max.
+        ///
         ///                     Numpy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.ndarray.astype.html
         ///		
-        /// @param
-        ///				None
+        /// @param				(Optional) rounding, default Rounding::TRUNCATE
+        /// @param				(Optional) saturate, default false
         /// @return
         ///				NdArray
         ///
         template<typename dtypeOut = double>
-        NdArray<dtypeOut> astype() const
+        NdArray<dtypeOut> astype(Rounding::Type inRounding = Rounding::TRUNCATE, bool inSaturate = false) const
         {
             NdArray<dtypeOut> outArray(shape_);
-            for (uint32 i = 0; i < size_; ++i)
+            convert(outArray.begin(), inRounding, inSaturate);
+            return std::move(outArray);
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Casts the array into a preallocated array of the same shape.
+        ///		
+        /// @param				NdArray, output array
+        /// @param				(Optional) rounding, default Rounding::TRUNCATE
+        /// @param				(Optional) saturate, default false
+        /// @return
+        ///				NdArray&
+        ///
+        template<typename dtypeOut>
+        NdArray<dtypeOut>& astype(NdArray<dtypeOut>& outArray, Rounding::Type inRounding = Rounding::TRUNCATE, bool inSaturate = false) const
+        {
+            if (outArray.shape() != shape_)
             {
-                outArray[i] = static_cast<dtypeOut>(array_[i]);
+                throw std::invalid_argument("ERROR: NdArray::astype: output array shape is not consistant with the array.");
             }
-            return std::move(outArray);
+
+            convert(outArray.begin(), inRounding, inSaturate);
+            return outArray;
         }
 
         //============================================================================
@@ -1328,54 +1649,8 @@ namespace NumCpp
         template<typename dtypeOut = double>
         NdArray<dtypeOut> cumprod(Axis::Type inAxis = Axis::NONE) const
         {
-            switch (inAxis)
-            {
-                case Axis::NONE:
-                {
-                    NdArray<dtypeOut> returnArray(1, size_);
-                    returnArray[0] = static_cast<dtypeOut>(array_[0]);
-                    for (uint32 i = 1; i < size_; ++i)
-                    {
-                        returnArray[i] = returnArray[i - 1] * static_cast<dtypeOut>(array_[i]);
-                    }
-
-                    return std::move(returnArray);
-                }
-                case Axis::COL:
-                {
-                    NdArray<dtypeOut> returnArray(shape_);
-                    for (uint32 row = 0; row < shape_.rows; ++row)
-                    {
-                        returnArray(row, 0) = static_cast<dtypeOut>(this->operator()(row, 0));
-                        for (uint32 col = 1; col < shape_.cols; ++col)
-                        {
-                            returnArray(row, col) = returnArray(row, col - 1) * static_cast<dtypeOut>(this->operator()(row, col));
-                        }
-                    }
-
-                    return std::move(returnArray);
-                }
-                case Axis::ROW:
-                {
-                    NdArray<dtypeOut> returnArray(shape_);
-                    for (uint32 col = 0; col < shape_.cols; ++col)
-                    {
-                        returnArray(0, col) = static_cast<dtypeOut>(this->operator()(0, col));
-                        for (uint32 row = 1; row < shape_.rows; ++row)
-                        {
-                            returnArray(row, col) = returnArray(row - 1, col) * static_cast<dtypeOut>(this->operator()(row, col));
-                        }
-                    }
-
-                    return std::move(returnArray);
-                }
-                default:
-                {
-                    // this isn't actually possible, just putting this here to get rid
-                    // of the compiler warning.
-                    return std::move(NdArray<dtypeOut>(0));
-                }
-            }
+            return std::move(scan<dtypeOut>([](dtypeOut inProd, dtype inValue) -> dtypeOut { return inProd * static_cast<dtypeOut>(inValue); },
+                std::multiplies<dtypeOut>(), static_cast<dtypeOut>(1), inAxis));
         }
 
         //============================================================================
@@ -1392,54 +1667,8 @@ namespace NumCpp
         template<typename dtypeOut = double>
         NdArray<dtypeOut> cumsum(Axis::Type inAxis = Axis::NONE) const
         {
-            switch (inAxis)
-            {
-                case Axis::NONE:
-                {
-                    NdArray<dtypeOut> returnArray(1, size_);
-                    returnArray[0] = static_cast<dtypeOut>(array_[0]);
-                    for (uint32 i = 1; i < size_; ++i)
-                    {
-                        returnArray[i] = returnArray[i - 1] + static_cast<dtypeOut>(array_[i]);
-                    }
-
-                    return std::move(returnArray);
-                }
-                case Axis::COL:
-                {
-                    NdArray<dtypeOut> returnArray(shape_);
-                    for (uint32 row = 0; row < shape_.rows; ++row)
-                    {
-                        returnArray(row, 0) = static_cast<dtypeOut>(this->operator()(row, 0));
-                        for (uint32 col = 1; col < shape_.cols; ++col)
-                        {
-                            returnArray(row, col) = returnArray(row, col - 1) + static_cast<dtypeOut>(this->operator()(row, col));
-                        }
-                    }
-
-                    return std::move(returnArray);
-                }
-                case Axis::ROW:
-                {
-                    NdArray<dtypeOut> returnArray(shape_);
-                    for (uint32 col = 0; col < shape_.cols; ++col)
-                    {
-                        returnArray(0, col) = static_cast<dtypeOut>(this->operator()(0, col));
-                        for (uint32 row = 1; row < shape_.rows; ++row)
-                        {
-                            returnArray(row, col) = returnArray(row - 1, col) + static_cast<dtypeOut>(this->operator()(row, col));
-                        }
-                    }
-
-                    return std::move(returnArray);
-                }
-                default:
-                {
-                    // this isn't actually possible, just putting this here to get rid
-                    // of the compiler warning.
-                    return std::move(NdArray<dtypeOut>(0));
-                }
-            }
+            return std::move(scan<dtypeOut>([](dtypeOut inSum, dtype inValue) -> dtypeOut { return inSum + static_cast<dtypeOut>(inValue); },
+                std::plus<dtypeOut>(), static_cast<dtypeOut>(0), inAxis));
         }
 
         //============================================================================
@@ -1656,6 +1885,46 @@ namespace NumCpp
             return std::move(outArray);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Reverse the order of elements along the given axis, in-place.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.flip.html
+        ///		
+        /// @param
+        ///				(Optional) Axis
+        /// @return
+        ///				None
+        ///
+        void flip(Axis::Type inAxis = Axis::NONE)
+        {
+            switch (inAxis)
+            {
+                case Axis::NONE:
+                {
+                    std::reverse(begin(), end());
+                    break;
+                }
+                case Axis::COL:
+                {
+                    for (uint32 row = 0; row < shape_.rows; ++row)
+                    {
+                        std::reverse(begin(row), end(row));
+                    }
+                    break;
+                }
+                case Axis::ROW:
+                {
+                    // whole rows are contiguous, so swap them end for end
+                    for (uint32 row = 0; row < shape_.rows / 2; ++row)
+                    {
+                        std::swap_ranges(begin(row), end(row), begin(shape_.rows - 1 - row));
+                    }
+                    break;
+                }
+            }
+        }
+
         //============================================================================
         // Method Description: 
         ///						Copy an element of an array to a standard C++ scalar and return it.
@@ -2856,6 +3125,120 @@ namespace NumCpp
             resizeSlow(inShape.rows, inShape.cols);
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Roll array elements along a given axis, in-place.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.roll.html
+        ///		
+        /// @param				elements to shift, positive means forward, negative means backwards
+        /// @param				(Optional) Axis
+        /// @return
+        ///				None
+        ///
+        void roll(int32 inShift, Axis::Type inAxis = Axis::NONE)
+        {
+            if (size_ == 0)
+            {
+                return;
+            }
+
+            switch (inAxis)
+            {
+                case Axis::NONE:
+                {
+                    uint32 shift = std::abs(inShift) % size_;
+                    if (inShift > 0)
+                    {
+                        shift = size_ - shift;
+                    }
+
+                    std::rotate(begin(), begin() + shift, end());
+                    break;
+                }
+                case Axis::COL:
+                {
+                    uint32 shift = std::abs(inShift) % shape_.cols;
+                    if (inShift > 0)
+                    {
+                        shift = shape_.cols - shift;
+                    }
+
+                    for (uint32 row = 0; row < shape_.rows; ++row)
+                    {
+                        std::rotate(begin(row), begin(row) + shift, end(row));
+                    }
+                    break;
+                }
+                case Axis::ROW:
+                {
+                    // rolling whole rows is a rotation of the flat buffer by a
+                    // multiple of the row length
+                    uint32 shift = std::abs(inShift) % shape_.rows;
+                    if (inShift > 0)
+                    {
+                        shift = shape_.rows - shift;
+                    }
+
+                    std::rotate(begin(), begin() + shift * shape_.cols, end());
+                    break;
+                }
+            }
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Rotate the array by 90 degrees counter clockwise, in-place.
+        ///						Square arrays are rotated without any allocation.
+        ///
+        ///                     NumPy Reference: https://www.numpy.org/devdocs/reference/generated/numpy.rot90.html
+        ///		
+        /// @param
+        ///				(Optional) the number of times to rotate 90 degrees
+        /// @return
+        ///				None
+        ///
+        void rot90(uint8 inK = 1)
+        {
+            inK %= 4;
+            if (inK == 0)
+            {
+                return;
+            }
+
+            if (inK == 2)
+            {
+                flip(Axis::NONE);
+                return;
+            }
+
+            if (shape_.rows == shape_.cols)
+            {
+                const uint32 tileSize = 32;
+                for (uint32 rowTile = 0; rowTile < shape_.rows; rowTile += tileSize)
+                {
+                    const uint32 rowEnd = std::min(rowTile + tileSize, shape_.rows);
+                    for (uint32 colTile = rowTile; colTile < shape_.cols; colTile += tileSize)
+                    {
+                        const uint32 colEnd = std::min(colTile + tileSize, shape_.cols);
+                        for (uint32 row = rowTile; row < rowEnd; ++row)
+                        {
+                            for (uint32 col = std::max(colTile, row + 1); col < colEnd; ++col)
+                            {
+                                std::swap(array_[row * shape_.cols + col], array_[col * shape_.cols + row]);
+                            }
+                        }
+                    }
+                }
+            }
+            else
+            {
+                *this = transpose();
+            }
+
+            flip(inK == 1 ? Axis::ROW : Axis::COL);
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return a with each element rounded to the given number
@@ -2887,6 +3270,55 @@ namespace NumCpp
             }
         }
 
+        //============================================================================
+        // Method Description: 
+        ///						Inclusive scan of the elements along the given axis, ie
+        ///						returnArray[i] = inFunction(returnArray[i - 1], array[i]) with
+        ///						inInitValue standing in for returnArray[-1]. Running reductions
+        ///						that are not associative (running max of a changing threshold,
+        ///						...) can be written this way; each line is scanned serially,
+        ///						independent lines in parallel.
+        ///
+        ///						Axis::ROW is scanned a whole row at a time so that both arrays
+        ///						are walked contiguously instead of down each column.
+        ///		
+        /// @param				function(running value, element) returning the new running value
+        /// @param				initial running value, the identity of the function
+        /// @param				(Optional) axis
+        /// @return
+        ///				NdArray
+        ///
+        template<typename dtypeOut, typename Function>
+        NdArray<dtypeOut> scan(Function inFunction, dtypeOut inInitValue, Axis::Type inAxis = Axis::NONE) const
+        {
+            return std::move(scanAxis(inFunction, static_cast<const NoCombine<dtypeOut>*>(nullptr), inInitValue, inAxis));
+        }
+
+        //============================================================================
+        // Method Description: 
+        ///						Inclusive scan as above for an associative running reduction,
+        ///						where inCombine(running value, total) folds in the total of a
+        ///						run of elements reduced from inInitValue, eg addition for
+        ///						cumsum. Long lines are then also split into blocks scanned in
+        ///						parallel: a first pass reduces each block, the block totals
+        ///						are combined in order, and a second pass scans every block from
+        ///						the running value before it. Floating point results can differ
+        ///						in the last bits from a serial scan, as the block totals are
+        ///						rounded on their own, but do not depend on the thread count.
+        ///		
+        /// @param				function(running value, element) returning the new running value
+        /// @param				function(running value, block total) returning the new running value
+        /// @param				initial running value, the identity of the function
+        /// @param				(Optional) axis
+        /// @return
+        ///				NdArray
+        ///
+        template<typename dtypeOut, typename Function, typename Combine>
+        NdArray<dtypeOut> scan(Function inFunction, Combine inCombine, dtypeOut inInitValue, Axis::Type inAxis = Axis::NONE) const
+        {
+            return std::move(scanAxis(inFunction, &inCombine, inInitValue, inAxis));
+        }
+
         //============================================================================
         // Method Description: 
         ///						Return the shape of the array
@@ -3262,12 +3694,24 @@ namespace NumCpp
         ///
         NdArray<dtype> transpose() const
         {
+            // walk the array in square tiles so that both the reads and the
+            // strided writes stay within a few cache lines
+            const uint32 tileSize = 32;
+
             NdArray<dtype> transArray(shape_.cols, shape_.rows);
-            for (uint16 row = 0; row < shape_.rows; ++row)
+            for (uint32 rowTile = 0; rowTile < shape_.rows; rowTile += tileSize)
             {
-                for (uint16 col = 0; col < shape_.cols; ++col)
+                const uint32 rowEnd = std::min(rowTile + tileSize, shape_.rows);
+                for (uint32 colTile = 0; colTile < shape_.cols; colTile += tileSize)
                 {
-                    transArray(col, row) = this->operator()(row, col);
+                    const uint32 colEnd = std::min(colTile + tileSize, shape_.cols);
+                    for (uint32 row = rowTile; row < rowEnd; ++row)
+                    {
+                        for (uint32 col = colTile; col < colEnd; ++col)
+                        {
+                            transArray.array_[col * shape_.rows + row] = array_[row * shape_.cols + col];
+                        }
+                    }
                 }
             }
             return std::move(transArray);
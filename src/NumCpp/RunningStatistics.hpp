@@ -0,0 +1,905 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+/// @version 1.0
+///
+/// @section LICENSE
+/// Copyright 2018 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software 
+/// without restriction, including without limitation the rights to use, copy, modify, 
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to 
+/// permit persons to whom the Software is furnished to do so, subject to the following 
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies 
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+/// DEALINGS IN THE SOFTWARE.
+///
+/// @section DESCRIPTION
+/// Accumulators for statistics of data that arrives a piece at a time
+///
+#pragma once
+
+#include"NumCpp/NdArray.hpp"
+#include"NumCpp/Shape.hpp"
+#include"NumCpp/Types.hpp"
+
+#include<algorithm>
+#include<cmath>
+#include<limits>
+#include<stdexcept>
+#include<string>
+#include<utility>
+#include<vector>
+
+namespace NumCpp
+{
+    //================================================================================
+    ///						Running mean and variance of each element over the arrays
+    ///						pushed into it (Welford's algorithm). Gives the same result as
+    ///						stacking the pushed arrays and reducing along the stacking
+    ///						axis, in O(1) memory. Accumulators filled independently, for
+    ///						instance one per thread, can be combined with merge.
+    template<typename dtype>
+    class RunningMoments
+    {
+    private:
+        //==============================Attributes====================================
+        uint64              count_;
+        NdArray<double>     mean_;
+        NdArray<double>     m2_;
+
+    public:
+        //============================================================================
+        ///						Constructor
+        ///		
+        /// @param      None
+        ///
+        /// @return     None
+        ///
+        RunningMoments() :
+            count_(0)
+        {}
+
+        //============================================================================
+        ///						Adds an array of samples, one sample per element. Every
+        ///						array pushed must have the same shape.
+        ///		
+        /// @param      NdArray
+        ///
+        /// @return     None
+        ///
+        void push(const NdArray<dtype>& inArray)
+        {
+            if (count_ == 0)
+            {
+                mean_ = NdArray<double>(inArray.shape());
+                mean_.zeros();
+                m2_ = NdArray<double>(inArray.shape());
+                m2_.zeros();
+            }
+            else if (inArray.shape() != mean_.shape())
+            {
+                throw std::invalid_argument("ERROR: RunningMoments::push: input array shape is not consistant with the previously pushed arrays.");
+            }
+
+            ++count_;
+            const double invCount = 1.0 / static_cast<double>(count_);
+            for (uint32 i = 0; i < inArray.size(); ++i)
+            {
+                const double value = static_cast<double>(inArray[i]);
+                const double delta = value - mean_[i];
+                mean_[i] += delta * invCount;
+                m2_[i] += delta * (value - mean_[i]);
+            }
+        }
+
+        //============================================================================
+        ///						Combines the samples of another accumulator into this one
+        ///		
+        /// @param      RunningMoments
+        ///
+        /// @return     None
+        ///
+        void merge(const RunningMoments<dtype>& inOther)
+        {
+            if (inOther.count_ == 0)
+            {
+                return;
+            }
+
+            if (count_ == 0)
+            {
+                *this = inOther;
+                return;
+            }
+
+            if (inOther.mean_.shape() != mean_.shape())
+            {
+                throw std::invalid_argument("ERROR: RunningMoments::merge: input accumulator shape is not consistant with this accumulator.");
+            }
+
+            const double countA = static_cast<double>(count_);
+            const double countB = static_cast<double>(inOther.count_);
+            const double total = countA + countB;
+            for (uint32 i = 0; i < mean_.size(); ++i)
+            {
+                const double delta = inOther.mean_[i] - mean_[i];
+                mean_[i] += delta * countB / total;
+                m2_[i] += inOther.m2_[i] + delta * delta * countA * countB / total;
+            }
+            count_ += inOther.count_;
+        }
+
+        //============================================================================
+        ///						Clears the accumulator
+        ///		
+        /// @param      None
+        ///
+        /// @return     None
+        ///
+        void reset()
+        {
+            count_ = 0;
+            mean_ = NdArray<double>();
+            m2_ = NdArray<double>();
+        }
+
+        //============================================================================
+        ///						Returns the number of arrays pushed
+        ///		
+        /// @param      None
+        ///
+        /// @return     count
+        ///
+        uint64 count() const
+        {
+            return count_;
+        }
+
+        //============================================================================
+        ///						Returns the mean of each element
+        ///		
+        /// @param      None
+        ///
+        /// @return     NdArray
+        ///
+        const NdArray<double>& mean() const
+        {
+            return mean_;
+        }
+
+        //============================================================================
+        ///						Returns the variance of each element
+        ///		
+        /// @param      (Optional) delta degrees of freedom, default 0
+        ///
+        /// @return     NdArray
+        ///
+        NdArray<double> var(uint32 inDdof = 0) const
+        {
+            NdArray<double> returnArray(m2_.shape());
+            const double divisor = static_cast<double>(count_) - static_cast<double>(inDdof);
+            for (uint32 i = 0; i < returnArray.size(); ++i)
+            {
+                returnArray[i] = m2_[i] / divisor;
+            }
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        ///						Returns the standard deviation of each element
+        ///		
+        /// @param      (Optional) delta degrees of freedom, default 0
+        ///
+        /// @return     NdArray
+        ///
+        NdArray<double> std(uint32 inDdof = 0) const
+        {
+            NdArray<double> returnArray = var(inDdof);
+            for (uint32 i = 0; i < returnArray.size(); ++i)
+            {
+                returnArray[i] = std::sqrt(returnArray[i]);
+            }
+
+            return std::move(returnArray);
+        }
+    };
+
+    //================================================================================
+    ///						Running minimum and maximum of each element over the arrays
+    ///						pushed into it
+    template<typename dtype>
+    class RunningMinMax
+    {
+    private:
+        //==============================Attributes====================================
+        uint64              count_;
+        NdArray<dtype>      min_;
+        NdArray<dtype>      max_;
+
+    public:
+        //============================================================================
+        ///						Constructor
+        ///		
+        /// @param      None
+        ///
+        /// @return     None
+        ///
+        RunningMinMax() :
+            count_(0)
+        {}
+
+        //============================================================================
+        ///						Adds an array of samples, one sample per element. Every
+        ///						array pushed must have the same shape.
+        ///		
+        /// @param      NdArray
+        ///
+        /// @return     None
+        ///
+        void push(const NdArray<dtype>& inArray)
+        {
+            if (count_ == 0)
+            {
+                min_ = inArray;
+                max_ = inArray;
+                ++count_;
+                return;
+            }
+
+            if (inArray.shape() != min_.shape())
+            {
+                throw std::invalid_argument("ERROR: RunningMinMax::push: input array shape is not consistant with the previously pushed arrays.");
+            }
+
+            for (uint32 i = 0; i < inArray.size(); ++i)
+            {
+                min_[i] = std::min(min_[i], inArray[i]);
+                max_[i] = std::max(max_[i], inArray[i]);
+            }
+            ++count_;
+        }
+
+        //============================================================================
+        ///						Combines the samples of another accumulator into this one
+        ///		
+        /// @param      RunningMinMax
+        ///
+        /// @return     None
+        ///
+        void merge(const RunningMinMax<dtype>& inOther)
+        {
+            if (inOther.count_ == 0)
+            {
+                return;
+            }
+
+            if (count_ == 0)
+            {
+                *this = inOther;
+                return;
+            }
+
+            if (inOther.min_.shape() != min_.shape())
+            {
+                throw std::invalid_argument("ERROR: RunningMinMax::merge: input accumulator shape is not consistant with this accumulator.");
+            }
+
+            for (uint32 i = 0; i < min_.size(); ++i)
+            {
+                min_[i] = std::min(min_[i], inOther.min_[i]);
+                max_[i] = std::max(max_[i], inOther.max_[i]);
+            }
+            count_ += inOther.count_;
+        }
+
+        //============================================================================
+        ///						Clears the accumulator
+        ///		
+        /// @param      None
+        ///
+        /// @return     None
+        ///
+        void reset()
+        {
+            count_ = 0;
+            min_ = NdArray<dtype>();
+            max_ = NdArray<dtype>();
+        }
+
+        //============================================================================
+        ///						Returns the number of arrays pushed
+        ///		
+        /// @param      None
+        ///
+        /// @return     count
+        ///
+        uint64 count() const
+        {
+            return count_;
+        }
+
+        //============================================================================
+        ///						Returns the minimum of each element
+        ///		
+        /// @param      None
+        ///
+        /// @return     NdArray
+        ///
+        const NdArray<dtype>& min() const
+        {
+            return min_;
+        }
+
+        //============================================================================
+        ///						Returns the maximum of each element
+        ///		
+        /// @param      None
+        ///
+        /// @return     NdArray
+        ///
+        const NdArray<dtype>& max() const
+        {
+            return max_;
+        }
+    };
+
+    //================================================================================
+    ///						Exponential moving average of each element over the arrays
+    ///						pushed into it, value = value + alpha * (sample - value). The
+    ///						first array pushed seeds the average.
+    template<typename dtype>
+    class ExponentialMovingAverage
+    {
+    private:
+        //==============================Attributes====================================
+        double              alpha_;
+        uint64              count_;
+        NdArray<double>     value_;
+        NdArray<double>     first_;
+
+    public:
+        //============================================================================
+        ///						Constructor
+        ///		
+        /// @param      smoothing factor in (0, 1], larger values follow the data faster
+        ///
+        /// @return     None
+        ///
+        explicit ExponentialMovingAverage(double inAlpha) :
+            alpha_(inAlpha),
+            count_(0)
+        {
+            if (inAlpha <= 0 || inAlpha > 1)
+            {
+                throw std::invalid_argument("ERROR: ExponentialMovingAverage: input alpha must be of the range (0, 1].");
+            }
+        }
+
+        //============================================================================
+        ///						Adds an array of samples, one sample per element. Every
+        ///						array pushed must have the same shape.
+        ///		
+        /// @param      NdArray
+        ///
+        /// @return     None
+        ///
+        void push(const NdArray<dtype>& inArray)
+        {
+            if (count_ == 0)
+            {
+                value_ = inArray.astype<double>();
+                first_ = value_;
+                ++count_;
+                return;
+            }
+
+            if (inArray.shape() != value_.shape())
+            {
+                throw std::invalid_argument("ERROR: ExponentialMovingAverage::push: input array shape is not consistant with the previously pushed arrays.");
+            }
+
+            for (uint32 i = 0; i < inArray.size(); ++i)
+            {
+                value_[i] += alpha_ * (static_cast<double>(inArray[i]) - value_[i]);
+            }
+            ++count_;
+        }
+
+        //============================================================================
+        ///						Combines another average into this one. The other average
+        ///						is taken to cover the samples that came after the samples
+        ///						of this one, the result is the same as having pushed every
+        ///						sample into this average in that order.
+        ///		
+        /// @param      ExponentialMovingAverage
+        ///
+        /// @return     None
+        ///
+        void merge(const ExponentialMovingAverage<dtype>& inOther)
+        {
+            if (inOther.alpha_ != alpha_)
+            {
+                throw std::invalid_argument("ERROR: ExponentialMovingAverage::merge: input alpha is not consistant with this average.");
+            }
+
+            if (inOther.count_ == 0)
+            {
+                return;
+            }
+
+            if (count_ == 0)
+            {
+                *this = inOther;
+                return;
+            }
+
+            if (inOther.value_.shape() != value_.shape())
+            {
+                throw std::invalid_argument("ERROR: ExponentialMovingAverage::merge: input average shape is not consistant with this average.");
+            }
+
+            // the average is linear in its starting state, the other average was
+            // seeded with its first sample instead of with this average
+            const double decay = std::pow(1.0 - alpha_, static_cast<double>(inOther.count_));
+            for (uint32 i = 0; i < value_.size(); ++i)
+            {
+                value_[i] = inOther.value_[i] + decay * (value_[i] - inOther.first_[i]);
+            }
+            count_ += inOther.count_;
+        }
+
+        //============================================================================
+        ///						Clears the average
+        ///		
+        /// @param      None
+        ///
+        /// @return     None
+        ///
+        void reset()
+        {
+            count_ = 0;
+            value_ = NdArray<double>();
+            first_ = NdArray<double>();
+        }
+
+        //============================================================================
+        ///						Returns the number of arrays pushed
+        ///		
+        /// @param      None
+        ///
+        /// @return     count
+        ///
+        uint64 count() const
+        {
+            return count_;
+        }
+
+        //============================================================================
+        ///						Returns the current average of each element
+        ///		
+        /// @param      None
+        ///
+        /// @return     NdArray
+        ///
+        const NdArray<double>& value() const
+        {
+            return value_;
+        }
+    };
+
+    //================================================================================
+    ///						Histogram with fixed, evenly spaced bins of all of the values
+    ///						pushed into it. Values outside of the bin range are counted
+    ///						separately and NaNs are ignored.
+    template<typename dtype>
+    class RunningHistogram
+    {
+    private:
+        //==============================Attributes====================================
+        double              min_;
+        double              max_;
+        double              binsPerUnit_;
+        NdArray<uint32>     counts_;
+        uint32              numUnderflow_;
+        uint32              numOverflow_;
+
+    public:
+        //============================================================================
+        ///						Constructor
+        ///		
+        /// @param      number of bins
+        /// @param      lower edge of the first bin
+        /// @param      upper edge of the last bin
+        ///
+        /// @return     None
+        ///
+        RunningHistogram(uint32 inNumBins, double inMin, double inMax) :
+            min_(inMin),
+            max_(inMax),
+            binsPerUnit_(0),
+            counts_(1, inNumBins),
+            numUnderflow_(0),
+            numOverflow_(0)
+        {
+            if (inNumBins == 0)
+            {
+                throw std::invalid_argument("ERROR: RunningHistogram: number of bins must be positive.");
+            }
+
+            if (!(inMin < inMax))
+            {
+                throw std::invalid_argument("ERROR: RunningHistogram: input min must be less than input max.");
+            }
+
+            binsPerUnit_ = static_cast<double>(inNumBins) / (inMax - inMin);
+            counts_.zeros();
+        }
+
+        //============================================================================
+        ///						Adds every element of the array to the histogram
+        ///		
+        /// @param      NdArray
+        ///
+        /// @return     None
+        ///
+        void push(const NdArray<dtype>& inArray)
+        {
+            const uint32 lastBin = counts_.size() - 1;
+            for (uint32 i = 0; i < inArray.size(); ++i)
+            {
+                const double value = static_cast<double>(inArray[i]);
+                if (value < min_)
+                {
+                    ++numUnderflow_;
+                }
+                else if (value > max_)
+                {
+                    ++numOverflow_;
+                }
+                else if (value == value)
+                {
+                    // the upper edge of the last bin is inclusive, like numpy
+                    const uint32 bin = static_cast<uint32>((value - min_) * binsPerUnit_);
+                    ++counts_[std::min(bin, lastBin)];
+                }
+            }
+        }
+
+        //============================================================================
+        ///						Combines the counts of another histogram with the same
+        ///						bins into this one
+        ///		
+        /// @param      RunningHistogram
+        ///
+        /// @return     None
+        ///
+        void merge(const RunningHistogram<dtype>& inOther)
+        {
+            if (inOther.counts_.size() != counts_.size() || inOther.min_ != min_ || inOther.max_ != max_)
+            {
+                throw std::invalid_argument("ERROR: RunningHistogram::merge: input histogram bins are not consistant with this histogram.");
+            }
+
+            for (uint32 i = 0; i < counts_.size(); ++i)
+            {
+                counts_[i] += inOther.counts_[i];
+            }
+            numUnderflow_ += inOther.numUnderflow_;
+            numOverflow_ += inOther.numOverflow_;
+        }
+
+        //============================================================================
+        ///						Clears the counts
+        ///		
+        /// @param      None
+        ///
+        /// @return     None
+        ///
+        void reset()
+        {
+            counts_.zeros();
+            numUnderflow_ = 0;
+            numOverflow_ = 0;
+        }
+
+        //============================================================================
+        ///						Returns the histogram
+        ///		
+        /// @param      None
+        ///
+        /// @return     std::pair of NdArrays; first is histogram counts, seconds is the bin edges
+        ///
+        std::pair<NdArray<uint32>, NdArray<double> > histogram() const
+        {
+            NdArray<double> binEdges(1, counts_.size() + 1);
+            const double binWidth = (max_ - min_) / static_cast<double>(counts_.size());
+            for (uint32 i = 0; i < binEdges.size(); ++i)
+            {
+                binEdges[i] = min_ + static_cast<double>(i) * binWidth;
+            }
+            binEdges[binEdges.size() - 1] = max_;
+
+            return std::make_pair(counts_, binEdges);
+        }
+
+        //============================================================================
+        ///						Returns the number of values below the first bin
+        ///		
+        /// @param      None
+        ///
+        /// @return     count
+        ///
+        uint32 numUnderflow() const
+        {
+            return numUnderflow_;
+        }
+
+        //============================================================================
+        ///						Returns the number of values above the last bin
+        ///		
+        /// @param      None
+        ///
+        /// @return     count
+        ///
+        uint32 numOverflow() const
+        {
+            return numOverflow_;
+        }
+    };
+
+    //================================================================================
+    ///						Approximate quantiles of all of the values pushed into it,
+    ///						using a compacting sketch in the style of Karnin, Lang and
+    ///						Liberty. Values are kept exactly until the first level fills,
+    ///						after which a full level is sorted and every other value is
+    ///						promoted to the next level with twice the weight. Memory
+    ///						grows with the log of the number of values. Each level adds
+    ///						at most count / capacity to the rank error, so a percentile
+    ///						is within count / capacity * (log2(count / capacity) + 1)
+    ///						ranks of the requested rank. The minimum and maximum are
+    ///						tracked exactly and NaNs are ignored.
+    template<typename dtype>
+    class RunningQuantile
+    {
+    private:
+        //==============================Attributes====================================
+        uint32                              capacity_;
+        uint64                              count_;
+        double                              min_;
+        double                              max_;
+        bool                                keepOdd_;
+        std::vector<std::vector<double> >   levels_;
+
+        //============================================================================
+        ///						Halves every level that has reached capacity
+        ///		
+        /// @param      None
+        ///
+        /// @return     None
+        ///
+        void compress()
+        {
+            for (uint32 level = 0; level < levels_.size(); ++level)
+            {
+                if (levels_[level].size() < capacity_)
+                {
+                    continue;
+                }
+
+                if (level + 1 == levels_.size())
+                {
+                    levels_.push_back(std::vector<double>());
+                }
+
+                std::vector<double>& values = levels_[level];
+                std::sort(values.begin(), values.end());
+
+                // an odd value out stays behind so the total weight is unchanged,
+                // and alternating which half is promoted keeps the sketch unbiased
+                double holdOver = 0;
+                const bool hasHoldOver = values.size() % 2 != 0;
+                if (hasHoldOver)
+                {
+                    holdOver = values.back();
+                    values.pop_back();
+                }
+
+                std::vector<double>& nextValues = levels_[level + 1];
+                for (uint32 i = keepOdd_ ? 1 : 0; i < values.size(); i += 2)
+                {
+                    nextValues.push_back(values[i]);
+                }
+                keepOdd_ = !keepOdd_;
+
+                values.clear();
+                if (hasHoldOver)
+                {
+                    values.push_back(holdOver);
+                }
+            }
+        }
+
+    public:
+        //============================================================================
+        ///						Constructor
+        ///		
+        /// @param      (Optional) values kept per level, larger is more accurate, default 200
+        ///
+        /// @return     None
+        ///
+        explicit RunningQuantile(uint32 inCapacity = 200) :
+            capacity_(inCapacity),
+            count_(0),
+            min_(std::numeric_limits<double>::infinity()),
+            max_(-std::numeric_limits<double>::infinity()),
+            keepOdd_(false),
+            levels_(1)
+        {
+            if (inCapacity < 2)
+            {
+                throw std::invalid_argument("ERROR: RunningQuantile: input capacity must be at least 2.");
+            }
+
+            levels_[0].reserve(inCapacity);
+        }
+
+        //============================================================================
+        ///						Adds every element of the array to the sketch
+        ///		
+        /// @param      NdArray
+        ///
+        /// @return     None
+        ///
+        void push(const NdArray<dtype>& inArray)
+        {
+            for (uint32 i = 0; i < inArray.size(); ++i)
+            {
+                const double value = static_cast<double>(inArray[i]);
+                if (value != value)
+                {
+                    continue;
+                }
+
+                levels_[0].push_back(value);
+                min_ = std::min(min_, value);
+                max_ = std::max(max_, value);
+                ++count_;
+                if (levels_[0].size() >= capacity_)
+                {
+                    compress();
+                }
+            }
+        }
+
+        //============================================================================
+        ///						Combines the values of another sketch into this one
+        ///		
+        /// @param      RunningQuantile
+        ///
+        /// @return     None
+        ///
+        void merge(const RunningQuantile<dtype>& inOther)
+        {
+            if (inOther.levels_.size() > levels_.size())
+            {
+                levels_.resize(inOther.levels_.size());
+            }
+
+            for (uint32 level = 0; level < inOther.levels_.size(); ++level)
+            {
+                levels_[level].insert(levels_[level].end(), inOther.levels_[level].begin(), inOther.levels_[level].end());
+            }
+            count_ += inOther.count_;
+            min_ = std::min(min_, inOther.min_);
+            max_ = std::max(max_, inOther.max_);
+
+            compress();
+        }
+
+        //============================================================================
+        ///						Clears the sketch
+        ///		
+        /// @param      None
+        ///
+        /// @return     None
+        ///
+        void reset()
+        {
+            count_ = 0;
+            min_ = std::numeric_limits<double>::infinity();
+            max_ = -std::numeric_limits<double>::infinity();
+            levels_.assign(1, std::vector<double>());
+        }
+
+        //============================================================================
+        ///						Returns the number of values pushed
+        ///		
+        /// @param      None
+        ///
+        /// @return     count
+        ///
+        uint64 count() const
+        {
+            return count_;
+        }
+
+        //============================================================================
+        ///						Returns the approximate qth percentile, linearly
+        ///						interpolated like Methods::percentile. The result is exact
+        ///						until the first level fills.
+        ///		
+        /// @param      percentile, must be in the range [0, 100]
+        ///
+        /// @return     percentile value, NaN if no values have been pushed
+        ///
+        double percentile(double inPercentile) const
+        {
+            if (inPercentile < 0 || inPercentile > 100)
+            {
+                throw std::invalid_argument("ERROR: RunningQuantile::percentile: input percentile value must be of the range [0, 100].");
+            }
+
+            std::vector<std::pair<double, uint64> > items;
+            uint64 totalWeight = 0;
+            for (uint32 level = 0; level < levels_.size(); ++level)
+            {
+                const uint64 weight = static_cast<uint64>(1) << level;
+                for (uint32 i = 0; i < levels_[level].size(); ++i)
+                {
+                    items.push_back(std::make_pair(levels_[level][i], weight));
+                }
+                totalWeight += weight * levels_[level].size();
+            }
+
+            if (items.empty())
+            {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+
+            // the extremes can be compacted away, so they are tracked exactly
+            if (inPercentile == 0)
+            {
+                return min_;
+            }
+            else if (inPercentile == 100)
+            {
+                return max_;
+            }
+
+            std::sort(items.begin(), items.end());
+
+            // each item covers weight consecutive ranks of the full sorted data
+            const double rank = inPercentile / 100.0 * static_cast<double>(totalWeight - 1);
+            const uint64 lowerRank = static_cast<uint64>(std::floor(rank));
+            const uint64 upperRank = std::min(lowerRank + 1, totalWeight - 1);
+            const double fraction = rank - static_cast<double>(lowerRank);
+
+            double lowerValue = items.back().first;
+            double upperValue = items.back().first;
+            uint64 cumulativeWeight = 0;
+            for (uint32 i = 0; i < items.size(); ++i)
+            {
+                cumulativeWeight += items[i].second;
+                if (lowerRank < cumulativeWeight)
+                {
+                    lowerValue = items[i].first;
+                    upperValue = upperRank < cumulativeWeight ? items[i].first : items[i + 1].first;
+                    break;
+                }
+            }
+
+            return lowerValue + (upperValue - lowerValue) * fraction;
+        }
+    };
+}
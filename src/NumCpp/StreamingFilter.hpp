@@ -0,0 +1,495 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+/// @version 1.0
+///
+/// @section LICENSE
+/// Copyright 2018 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software 
+/// without restriction, including without limitation the rights to use, copy, modify, 
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to 
+/// permit persons to whom the Software is furnished to do so, subject to the following 
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies 
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+/// DEALINGS IN THE SOFTWARE.
+///
+/// @section DESCRIPTION
+/// Stateful one-dimensional filters over a signal that arrives in chunks
+///
+#pragma once
+
+#include"NumCpp/Filter.hpp"
+#include"NumCpp/NdArray.hpp"
+#include"NumCpp/Types.hpp"
+
+#include<algorithm>
+#include<deque>
+#include<stdexcept>
+#include<string>
+#include<utility>
+#include<vector>
+
+namespace NumCpp
+{
+    //================================================================================
+    ///						A one-dimensional filter over a signal that arrives in chunks
+    ///						of any size. The filter keeps the few samples its window still
+    ///						needs between calls to push and emits each output once the
+    ///						sample half a kernel past it has arrived, so the latency is a
+    ///						fixed latency() samples. flush ends the signal: it applies the
+    ///						closing boundary, emits the remaining outputs and readies the
+    ///						filter for a new signal. The outputs of all the calls together
+    ///						are the same as the matching Filters::*1d function run on the
+    ///						whole signal (convolve1d with the DIRECT method and
+    ///						uniformFilter1d with the RECURSIVE method).
+    ///
+    ///						WRAP needs both ends of the signal at once and can not be
+    ///						streamed.
+    ///
+    ///						eg StreamingFilter<double> filter = StreamingFilter<double>::medianFilter1d(5);
+    ///						   NdArray<double> smoothed = filter.push(chunk);
+    template<typename dtype>
+    class StreamingFilter
+    {
+    private:
+        //==============================Enums=========================================
+        enum Kind { CONVOLVE = 0, UNIFORM, MAXIMUM, MINIMUM, RANK };
+
+        //==============================Attributes====================================
+        Kind                                    kind_;
+        uint32                                  size_;
+        uint32                                  halfSize_;
+        std::vector<double>                     weights_;
+        uint32                                  rank_;
+        Filter::Boundary::Mode                  mode_;
+        dtype                                   constantValue_;
+
+        // samples [historyStart_, historyStart_ + history_.size()) of the signal
+        std::vector<dtype>                      history_;
+        uint64                                  historyStart_;
+        uint64                                  numIn_;
+        uint64                                  numOut_;
+
+        std::vector<dtype>                      line_;
+        double                                  prefixSum_;
+        std::vector<double>                     blockSuffix_;
+        typename Filters<dtype>::RankWindow     window_;
+        std::deque<std::pair<int64, dtype> >    extremes_;
+
+        //============================================================================
+        ///						Constructor
+        ///		
+        /// @param      filter kind
+        /// @param      kernel size
+        /// @param      boundary mode
+        /// @param      contant value if boundary = 'constant'
+        /// @param      name of the calling function for the error message
+        ///
+        /// @return     None
+        ///
+        StreamingFilter(Kind inKind, uint32 inSize, Filter::Boundary::Mode inMode, dtype inConstantValue,
+            const std::string& inFunctionName) :
+            kind_(inKind),
+            size_(inSize),
+            halfSize_(inSize / 2), // integer division
+            rank_(0),
+            mode_(inMode),
+            constantValue_(inConstantValue),
+            historyStart_(0),
+            numIn_(0),
+            numOut_(0),
+            line_(inSize),
+            prefixSum_(0),
+            blockSuffix_(inSize)
+        {
+            if (inSize % 2 == 0)
+            {
+                throw std::invalid_argument("ERROR: NumCpp::StreamingFilter::" + inFunctionName + ": input kernal size must be an odd value.");
+            }
+
+            if (inMode == Filter::Boundary::WRAP)
+            {
+                throw std::invalid_argument("ERROR: NumCpp::StreamingFilter::" + inFunctionName + ": WRAP boundary can not be streamed.");
+            }
+        }
+
+        //============================================================================
+        ///						Number of trailing samples kept for the windows still to
+        ///						come, with room for the closing boundary to reflect into
+        ///		
+        /// @return     uint32
+        ///
+        uint32 historySize() const
+        {
+            return 2 * size_ + 2;
+        }
+
+        //============================================================================
+        ///						Maps a signal index, possibly past either end of a signal of
+        ///						inLength samples, to its value for the boundary mode. Near
+        ///						the start the mapping is the same for any length longer
+        ///						than the latency, so it is resolved as soon as the window
+        ///						is complete; past the end it is resolved on flush.
+        ///		
+        /// @param      signal index
+        /// @param      signal length
+        ///
+        /// @return     dtype
+        ///
+        dtype value(int64 inIndex, uint64 inLength) const
+        {
+            if (inIndex >= 0 && static_cast<uint64>(inIndex) < inLength)
+            {
+                return history_[static_cast<size_t>(static_cast<uint64>(inIndex) - historyStart_)];
+            }
+
+            // only the last samples are kept, so reflect within them
+            const uint64 kept = std::min<uint64>(inLength, historySize());
+            const uint64 base = inIndex < 0 ? 0 : inLength - kept;
+            const int32 index = Filters<dtype>::boundaryIndex(static_cast<int32>(inIndex - static_cast<int64>(base)),
+                static_cast<uint32>(kept), mode_);
+            if (index < 0)
+            {
+                return constantValue_;
+            }
+
+            return history_[static_cast<size_t>(base + static_cast<uint64>(index) - historyStart_)];
+        }
+
+        //============================================================================
+        ///						Adds a sample to the extremum window, dropping the samples it
+        ///						outranks as they can no longer be the extremum
+        ///		
+        /// @param      signal index
+        /// @param      sample
+        ///
+        /// @return     None
+        ///
+        void pushExtreme(int64 inIndex, dtype inValue)
+        {
+            if (kind_ == MAXIMUM)
+            {
+                while (!extremes_.empty() && !(inValue < extremes_.back().second))
+                {
+                    extremes_.pop_back();
+                }
+            }
+            else
+            {
+                while (!extremes_.empty() && !(extremes_.back().second < inValue))
+                {
+                    extremes_.pop_back();
+                }
+            }
+
+            extremes_.push_back(std::make_pair(inIndex, inValue));
+        }
+
+        //============================================================================
+        ///						Computes the output at a signal index
+        ///		
+        /// @param      signal index
+        /// @param      signal length known so far
+        ///
+        /// @return     dtype
+        ///
+        dtype filterAt(uint64 inIndex, uint64 inLength)
+        {
+            const int64 first = static_cast<int64>(inIndex) - static_cast<int64>(halfSize_);
+            const int64 last = static_cast<int64>(inIndex) + static_cast<int64>(halfSize_);
+
+            switch (kind_)
+            {
+                case CONVOLVE:
+                {
+                    // the interior windows read the history directly
+                    const dtype* window = &line_[0];
+                    if (first >= 0 && static_cast<uint64>(last) < inLength)
+                    {
+                        window = &history_[static_cast<size_t>(static_cast<uint64>(first) - historyStart_)];
+                    }
+                    else
+                    {
+                        for (uint32 k = 0; k < size_; ++k)
+                        {
+                            line_[k] = value(first + k, inLength);
+                        }
+                    }
+
+                    double sum = 0;
+                    for (uint32 k = 0; k < size_; ++k)
+                    {
+                        sum += static_cast<double>(window[k]) * weights_[k];
+                    }
+                    return static_cast<dtype>(sum);
+                }
+                case UNIFORM:
+                {
+                    // the block running sums of Filters::runningSumLine. The window
+                    // that starts a block is the whole block, and its suffix sums are
+                    // taken then; the later windows add the prefix of the next block.
+                    // Nothing is subtracted back out, so a non-finite sample only
+                    // reaches the windows that hold it and the sums restart every
+                    // size_ samples.
+                    const uint32 offset = static_cast<uint32>(inIndex % size_);
+                    if (offset == 0)
+                    {
+                        for (uint32 k = size_; k-- > 0; )
+                        {
+                            const double sample = static_cast<double>(value(first + k, inLength));
+                            blockSuffix_[k] = k == size_ - 1 ? sample : blockSuffix_[k + 1] + sample;
+                        }
+                        return static_cast<dtype>(blockSuffix_[0] / static_cast<double>(size_));
+                    }
+
+                    const double sample = static_cast<double>(value(last, inLength));
+                    prefixSum_ = offset == 1 ? sample : prefixSum_ + sample;
+                    return static_cast<dtype>((blockSuffix_[offset] + prefixSum_) / static_cast<double>(size_));
+                }
+                case MAXIMUM:
+                case MINIMUM:
+                {
+                    for (int64 i = inIndex == 0 ? first : last; i <= last; ++i)
+                    {
+                        pushExtreme(i, value(i, inLength));
+                    }
+
+                    while (extremes_.front().first < first)
+                    {
+                        extremes_.pop_front();
+                    }
+                    return extremes_.front().second;
+                }
+                default:
+                {
+                    if (inIndex == 0)
+                    {
+                        for (int64 i = first; i <= last; ++i)
+                        {
+                            window_.add(value(i, inLength));
+                        }
+                    }
+                    else
+                    {
+                        const dtype outgoing = value(first - 1, inLength);
+                        const dtype incoming = value(last, inLength);
+                        window_.replace(&outgoing, &incoming, 1);
+                    }
+                    return window_.select(rank_);
+                }
+            }
+        }
+
+    public:
+        //============================================================================
+        ///						Streaming version of Filters::convolve1d
+        ///		
+        /// @param      NdArray, weights
+        /// @param      boundary mode, default Reflect, options (reflect, constant, nearest, mirror)
+        /// @param      contant value if boundary = 'constant'
+        ///
+        /// @return     StreamingFilter
+        ///
+        static StreamingFilter<dtype> convolve1d(const NdArray<dtype>& inWeights,
+            Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            StreamingFilter<dtype> filter(CONVOLVE, inWeights.size(), inMode, inConstantValue, "convolve1d");
+
+            // a convolution is a correlation with the flipped weights
+            filter.weights_.assign(inWeights.cbegin(), inWeights.cend());
+            std::reverse(filter.weights_.begin(), filter.weights_.end());
+            return filter;
+        }
+
+        //============================================================================
+        ///						Streaming version of Filters::gaussianFilter1d
+        ///		
+        /// @param      Standard deviation for Gaussian kernel
+        /// @param      boundary mode, default Reflect, options (reflect, constant, nearest, mirror)
+        /// @param      contant value if boundary = 'constant'
+        ///
+        /// @return     StreamingFilter
+        ///
+        static StreamingFilter<dtype> gaussianFilter1d(double inSigma,
+            Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            if (inSigma <= 0)
+            {
+                throw std::invalid_argument("ERROR: NumCpp::StreamingFilter::gaussianFilter1d: input sigma value must be greater than zero.");
+            }
+
+            const std::vector<double> kernel = Filters<dtype>::gaussianKernel(inSigma);
+            StreamingFilter<dtype> filter(CONVOLVE, static_cast<uint32>(kernel.size()), inMode, inConstantValue, "gaussianFilter1d");
+            filter.weights_ = kernel;
+            return filter;
+        }
+
+        //============================================================================
+        ///						Streaming version of Filters::maximumFilter1d
+        ///		
+        /// @param      size of the kernel to apply
+        /// @param      boundary mode, default Reflect, options (reflect, constant, nearest, mirror)
+        /// @param      contant value if boundary = 'constant'
+        ///
+        /// @return     StreamingFilter
+        ///
+        static StreamingFilter<dtype> maximumFilter1d(uint32 inSize,
+            Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            return StreamingFilter<dtype>(MAXIMUM, inSize, inMode, inConstantValue, "maximumFilter1d");
+        }
+
+        //============================================================================
+        ///						Streaming version of Filters::medianFilter1d
+        ///		
+        /// @param      size of the kernel to apply
+        /// @param      boundary mode, default Reflect, options (reflect, constant, nearest, mirror)
+        /// @param      contant value if boundary = 'constant'
+        ///
+        /// @return     StreamingFilter
+        ///
+        static StreamingFilter<dtype> medianFilter1d(uint32 inSize,
+            Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            StreamingFilter<dtype> filter(RANK, inSize, inMode, inConstantValue, "medianFilter1d");
+            filter.rank_ = inSize / 2; // integer division
+            return filter;
+        }
+
+        //============================================================================
+        ///						Streaming version of Filters::minumumFilter1d
+        ///		
+        /// @param      size of the kernel to apply
+        /// @param      boundary mode, default Reflect, options (reflect, constant, nearest, mirror)
+        /// @param      contant value if boundary = 'constant'
+        ///
+        /// @return     StreamingFilter
+        ///
+        static StreamingFilter<dtype> minimumFilter1d(uint32 inSize,
+            Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            return StreamingFilter<dtype>(MINIMUM, inSize, inMode, inConstantValue, "minimumFilter1d");
+        }
+
+        //============================================================================
+        ///						Streaming version of Filters::uniformFilter1d
+        ///		
+        /// @param      size of the kernel to apply
+        /// @param      boundary mode, default Reflect, options (reflect, constant, nearest, mirror)
+        /// @param      contant value if boundary = 'constant'
+        ///
+        /// @return     StreamingFilter
+        ///
+        static StreamingFilter<dtype> uniformFilter1d(uint32 inSize,
+            Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+        {
+            return StreamingFilter<dtype>(UNIFORM, inSize, inMode, inConstantValue, "uniformFilter1d");
+        }
+
+        //============================================================================
+        ///						Number of samples an output waits for after its own sample
+        ///		
+        /// @return     uint32
+        ///
+        uint32 latency() const
+        {
+            return halfSize_;
+        }
+
+        //============================================================================
+        ///						Number of samples pushed since the signal started
+        ///		
+        /// @return     uint64
+        ///
+        uint64 numIn() const
+        {
+            return numIn_;
+        }
+
+        //============================================================================
+        ///						Number of outputs emitted since the signal started
+        ///		
+        /// @return     uint64
+        ///
+        uint64 numOut() const
+        {
+            return numOut_;
+        }
+
+        //============================================================================
+        ///						Adds the next chunk of the signal and returns the outputs
+        ///						that are now complete, a row of possibly zero values
+        ///		
+        /// @param      NdArray, chunk of the signal of any shape, read flattened
+        ///
+        /// @return     NdArray
+        ///
+        NdArray<dtype> push(const NdArray<dtype>& inChunk)
+        {
+            // drop the samples no window will read again, once enough have built up
+            const uint32 keep = historySize();
+            if (history_.size() + inChunk.size() > 2 * keep && history_.size() > keep)
+            {
+                const size_t numDrop = history_.size() - keep;
+                history_.erase(history_.begin(), history_.begin() + numDrop);
+                historyStart_ += numDrop;
+            }
+            history_.insert(history_.end(), inChunk.cbegin(), inChunk.cend());
+            numIn_ += inChunk.size();
+
+            // each output waits until its whole window has arrived
+            const uint64 numReady = numIn_ > halfSize_ ? numIn_ - halfSize_ : 0;
+            NdArray<dtype> returnArray(1, static_cast<uint32>(numReady - numOut_));
+            for (uint32 i = 0; numOut_ < numReady; ++i, ++numOut_)
+            {
+                returnArray[i] = filterAt(numOut_, numIn_);
+            }
+
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        ///						Ends the signal, returns the outputs still waiting on the
+        ///						closing boundary, and resets the filter for a new signal
+        ///		
+        /// @return     NdArray
+        ///
+        NdArray<dtype> flush()
+        {
+            NdArray<dtype> returnArray(1, static_cast<uint32>(numIn_ - numOut_));
+            for (uint32 i = 0; numOut_ < numIn_; ++i, ++numOut_)
+            {
+                returnArray[i] = filterAt(numOut_, numIn_);
+            }
+
+            reset();
+            return std::move(returnArray);
+        }
+
+        //============================================================================
+        ///						Discards the signal so far
+        ///		
+        /// @return     None
+        ///
+        void reset()
+        {
+            history_.clear();
+            historyStart_ = 0;
+            numIn_ = 0;
+            numOut_ = 0;
+            prefixSum_ = 0;
+            window_ = typename Filters<dtype>::RankWindow();
+            extremes_.clear();
+        }
+    };
+}
@@ -0,0 +1,314 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+/// @version 1.0
+///
+/// @section LICENSE
+/// Copyright 2018 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software 
+/// without restriction, including without limitation the rights to use, copy, modify, 
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to 
+/// permit persons to whom the Software is furnished to do so, subject to the following 
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies 
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+/// DEALINGS IN THE SOFTWARE.
+///
+/// @section DESCRIPTION
+/// Non-owning strided view of an NdArray for copy free flips, transposes and rotations
+///
+#pragma once
+
+#include"NumCpp/NdArray.hpp"
+#include"NumCpp/Shape.hpp"
+#include"NumCpp/Types.hpp"
+#include"NumCpp/Utils.hpp"
+
+#include<algorithm>
+#include<cstdlib>
+#include<stdexcept>
+#include<string>
+
+namespace NumCpp
+{
+    //================================================================================
+    ///						A read only view of an NdArray addressed through signed row
+    ///						and column strides. Flips negate a stride and transposes swap
+    ///						them, so any chain of flip/transpose/rot90 costs nothing until
+    ///						the view is read or materialized with toNdArray. The view does
+    ///						not own its data and must not outlive the NdArray it was
+    ///						created from.
+    template<typename dtype>
+    class StridedView
+    {
+    private:
+        //==============================Attributes====================================
+        const dtype*    origin_;
+        Shape           shape_;
+        int64           rowStride_;
+        int64           colStride_;
+
+    public:
+        //============================================================================
+        ///						Constructor
+        ///		
+        /// @param      NdArray to view
+        ///
+        /// @return     None
+        ///
+        explicit StridedView(const NdArray<dtype>& inArray) :
+            origin_(inArray.cbegin()),
+            shape_(inArray.shape()),
+            rowStride_(static_cast<int64>(inArray.shape().cols)),
+            colStride_(1)
+        {}
+
+        //============================================================================
+        ///						Returns the element at the row and column
+        ///		
+        /// @param      row
+        /// @param      col
+        ///
+        /// @return     value
+        ///
+        const dtype& operator()(uint32 inRow, uint32 inCol) const
+        {
+            return origin_[static_cast<int64>(inRow) * rowStride_ + static_cast<int64>(inCol) * colStride_];
+        }
+
+        //============================================================================
+        ///						Returns the element at the flat (row major) index
+        ///		
+        /// @param      flat index
+        ///
+        /// @return     value
+        ///
+        const dtype& operator[](uint32 inIndex) const
+        {
+            return operator()(inIndex / shape_.cols, inIndex % shape_.cols);
+        }
+
+        //============================================================================
+        ///						Returns the element at the row and column, with bounds checking
+        ///		
+        /// @param      row
+        /// @param      col
+        ///
+        /// @return     value
+        ///
+        const dtype& at(uint32 inRow, uint32 inCol) const
+        {
+            if (inRow >= shape_.rows || inCol >= shape_.cols)
+            {
+                std::string errStr = "ERROR: StridedView::at: index (" + Utils<uint32>::num2str(inRow) + ", ";
+                errStr += Utils<uint32>::num2str(inCol) + ") out of bounds for shape " + shape_.str();
+                throw std::invalid_argument(errStr);
+            }
+
+            return operator()(inRow, inCol);
+        }
+
+        //============================================================================
+        ///						Reverses the view along the given axis
+        ///		
+        /// @param      (Optional) Axis
+        ///
+        /// @return     StridedView
+        ///
+        StridedView<dtype> flip(Axis::Type inAxis = Axis::NONE) const
+        {
+            StridedView<dtype> returnView(*this);
+            if (shape_.size() == 0)
+            {
+                return returnView;
+            }
+
+            // reversing the flat order of a 2d array is the same as
+            // reversing both of its axes
+            if (inAxis == Axis::NONE || inAxis == Axis::ROW)
+            {
+                returnView.origin_ += static_cast<int64>(shape_.rows - 1) * rowStride_;
+                returnView.rowStride_ = -rowStride_;
+            }
+
+            if (inAxis == Axis::NONE || inAxis == Axis::COL)
+            {
+                returnView.origin_ += static_cast<int64>(shape_.cols - 1) * colStride_;
+                returnView.colStride_ = -colStride_;
+            }
+
+            return returnView;
+        }
+
+        //============================================================================
+        ///						Reverses the view left/right
+        ///		
+        /// @param      None
+        ///
+        /// @return     StridedView
+        ///
+        StridedView<dtype> fliplr() const
+        {
+            return flip(Axis::COL);
+        }
+
+        //============================================================================
+        ///						Reverses the view up/down
+        ///		
+        /// @param      None
+        ///
+        /// @return     StridedView
+        ///
+        StridedView<dtype> flipud() const
+        {
+            return flip(Axis::ROW);
+        }
+
+        //============================================================================
+        ///						Rotates the view by 90 degrees counter clockwise
+        ///		
+        /// @param      (Optional) the number of times to rotate 90 degrees
+        ///
+        /// @return     StridedView
+        ///
+        StridedView<dtype> rot90(uint8 inK = 1) const
+        {
+            switch (inK % 4)
+            {
+                case 1:
+                {
+                    return transpose().flipud();
+                }
+                case 2:
+                {
+                    return flip(Axis::NONE);
+                }
+                case 3:
+                {
+                    return transpose().fliplr();
+                }
+                default:
+                {
+                    return *this;
+                }
+            }
+        }
+
+        //============================================================================
+        ///						Swaps the rows and columns of the view
+        ///		
+        /// @param      None
+        ///
+        /// @return     StridedView
+        ///
+        StridedView<dtype> transpose() const
+        {
+            StridedView<dtype> returnView(*this);
+            returnView.shape_ = Shape(shape_.cols, shape_.rows);
+            returnView.rowStride_ = colStride_;
+            returnView.colStride_ = rowStride_;
+
+            return returnView;
+        }
+
+        //============================================================================
+        ///						Returns the shape of the view
+        ///		
+        /// @param      None
+        ///
+        /// @return     Shape
+        ///
+        Shape shape() const
+        {
+            return shape_;
+        }
+
+        //============================================================================
+        ///						Returns the number of elements in the view
+        ///		
+        /// @param      None
+        ///
+        /// @return     size
+        ///
+        uint32 size() const
+        {
+            return shape_.size();
+        }
+
+        //============================================================================
+        ///						Copies the view into an array of the same shape in a single
+        ///						pass. When the view walks the source column-wise the copy is
+        ///						done in square tiles to keep the reads cache friendly.
+        ///		
+        /// @param      NdArray, output array
+        ///
+        /// @return     NdArray&
+        ///
+        NdArray<dtype>& toNdArray(NdArray<dtype>& outArray) const
+        {
+            if (outArray.shape() != shape_)
+            {
+                throw std::invalid_argument("ERROR: StridedView::toNdArray: output array shape is not consistant with the view.");
+            }
+
+            typename NdArray<dtype>::iterator outData = outArray.begin();
+            if (std::llabs(colStride_) <= std::llabs(rowStride_))
+            {
+                for (uint32 row = 0; row < shape_.rows; ++row)
+                {
+                    const dtype* rowOrigin = origin_ + static_cast<int64>(row) * rowStride_;
+                    for (uint32 col = 0; col < shape_.cols; ++col)
+                    {
+                        outData[row * shape_.cols + col] = rowOrigin[static_cast<int64>(col) * colStride_];
+                    }
+                }
+
+                return outArray;
+            }
+
+            const uint32 tileSize = 32;
+            for (uint32 rowTile = 0; rowTile < shape_.rows; rowTile += tileSize)
+            {
+                const uint32 rowEnd = std::min(rowTile + tileSize, shape_.rows);
+                for (uint32 colTile = 0; colTile < shape_.cols; colTile += tileSize)
+                {
+                    const uint32 colEnd = std::min(colTile + tileSize, shape_.cols);
+                    for (uint32 col = colTile; col < colEnd; ++col)
+                    {
+                        const dtype* colOrigin = origin_ + static_cast<int64>(col) * colStride_;
+                        for (uint32 row = rowTile; row < rowEnd; ++row)
+                        {
+                            outData[row * shape_.cols + col] = colOrigin[static_cast<int64>(row) * rowStride_];
+                        }
+                    }
+                }
+            }
+
+            return outArray;
+        }
+
+        //============================================================================
+        ///						Materializes the view into a new array
+        ///		
+        /// @param      None
+        ///
+        /// @return     NdArray
+        ///
+        NdArray<dtype> toNdArray() const
+        {
+            NdArray<dtype> returnArray(shape_);
+            toNdArray(returnArray);
+
+            return std::move(returnArray);
+        }
+    };
+}
@@ -0,0 +1,383 @@
+/// @file
+/// @author David Pilger <dpilger26@gmail.com>
+/// [GitHub Repository](https://github.com/dpilger26/NumCpp)
+/// @version 1.0
+///
+/// @section LICENSE
+/// Copyright 2018 David Pilger
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+/// software and associated documentation files(the "Software"), to deal in the Software 
+/// without restriction, including without limitation the rights to use, copy, modify, 
+/// merge, publish, distribute, sublicense, and/or sell copies of the Software, and to 
+/// permit persons to whom the Software is furnished to do so, subject to the following 
+/// conditions :
+///
+/// The above copyright notice and this permission notice shall be included in all copies 
+/// or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+/// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+/// PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+/// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+/// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+/// DEALINGS IN THE SOFTWARE.
+///
+/// @section DESCRIPTION
+/// Splits work into row tiles and runs them on a group of worker threads
+///
+#pragma once
+
+#include"NumCpp/Types.hpp"
+
+#include<algorithm>
+#include<atomic>
+#include<condition_variable>
+#include<exception>
+#include<functional>
+#include<mutex>
+#include<system_error>
+#include<thread>
+#include<vector>
+
+namespace NumCpp
+{
+    //================================================================================
+    ///						Runs independent tasks on a pool of worker threads. The
+    ///						calling thread works through the tasks alongside the workers,
+    ///						which hand out task indices from a shared counter so uneven
+    ///						tasks balance themselves. The workers are started the first
+    ///						time a call needs them and then sleep between calls, so a
+    ///						call only pays for waking them; they are joined when the
+    ///						program exits. A parallelFor issued from inside a task, or
+    ///						while another thread's call has the pool, runs serially.
+    class TileExecutor
+    {
+    public:
+        //============================================================================
+        ///						Input bytes a row tile is sized to, about the L2 cache
+        ///						of one core
+        static const uint32 TILE_BYTES = 256 * 1024;
+
+        //============================================================================
+        ///						Returns the number of threads work is spread over
+        ///		
+        /// @return     number of threads, std::thread::hardware_concurrency() unless set
+        ///
+        static uint32 numThreads()
+        {
+            const uint32 setting = threadSetting();
+            if (setting > 0)
+            {
+                return setting;
+            }
+
+            const uint32 hardwareThreads = static_cast<uint32>(std::thread::hardware_concurrency());
+            return hardwareThreads > 0 ? hardwareThreads : 1;
+        }
+
+        //============================================================================
+        ///						Sets the number of threads work is spread over
+        ///		
+        /// @param      number of threads, 1 runs everything on the calling thread
+        ///             and 0 restores the hardware default
+        ///
+        /// @return     None
+        ///
+        static void setNumThreads(uint32 inNumThreads)
+        {
+            threadSetting() = inNumThreads;
+        }
+
+        //============================================================================
+        ///						Returns the number of rows in a tile so that the tile's
+        ///						input fits in TILE_BYTES. The tiling only depends on the
+        ///						image geometry, never on the thread count, so results do
+        ///						not change with the number of threads.
+        ///		
+        /// @param      bytes in one row of the input
+        /// @param      minimum number of rows, e.g. to keep halos a small fraction
+        ///
+        /// @return     rows per tile
+        ///
+        static uint32 tileRows(uint32 inRowBytes, uint32 inMinRows = 1)
+        {
+            const uint32 rows = TILE_BYTES / std::max(inRowBytes, static_cast<uint32>(1));
+            return std::max(std::max(rows, inMinRows), static_cast<uint32>(1));
+        }
+
+        //============================================================================
+        ///						Calls inFunction(task) for every task in [0, inNumTasks),
+        ///						spread over the worker threads. Returns once all tasks are
+        ///						done; the first exception thrown by a task, on any thread,
+        ///						is rethrown here and the tasks not yet started are skipped.
+        ///		
+        /// @param      number of tasks
+        /// @param      function taking the uint32 task index
+        ///
+        /// @return     None
+        ///
+        template<typename Function>
+        static void parallelFor(uint32 inNumTasks, const Function& inFunction)
+        {
+            const uint32 numWorkers = std::min(numThreads(), inNumTasks);
+            if (numWorkers <= 1 || insideTask())
+            {
+                for (uint32 task = 0; task < inNumTasks; ++task)
+                {
+                    inFunction(task);
+                }
+                return;
+            }
+
+            WorkerPool& workers = pool();
+            std::unique_lock<std::mutex> submitLock(workers.submitMutex(), std::try_to_lock);
+            if (!submitLock.owns_lock())
+            {
+                for (uint32 task = 0; task < inNumTasks; ++task)
+                {
+                    inFunction(task);
+                }
+                return;
+            }
+
+            std::atomic<uint32> nextTask(0);
+            std::exception_ptr error;
+            std::mutex errorMutex;
+
+            // the job never throws, a task's exception is kept for the calling thread
+            const std::function<void()> job = [&]()
+            {
+                for (uint32 task = nextTask++; task < inNumTasks; task = nextTask++)
+                {
+                    try
+                    {
+                        inFunction(task);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(errorMutex);
+                        if (!error)
+                        {
+                            error = std::current_exception();
+                        }
+                        nextTask = inNumTasks;
+                    }
+                }
+            };
+
+            workers.run(job, numWorkers - 1);
+
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+
+        //============================================================================
+        ///						Splits [0, inNumRows) into tiles of inRowsPerTile rows and
+        ///						calls inFunction(firstRow, numRows) for each, in parallel
+        ///		
+        /// @param      number of rows
+        /// @param      rows per tile, see tileRows()
+        /// @param      function taking the uint32 first row and number of rows
+        ///
+        /// @return     None
+        ///
+        template<typename Function>
+        static void forEachRowTile(uint32 inNumRows, uint32 inRowsPerTile, const Function& inFunction)
+        {
+            const uint32 rowsPerTile = std::max(inRowsPerTile, static_cast<uint32>(1));
+            const uint32 numTiles = (inNumRows + rowsPerTile - 1) / rowsPerTile;
+            parallelFor(numTiles,
+                [&](uint32 inTile)
+                {
+                    const uint32 firstRow = inTile * rowsPerTile;
+                    inFunction(firstRow, std::min(rowsPerTile, inNumRows - firstRow));
+                });
+        }
+
+    private:
+        //============================================================================
+        ///						Persistent worker threads. A call to run hands its job to
+        ///						as many sleeping workers as it asks for, runs the job on the
+        ///						calling thread too, and returns once every worker that took
+        ///						the job is done with it, as the job refers to the caller's
+        ///						stack.
+        class WorkerPool
+        {
+        public:
+            //============================================================================
+            ///						Constructor
+            ///		
+            /// @return     None
+            ///
+            WorkerPool() :
+                job_(nullptr),
+                seats_(0),
+                busy_(0),
+                generation_(0),
+                stop_(false)
+            {}
+
+            //============================================================================
+            ///						Destructor, wakes the workers and joins them
+            ///		
+            /// @return     None
+            ///
+            ~WorkerPool()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    stop_ = true;
+                }
+                wake_.notify_all();
+
+                for (auto& thread : threads_)
+                {
+                    thread.join();
+                }
+            }
+
+            //============================================================================
+            ///						Held by the one call using the pool at a time
+            ///		
+            /// @return     std::mutex&
+            ///
+            std::mutex& submitMutex()
+            {
+                return submitMutex_;
+            }
+
+            //============================================================================
+            ///						Runs the job on the calling thread and on up to
+            ///						inNumHelpers workers, starting the workers still missing
+            ///		
+            /// @param      job, must not throw
+            /// @param      number of workers to run it on
+            ///
+            /// @return     None
+            ///
+            void run(const std::function<void()>& inJob, uint32 inNumHelpers)
+            {
+                while (threads_.size() < inNumHelpers)
+                {
+                    try
+                    {
+                        threads_.push_back(std::thread(&WorkerPool::workerLoop, this));
+                    }
+                    catch (const std::system_error&)
+                    {
+                        // could not start another thread, the ones running pick up the slack
+                        break;
+                    }
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    job_ = &inJob;
+                    seats_ = std::min(inNumHelpers, static_cast<uint32>(threads_.size()));
+                    ++generation_;
+                }
+                wake_.notify_all();
+
+                insideTask() = true;
+                inJob();
+                insideTask() = false;
+
+                // a worker that has not woken up by now no longer joins in
+                std::unique_lock<std::mutex> lock(mutex_);
+                seats_ = 0;
+                done_.wait(lock, [this]() { return busy_ == 0; });
+                job_ = nullptr;
+            }
+
+        private:
+            //==============================Attributes====================================
+            std::mutex                      submitMutex_;
+            std::mutex                      mutex_;
+            std::condition_variable         wake_;
+            std::condition_variable         done_;
+            std::vector<std::thread>        threads_;
+            const std::function<void()>*    job_;
+            uint32                          seats_;
+            uint32                          busy_;
+            uint64                          generation_;
+            bool                            stop_;
+
+            //============================================================================
+            ///						Body of a worker thread, sleeps until a job has a free
+            ///						seat or the pool shuts down
+            ///		
+            /// @return     None
+            ///
+            void workerLoop()
+            {
+                insideTask() = true;
+
+                uint64 seenGeneration = 0;
+                std::unique_lock<std::mutex> lock(mutex_);
+                for (;;)
+                {
+                    wake_.wait(lock, [&]() { return stop_ || generation_ != seenGeneration; });
+                    if (stop_)
+                    {
+                        return;
+                    }
+
+                    seenGeneration = generation_;
+                    if (seats_ == 0)
+                    {
+                        continue;
+                    }
+
+                    --seats_;
+                    ++busy_;
+                    const std::function<void()>* job = job_;
+                    lock.unlock();
+                    (*job)();
+                    lock.lock();
+
+                    if (--busy_ == 0)
+                    {
+                        done_.notify_all();
+                    }
+                }
+            }
+        };
+
+        //============================================================================
+        ///						The worker pool, created on first use and torn down, joining
+        ///						its workers, at program exit
+        ///		
+        /// @return     WorkerPool&
+        ///
+        static WorkerPool& pool()
+        {
+            static WorkerPool workers;
+            return workers;
+        }
+
+        //============================================================================
+        ///						The thread count set by setNumThreads, 0 for the default
+        ///		
+        /// @return     std::atomic<uint32>&
+        ///
+        static std::atomic<uint32>& threadSetting()
+        {
+            static std::atomic<uint32> setting(0);
+            return setting;
+        }
+
+        //============================================================================
+        ///						Whether the current thread is running a task
+        ///		
+        /// @return     bool&
+        ///
+        static bool& insideTask()
+        {
+            static thread_local bool inside = false;
+            return inside;
+        }
+    };
+}
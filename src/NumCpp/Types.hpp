@@ -49,4 +49,12 @@ namespace NumCpp
     //================================================================================
     ///						Enum for endianess
     struct Endian { enum Type { NATIVE = 0, BIG, LITTLE }; };
+
+    //================================================================================
+    ///						Enum of the statistics Methods::describe can compute, may be or'd together
+    struct Stat { enum Type { MIN = 1, MAX = 2, SUM = 4, MEAN = 8, STD = 16, COUNT_NONZERO = 32, ARGMIN = 64, ARGMAX = 128, ALL = 255 }; };
+
+    //================================================================================
+    ///						Enum for how astype converts floating point values to integers
+    struct Rounding { enum Type { TRUNCATE = 0, NEAREST }; };
 }
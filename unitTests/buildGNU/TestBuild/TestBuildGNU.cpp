@@ -11,18 +11,28 @@
 #include"NumCpp/Constants.hpp"
 #include"NumCpp/Coordinates.hpp"
 #include"NumCpp/DataCube.hpp"
+#include"NumCpp/Description.hpp"
 #include"NumCpp/DtypeInfo.hpp"
 #include"NumCpp/FFT.hpp"
+#include"NumCpp/FastMath.hpp"
 #include"NumCpp/Filter.hpp"
+#include"NumCpp/FilterPipeline.hpp"
+#include"NumCpp/Generator.hpp"
 #include"NumCpp/ImageProcessing.hpp"
 #include"NumCpp/Linalg.hpp"
+#include"NumCpp/MaskedArray.hpp"
 #include"NumCpp/Methods.hpp"
+#include"NumCpp/Morphology.hpp"
 #include"NumCpp/NdArray.hpp"
 #include"NumCpp/Polynomial.hpp"
 #include"NumCpp/Random.hpp"
 #include"NumCpp/Rotations.hpp"
+#include"NumCpp/RunningStatistics.hpp"
 #include"NumCpp/Shape.hpp"
 #include"NumCpp/Slice.hpp"
+#include"NumCpp/StreamingFilter.hpp"
+#include"NumCpp/StridedView.hpp"
+#include"NumCpp/TileExecutor.hpp"
 #include"NumCpp/Timer.hpp"
 #include"NumCpp/Types.hpp"
 #include"NumCpp/Utils.hpp"
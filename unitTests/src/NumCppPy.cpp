@@ -530,6 +530,33 @@ namespace NdArrayInterface
 
     //================================================================================
 
+    template<typename dtype>
+    np::ndarray flip(NdArray<dtype>& self, Axis::Type inAxis = Axis::NONE)
+    {
+        self.flip(inAxis);
+        return numCToBoost(self);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray roll(NdArray<dtype>& self, int32 inShift, Axis::Type inAxis = Axis::NONE)
+    {
+        self.roll(inShift, inAxis);
+        return numCToBoost(self);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray rot90(NdArray<dtype>& self, uint8 inK = 1)
+    {
+        self.rot90(inK);
+        return numCToBoost(self);
+    }
+
+    //================================================================================
+
     template<typename dtype>
     np::ndarray std(NdArray<dtype>& self, Axis::Type inAxis = Axis::NONE)
     {
@@ -1037,10 +1064,10 @@ namespace MethodsInterface
 
     //================================================================================
 
-    template<typename dtype>
+    template<typename dtype, typename dtypeOut>
     np::ndarray arctan2Array(const NdArray<dtype>& inY, const NdArray<dtype>& inX)
     {
-        return numCToBoost(Methods<dtype>::arctan2(inY, inX));
+        return numCToBoost(Methods<dtype>::template arctan2<dtypeOut>(inY, inX));
     }
 
     //================================================================================
@@ -1093,6 +1120,22 @@ namespace MethodsInterface
 
     //================================================================================
 
+    template<typename dtype, typename dtypeOut>
+    NdArray<dtypeOut> astypeArray(const NdArray<dtype>& inArray)
+    {
+        return Methods<dtype>::astype<dtypeOut>(inArray);
+    }
+
+    //================================================================================
+
+    template<typename dtype, typename dtypeOut>
+    np::ndarray astypeConvert(const NdArray<dtype>& inArray, Rounding::Type inRounding, bool inSaturate)
+    {
+        return numCToBoost(Methods<dtype>::astype<dtypeOut>(inArray, inRounding, inSaturate));
+    }
+
+    //================================================================================
+
     template<typename dtype>
     np::ndarray average(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
     {
@@ -1197,6 +1240,15 @@ namespace MethodsInterface
 
     //================================================================================
 
+    template<typename dtype>
+    np::ndarray clipArrayInPlace(const NdArray<dtype>& inArray, dtype inMinValue, dtype inMaxValue)
+    {
+        NdArray<dtype> returnArray(inArray);
+        return numCToBoost(Methods<dtype>::clip(returnArray, inMinValue, inMaxValue, returnArray));
+    }
+
+    //================================================================================
+
     template<typename dtype>
     dtype clipScalar(dtype inValue, dtype inMinValue, dtype inMaxValue)
     {
@@ -1231,6 +1283,16 @@ namespace MethodsInterface
 
     //================================================================================
 
+    template<typename dtype>
+    np::ndarray concatenateInto(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2,
+        const NdArray<dtype>& inArray3, const NdArray<dtype>& inArray4, NdArray<dtype>& outArray, Axis::Type inAxis)
+    {
+        std::vector<NdArray<dtype> > arrays = { inArray1, inArray2, inArray3, inArray4 };
+        return numCToBoost(Methods<dtype>::concatenate_into(arrays.begin(), arrays.end(), outArray, inAxis));
+    }
+
+    //================================================================================
+
     template<typename dtype>
     np::ndarray copy(const NdArray<dtype>& inArray)
     {
@@ -1351,6 +1413,17 @@ namespace MethodsInterface
 
     //================================================================================
 
+    template<typename dtype>
+    bp::tuple describe(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE, bool inIgnoreNan = false)
+    {
+        Description<dtype> description = Methods<dtype>::describe(inArray, inAxis, Stat::ALL, inIgnoreNan);
+        return bp::make_tuple(numCToBoost(description.count), numCToBoost(description.min), numCToBoost(description.max),
+            numCToBoost(description.sum), numCToBoost(description.mean), numCToBoost(description.std),
+            numCToBoost(description.count_nonzero), numCToBoost(description.argmin), numCToBoost(description.argmax));
+    }
+
+    //================================================================================
+
     template<typename dtype>
     np::ndarray diagflat(const NdArray<dtype>& inArray)
     {
@@ -1415,6 +1488,15 @@ namespace MethodsInterface
 
     //================================================================================
 
+    template<typename dtype>
+    np::ndarray expArrayInPlace(const NdArray<dtype>& inArray)
+    {
+        NdArray<dtype> returnArray(inArray);
+        return numCToBoost(Methods<dtype>::exp(returnArray, returnArray));
+    }
+
+    //================================================================================
+
     template<typename dtype>
     dtype expScalar(dtype inValue)
     {
@@ -1423,10 +1505,10 @@ namespace MethodsInterface
 
     //================================================================================
 
-    template<typename dtype>
+    template<typename dtype, typename dtypeOut>
     np::ndarray expArray(const NdArray<dtype>& inArray)
     {
-        return numCToBoost(Methods<dtype>::exp(inArray));
+        return numCToBoost(Methods<dtype>::template exp<dtypeOut>(inArray));
     }
 
     //================================================================================
@@ -1605,6 +1687,22 @@ namespace MethodsInterface
 
     //================================================================================
 
+    template<typename dtype>
+    NdArray<bool> greater(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
+    {
+        return Methods<dtype>::greater(inArray1, inArray2);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    NdArray<bool> greater_equal(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
+    {
+        return Methods<dtype>::greater_equal(inArray1, inArray2);
+    }
+
+    //================================================================================
+
     template<typename dtype>
     bp::tuple histogram(const NdArray<dtype>& inArray, uint32 inNumBins = 10)
     {
@@ -1639,6 +1737,14 @@ namespace MethodsInterface
 
     //================================================================================
 
+    template<typename dtype>
+    NdArray<dtype> invertArray(const NdArray<dtype>& inArray)
+    {
+        return Methods<dtype>::invert(inArray);
+    }
+
+    //================================================================================
+
     template<typename dtype>
     bool isnanScalar(dtype inValue)
     {
@@ -1672,723 +1778,1492 @@ namespace MethodsInterface
     //================================================================================
 
     template<typename dtype>
-    np::ndarray nansSquare(uint32 inSquareSize)
+    NdArray<bool> less(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
     {
-        return numCToBoost(Methods<dtype>::nans(inSquareSize));
+        return Methods<dtype>::less(inArray1, inArray2);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray nansRowCol(uint32 inNumRows, uint32 inNumCols)
+    NdArray<bool> less_equal(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
     {
-        return numCToBoost(Methods<dtype>::nans(inNumRows, inNumCols));
+        return Methods<dtype>::less_equal(inArray1, inArray2);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray nansShape(const Shape& inShape)
+    NdArray<bool> logical_andArray(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
     {
-        return numCToBoost(Methods<dtype>::nans(inShape));
+        return Methods<dtype>::logical_and(inArray1, inArray2);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray nansList(uint32 inNumRows, uint32 inNumCols)
+    NdArray<bool> logical_notArray(const NdArray<dtype>& inArray)
     {
-        return numCToBoost(Methods<dtype>::nans({ inNumRows, inNumCols }));
+        return Methods<dtype>::logical_not(inArray);
     }
 
     //================================================================================
 
-    template<typename dtype, typename dtypeOut>
-    np::ndarray negative(const NdArray<dtypeOut> inArray)
+    template<typename dtype>
+    NdArray<bool> logical_orArray(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
     {
-        return numCToBoost(Methods<dtype>::negative<dtypeOut>(inArray));
+        return Methods<dtype>::logical_or(inArray1, inArray2);
     }
 
     //================================================================================
 
     template<typename dtype>
-    dtype logScalar(dtype inValue)
+    NdArray<bool> logical_xorArray(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
     {
-        return Methods<dtype>::log(inValue);
+        return Methods<dtype>::logical_xor(inArray1, inArray2);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray logArray(const NdArray<dtype>& inArray)
+    NdArray<dtype> maxArray(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
     {
-        return numCToBoost(Methods<dtype>::log(inArray));
+        return Methods<dtype>::max(inArray, inAxis);
     }
 
     //================================================================================
 
     template<typename dtype>
-    dtype log10Scalar(dtype inValue)
+    NdArray<dtype> maximum(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
     {
-        return Methods<dtype>::log10(inValue);
+        return Methods<dtype>::maximum(inArray1, inArray2);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray log10Array(const NdArray<dtype>& inArray)
+    NdArray<double> meanArray(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
     {
-        return numCToBoost(Methods<dtype>::log10(inArray));
+        return Methods<dtype>::mean(inArray, inAxis);
     }
 
     //================================================================================
 
     template<typename dtype>
-    dtype log1pScalar(dtype inValue)
+    NdArray<dtype> medianArray(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
     {
-        return Methods<dtype>::log1p(inValue);
+        return Methods<dtype>::median(inArray, inAxis);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray log1pArray(const NdArray<dtype>& inArray)
+    np::ndarray medianArrayOut(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
     {
-        return numCToBoost(Methods<dtype>::log1p(inArray));
+        Shape inShape = inArray.shape();
+        NdArray<dtype> returnArray(1, inAxis == Axis::NONE ? 1 : (inAxis == Axis::ROW ? inShape.cols : inShape.rows));
+        return numCToBoost(Methods<dtype>::median(inArray, returnArray, inAxis));
     }
 
     //================================================================================
 
     template<typename dtype>
-    dtype log2Scalar(dtype inValue)
+    NdArray<dtype> minArray(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
     {
-        return Methods<dtype>::log2(inValue);
+        return Methods<dtype>::min(inArray, inAxis);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray log2Array(const NdArray<dtype>& inArray)
-    {
-        return numCToBoost(Methods<dtype>::log2(inArray));
-    }
-
-    template<typename dtype>
-    dtype newbyteorderScalar(dtype inValue, Endian::Type inEndianess)
+    NdArray<dtype> minimum(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
     {
-        return Methods<dtype>::newbyteorder(inValue, inEndianess);
+        return Methods<dtype>::minimum(inArray1, inArray2);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray newbyteorderArray(const NdArray<dtype>& inArray, Endian::Type inEndianess)
+    NdArray<dtype> modArray(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
     {
-        return numCToBoost(Methods<dtype>::newbyteorder(inArray, inEndianess));
+        return Methods<dtype>::mod(inArray1, inArray2);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray onesSquare(uint32 inSquareSize)
+    NdArray<dtype> multiply(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
     {
-        return numCToBoost(Methods<dtype>::ones(inSquareSize));
+        return Methods<dtype>::multiply(inArray1, inArray2);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray onesRowCol(uint32 inNumRows, uint32 inNumCols)
+    NdArray<uint32> nanargmaxArray(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
     {
-        return numCToBoost(Methods<dtype>::ones(inNumRows, inNumCols));
+        return Methods<dtype>::nanargmax(inArray, inAxis);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray onesShape(const Shape& inShape)
+    NdArray<uint32> nanargminArray(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
     {
-        return numCToBoost(Methods<dtype>::ones(inShape));
+        return Methods<dtype>::nanargmin(inArray, inAxis);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray sqrArray(const NdArray<dtype>& inArray)
+    NdArray<dtype> nanmaxArray(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
     {
-        return numCToBoost(Methods<dtype>::sqr(inArray));
+        return Methods<dtype>::nanmax(inArray, inAxis);
     }
 
     //================================================================================
 
-    template<typename dtype, typename dtypeOut>
-    np::ndarray powerArrayScalar(const NdArray<dtype>& inArray, uint8 inExponent)
+    template<typename dtype>
+    NdArray<double> nanmeanArray(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
     {
-        return numCToBoost(Methods<dtype>::power<dtypeOut>(inArray, inExponent));
+        return Methods<dtype>::nanmean(inArray, inAxis);
     }
 
     //================================================================================
 
-    template<typename dtype, typename dtypeOut>
-    np::ndarray powerArrayArray(const NdArray<dtype>& inArray, const NdArray<uint8>& inExponents)
+    template<typename dtype>
+    np::ndarray nanmeanArrayOut(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
     {
-        return numCToBoost(Methods<dtype>::power<dtypeOut>(inArray, inExponents));
+        Shape inShape = inArray.shape();
+        NdArray<double> returnArray(1, inAxis == Axis::NONE ? 1 : (inAxis == Axis::ROW ? inShape.cols : inShape.rows));
+        return numCToBoost(Methods<dtype>::nanmean(inArray, returnArray, inAxis));
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray putmask(NdArray<dtype>& inArray, const NdArray<bool>& inMask, const NdArray<dtype>& inValues)
+    NdArray<dtype> nanmedianArray(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
     {
-        return numCToBoost(Methods<dtype>::putmask(inArray, inMask, inValues));
+        return Methods<dtype>::nanmedian(inArray, inAxis);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray putmaskScalar(NdArray<dtype>& inArray, const NdArray<bool>& inMask, dtype inValue)
+    NdArray<dtype> nanminArray(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
     {
-        return numCToBoost(Methods<dtype>::putmask(inArray, inMask, inValue));
+        return Methods<dtype>::nanmin(inArray, inAxis);
     }
 
     //================================================================================
 
     template<typename dtype>
-    dtype rad2degScalar(dtype inValue)
+    NdArray<double> nanpercentileArray(const NdArray<dtype>& inArray, double inPercentile, Axis::Type inAxis, const std::string& inInterpMethod)
     {
-        return Methods<dtype>::rad2deg(inValue);
+        return Methods<dtype>::nanpercentile(inArray, inPercentile, inAxis, inInterpMethod);
     }
 
     //================================================================================
 
-    template<typename dtype>
-    np::ndarray rad2degArray(const NdArray<dtype>& inArray)
+    template<typename dtype, typename dtypeOut>
+    NdArray<dtypeOut> nanprodArray(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
     {
-        return numCToBoost(Methods<dtype>::rad2deg(inArray));
+        return Methods<dtype>::nanprod<dtypeOut>(inArray, inAxis);
     }
 
     //================================================================================
 
-    template<typename dtype, typename dtypeOut>
-    dtype remainderScalar(dtype inValue1, dtype inValue2)
+    template<typename dtype>
+    np::ndarray nansSquare(uint32 inSquareSize)
     {
-        return Methods<dtype>::remainder<dtypeOut>(inValue1, inValue2);
+        return numCToBoost(Methods<dtype>::nans(inSquareSize));
     }
 
     //================================================================================
 
-    template<typename dtype, typename dtypeOut>
-    np::ndarray remainderArray(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
+    template<typename dtype>
+    np::ndarray nansRowCol(uint32 inNumRows, uint32 inNumCols)
     {
-        return numCToBoost(Methods<dtype>::remainder<dtypeOut>(inArray1, inArray2));
+        return numCToBoost(Methods<dtype>::nans(inNumRows, inNumCols));
     }
 
     //================================================================================
 
     template<typename dtype>
-    NdArray<dtype>& reshape(NdArray<dtype>& inArray, const Shape& inNewShape)
+    np::ndarray nansShape(const Shape& inShape)
     {
-        return Methods<dtype>::reshape(inArray, inNewShape);
+        return numCToBoost(Methods<dtype>::nans(inShape));
     }
 
     //================================================================================
 
     template<typename dtype>
-    NdArray<dtype>& reshapeList(NdArray<dtype>& inArray, const Shape& inNewShape)
+    np::ndarray nansList(uint32 inNumRows, uint32 inNumCols)
     {
-        return Methods<dtype>::reshape(inArray, inNewShape.rows, inNewShape.cols);
+        return numCToBoost(Methods<dtype>::nans({ inNumRows, inNumCols }));
     }
 
     //================================================================================
 
     template<typename dtype>
-    NdArray<dtype>& resizeFast(NdArray<dtype>& inArray, const Shape& inNewShape)
+    NdArray<double> nanstdArray(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
     {
-        return Methods<dtype>::resizeFast(inArray, inNewShape);
+        return Methods<dtype>::nanstd(inArray, inAxis);
     }
 
     //================================================================================
 
-    template<typename dtype>
-    NdArray<dtype>& resizeFastList(NdArray<dtype>& inArray, const Shape& inNewShape)
+    template<typename dtype, typename dtypeOut>
+    NdArray<dtypeOut> nansumArray(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
     {
-        return Methods<dtype>::resizeFast(inArray, inNewShape.rows, inNewShape.cols);
+        return Methods<dtype>::nansum<dtypeOut>(inArray, inAxis);
     }
 
     //================================================================================
 
     template<typename dtype>
-    NdArray<dtype>& resizeSlow(NdArray<dtype>& inArray, const Shape& inNewShape)
+    NdArray<double> nanvarArray(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
     {
-        return Methods<dtype>::resizeSlow(inArray, inNewShape);
+        return Methods<dtype>::nanvar(inArray, inAxis);
     }
 
     //================================================================================
 
-    template<typename dtype>
-    NdArray<dtype>& resizeSlowList(NdArray<dtype>& inArray, const Shape& inNewShape)
+    template<typename dtype, typename dtypeOut>
+    np::ndarray negative(const NdArray<dtypeOut> inArray)
     {
-        return Methods<dtype>::resizeSlow(inArray, inNewShape.rows, inNewShape.cols);
+        return numCToBoost(Methods<dtype>::negative<dtypeOut>(inArray));
     }
 
     //================================================================================
 
     template<typename dtype>
-    dtype rintScalar(dtype inValue)
+    dtype logScalar(dtype inValue)
     {
-        return Methods<dtype>::rint(inValue);
+        return Methods<dtype>::log(inValue);
     }
 
     //================================================================================
 
-    template<typename dtype>
-    np::ndarray rintArray(const NdArray<dtype>& inArray)
+    template<typename dtype, typename dtypeOut>
+    np::ndarray logArray(const NdArray<dtype>& inArray)
     {
-        return numCToBoost(Methods<dtype>::rint(inArray));
+        return numCToBoost(Methods<dtype>::template log<dtypeOut>(inArray));
     }
 
     //================================================================================
 
     template<typename dtype>
-    dtype roundScalar(dtype inValue, uint8 inDecimals)
+    dtype log10Scalar(dtype inValue)
     {
-        return Methods<dtype>::round(inValue, inDecimals);
+        return Methods<dtype>::log10(inValue);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray roundArray(const NdArray<dtype>& inArray, uint8 inDecimals)
+    np::ndarray log10Array(const NdArray<dtype>& inArray)
     {
-        return numCToBoost(Methods<dtype>::round(inArray, inDecimals));
+        return numCToBoost(Methods<dtype>::log10(inArray));
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray row_stack(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2,
-        const NdArray<dtype>& inArray3, const NdArray<dtype>& inArray4)
+    dtype log1pScalar(dtype inValue)
     {
-        return numCToBoost(Methods<dtype>::row_stack({ inArray1, inArray2, inArray3, inArray4 }));
+        return Methods<dtype>::log1p(inValue);
     }
 
     //================================================================================
 
     template<typename dtype>
-    int8 signScalar(dtype inValue)
+    np::ndarray log1pArray(const NdArray<dtype>& inArray)
     {
-        return Methods<dtype>::sign(inValue);
+        return numCToBoost(Methods<dtype>::log1p(inArray));
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray signArray(const NdArray<dtype>& inArray)
+    dtype log2Scalar(dtype inValue)
     {
-        return numCToBoost(Methods<dtype>::sign(inArray));
+        return Methods<dtype>::log2(inValue);
     }
 
     //================================================================================
 
-    template<typename dtype>
-    bool signbitScalar(dtype inValue)
+    template<typename dtype, typename dtypeOut>
+    NdArray<dtypeOut> negativeArray(const NdArray<dtype>& inArray)
     {
-        return Methods<dtype>::signbit(inValue);
+        return Methods<dtype>::negative<dtypeOut>(inArray);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray signbitArray(const NdArray<dtype>& inArray)
+    np::ndarray negativeArrayInPlace(const NdArray<dtype>& inArray)
     {
-        return numCToBoost(Methods<dtype>::signbit(inArray));
+        NdArray<dtype> returnArray(inArray);
+        return numCToBoost(Methods<dtype>::negative(returnArray, returnArray));
     }
 
     //================================================================================
 
     template<typename dtype>
-    double sinScalar(dtype inValue)
+    np::ndarray log2Array(const NdArray<dtype>& inArray)
     {
-        return Methods<dtype>::sin(inValue);
+        return numCToBoost(Methods<dtype>::log2(inArray));
     }
 
-    //================================================================================
-
     template<typename dtype>
-    np::ndarray sinArray(const NdArray<dtype>& inArray)
+    dtype newbyteorderScalar(dtype inValue, Endian::Type inEndianess)
     {
-        return numCToBoost(Methods<dtype>::sin(inArray));
+        return Methods<dtype>::newbyteorder(inValue, inEndianess);
     }
 
     //================================================================================
 
     template<typename dtype>
-    double sincScalar(dtype inValue)
+    np::ndarray newbyteorderArray(const NdArray<dtype>& inArray, Endian::Type inEndianess)
     {
-        return Methods<dtype>::sinc(inValue);
+        return numCToBoost(Methods<dtype>::newbyteorder(inArray, inEndianess));
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray sincArray(const NdArray<dtype>& inArray)
+    NdArray<bool> not_equal(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
     {
-        return numCToBoost(Methods<dtype>::sinc(inArray));
+        return Methods<dtype>::not_equal(inArray1, inArray2);
     }
 
     //================================================================================
 
     template<typename dtype>
-    double sinhScalar(dtype inValue)
+    np::ndarray onesSquare(uint32 inSquareSize)
     {
-        return Methods<dtype>::sinh(inValue);
+        return numCToBoost(Methods<dtype>::ones(inSquareSize));
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray sinhArray(const NdArray<dtype>& inArray)
+    np::ndarray onesRowCol(uint32 inNumRows, uint32 inNumCols)
     {
-        return numCToBoost(Methods<dtype>::sinh(inArray));
+        return numCToBoost(Methods<dtype>::ones(inNumRows, inNumCols));
     }
 
     //================================================================================
 
     template<typename dtype>
-    double sqrtScalar(dtype inValue)
+    np::ndarray onesShape(const Shape& inShape)
     {
-        return Methods<dtype>::sqrt(inValue);
+        return numCToBoost(Methods<dtype>::ones(inShape));
     }
 
     //================================================================================
 
-    template<typename dtype>
-    np::ndarray sqrtArray(const NdArray<dtype>& inArray)
+    template<typename dtype, typename dtypeOut>
+    NdArray<dtypeOut> percentileArray(const NdArray<dtype>& inArray, double inPercentile, Axis::Type inAxis, const std::string& inInterpMethod)
     {
-        return numCToBoost(Methods<dtype>::sqrt(inArray));
+        return Methods<dtype>::percentile<dtypeOut>(inArray, inPercentile, inAxis, inInterpMethod);
     }
 
     //================================================================================
 
-    template<typename dtype>
-    double squareScalar(dtype inValue)
+    template<typename dtype, typename dtypeOut>
+    NdArray<dtypeOut> prodArray(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
     {
-        return Methods<dtype>::square(inValue);
+        return Methods<dtype>::prod<dtypeOut>(inArray, inAxis);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray squareArray(const NdArray<dtype>& inArray)
+    NdArray<dtype> ptpArray(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
     {
-        return numCToBoost(Methods<dtype>::square(inArray));
+        return Methods<dtype>::ptp(inArray, inAxis);
     }
 
     //================================================================================
 
-    template<typename dtype>
-    double tanScalar(dtype inValue)
+    template<typename dtype, typename dtypeOut>
+    NdArray<dtypeOut> reciprocalArray(const NdArray<dtype>& inArray)
     {
-        return Methods<dtype>::tan(inValue);
+        return Methods<dtype>::reciprocal<dtypeOut>(inArray);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray tanArray(const NdArray<dtype>& inArray)
+    np::ndarray sqrArray(const NdArray<dtype>& inArray)
     {
-        return numCToBoost(Methods<dtype>::tan(inArray));
+        return numCToBoost(Methods<dtype>::sqr(inArray));
     }
 
     //================================================================================
 
-    template<typename dtype>
+    template<typename dtype, typename dtypeOut>
+    np::ndarray powerArrayScalar(const NdArray<dtype>& inArray, uint8 inExponent)
+    {
+        return numCToBoost(Methods<dtype>::power<dtypeOut>(inArray, inExponent));
+    }
+
+    //================================================================================
+
+    template<typename dtype, typename dtypeOut>
+    np::ndarray powerArrayArray(const NdArray<dtype>& inArray, const NdArray<uint8>& inExponents)
+    {
+        return numCToBoost(Methods<dtype>::power<dtypeOut>(inArray, inExponents));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray putmask(NdArray<dtype>& inArray, const NdArray<bool>& inMask, const NdArray<dtype>& inValues)
+    {
+        return numCToBoost(Methods<dtype>::putmask(inArray, inMask, inValues));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray putmaskScalar(NdArray<dtype>& inArray, const NdArray<bool>& inMask, dtype inValue)
+    {
+        return numCToBoost(Methods<dtype>::putmask(inArray, inMask, inValue));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    dtype rad2degScalar(dtype inValue)
+    {
+        return Methods<dtype>::rad2deg(inValue);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray rad2degArray(const NdArray<dtype>& inArray)
+    {
+        return numCToBoost(Methods<dtype>::rad2deg(inArray));
+    }
+
+    //================================================================================
+
+    template<typename dtype, typename dtypeOut>
+    dtype remainderScalar(dtype inValue1, dtype inValue2)
+    {
+        return Methods<dtype>::remainder<dtypeOut>(inValue1, inValue2);
+    }
+
+    //================================================================================
+
+    template<typename dtype, typename dtypeOut>
+    np::ndarray remainderArray(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2)
+    {
+        return numCToBoost(Methods<dtype>::remainder<dtypeOut>(inArray1, inArray2));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    NdArray<dtype> pad(const NdArray<dtype>& inArray, uint16 inPadWidth, dtype inPadValue)
+    {
+        return Methods<dtype>::pad(inArray, inPadWidth, inPadValue);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    NdArray<dtype>& reshape(NdArray<dtype>& inArray, const Shape& inNewShape)
+    {
+        return Methods<dtype>::reshape(inArray, inNewShape);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    NdArray<dtype>& reshapeList(NdArray<dtype>& inArray, const Shape& inNewShape)
+    {
+        return Methods<dtype>::reshape(inArray, inNewShape.rows, inNewShape.cols);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    NdArray<dtype>& resizeFast(NdArray<dtype>& inArray, const Shape& inNewShape)
+    {
+        return Methods<dtype>::resizeFast(inArray, inNewShape);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    NdArray<dtype>& resizeFastList(NdArray<dtype>& inArray, const Shape& inNewShape)
+    {
+        return Methods<dtype>::resizeFast(inArray, inNewShape.rows, inNewShape.cols);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    NdArray<dtype>& resizeSlow(NdArray<dtype>& inArray, const Shape& inNewShape)
+    {
+        return Methods<dtype>::resizeSlow(inArray, inNewShape);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    NdArray<dtype>& resizeSlowList(NdArray<dtype>& inArray, const Shape& inNewShape)
+    {
+        return Methods<dtype>::resizeSlow(inArray, inNewShape.rows, inNewShape.cols);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    dtype rintScalar(dtype inValue)
+    {
+        return Methods<dtype>::rint(inValue);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray rintArray(const NdArray<dtype>& inArray)
+    {
+        return numCToBoost(Methods<dtype>::rint(inArray));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    dtype roundScalar(dtype inValue, uint8 inDecimals)
+    {
+        return Methods<dtype>::round(inValue, inDecimals);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray roundArray(const NdArray<dtype>& inArray, uint8 inDecimals)
+    {
+        return numCToBoost(Methods<dtype>::round(inArray, inDecimals));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray row_stack(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2,
+        const NdArray<dtype>& inArray3, const NdArray<dtype>& inArray4)
+    {
+        return numCToBoost(Methods<dtype>::row_stack({ inArray1, inArray2, inArray3, inArray4 }));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    int8 signScalar(dtype inValue)
+    {
+        return Methods<dtype>::sign(inValue);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray signArray(const NdArray<dtype>& inArray)
+    {
+        return numCToBoost(Methods<dtype>::sign(inArray));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    bool signbitScalar(dtype inValue)
+    {
+        return Methods<dtype>::signbit(inValue);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray signbitArray(const NdArray<dtype>& inArray)
+    {
+        return numCToBoost(Methods<dtype>::signbit(inArray));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    double sinScalar(dtype inValue)
+    {
+        return Methods<dtype>::sin(inValue);
+    }
+
+    //================================================================================
+
+    template<typename dtype, typename dtypeOut>
+    np::ndarray sinArray(const NdArray<dtype>& inArray)
+    {
+        return numCToBoost(Methods<dtype>::template sin<dtypeOut>(inArray));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    double sincScalar(dtype inValue)
+    {
+        return Methods<dtype>::sinc(inValue);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray sincArray(const NdArray<dtype>& inArray)
+    {
+        return numCToBoost(Methods<dtype>::sinc(inArray));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    double sinhScalar(dtype inValue)
+    {
+        return Methods<dtype>::sinh(inValue);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray sinhArray(const NdArray<dtype>& inArray)
+    {
+        return numCToBoost(Methods<dtype>::sinh(inArray));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    double sqrtScalar(dtype inValue)
+    {
+        return Methods<dtype>::sqrt(inValue);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray sqrtArray(const NdArray<dtype>& inArray)
+    {
+        return numCToBoost(Methods<dtype>::sqrt(inArray));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    double squareScalar(dtype inValue)
+    {
+        return Methods<dtype>::square(inValue);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray squareArray(const NdArray<dtype>& inArray)
+    {
+        return numCToBoost(Methods<dtype>::square(inArray));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    NdArray<double> stdArray(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
+    {
+        return Methods<dtype>::std(inArray, inAxis);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray stdArrayOut(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
+    {
+        Shape inShape = inArray.shape();
+        NdArray<double> returnArray(1, inAxis == Axis::NONE ? 1 : (inAxis == Axis::ROW ? inShape.cols : inShape.rows));
+        return numCToBoost(Methods<dtype>::std(inArray, returnArray, inAxis));
+    }
+
+    //================================================================================
+
+    template<typename dtype, typename dtypeOut>
+    NdArray<dtypeOut> sumArray(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
+    {
+        return Methods<dtype>::sum<dtypeOut>(inArray, inAxis);
+    }
+
+    //================================================================================
+
+    template<typename dtype, typename dtypeOut>
+    np::ndarray sumArrayOut(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
+    {
+        Shape inShape = inArray.shape();
+        NdArray<dtypeOut> returnArray(1, inAxis == Axis::NONE ? 1 : (inAxis == Axis::ROW ? inShape.cols : inShape.rows));
+        return numCToBoost(Methods<dtype>::sum(inArray, returnArray, inAxis));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    double tanScalar(dtype inValue)
+    {
+        return Methods<dtype>::tan(inValue);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray tanArray(const NdArray<dtype>& inArray)
+    {
+        return numCToBoost(Methods<dtype>::tan(inArray));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
     double tanhScalar(dtype inValue)
     {
-        return Methods<dtype>::tanh(inValue);
+        return Methods<dtype>::tanh(inValue);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray tanhArray(const NdArray<dtype>& inArray)
+    {
+        return numCToBoost(Methods<dtype>::tanh(inArray));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray tileRectangle(const NdArray<dtype>& inArray, uint32 inNumRows, uint32 inNumCols)
+    {
+        return numCToBoost(Methods<dtype>::tile(inArray, inNumRows, inNumCols));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray tileShape(const NdArray<dtype>& inArray, const Shape& inRepShape)
+    {
+        return numCToBoost(Methods<dtype>::tile(inArray, inRepShape));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray tileList(const NdArray<dtype>& inArray, uint32 inNumRows, uint32 inNumCols)
+    {
+        return numCToBoost(Methods<dtype>::tile(inArray, { inNumRows, inNumCols }));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray trapzDx(const NdArray<dtype>& inY, double dx = 1.0, Axis::Type inAxis = Axis::NONE)
+    {
+        return numCToBoost(Methods<dtype>::trapz(inY, dx, inAxis));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray trapz(const NdArray<dtype>& inY, const NdArray<dtype>& inX, Axis::Type inAxis = Axis::NONE)
+    {
+        return numCToBoost(Methods<dtype>::trapz(inY, inX, inAxis));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray triSquare(uint32 inSquareSize, int32 inOffset)
+    {
+        return numCToBoost(Methods<dtype>::tri(inSquareSize, inOffset));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray triRect(uint32 inNumRows, uint32 inNumCols, int32 inOffset)
+    {
+        return numCToBoost(Methods<dtype>::tri(inNumRows, inNumCols, inOffset));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    dtype unwrapScalar(dtype inValue)
+    {
+        return Methods<dtype>::unwrap(inValue);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray unwrapArray(const NdArray<dtype>& inArray)
+    {
+        return numCToBoost(Methods<dtype>::unwrap(inArray));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    double truncScalar(dtype inValue)
+    {
+        return Methods<dtype>::trunc(inValue);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray truncArray(const NdArray<dtype>& inArray)
+    {
+        return numCToBoost(Methods<dtype>::trunc(inArray));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    NdArray<double> varArray(const NdArray<dtype>& inArray, Axis::Type inAxis = Axis::NONE)
+    {
+        return Methods<dtype>::var(inArray, inAxis);
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray vstack(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2,
+        const NdArray<dtype>& inArray3, const NdArray<dtype>& inArray4)
+    {
+        return numCToBoost(Methods<dtype>::vstack({ inArray1, inArray2, inArray3, inArray4 }));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray where(const NdArray<dtype>& inMask, const NdArray<dtype>& inA, const NdArray<dtype>& inB)
+    {
+        return numCToBoost(Methods<dtype>::where(inMask.astype<bool>(), inA, inB));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray zerosSquare(uint32 inSquareSize)
+    {
+        return numCToBoost(Methods<dtype>::zeros(inSquareSize));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray zerosRowCol(uint32 inNumRows, uint32 inNumCols)
+    {
+        return numCToBoost(Methods<dtype>::zeros(inNumRows, inNumCols));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray zerosShape(const Shape& inShape)
+    {
+        return numCToBoost(Methods<dtype>::zeros(inShape));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray zerosList(uint32 inNumRows, uint32 inNumCols)
+    {
+        return numCToBoost(Methods<dtype>::zeros({ inNumRows, inNumCols }));
+    }
+}
+
+namespace RandomInterface
+{
+    template<typename dtype>
+    np::ndarray permutationScalar(dtype inValue)
+    {
+        return numCToBoost(Random<dtype>::permutation(inValue));
+    }
+
+    //================================================================================
+
+    template<typename dtype>
+    np::ndarray permutationArray(const NdArray<dtype>& inArray)
+    {
+        return numCToBoost(Random<dtype>::permutation(inArray));
+    }
+}
+
+namespace LinalgInterface
+{
+    template<typename dtype>
+    np::ndarray hatArray(const NdArray<dtype>& inArray)
+    {
+        return numCToBoost(Linalg<dtype>::hat(inArray));
+    }
+
+    template<typename dtype, typename dtypeOut>
+    np::ndarray multi_dot(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, const NdArray<dtype>& inArray3, const NdArray<dtype>& inArray4)
+    {
+        return numCToBoost(Linalg<dtype>::multi_dot<dtypeOut>({ inArray1 ,inArray2, inArray3, inArray4 }));
+    }
+}
+
+namespace RotationsInterface
+{
+    np::ndarray angularVelocity(const Rotations::Quaternion& inQuat1, const Rotations::Quaternion& inQuat2, double inTime)
+    {
+        return numCToBoost(inQuat1.angularVelocity(inQuat2, inTime));
+    }
+
+    np::ndarray nlerp(const Rotations::Quaternion& inQuat1, const Rotations::Quaternion& inQuat2, double inPercent)
+    {
+        return numCToBoost(inQuat1.nlerp(inQuat2, inPercent).toNdArray());
+    }
+
+    np::ndarray slerp(const Rotations::Quaternion& inQuat1, const Rotations::Quaternion& inQuat2, double inPercent)
+    {
+        return numCToBoost(inQuat1.slerp(inQuat2, inPercent).toNdArray());
+    }
+
+    np::ndarray toDCM(const Rotations::Quaternion& inQuat)
+    {
+        return numCToBoost(inQuat.toDCM());
+    }
+
+    np::ndarray multiplyScalar(const Rotations::Quaternion& inQuat, double inScalar)
+    {
+        Rotations::Quaternion returnQuat = inQuat * inScalar;
+        return numCToBoost(returnQuat.toNdArray());
+    }
+
+    template<typename dtype>
+    np::ndarray multiplyArray(const Rotations::Quaternion& inQuat, const NdArray<dtype>& inArray)
+    {
+        NdArray<double> returnArray = inQuat * inArray;
+        return numCToBoost(returnArray);
+    }
+
+    np::ndarray multiplyQuaternion(const Rotations::Quaternion& inQuat1, const Rotations::Quaternion& inQuat2)
+    {
+        Rotations::Quaternion returnQuat = inQuat1 * inQuat2;
+        return numCToBoost(returnQuat.toNdArray());
+    }
+
+    template<typename dtype>
+    np::ndarray hatArray(const NdArray<dtype>& inArray)
+    {
+        return numCToBoost(Rotations::hat(inArray));
+    }
+}
+
+namespace RaInterface
+{
+    template<typename dtype>
+    void print(const Coordinates::RA<dtype>& inRa)
+    {
+        std::cout << inRa;
+    }
+}
+
+namespace DecInterface
+{
+    template<typename dtype>
+    void print(const Coordinates::Dec<dtype>& self)
+    {
+        std::cout << self;
+    }
+}
+
+namespace CoordinateInterface
+{
+    template<typename dtype>
+    void print(const Coordinates::Coordinate<dtype>& self)
+    {
+        std::cout << self;
+    }
+
+    template<typename dtype>
+    dtype degreeSeperationCoordinate(const Coordinates::Coordinate<dtype>& self, const Coordinates::Coordinate<dtype>& inOtherCoordinate)
+    {
+        return self.degreeSeperation(inOtherCoordinate);
+    }
+
+    template<typename dtype>
+    dtype degreeSeperationVector(const Coordinates::Coordinate<dtype>& self, const NdArray<dtype>& inVec)
+    {
+        return self.degreeSeperation(inVec);
+    }
+
+    template<typename dtype>
+    dtype radianSeperationCoordinate(const Coordinates::Coordinate<dtype>& self, const Coordinates::Coordinate<dtype>& inOtherCoordinate)
+    {
+        return self.radianSeperation(inOtherCoordinate);
+    }
+
+    template<typename dtype>
+    dtype radianSeperationVector(const Coordinates::Coordinate<dtype>& self, const NdArray<dtype>& inVec)
+    {
+        return self.radianSeperation(inVec);
+    }
+}
+
+namespace DataCubeInterface
+{
+    template<typename dtype>
+    NdArray<dtype>& at(DataCube<dtype>& self, uint32 inIndex)
+    {
+        return self.at(inIndex);
+    }
+
+    template<typename dtype>
+    NdArray<dtype>& getItem(DataCube<dtype>& self, uint32 inIndex)
+    {
+        return self[inIndex];
     }
+}
 
-    //================================================================================
+//================================================================================
 
+namespace MaskedArrayInterface
+{
     template<typename dtype>
-    np::ndarray tanhArray(const NdArray<dtype>& inArray)
+    MaskedArray<dtype>* withMask(const NdArray<dtype>& inData, const NdArray<dtype>& inMask)
     {
-        return numCToBoost(Methods<dtype>::tanh(inArray));
+        return new MaskedArray<dtype>(inData, inMask.astype<bool>());
     }
 
-    //================================================================================
+    template<typename dtype>
+    MaskedArray<dtype> maskedInvalid(const NdArray<dtype>& inData)
+    {
+        return MaskedArray<dtype>::maskedInvalid(inData);
+    }
 
     template<typename dtype>
-    np::ndarray tileRectangle(const NdArray<dtype>& inArray, uint32 inNumRows, uint32 inNumCols)
+    np::ndarray mask(const MaskedArray<dtype>& self)
     {
-        return numCToBoost(Methods<dtype>::tile(inArray, inNumRows, inNumCols));
+        return numCToBoost(self.mask());
     }
 
-    //================================================================================
+    template<typename dtype>
+    np::ndarray filled(const MaskedArray<dtype>& self, dtype inFillValue)
+    {
+        return numCToBoost(self.filled(inFillValue));
+    }
 
     template<typename dtype>
-    np::ndarray tileShape(const NdArray<dtype>& inArray, const Shape& inRepShape)
+    np::ndarray count(const MaskedArray<dtype>& self, Axis::Type inAxis = Axis::NONE)
     {
-        return numCToBoost(Methods<dtype>::tile(inArray, inRepShape));
+        return numCToBoost(self.count(inAxis));
     }
 
-    //================================================================================
+    template<typename dtype>
+    np::ndarray max(const MaskedArray<dtype>& self, Axis::Type inAxis = Axis::NONE)
+    {
+        return numCToBoost(self.max(inAxis));
+    }
 
     template<typename dtype>
-    np::ndarray tileList(const NdArray<dtype>& inArray, uint32 inNumRows, uint32 inNumCols)
+    np::ndarray mean(const MaskedArray<dtype>& self, Axis::Type inAxis = Axis::NONE)
     {
-        return numCToBoost(Methods<dtype>::tile(inArray, { inNumRows, inNumCols }));
+        return numCToBoost(self.mean(inAxis));
     }
 
-    //================================================================================
+    template<typename dtype>
+    np::ndarray min(const MaskedArray<dtype>& self, Axis::Type inAxis = Axis::NONE)
+    {
+        return numCToBoost(self.min(inAxis));
+    }
 
     template<typename dtype>
-    np::ndarray trapzDx(const NdArray<dtype>& inY, double dx = 1.0, Axis::Type inAxis = Axis::NONE)
+    np::ndarray std(const MaskedArray<dtype>& self, Axis::Type inAxis = Axis::NONE)
     {
-        return numCToBoost(Methods<dtype>::trapz(inY, dx, inAxis));
+        return numCToBoost(self.std(inAxis));
     }
 
-    //================================================================================
+    template<typename dtype>
+    np::ndarray sum(const MaskedArray<dtype>& self, Axis::Type inAxis = Axis::NONE)
+    {
+        return numCToBoost(self.sum(inAxis));
+    }
 
     template<typename dtype>
-    np::ndarray trapz(const NdArray<dtype>& inY, const NdArray<dtype>& inX, Axis::Type inAxis = Axis::NONE)
+    np::ndarray var(const MaskedArray<dtype>& self, Axis::Type inAxis = Axis::NONE)
     {
-        return numCToBoost(Methods<dtype>::trapz(inY, inX, inAxis));
+        return numCToBoost(self.var(inAxis));
     }
 
-    //================================================================================
+    template<typename dtype>
+    bool isValid(const MaskedArray<dtype>& self, uint32 inIndex)
+    {
+        return self.isValid(inIndex);
+    }
 
     template<typename dtype>
-    np::ndarray triSquare(uint32 inSquareSize, int32 inOffset)
+    void setValid(MaskedArray<dtype>& self, uint32 inIndex, bool inValid)
     {
-        return numCToBoost(Methods<dtype>::tri(inSquareSize, inOffset));
+        self.setValid(inIndex, inValid);
     }
+}
 
-    //================================================================================
+//================================================================================
 
+namespace RunningStatisticsInterface
+{
     template<typename dtype>
-    np::ndarray triRect(uint32 inNumRows, uint32 inNumCols, int32 inOffset)
+    np::ndarray momentsMean(const RunningMoments<dtype>& self)
     {
-        return numCToBoost(Methods<dtype>::tri(inNumRows, inNumCols, inOffset));
+        return numCToBoost(self.mean());
     }
 
-    //================================================================================
+    template<typename dtype>
+    np::ndarray momentsStd(const RunningMoments<dtype>& self, uint32 inDdof)
+    {
+        return numCToBoost(self.std(inDdof));
+    }
 
     template<typename dtype>
-    dtype unwrapScalar(dtype inValue)
+    np::ndarray momentsVar(const RunningMoments<dtype>& self, uint32 inDdof)
     {
-        return Methods<dtype>::unwrap(inValue);
+        return numCToBoost(self.var(inDdof));
     }
 
-    //================================================================================
+    template<typename dtype>
+    np::ndarray minMaxMin(const RunningMinMax<dtype>& self)
+    {
+        return numCToBoost(self.min());
+    }
 
     template<typename dtype>
-    np::ndarray unwrapArray(const NdArray<dtype>& inArray)
+    np::ndarray minMaxMax(const RunningMinMax<dtype>& self)
     {
-        return numCToBoost(Methods<dtype>::unwrap(inArray));
+        return numCToBoost(self.max());
+    }
+
+    template<typename dtype>
+    np::ndarray emaValue(const ExponentialMovingAverage<dtype>& self)
+    {
+        return numCToBoost(self.value());
+    }
+
+    template<typename dtype>
+    bp::tuple histogram(const RunningHistogram<dtype>& self)
+    {
+        std::pair<NdArray<uint32>, NdArray<double> > output = self.histogram();
+        return bp::make_tuple(numCToBoost(output.first), numCToBoost(output.second));
+    }
+}
+
+//================================================================================
+
+namespace GeneratorInterface
+{
+    template<typename dtype>
+    Generator<dtype> arange(dtype inStart, dtype inStop, dtype inStep)
+    {
+        return Generator<dtype>::arange(inStart, inStop, inStep);
+    }
+
+    template<typename dtype>
+    Generator<dtype> linspace(dtype inStart, dtype inStop, uint32 inNum, bool endPoint)
+    {
+        return Generator<dtype>::linspace(inStart, inStop, inNum, endPoint);
+    }
+
+    template<typename dtype>
+    Generator<dtype> eye(uint32 inN, uint32 inM, int32 inK)
+    {
+        return Generator<dtype>::eye(inN, inM, inK);
+    }
+
+    template<typename dtype>
+    Generator<dtype> tri(uint32 inN, uint32 inM, int32 inOffset)
+    {
+        return Generator<dtype>::tri(inN, inM, inOffset);
+    }
+
+    template<typename dtype>
+    np::ndarray toNdArray(const Generator<dtype>& self)
+    {
+        return numCToBoost(self.toNdArray());
+    }
+
+    template<typename dtype>
+    np::ndarray add(const Generator<dtype>& self, const NdArray<dtype>& inArray)
+    {
+        return numCToBoost(inArray + self);
+    }
+
+    template<typename dtype>
+    np::ndarray subtract(const Generator<dtype>& self, const NdArray<dtype>& inArray)
+    {
+        return numCToBoost(inArray - self);
+    }
+
+    template<typename dtype>
+    np::ndarray multiply(const Generator<dtype>& self, const NdArray<dtype>& inArray)
+    {
+        return numCToBoost(inArray * self);
+    }
+
+    template<typename dtype>
+    np::ndarray divide(const Generator<dtype>& self, const NdArray<dtype>& inArray)
+    {
+        return numCToBoost(inArray / self);
+    }
+}
+
+//================================================================================
+
+namespace FiltersInterface
+{
+    template<typename dtype>
+    NdArray<dtype> complementaryMedianFilter(const NdArray<dtype>& inImageArray, uint32 inSize, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
+    {
+        return Filters<dtype>::complementaryMedianFilter(inImageArray, inSize, inMode, inConstantValue);
     }
 
     //================================================================================
 
     template<typename dtype>
-    double truncScalar(dtype inValue)
+    NdArray<dtype> complementaryMedianFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        return Methods<dtype>::trunc(inValue);
+        return Filters<dtype>::complementaryMedianFilter1d(inImageArray, inSize, inMode, inConstantValue);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray truncArray(const NdArray<dtype>& inArray)
+    NdArray<dtype> convolve(const NdArray<dtype>& inImageArray, uint32 inSize, const NdArray<dtype>& inWeights, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        return numCToBoost(Methods<dtype>::trunc(inArray));
+        return Filters<dtype>::convolve(inImageArray, inSize, inWeights, inMode, inConstantValue);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray vstack(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2,
-        const NdArray<dtype>& inArray3, const NdArray<dtype>& inArray4)
+    NdArray<dtype> convolveAuto(const NdArray<dtype>& inImageArray, uint32 inSize, const NdArray<dtype>& inWeights, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        return numCToBoost(Methods<dtype>::vstack({ inArray1, inArray2, inArray3, inArray4 }));
+        return Filters<dtype>::convolve(inImageArray, inSize, inWeights, inMode, inConstantValue, Filter::Method::AUTO);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray zerosSquare(uint32 inSquareSize)
+    NdArray<dtype> convolveFFT(const NdArray<dtype>& inImageArray, uint32 inSize, const NdArray<dtype>& inWeights, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        return numCToBoost(Methods<dtype>::zeros(inSquareSize));
+        return Filters<dtype>::convolve(inImageArray, inSize, inWeights, inMode, inConstantValue, Filter::Method::FFT);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray zerosRowCol(uint32 inNumRows, uint32 inNumCols)
+    NdArray<dtype> convolve1d(const NdArray<dtype>& inImageArray, const NdArray<dtype>& inWeights, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        return numCToBoost(Methods<dtype>::zeros(inNumRows, inNumCols));
+        return Filters<dtype>::convolve1d(inImageArray, inWeights, inMode, inConstantValue);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray zerosShape(const Shape& inShape)
+    NdArray<dtype> convolve1dFFT(const NdArray<dtype>& inImageArray, const NdArray<dtype>& inWeights, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        return numCToBoost(Methods<dtype>::zeros(inShape));
+        return Filters<dtype>::convolve1d(inImageArray, inWeights, inMode, inConstantValue, Filter::Method::FFT);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray zerosList(uint32 inNumRows, uint32 inNumCols)
+    NdArray<dtype> gaussianFilter(const NdArray<dtype>& inImageArray, double inSigma, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        return numCToBoost(Methods<dtype>::zeros({ inNumRows, inNumCols }));
+        return Filters<dtype>::gaussianFilter(inImageArray, inSigma, inMode, inConstantValue);
     }
-}
 
-namespace RandomInterface
-{
+    //================================================================================
+
     template<typename dtype>
-    np::ndarray permutationScalar(dtype inValue)
+    NdArray<dtype> gaussianFilterRecursive(const NdArray<dtype>& inImageArray, double inSigma, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        return numCToBoost(Random<dtype>::permutation(inValue));
+        return Filters<dtype>::gaussianFilter(inImageArray, inSigma, inMode, inConstantValue, Filter::Method::RECURSIVE);
     }
 
     //================================================================================
 
     template<typename dtype>
-    np::ndarray permutationArray(const NdArray<dtype>& inArray)
+    NdArray<dtype> gaussianFilter1d(const NdArray<dtype>& inImageArray, double inSigma, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        return numCToBoost(Random<dtype>::permutation(inArray));
+        return Filters<dtype>::gaussianFilter1d(inImageArray, inSigma, inMode, inConstantValue);
     }
-}
 
-namespace LinalgInterface
-{
+    //================================================================================
+
     template<typename dtype>
-    np::ndarray hatArray(const NdArray<dtype>& inArray)
+    NdArray<dtype> gaussianFilter1dRecursive(const NdArray<dtype>& inImageArray, double inSigma, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        return numCToBoost(Linalg<dtype>::hat(inArray));
+        return Filters<dtype>::gaussianFilter1d(inImageArray, inSigma, inMode, inConstantValue, Filter::Method::RECURSIVE);
     }
 
-    template<typename dtype, typename dtypeOut>
-    np::ndarray multi_dot(const NdArray<dtype>& inArray1, const NdArray<dtype>& inArray2, const NdArray<dtype>& inArray3, const NdArray<dtype>& inArray4)
+    //================================================================================
+
+    template<typename dtype>
+    NdArray<dtype> maximumFilter(const NdArray<dtype>& inImageArray, uint32 inSize, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        return numCToBoost(Linalg<dtype>::multi_dot<dtypeOut>({ inArray1 ,inArray2, inArray3, inArray4 }));
+        return Filters<dtype>::maximumFilter(inImageArray, inSize, inMode, inConstantValue);
     }
-}
 
-namespace RotationsInterface
-{
-    np::ndarray angularVelocity(const Rotations::Quaternion& inQuat1, const Rotations::Quaternion& inQuat2, double inTime)
+    //================================================================================
+
+    template<typename dtype>
+    NdArray<dtype> maximumFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        return numCToBoost(inQuat1.angularVelocity(inQuat2, inTime));
+        return Filters<dtype>::maximumFilter1d(inImageArray, inSize, inMode, inConstantValue);
     }
 
-    np::ndarray nlerp(const Rotations::Quaternion& inQuat1, const Rotations::Quaternion& inQuat2, double inPercent)
+    //================================================================================
+
+    template<typename dtype>
+    NdArray<dtype> medianFilter(const NdArray<dtype>& inImageArray, uint32 inSize, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        return numCToBoost(inQuat1.nlerp(inQuat2, inPercent).toNdArray());
+        return Filters<dtype>::medianFilter(inImageArray, inSize, inMode, inConstantValue);
     }
 
-    np::ndarray slerp(const Rotations::Quaternion& inQuat1, const Rotations::Quaternion& inQuat2, double inPercent)
+    //================================================================================
+
+    template<typename dtype>
+    NdArray<dtype> medianFilterInPlace(const NdArray<dtype>& inImageArray, uint32 inSize, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        return numCToBoost(inQuat1.slerp(inQuat2, inPercent).toNdArray());
+        NdArray<dtype> returnArray(inImageArray);
+        return Filters<dtype>::medianFilter(returnArray, inSize, returnArray, inMode, inConstantValue);
     }
 
-    np::ndarray toDCM(const Rotations::Quaternion& inQuat)
+    //================================================================================
+
+    template<typename dtype>
+    NdArray<dtype> medianFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        return numCToBoost(inQuat.toDCM());
+        return Filters<dtype>::medianFilter1d(inImageArray, inSize, inMode, inConstantValue);
     }
 
-    np::ndarray multiplyScalar(const Rotations::Quaternion& inQuat, double inScalar)
+    //================================================================================
+
+    template<typename dtype>
+    NdArray<dtype> minimumFilter(const NdArray<dtype>& inImageArray, uint32 inSize, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        Rotations::Quaternion returnQuat = inQuat * inScalar;
-        return numCToBoost(returnQuat.toNdArray());
+        return Filters<dtype>::minimumFilter(inImageArray, inSize, inMode, inConstantValue);
     }
 
+    //================================================================================
+
     template<typename dtype>
-    np::ndarray multiplyArray(const Rotations::Quaternion& inQuat, const NdArray<dtype>& inArray)
+    NdArray<dtype> minumumFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        NdArray<double> returnArray = inQuat * inArray;
-        return numCToBoost(returnArray);
+        return Filters<dtype>::minumumFilter1d(inImageArray, inSize, inMode, inConstantValue);
     }
 
-    np::ndarray multiplyQuaternion(const Rotations::Quaternion& inQuat1, const Rotations::Quaternion& inQuat2)
+    //================================================================================
+
+    template<typename dtype>
+    NdArray<dtype> percentileFilter(const NdArray<dtype>& inImageArray, uint32 inSize, uint8 inPercentile, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        Rotations::Quaternion returnQuat = inQuat1 * inQuat2;
-        return numCToBoost(returnQuat.toNdArray());
+        return Filters<dtype>::percentileFilter(inImageArray, inSize, inPercentile, inMode, inConstantValue);
     }
 
+    //================================================================================
+
     template<typename dtype>
-    np::ndarray hatArray(const NdArray<dtype>& inArray)
+    NdArray<dtype> percentileFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize, uint8 inPercentile, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        return numCToBoost(Rotations::hat(inArray));
+        return Filters<dtype>::percentileFilter1d(inImageArray, inSize, inPercentile, inMode, inConstantValue);
     }
-}
 
-namespace RaInterface
-{
+    //================================================================================
+
     template<typename dtype>
-    void print(const Coordinates::RA<dtype>& inRa)
+    NdArray<dtype> rankFilter(const NdArray<dtype>& inImageArray, uint32 inSize, uint32 inRank, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        std::cout << inRa;
+        return Filters<dtype>::rankFilter(inImageArray, inSize, inRank, inMode, inConstantValue);
     }
-}
 
-namespace DecInterface
-{
+    //================================================================================
+
     template<typename dtype>
-    void print(const Coordinates::Dec<dtype>& self)
+    NdArray<dtype> rankFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize, uint8 inRank, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        std::cout << self;
+        return Filters<dtype>::rankFilter1d(inImageArray, inSize, inRank, inMode, inConstantValue);
     }
-}
 
-namespace CoordinateInterface
-{
+    //================================================================================
+
     template<typename dtype>
-    void print(const Coordinates::Coordinate<dtype>& self)
+    NdArray<dtype> uniformFilter(const NdArray<dtype>& inImageArray, uint32 inSize, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        std::cout << self;
+        return Filters<dtype>::uniformFilter(inImageArray, inSize, inMode, inConstantValue);
     }
 
+    //================================================================================
+
     template<typename dtype>
-    dtype degreeSeperationCoordinate(const Coordinates::Coordinate<dtype>& self, const Coordinates::Coordinate<dtype>& inOtherCoordinate)
+    NdArray<dtype> uniformFilterRecursive(const NdArray<dtype>& inImageArray, uint32 inSize, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        return self.degreeSeperation(inOtherCoordinate);
+        return Filters<dtype>::uniformFilter(inImageArray, inSize, inMode, inConstantValue, Filter::Method::RECURSIVE);
     }
 
+    //================================================================================
+
     template<typename dtype>
-    dtype degreeSeperationVector(const Coordinates::Coordinate<dtype>& self, const NdArray<dtype>& inVec)
+    NdArray<dtype> uniformFilter1d(const NdArray<dtype>& inImageArray, uint32 inSize, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        return self.degreeSeperation(inVec);
+        return Filters<dtype>::uniformFilter1d(inImageArray, inSize, inMode, inConstantValue);
     }
 
+    //================================================================================
+
     template<typename dtype>
-    dtype radianSeperationCoordinate(const Coordinates::Coordinate<dtype>& self, const Coordinates::Coordinate<dtype>& inOtherCoordinate)
+    NdArray<dtype> uniformFilter1dRecursive(const NdArray<dtype>& inImageArray, uint32 inSize, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        return self.radianSeperation(inOtherCoordinate);
+        return Filters<dtype>::uniformFilter1d(inImageArray, inSize, inMode, inConstantValue, Filter::Method::RECURSIVE);
     }
 
+    //================================================================================
+
     template<typename dtype>
-    dtype radianSeperationVector(const Coordinates::Coordinate<dtype>& self, const NdArray<dtype>& inVec)
+    NdArray<dtype> uniformFilter1dInPlace(const NdArray<dtype>& inImageArray, uint32 inSize, Filter::Boundary::Mode inMode = Filter::Boundary::REFLECT, dtype inConstantValue = 0)
     {
-        return self.radianSeperation(inVec);
+        NdArray<dtype> returnArray(inImageArray);
+        return Filters<dtype>::uniformFilter1d(returnArray, inSize, returnArray, inMode, inConstantValue);
     }
 }
 
-namespace DataCubeInterface
+//================================================================================
+
+namespace FilterPipelineInterface
 {
     template<typename dtype>
-    NdArray<dtype>& at(DataCube<dtype>& self, uint32 inIndex)
+    NdArray<dtype> run(const FilterPipeline<dtype>& inPipeline, const NdArray<dtype>& inImageArray)
     {
-        return self.at(inIndex);
+        return inPipeline.run(inImageArray);
     }
 
+    //================================================================================
+
     template<typename dtype>
-    NdArray<dtype>& getItem(DataCube<dtype>& self, uint32 inIndex)
+    NdArray<dtype> runInPlace(const FilterPipeline<dtype>& inPipeline, const NdArray<dtype>& inImageArray)
     {
-        return self[inIndex];
+        NdArray<dtype> returnArray(inImageArray);
+        inPipeline.run(returnArray, returnArray);
+        return returnArray;
     }
 }
 
@@ -2471,6 +3346,10 @@ BOOST_PYTHON_MODULE(NumCpp)
         .value("BIG", Endian::BIG)
         .value("LITTLE", Endian::LITTLE);
 
+    bp::enum_<Rounding::Type>("Rounding")
+        .value("TRUNCATE", Rounding::TRUNCATE)
+        .value("NEAREST", Rounding::NEAREST);
+
     // NdArray.hpp
     typedef NdArray<double> NdArrayDouble;
     bp::class_<NdArrayDouble>
@@ -2507,6 +3386,7 @@ BOOST_PYTHON_MODULE(NumCpp)
         .def("get", &NdArrayInterface::getSlice2D<double>)
         .def("get", &NdArrayInterface::getSlice2DRow<double>)
         .def("get", &NdArrayInterface::getSlice2DCol<double>)
+        .def("flip", &NdArrayInterface::flip<double>)
         .def("item", &NdArrayDouble::item)
         .def("max", &NdArrayInterface::max<double>)
         .def("min", &NdArrayInterface::min<double>)
@@ -2540,6 +3420,8 @@ BOOST_PYTHON_MODULE(NumCpp)
         .def("resizeFastList", &NdArrayInterface::resizeFastList<double>)
         .def("resizeSlow", &NdArrayInterface::resizeSlow<double>)
         .def("resizeSlowList", &NdArrayInterface::resizeSlowList<double>)
+        .def("roll", &NdArrayInterface::roll<double>)
+        .def("rot90", &NdArrayInterface::rot90<double>)
         .def("round", &NdArrayInterface::round<double>)
         .def("shape", &NdArrayDouble::shape)
         .def("size", &NdArrayDouble::size)
@@ -2553,6 +3435,7 @@ BOOST_PYTHON_MODULE(NumCpp)
         .def("trace", &NdArrayDouble::trace<double>)
         .def("transpose", &NdArrayInterface::transpose<double>)
         .def("var", &NdArrayInterface::var<double>)
+        .def("where", &MethodsInterface::where<double>).staticmethod("where")
         .def("zeros", &NdArrayDouble::zeros)
         .def("operatorPlusScalar", &NdArrayInterface::operatorPlusScalar<double>)
         .def("operatorPlusArray", &NdArrayInterface::operatorPlusArray<double>)
@@ -2697,7 +3580,8 @@ BOOST_PYTHON_MODULE(NumCpp)
         .def("arctanScalar", &MethodsInterface::arctanScalar<double>).staticmethod("arctanScalar")
         .def("arctanArray", &MethodsInterface::arctanArray<double>).staticmethod("arctanArray")
         .def("arctan2Scalar", &MethodsInterface::arctan2Scalar<double>).staticmethod("arctan2Scalar")
-        .def("arctan2Array", &MethodsInterface::arctan2Array<double>).staticmethod("arctan2Array")
+        .def("arctan2Array", &MethodsInterface::arctan2Array<double, double>).staticmethod("arctan2Array")
+        .def("arctan2ArrayFloat", &MethodsInterface::arctan2Array<double, float>).staticmethod("arctan2ArrayFloat")
         .def("arctanhScalar", &MethodsInterface::arctanhScalar<double>).staticmethod("arctanhScalar")
         .def("arctanhArray", &MethodsInterface::arctanhArray<double>).staticmethod("arctanhArray")
         .def("argmax", &MethodsInterface::argmaxArray<double>).staticmethod("argmax")
@@ -2710,7 +3594,9 @@ BOOST_PYTHON_MODULE(NumCpp)
         .def("array_equiv", &MethodsDouble::array_equiv).staticmethod("array_equiv")
         .def("asarrayVector", &MethodsInterface::asarrayVector<double>).staticmethod("asarrayVector")
         .def("asarrayList", &MethodsInterface::asarrayList<double>).staticmethod("asarrayList")
-        .def("astype", &Methods<uint32>::astype<double>).staticmethod("astype")
+        .def("astype", &MethodsInterface::astypeArray<uint32, double>).staticmethod("astype")
+        .def("astypeUint16", &MethodsInterface::astypeConvert<double, uint16>).staticmethod("astypeUint16")
+        .def("astypeFloat", &MethodsInterface::astypeConvert<double, float>).staticmethod("astypeFloat")
         .def("average", &MethodsInterface::average<double>).staticmethod("average")
         .def("averageWeighted", &MethodsInterface::averageWeighted<double>).staticmethod("averageWeighted")
         .def("bincount", &MethodsInterface::bincount<uint32>).staticmethod("bincount")
@@ -2726,8 +3612,10 @@ BOOST_PYTHON_MODULE(NumCpp)
         .def("ceilArray", &MethodsInterface::ceilArray<double>).staticmethod("ceilArray")
         .def("clipScalar", &MethodsInterface::clipScalar<double>).staticmethod("clipScalar")
         .def("clipArray", &MethodsInterface::clipArray<double>).staticmethod("clipArray")
+        .def("clipArrayInPlace", &MethodsInterface::clipArrayInPlace<double>).staticmethod("clipArrayInPlace")
         .def("column_stack", &MethodsInterface::column_stack<double>).staticmethod("column_stack")
         .def("concatenate", &MethodsInterface::concatenate<double>).staticmethod("concatenate")
+        .def("concatenate_into", &MethodsInterface::concatenateInto<double>).staticmethod("concatenate_into")
         .def("contains", &MethodsDouble::contains).staticmethod("contains")
         .def("copy", &MethodsInterface::copy<double>).staticmethod("copy")
         .def("copysign", &MethodsInterface::copySign<double>).staticmethod("copysign")
@@ -2748,6 +3636,7 @@ BOOST_PYTHON_MODULE(NumCpp)
         .def("deg2radArray", &MethodsInterface::deg2radArray<double>).staticmethod("deg2radArray")
         .def("deleteIndicesScalar", &MethodsInterface::deleteIndicesScalar<double>).staticmethod("deleteIndicesScalar")
         .def("deleteIndicesSlice", &MethodsInterface::deleteIndicesSlice<double>).staticmethod("deleteIndicesSlice")
+        .def("describe", &MethodsInterface::describe<double>).staticmethod("describe")
         .def("diagflat", &MethodsInterface::diagflat<double>).staticmethod("diagflat")
         .def("diagonal", &MethodsInterface::diagonal<double>).staticmethod("diagonal")
         .def("diff", &MethodsInterface::diff<double>).staticmethod("diff")
@@ -2763,7 +3652,9 @@ BOOST_PYTHON_MODULE(NumCpp)
         .def("endianess", &MethodsDouble::endianess).staticmethod("endianess")
         .def("equal", &MethodsInterface::equal<double>).staticmethod("equal")
         .def("expScalar", &MethodsInterface::expScalar<double>).staticmethod("expScalar")
-        .def("expArray", &MethodsInterface::expArray<double>).staticmethod("expArray")
+        .def("expArray", &MethodsInterface::expArray<double, double>).staticmethod("expArray")
+        .def("expArrayFloat", &MethodsInterface::expArray<double, float>).staticmethod("expArrayFloat")
+        .def("expArrayInPlace", &MethodsInterface::expArrayInPlace<double>).staticmethod("expArrayInPlace")
         .def("exp2Scalar", &MethodsInterface::exp2Scalar<double>).staticmethod("exp2Scalar")
         .def("exp2Array", &MethodsInterface::exp2Array<double>).staticmethod("exp2Array")
         .def("expm1Scalar", &MethodsInterface::expm1Scalar<double>).staticmethod("expm1Scalar")
@@ -2794,8 +3685,8 @@ BOOST_PYTHON_MODULE(NumCpp)
         .def("fullShape", &MethodsInterface::fullShape<double>).staticmethod("fullShape")
         .def("full_like", &MethodsDouble::full_like<double>).staticmethod("full_like")
         //.def("full_like", &MethodsDouble::full_like<float>).staticmethod("full_like")
-        .def("greater", &MethodsDouble::greater).staticmethod("greater")
-        .def("greater_equal", &MethodsDouble::greater_equal).staticmethod("greater_equal")
+        .def("greater", &MethodsInterface::greater<double>).staticmethod("greater")
+        .def("greater_equal", &MethodsInterface::greater_equal<double>).staticmethod("greater_equal")
         .def("histogram", &MethodsInterface::histogram<double>).staticmethod("histogram")
         .def("hstack", &MethodsInterface::hstack<double>).staticmethod("hstack")
         .def("hypotScalar", &MethodsInterface::hypotScalar<double, double>).staticmethod("hypotScalar")
@@ -2804,92 +3695,96 @@ BOOST_PYTHON_MODULE(NumCpp)
         //.def("hypotArray", &MethodsInterface::hypotArray<double, float>).staticmethod("hypot")
         .def("identity", &MethodsDouble::identity).staticmethod("identity")
         .def("intersect1d", &Methods<uint32>::intersect1d).staticmethod("intersect1d")
-        .def("invert", &Methods<uint32>::invert).staticmethod("invert")
+        .def("invert", &MethodsInterface::invertArray<uint32>).staticmethod("invert")
         .def("isclose", &MethodsDouble::isclose).staticmethod("isclose")
         .def("isnanScalar", &MethodsInterface::isnanScalar<double>).staticmethod("isnanScalar")
         .def("isnanArray", &MethodsInterface::isnanArray<double>).staticmethod("isnanArray")
         .def("ldexpScalar", &MethodsInterface::ldexpScalar<double>).staticmethod("ldexpScalar")
         .def("ldexpArray", &MethodsInterface::ldexpArray<double>).staticmethod("ldexpArray")
         .def("left_shift", &Methods<uint32>::left_shift).staticmethod("left_shift")
-        .def("less", &MethodsDouble::less).staticmethod("less")
-        .def("less_equal", &MethodsDouble::less_equal).staticmethod("less_equal")
+        .def("less", &MethodsInterface::less<double>).staticmethod("less")
+        .def("less_equal", &MethodsInterface::less_equal<double>).staticmethod("less_equal")
         .def("linspace", &MethodsDouble::linspace).staticmethod("linspace")
         .def("load", &MethodsDouble::load).staticmethod("load")
         .def("logScalar", &MethodsInterface::logScalar<double>).staticmethod("logScalar")
-        .def("logArray", &MethodsInterface::logArray<double>).staticmethod("logArray")
+        .def("logArray", &MethodsInterface::logArray<double, double>).staticmethod("logArray")
+        .def("logArrayFloat", &MethodsInterface::logArray<double, float>).staticmethod("logArrayFloat")
         .def("log10Scalar", &MethodsInterface::log10Scalar<double>).staticmethod("log10Scalar")
         .def("log10Array", &MethodsInterface::log10Array<double>).staticmethod("log10Array")
         .def("log1pScalar", &MethodsInterface::log1pScalar<double>).staticmethod("log1pScalar")
         .def("log1pArray", &MethodsInterface::log1pArray<double>).staticmethod("log1pArray")
         .def("log2Scalar", &MethodsInterface::log2Scalar<double>).staticmethod("log2Scalar")
         .def("log2Array", &MethodsInterface::log2Array<double>).staticmethod("log2Array")
-        .def("logical_and", &MethodsDouble::logical_and).staticmethod("logical_and")
-        .def("logical_not", &MethodsDouble::logical_not).staticmethod("logical_not")
-        .def("logical_or", &MethodsDouble::logical_or).staticmethod("logical_or")
-        .def("logical_xor", &MethodsDouble::logical_xor).staticmethod("logical_xor")
+        .def("logical_and", &MethodsInterface::logical_andArray<double>).staticmethod("logical_and")
+        .def("logical_not", &MethodsInterface::logical_notArray<double>).staticmethod("logical_not")
+        .def("logical_or", &MethodsInterface::logical_orArray<double>).staticmethod("logical_or")
+        .def("logical_xor", &MethodsInterface::logical_xorArray<double>).staticmethod("logical_xor")
         .def("matmul", &MethodsDouble::matmul<double>).staticmethod("matmul")
         //.def("matmul", &MethodsDouble::matmul<float>).staticmethod("matmul")
-        .def("max", &MethodsDouble::max).staticmethod("max")
-        .def("maximum", &MethodsDouble::maximum).staticmethod("maximum")
-        .def("mean", &MethodsDouble::mean).staticmethod("mean")
-        .def("median", &MethodsDouble::median).staticmethod("median")
-        .def("min", &MethodsDouble::min).staticmethod("min")
-        .def("minimum", &MethodsDouble::minimum).staticmethod("minimum")
-        .def("mod", &Methods<uint32>::mod).staticmethod("mod")
-        .def("multiply", &MethodsDouble::multiply).staticmethod("multiply")
-        .def("nanargmax", &MethodsDouble::nanargmax).staticmethod("nanargmax")
-        .def("nanargmin", &MethodsDouble::nanargmin).staticmethod("nanargmin")
+        .def("max", &MethodsInterface::maxArray<double>).staticmethod("max")
+        .def("maximum", &MethodsInterface::maximum<double>).staticmethod("maximum")
+        .def("mean", &MethodsInterface::meanArray<double>).staticmethod("mean")
+        .def("median", &MethodsInterface::medianArray<double>).staticmethod("median")
+        .def("medianOut", &MethodsInterface::medianArrayOut<double>).staticmethod("medianOut")
+        .def("min", &MethodsInterface::minArray<double>).staticmethod("min")
+        .def("minimum", &MethodsInterface::minimum<double>).staticmethod("minimum")
+        .def("mod", &MethodsInterface::modArray<uint32>).staticmethod("mod")
+        .def("multiply", &MethodsInterface::multiply<double>).staticmethod("multiply")
+        .def("nanargmax", &MethodsInterface::nanargmaxArray<double>).staticmethod("nanargmax")
+        .def("nanargmin", &MethodsInterface::nanargminArray<double>).staticmethod("nanargmin")
         .def("nancumprod", &MethodsDouble::nancumprod<double>).staticmethod("nancumprod")
         //.def("nancumprod", &MethodsDouble::nancumprod<float>).staticmethod("nancumprod")
         .def("nancumsum", &MethodsDouble::nancumsum<double>).staticmethod("nancumsum")
         //.def("nancumsum", &MethodsDouble::nancumsum<float>).staticmethod("nancumsum")
-        .def("nanmax", &MethodsDouble::nanmax).staticmethod("nanmax")
-        .def("nanmean", &MethodsDouble::nanmean).staticmethod("nanmean")
-        .def("nanmedian", &MethodsDouble::nanmedian).staticmethod("nanmedian")
-        .def("nanmin", &MethodsDouble::nanmin).staticmethod("nanmin")
-        .def("nanpercentile", &MethodsDouble::nanpercentile<double>).staticmethod("nanpercentile")
-        .def("nanprod", &MethodsDouble::nanprod<double>).staticmethod("nanprod")
-        //.def("nanprod", &MethodsDouble::nanprod<float>).staticmethod("nanprod")
+        .def("nanmax", &MethodsInterface::nanmaxArray<double>).staticmethod("nanmax")
+        .def("nanmean", &MethodsInterface::nanmeanArray<double>).staticmethod("nanmean")
+        .def("nanmeanOut", &MethodsInterface::nanmeanArrayOut<double>).staticmethod("nanmeanOut")
+        .def("nanmedian", &MethodsInterface::nanmedianArray<double>).staticmethod("nanmedian")
+        .def("nanmin", &MethodsInterface::nanminArray<double>).staticmethod("nanmin")
+        .def("nanpercentile", &MethodsInterface::nanpercentileArray<double>).staticmethod("nanpercentile")
+        .def("nanprod", &MethodsInterface::nanprodArray<double, double>).staticmethod("nanprod")
+        //.def("nanprod", &MethodsInterface::nanprodArray<double, float>).staticmethod("nanprod")
         .def("nansSquare", &MethodsInterface::nansSquare<double>).staticmethod("nansSquare")
         .def("nansRowCol", &MethodsInterface::nansRowCol<double>).staticmethod("nansRowCol")
         .def("nansShape", &MethodsInterface::nansShape<double>).staticmethod("nansShape")
         .def("nansList", &MethodsInterface::nansList<double>).staticmethod("nansList")
-        .def("nanstd", &MethodsDouble::nanstd).staticmethod("nanstd")
-        .def("nansum", &MethodsDouble::nansum<double>).staticmethod("nansum")
-        //.def("nansum", &MethodsDouble::nansum<float>).staticmethod("nansum")
-        .def("nanvar", &MethodsDouble::nanvar).staticmethod("nanvar")
+        .def("nanstd", &MethodsInterface::nanstdArray<double>).staticmethod("nanstd")
+        .def("nansum", &MethodsInterface::nansumArray<double, double>).staticmethod("nansum")
+        //.def("nansum", &MethodsInterface::nansumArray<double, float>).staticmethod("nansum")
+        .def("nanvar", &MethodsInterface::nanvarArray<double>).staticmethod("nanvar")
         .def("nbytes", &MethodsDouble::nbytes).staticmethod("nbytes")
         .def("newbyteorderScalar", &MethodsInterface::newbyteorderScalar<uint32>).staticmethod("newbyteorderScalar")
         .def("newbyteorderArray", &MethodsInterface::newbyteorderArray<uint32>).staticmethod("newbyteorderArray")
-        .def("negative", &MethodsDouble::negative<double>).staticmethod("negative")
-        //.def("negative", &MethodsDouble::negative<float>).staticmethod("negative")
+        .def("negative", &MethodsInterface::negativeArray<double, double>).staticmethod("negative")
+        //.def("negative", &MethodsInterface::negativeArray<double, float>).staticmethod("negative")
+        .def("negativeArrayInPlace", &MethodsInterface::negativeArrayInPlace<double>).staticmethod("negativeArrayInPlace")
         .def("nonzero", &MethodsDouble::nonzero).staticmethod("nonzero")
         .def("norm", &MethodsDouble::norm<double>).staticmethod("norm")
         //.def("norm", &MethodsDouble::norm<float>).staticmethod("norm")
-        .def("not_equal", &MethodsDouble::not_equal).staticmethod("not_equal")
+        .def("not_equal", &MethodsInterface::not_equal<double>).staticmethod("not_equal")
         .def("onesSquare", &MethodsInterface::onesSquare<double>).staticmethod("onesSquare")
         .def("onesRowCol", &MethodsInterface::onesRowCol<double>).staticmethod("onesRowCol")
         .def("onesShape", &MethodsInterface::onesShape<double>).staticmethod("onesShape")
         .def("ones_like", &MethodsDouble::ones_like<double>).staticmethod("ones_like")
         //.def("ones_like", &MethodsDouble::ones_like<float>).staticmethod("ones_like")
-        .def("pad", &MethodsDouble::pad).staticmethod("pad")
+        .def("pad", &MethodsInterface::pad<double>).staticmethod("pad")
         .def("partition", &MethodsDouble::partition).staticmethod("partition")
-        .def("percentile", &MethodsDouble::percentile<double>).staticmethod("percentile")
-        //.def("percentile", &MethodsDouble::percentile<float>).staticmethod("percentile")
+        .def("percentile", &MethodsInterface::percentileArray<double, double>).staticmethod("percentile")
+        //.def("percentile", &MethodsInterface::percentileArray<double, float>).staticmethod("percentile")
         .def("powerArrayScalar", &MethodsInterface::powerArrayScalar<double, double>).staticmethod("powerArrayScalar")
         //.def("power", &MethodsInterface::powerArrayScalar<double, float>).staticmethod("power")
         .def("powerArrayArray", &MethodsInterface::powerArrayArray<double, double>).staticmethod("powerArrayArray")
         //.def("power", &MethodsInterface::powerArrayArray<double, float>).staticmethod("power")
-        .def("prod", &MethodsDouble::prod<double>).staticmethod("prod")
-        //.def("prod", &MethodsDouble::prod<float>).staticmethod("prod")
-        .def("ptp", &MethodsDouble::ptp).staticmethod("ptp")
+        .def("prod", &MethodsInterface::prodArray<double, double>).staticmethod("prod")
+        //.def("prod", &MethodsInterface::prodArray<double, float>).staticmethod("prod")
+        .def("ptp", &MethodsInterface::ptpArray<double>).staticmethod("ptp")
         .def("put", &MethodsDouble::put, bp::return_internal_reference<>()).staticmethod("put")
         .def("putmask", &MethodsInterface::putmask<double>).staticmethod("putmask")
         .def("putmaskScalar", &MethodsInterface::putmaskScalar<double>).staticmethod("putmaskScalar")
         .def("rad2degScalar", &MethodsInterface::rad2degScalar<double>).staticmethod("rad2degScalar")
         .def("rad2degArray", &MethodsInterface::rad2degArray<double>).staticmethod("rad2degArray")
-        .def("reciprocal", &MethodsDouble::reciprocal<double>).staticmethod("reciprocal")
-        //.def("reciprocal", &MethodsDouble::reciprocal<float>).staticmethod("reciprocal")
+        .def("reciprocal", &MethodsInterface::reciprocalArray<double, double>).staticmethod("reciprocal")
+        //.def("reciprocal", &MethodsInterface::reciprocalArray<double, float>).staticmethod("reciprocal")
         .def("remainderScalar", &MethodsInterface::remainderScalar<double, double>).staticmethod("remainderScalar")
         //.def("remainder", &MethodsInterface::remainderScalar<double, float>).staticmethod("remainder")
         .def("remainderArray", &MethodsInterface::remainderArray<double, double>).staticmethod("remainderArray")
@@ -2914,7 +3809,8 @@ BOOST_PYTHON_MODULE(NumCpp)
         .def("signbitScalar", &MethodsInterface::signbitScalar<double>).staticmethod("signbitScalar")
         .def("signbitArray", &MethodsInterface::signbitArray<double>).staticmethod("signbitArray")
         .def("sinScalar", &MethodsInterface::sinScalar<double>).staticmethod("sinScalar")
-        .def("sinArray", &MethodsInterface::sinArray<double>).staticmethod("sinArray")
+        .def("sinArray", &MethodsInterface::sinArray<double, double>).staticmethod("sinArray")
+        .def("sinArrayFloat", &MethodsInterface::sinArray<double, float>).staticmethod("sinArrayFloat")
         .def("sincScalar", &MethodsInterface::sincScalar<double>).staticmethod("sincScalar")
         .def("sincArray", &MethodsInterface::sincArray<double>).staticmethod("sincArray")
         .def("sinhScalar", &MethodsInterface::sinhScalar<double>).staticmethod("sinhScalar")
@@ -2925,9 +3821,11 @@ BOOST_PYTHON_MODULE(NumCpp)
         .def("sqrtArray", &MethodsInterface::sqrtArray<double>).staticmethod("sqrtArray")
         .def("squareScalar", &MethodsInterface::squareScalar<double>).staticmethod("squareScalar")
         .def("squareArray", &MethodsInterface::squareArray<double>).staticmethod("squareArray")
-        .def("std", &MethodsDouble::std).staticmethod("std")
-        .def("sum", &MethodsDouble::sum<double>).staticmethod("sum")
-        //.def("sum", &MethodsDouble::sum<float>).staticmethod("sum")
+        .def("std", &MethodsInterface::stdArray<double>).staticmethod("std")
+        .def("stdOut", &MethodsInterface::stdArrayOut<double>).staticmethod("stdOut")
+        .def("sum", &MethodsInterface::sumArray<double, double>).staticmethod("sum")
+        //.def("sum", &MethodsInterface::sumArray<double, float>).staticmethod("sum")
+        .def("sumOut", &MethodsInterface::sumArrayOut<double, double>).staticmethod("sumOut")
         .def("swapaxes", &MethodsDouble::swapaxes).staticmethod("swapaxes")
         .def("tanScalar", &MethodsInterface::tanScalar<double>).staticmethod("tanScalar")
         .def("tanArray", &MethodsInterface::tanArray<double>).staticmethod("tanArray")
@@ -2952,7 +3850,7 @@ BOOST_PYTHON_MODULE(NumCpp)
         .def("unique", &MethodsDouble::unique).staticmethod("unique")
         .def("unwrapScalar", &MethodsInterface::unwrapScalar<double>).staticmethod("unwrapScalar")
         .def("unwrapArray", &MethodsInterface::unwrapArray<double>).staticmethod("unwrapArray")
-        .def("var", &MethodsDouble::var).staticmethod("var")
+        .def("var", &MethodsInterface::varArray<double>).staticmethod("var")
         .def("vstack", &MethodsInterface::vstack<double>).staticmethod("vstack")
         .def("zerosSquare", &MethodsInterface::zerosSquare<double>).staticmethod("zerosSquare")
         .def("zerosRowCol", &MethodsInterface::zerosRowCol<double>).staticmethod("zerosRowCol")
@@ -3149,24 +4047,103 @@ BOOST_PYTHON_MODULE(NumCpp)
 
     bp::class_<FiltersDouble>
         ("Filters", bp::init<>())
-        .def("complementaryMedianFilter", &FiltersDouble::complementaryMedianFilter).staticmethod("complementaryMedianFilter")
-        .def("complementaryMedianFilter1d", &FiltersDouble::complementaryMedianFilter1d).staticmethod("complementaryMedianFilter1d")
-        .def("convolve", &FiltersDouble::convolve).staticmethod("convolve")
-        .def("convolve1d", &FiltersDouble::convolve1d).staticmethod("convolve1d")
-        .def("gaussianFilter", &FiltersDouble::gaussianFilter).staticmethod("gaussianFilter")
-        .def("gaussianFilter1d", &FiltersDouble::gaussianFilter1d).staticmethod("gaussianFilter1d")
-        .def("maximumFilter", &FiltersDouble::maximumFilter).staticmethod("maximumFilter")
-        .def("maximumFilter1d", &FiltersDouble::maximumFilter1d).staticmethod("maximumFilter1d")
-        .def("medianFilter", &FiltersDouble::medianFilter).staticmethod("medianFilter")
-        .def("medianFilter1d", &FiltersDouble::medianFilter1d).staticmethod("medianFilter1d")
-        .def("minimumFilter", &FiltersDouble::minimumFilter).staticmethod("minimumFilter")
-        .def("minumumFilter1d", &FiltersDouble::minumumFilter1d).staticmethod("minumumFilter1d")
-        .def("percentileFilter", &FiltersDouble::percentileFilter).staticmethod("percentileFilter")
-        .def("percentileFilter1d", &FiltersDouble::percentileFilter1d).staticmethod("percentileFilter1d")
-        .def("rankFilter", &FiltersDouble::rankFilter).staticmethod("rankFilter")
-        .def("rankFilter1d", &FiltersDouble::rankFilter1d).staticmethod("rankFilter1d")
-        .def("uniformFilter", &FiltersDouble::uniformFilter).staticmethod("uniformFilter")
-        .def("uniformFilter1d", &FiltersDouble::uniformFilter1d).staticmethod("uniformFilter1d");
+        .def("complementaryMedianFilter", &FiltersInterface::complementaryMedianFilter<double>).staticmethod("complementaryMedianFilter")
+        .def("complementaryMedianFilter1d", &FiltersInterface::complementaryMedianFilter1d<double>).staticmethod("complementaryMedianFilter1d")
+        .def("convolve", &FiltersInterface::convolve<double>).staticmethod("convolve")
+        .def("convolveAuto", &FiltersInterface::convolveAuto<double>).staticmethod("convolveAuto")
+        .def("convolveFFT", &FiltersInterface::convolveFFT<double>).staticmethod("convolveFFT")
+        .def("convolve1d", &FiltersInterface::convolve1d<double>).staticmethod("convolve1d")
+        .def("convolve1dFFT", &FiltersInterface::convolve1dFFT<double>).staticmethod("convolve1dFFT")
+        .def("gaussianFilter", &FiltersInterface::gaussianFilter<double>).staticmethod("gaussianFilter")
+        .def("gaussianFilterRecursive", &FiltersInterface::gaussianFilterRecursive<double>).staticmethod("gaussianFilterRecursive")
+        .def("gaussianFilter1d", &FiltersInterface::gaussianFilter1d<double>).staticmethod("gaussianFilter1d")
+        .def("gaussianFilter1dRecursive", &FiltersInterface::gaussianFilter1dRecursive<double>).staticmethod("gaussianFilter1dRecursive")
+        .def("maximumFilter", &FiltersInterface::maximumFilter<double>).staticmethod("maximumFilter")
+        .def("maximumFilter1d", &FiltersInterface::maximumFilter1d<double>).staticmethod("maximumFilter1d")
+        .def("medianFilter", &FiltersInterface::medianFilter<double>).staticmethod("medianFilter")
+        .def("medianFilterInPlace", &FiltersInterface::medianFilterInPlace<double>).staticmethod("medianFilterInPlace")
+        .def("medianFilter1d", &FiltersInterface::medianFilter1d<double>).staticmethod("medianFilter1d")
+        .def("minimumFilter", &FiltersInterface::minimumFilter<double>).staticmethod("minimumFilter")
+        .def("minumumFilter1d", &FiltersInterface::minumumFilter1d<double>).staticmethod("minumumFilter1d")
+        .def("percentileFilter", &FiltersInterface::percentileFilter<double>).staticmethod("percentileFilter")
+        .def("percentileFilter1d", &FiltersInterface::percentileFilter1d<double>).staticmethod("percentileFilter1d")
+        .def("rankFilter", &FiltersInterface::rankFilter<double>).staticmethod("rankFilter")
+        .def("rankFilter1d", &FiltersInterface::rankFilter1d<double>).staticmethod("rankFilter1d")
+        .def("uniformFilter", &FiltersInterface::uniformFilter<double>).staticmethod("uniformFilter")
+        .def("uniformFilterRecursive", &FiltersInterface::uniformFilterRecursive<double>).staticmethod("uniformFilterRecursive")
+        .def("uniformFilter1d", &FiltersInterface::uniformFilter1d<double>).staticmethod("uniformFilter1d")
+        .def("uniformFilter1dRecursive", &FiltersInterface::uniformFilter1dRecursive<double>).staticmethod("uniformFilter1dRecursive")
+        .def("uniformFilter1dInPlace", &FiltersInterface::uniformFilter1dInPlace<double>).staticmethod("uniformFilter1dInPlace");
+
+    // FilterPipeline.hpp
+    typedef FilterPipeline<double> FilterPipelineDouble;
+
+    bp::class_<FilterPipelineDouble>
+        ("FilterPipeline", bp::init<>())
+        .def("gaussianFilter", &FilterPipelineDouble::gaussianFilter, bp::return_internal_reference<>())
+        .def("uniformFilter", &FilterPipelineDouble::uniformFilter, bp::return_internal_reference<>())
+        .def("maximumFilter", &FilterPipelineDouble::maximumFilter, bp::return_internal_reference<>())
+        .def("minimumFilter", &FilterPipelineDouble::minimumFilter, bp::return_internal_reference<>())
+        .def("medianFilter", &FilterPipelineDouble::medianFilter, bp::return_internal_reference<>())
+        .def("complementaryMedianFilter", &FilterPipelineDouble::complementaryMedianFilter, bp::return_internal_reference<>())
+        .def("rankFilter", &FilterPipelineDouble::rankFilter, bp::return_internal_reference<>())
+        .def("percentileFilter", &FilterPipelineDouble::percentileFilter, bp::return_internal_reference<>())
+        .def("convolve", &FilterPipelineDouble::convolve, bp::return_internal_reference<>())
+        .def("threshold", &FilterPipelineDouble::threshold, bp::return_internal_reference<>())
+        .def("numStages", &FilterPipelineDouble::numStages)
+        .def("run", &FilterPipelineInterface::run<double>)
+        .def("runInPlace", &FilterPipelineInterface::runInPlace<double>);
+
+    // StreamingFilter.hpp
+    typedef StreamingFilter<double> StreamingFilterDouble;
+
+    bp::class_<StreamingFilterDouble>
+        ("StreamingFilter", bp::no_init)
+        .def("convolve1d", &StreamingFilterDouble::convolve1d).staticmethod("convolve1d")
+        .def("gaussianFilter1d", &StreamingFilterDouble::gaussianFilter1d).staticmethod("gaussianFilter1d")
+        .def("maximumFilter1d", &StreamingFilterDouble::maximumFilter1d).staticmethod("maximumFilter1d")
+        .def("medianFilter1d", &StreamingFilterDouble::medianFilter1d).staticmethod("medianFilter1d")
+        .def("minimumFilter1d", &StreamingFilterDouble::minimumFilter1d).staticmethod("minimumFilter1d")
+        .def("uniformFilter1d", &StreamingFilterDouble::uniformFilter1d).staticmethod("uniformFilter1d")
+        .def("latency", &StreamingFilterDouble::latency)
+        .def("numIn", &StreamingFilterDouble::numIn)
+        .def("numOut", &StreamingFilterDouble::numOut)
+        .def("push", &StreamingFilterDouble::push)
+        .def("flush", &StreamingFilterDouble::flush)
+        .def("reset", &StreamingFilterDouble::reset);
+
+    // TileExecutor.hpp
+    bp::class_<TileExecutor>
+        ("TileExecutor", bp::init<>())
+        .def("numThreads", &TileExecutor::numThreads).staticmethod("numThreads")
+        .def("setNumThreads", &TileExecutor::setNumThreads).staticmethod("setNumThreads");
+
+    // Morphology.hpp
+    bp::class_<Morphology::BitMask>
+        ("BitMask", bp::init<>())
+        .def(bp::init<uint32, uint32>())
+        .def(bp::init<NdArray<bool> >())
+        .def(bp::init<Morphology::BitMask>())
+        .def("numRows", &Morphology::BitMask::numRows)
+        .def("numCols", &Morphology::BitMask::numCols)
+        .def("shape", &Morphology::BitMask::shape)
+        .def("get", &Morphology::BitMask::get)
+        .def("set", &Morphology::BitMask::set)
+        .def("count", &Morphology::BitMask::count)
+        .def("any", &Morphology::BitMask::any)
+        .def("dilate", &Morphology::BitMask::dilate)
+        .def("erode", &Morphology::BitMask::erode)
+        .def("toNdArray", &Morphology::BitMask::toNdArray)
+        .def("__and__", &Morphology::BitMask::operator&)
+        .def("__or__", &Morphology::BitMask::operator|)
+        .def("__invert__", &Morphology::BitMask::operator~)
+        .def("__eq__", &Morphology::BitMask::operator==)
+        .def("__ne__", &Morphology::BitMask::operator!=);
+
+    bp::class_<Morphology>
+        ("Morphology", bp::init<>())
+        .def("dilate", &Morphology::dilate).staticmethod("dilate")
+        .def("erode", &Morphology::erode).staticmethod("erode");
 
     // Image Processing
     typedef ImageProcessing<double> ImageProcessingDouble;
@@ -3208,10 +4185,32 @@ BOOST_PYTHON_MODULE(NumCpp)
         .def("__str__", &ClusterDouble::str)
         .def("print", &ClusterDouble::print);
 
+    typedef ImageProcessingDouble::ClusterStore ClusterStoreDouble;
+    bp::class_<ClusterStoreDouble>
+        ("ClusterStore", bp::init<>())
+        .def(bp::init<ClusterStoreDouble>())
+        .def("size", &ClusterStoreDouble::size)
+        .def("numPixels", &ClusterStoreDouble::numPixels)
+        .def("clusterSize", &ClusterStoreDouble::clusterSize)
+        .def("numExceedances", &ClusterStoreDouble::numExceedances)
+        .def("rowMin", &ClusterStoreDouble::rowMin)
+        .def("rowMax", &ClusterStoreDouble::rowMax)
+        .def("colMin", &ClusterStoreDouble::colMin)
+        .def("colMax", &ClusterStoreDouble::colMax)
+        .def("height", &ClusterStoreDouble::height)
+        .def("width", &ClusterStoreDouble::width)
+        .def("intensity", &ClusterStoreDouble::intensity)
+        .def("peakPixelIntensity", &ClusterStoreDouble::peakPixelIntensity)
+        .def("eod", &ClusterStoreDouble::eod)
+        .def("contains", &ClusterStoreDouble::contains)
+        .def("cluster", &ClusterStoreDouble::cluster)
+        .def("clusters", &ClusterStoreDouble::clusters);
+
     typedef ImageProcessingDouble::Centroid CentroidDouble;
     bp::class_<CentroidDouble>
         ("Centroid", bp::init<>())
         .def(bp::init<ClusterDouble>())
+        .def(bp::init<ClusterStoreDouble, uint32>())
         .def(bp::init<CentroidDouble>())
         .def("row", &CentroidDouble::row)
         .def("col", &CentroidDouble::col)
@@ -3233,7 +4232,11 @@ BOOST_PYTHON_MODULE(NumCpp)
         ("ImageProcessing", bp::init<>())
         .def("applyThreshold", &ImageProcessingDouble::applyThreshold).staticmethod("applyThreshold")
         .def("centroidClusters", &ImageProcessingDouble::centroidClusters).staticmethod("centroidClusters")
+        .def("centroidClusterStore", &ImageProcessingDouble::centroidClusterStore).staticmethod("centroidClusterStore")
+        .def("centroidExceedances", &ImageProcessingDouble::centroidExceedances).staticmethod("centroidExceedances")
+        .def("centroidThreshold", &ImageProcessingDouble::centroidThreshold).staticmethod("centroidThreshold")
         .def("clusterPixels", &ImageProcessingDouble::clusterPixels).staticmethod("clusterPixels")
+        .def("clusterStore", &ImageProcessingDouble::clusterStore).staticmethod("clusterStore")
         .def("generateThreshold", &ImageProcessingDouble::generateThreshold).staticmethod("generateThreshold")
         .def("generateCentroids", &ImageProcessingDouble::generateCentroids).staticmethod("generateCentroids")
         .def("windowExceedances", &ImageProcessingDouble::windowExceedances).staticmethod("windowExceedances");
@@ -3387,4 +4390,91 @@ BOOST_PYTHON_MODULE(NumCpp)
         .def("pop_front", &DataCubeDouble::pop_front)
         .def("push_back", &DataCubeDouble::push_back)
         .def("push_front", &DataCubeDouble::push_front);
+
+    // MaskedArray
+    typedef MaskedArray<double> MaskedArrayDouble;
+    bp::class_<MaskedArrayDouble>
+        ("MaskedArray", bp::init<NdArray<double> >())
+        .def("__init__", bp::make_constructor(&MaskedArrayInterface::withMask<double>))
+        .def("maskedInvalid", &MaskedArrayInterface::maskedInvalid<double>).staticmethod("maskedInvalid")
+        .def("count", &MaskedArrayInterface::count<double>)
+        .def("filled", &MaskedArrayInterface::filled<double>)
+        .def("isValid", &MaskedArrayInterface::isValid<double>)
+        .def("mask", &MaskedArrayInterface::mask<double>)
+        .def("max", &MaskedArrayInterface::max<double>)
+        .def("mean", &MaskedArrayInterface::mean<double>)
+        .def("min", &MaskedArrayInterface::min<double>)
+        .def("setValid", &MaskedArrayInterface::setValid<double>)
+        .def("shape", &MaskedArrayDouble::shape)
+        .def("size", &MaskedArrayDouble::size)
+        .def("std", &MaskedArrayInterface::std<double>)
+        .def("sum", &MaskedArrayInterface::sum<double>)
+        .def("var", &MaskedArrayInterface::var<double>);
+
+    // RunningStatistics
+    typedef RunningMoments<double> RunningMomentsDouble;
+    bp::class_<RunningMomentsDouble>
+        ("RunningMoments", bp::init<>())
+        .def("count", &RunningMomentsDouble::count)
+        .def("mean", &RunningStatisticsInterface::momentsMean<double>)
+        .def("merge", &RunningMomentsDouble::merge)
+        .def("push", &RunningMomentsDouble::push)
+        .def("reset", &RunningMomentsDouble::reset)
+        .def("std", &RunningStatisticsInterface::momentsStd<double>)
+        .def("var", &RunningStatisticsInterface::momentsVar<double>);
+
+    typedef RunningMinMax<double> RunningMinMaxDouble;
+    bp::class_<RunningMinMaxDouble>
+        ("RunningMinMax", bp::init<>())
+        .def("count", &RunningMinMaxDouble::count)
+        .def("max", &RunningStatisticsInterface::minMaxMax<double>)
+        .def("merge", &RunningMinMaxDouble::merge)
+        .def("min", &RunningStatisticsInterface::minMaxMin<double>)
+        .def("push", &RunningMinMaxDouble::push)
+        .def("reset", &RunningMinMaxDouble::reset);
+
+    typedef ExponentialMovingAverage<double> ExponentialMovingAverageDouble;
+    bp::class_<ExponentialMovingAverageDouble>
+        ("ExponentialMovingAverage", bp::init<double>())
+        .def("count", &ExponentialMovingAverageDouble::count)
+        .def("merge", &ExponentialMovingAverageDouble::merge)
+        .def("push", &ExponentialMovingAverageDouble::push)
+        .def("reset", &ExponentialMovingAverageDouble::reset)
+        .def("value", &RunningStatisticsInterface::emaValue<double>);
+
+    typedef RunningHistogram<double> RunningHistogramDouble;
+    bp::class_<RunningHistogramDouble>
+        ("RunningHistogram", bp::init<uint32, double, double>())
+        .def("histogram", &RunningStatisticsInterface::histogram<double>)
+        .def("merge", &RunningHistogramDouble::merge)
+        .def("numOverflow", &RunningHistogramDouble::numOverflow)
+        .def("numUnderflow", &RunningHistogramDouble::numUnderflow)
+        .def("push", &RunningHistogramDouble::push)
+        .def("reset", &RunningHistogramDouble::reset);
+
+    typedef RunningQuantile<double> RunningQuantileDouble;
+    bp::class_<RunningQuantileDouble>
+        ("RunningQuantile", bp::init<uint32>())
+        .def("count", &RunningQuantileDouble::count)
+        .def("merge", &RunningQuantileDouble::merge)
+        .def("percentile", &RunningQuantileDouble::percentile)
+        .def("push", &RunningQuantileDouble::push)
+        .def("reset", &RunningQuantileDouble::reset);
+
+    // Generator
+    typedef Generator<double> GeneratorDouble;
+    bp::class_<GeneratorDouble>
+        ("Generator", bp::no_init)
+        .def("arange", &GeneratorInterface::arange<double>).staticmethod("arange")
+        .def("eye", &GeneratorInterface::eye<double>).staticmethod("eye")
+        .def("identity", &GeneratorDouble::identity).staticmethod("identity")
+        .def("linspace", &GeneratorInterface::linspace<double>).staticmethod("linspace")
+        .def("tri", &GeneratorInterface::tri<double>).staticmethod("tri")
+        .def("add", &GeneratorInterface::add<double>)
+        .def("divide", &GeneratorInterface::divide<double>)
+        .def("multiply", &GeneratorInterface::multiply<double>)
+        .def("shape", &GeneratorDouble::shape)
+        .def("size", &GeneratorDouble::size)
+        .def("subtract", &GeneratorInterface::subtract<double>)
+        .def("toNdArray", &GeneratorInterface::toNdArray<double>);
 }
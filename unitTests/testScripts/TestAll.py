@@ -4,13 +4,19 @@ import TestSlice
 import TestTimer
 import TestNdArray
 import TestMethods
+import TestMaskedArray
+import TestGenerator
 import TestConstants
 import TestCoordinates
 import TestFilters
+import TestFilterPipeline
+import TestStreamingFilter
+import TestMorphology
 import TestImageProcessing
 import TestLinalg
 import TestRandom
 import TestRotations
+import TestRunningStatistics
 import TestPolynomial
 import TestFFT
 import TestUtils
@@ -26,12 +32,18 @@ def doTest():
     TestDtypeInfo.doTest()
     TestNdArray.doTest()
     TestMethods.doTest()
+    TestMaskedArray.doTest()
+    TestGenerator.doTest()
     TestCoordinates.doTest()
     TestConstants.doTest()
     TestLinalg.doTest()
     TestRandom.doTest()
     TestRotations.doTest()
+    TestRunningStatistics.doTest()
     TestFilters.doTest()
+    TestFilterPipeline.doTest()
+    TestStreamingFilter.doTest()
+    TestMorphology.doTest()
     TestPolynomial.doTest()
     TestFFT.doTest()
     TestImageProcessing.doTest()
@@ -0,0 +1,88 @@
+import numpy as np
+from termcolor import colored
+import scipy.ndimage.filters as filters
+import sys
+sys.path.append(r'../build/x64/Release')
+import NumCpp
+
+####################################################################################
+def doTest():
+    print(colored('Testing FilterPipeline', 'magenta'))
+
+    modes = {'reflect' : NumCpp.Mode.REFLECT,
+             'constant': NumCpp.Mode.CONSTANT,
+             'nearest': NumCpp.Mode.NEAREST,
+             'mirror': NumCpp.Mode.MIRROR,
+             'wrap': NumCpp.Mode.WRAP}
+
+    for mode in modes.keys():
+        print(colored(f'Testing single stages: mode = {mode}', 'cyan'))
+        shape = np.random.randint(100, 200, [2,])
+        cShape = NumCpp.Shape(shape[0].item(), shape[1].item())
+        cArray = NumCpp.NdArray(cShape)
+        data = np.random.randint(100, 1000, shape).astype(np.double)
+        cArray.setArray(data)
+        kernalSize = 0
+        while kernalSize % 2 == 0:
+            kernalSize = np.random.randint(3, 9)
+        constantValue = np.random.randint(0, 5, [1,]).item() # only actaully needed for constant boundary condition
+        weights = np.random.randint(1, 5, [kernalSize, kernalSize])
+        cWeights = NumCpp.NdArray(kernalSize, kernalSize)
+        cWeights.setArray(weights)
+        results = [np.array_equal(NumCpp.FilterPipeline().medianFilter(kernalSize, modes[mode], constantValue).run(cArray).getNumpyArray(),
+                                  NumCpp.Filters.medianFilter(cArray, kernalSize, modes[mode], constantValue).getNumpyArray()),
+                   np.array_equal(NumCpp.FilterPipeline().complementaryMedianFilter(kernalSize, modes[mode], constantValue).run(cArray).getNumpyArray(),
+                                  NumCpp.Filters.complementaryMedianFilter(cArray, kernalSize, modes[mode], constantValue).getNumpyArray()),
+                   np.array_equal(NumCpp.FilterPipeline().maximumFilter(kernalSize, modes[mode], constantValue).run(cArray).getNumpyArray(),
+                                  NumCpp.Filters.maximumFilter(cArray, kernalSize, modes[mode], constantValue).getNumpyArray()),
+                   np.array_equal(NumCpp.FilterPipeline().minimumFilter(kernalSize, modes[mode], constantValue).run(cArray).getNumpyArray(),
+                                  NumCpp.Filters.minimumFilter(cArray, kernalSize, modes[mode], constantValue).getNumpyArray()),
+                   np.array_equal(NumCpp.FilterPipeline().rankFilter(kernalSize, 2, modes[mode], constantValue).run(cArray).getNumpyArray(),
+                                  NumCpp.Filters.rankFilter(cArray, kernalSize, 2, modes[mode], constantValue).getNumpyArray()),
+                   np.array_equal(NumCpp.FilterPipeline().percentileFilter(kernalSize, 30, modes[mode], constantValue).run(cArray).getNumpyArray(),
+                                  NumCpp.Filters.percentileFilter(cArray, kernalSize, 30, modes[mode], constantValue).getNumpyArray()),
+                   np.array_equal(np.round(NumCpp.FilterPipeline().gaussianFilter(1.5, modes[mode], constantValue).run(cArray).getNumpyArray(), 8),
+                                  np.round(NumCpp.Filters.gaussianFilter(cArray, 1.5, modes[mode], constantValue).getNumpyArray(), 8)),
+                   np.array_equal(np.round(NumCpp.FilterPipeline().uniformFilter(kernalSize, modes[mode], constantValue).run(cArray).getNumpyArray(), 8),
+                                  np.round(NumCpp.Filters.uniformFilter(cArray, kernalSize, modes[mode], constantValue).getNumpyArray(), 8)),
+                   np.array_equal(NumCpp.FilterPipeline().convolve(kernalSize, cWeights, modes[mode], constantValue).run(cArray).getNumpyArray(),
+                                  filters.convolve(data, weights, mode=mode, cval=constantValue))]
+        if all(results):
+            print(colored('\tPASS', 'green'))
+        else:
+            print(colored('\tFAIL', 'red'))
+
+        print(colored(f'Testing chained stages: mode = {mode}', 'cyan'))
+        threshold = np.random.randint(300, 700, [1,]).item()
+        pipeline = NumCpp.FilterPipeline()
+        pipeline.gaussianFilter(1.0, modes[mode], constantValue).complementaryMedianFilter(kernalSize, modes[mode], constantValue)
+        pipeline.maximumFilter(3, modes[mode], constantValue).threshold(threshold)
+        dataOutC = pipeline.run(cArray).getNumpyArray()
+        chained = NumCpp.Filters.gaussianFilter(cArray, 1.0, modes[mode], constantValue)
+        chained = NumCpp.Filters.complementaryMedianFilter(chained, kernalSize, modes[mode], constantValue)
+        chained = NumCpp.Filters.maximumFilter(chained, 3, modes[mode], constantValue)
+        dataOutChained = (chained.getNumpyArray() > threshold).astype(np.double)
+        if (pipeline.numStages() == 4 and np.array_equal(dataOutC, dataOutChained) and
+                np.array_equal(pipeline.runInPlace(cArray).getNumpyArray(), dataOutChained)):
+            print(colored('\tPASS', 'green'))
+        else:
+            print(colored('\tFAIL', 'red'))
+
+        print(colored(f'Testing uniform stage with NaN: mode = {mode}', 'cyan'))
+        data[np.random.randint(10, shape[0] - 10), np.random.randint(10, shape[1] - 10)] = np.nan
+        cArray.setArray(data)
+        pipeline = NumCpp.FilterPipeline()
+        pipeline.gaussianFilter(1.0, modes[mode], constantValue).uniformFilter(kernalSize, modes[mode], constantValue)
+        dataOutC = pipeline.run(cArray).getNumpyArray()
+        chained = NumCpp.Filters.gaussianFilter(cArray, 1.0, modes[mode], constantValue)
+        dataOutChained = NumCpp.Filters.uniformFilter(chained, kernalSize, modes[mode], constantValue).getNumpyArray()
+        finite = np.isfinite(dataOutChained)
+        if (np.array_equal(np.isnan(dataOutC), np.isnan(dataOutChained)) and
+                np.array_equal(np.round(dataOutC[finite], 8), np.round(dataOutChained[finite], 8))):
+            print(colored('\tPASS', 'green'))
+        else:
+            print(colored('\tFAIL', 'red'))
+
+####################################################################################
+if __name__ == '__main__':
+    doTest()
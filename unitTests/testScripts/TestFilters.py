@@ -5,6 +5,28 @@ import sys
 sys.path.append(r'../build/x64/Release')
 import NumCpp
 
+####################################################################################
+def impulseResponseWidth(response):
+    # standard deviation from the second moment, and the peak, of a normalized impulse response
+    response = response / response.sum()
+    positions = np.arange(response.size)
+    mean = np.sum(positions * response)
+    return np.sqrt(np.sum((positions - mean) ** 2 * response)), response.max()
+
+####################################################################################
+def windowMean(data, size):
+    # mean of every size wide window with a 'nearest' boundary, one window at a time
+    padded = np.pad(data, size // 2, mode='edge')
+    windows = np.lib.stride_tricks.sliding_window_view(padded, [size,] * data.ndim)
+    return windows.mean(axis=tuple(range(data.ndim, 2 * data.ndim)))
+
+####################################################################################
+def uniformOutliersOk(dataOutC, dataOutPy):
+    # non-finite values only reach the windows that hold them, the rest match the window means
+    finite = np.isfinite(dataOutPy)
+    return (np.array_equal(np.isnan(dataOutC), np.isnan(dataOutPy)) and
+            np.allclose(dataOutC[finite], dataOutPy[finite]))
+
 ####################################################################################
 def doTest():
     print(colored('Testing Filters', 'magenta'))
@@ -57,6 +79,26 @@ def test1D():
         else:
             print(colored('\tFAIL', 'red'))
 
+        print(colored(f'Testing convolve1dFFT: mode = {mode}', 'cyan'))
+        size = np.random.randint(1000, 2000, [1,]).item()
+        cShape = NumCpp.Shape(1, size)
+        cArray = NumCpp.NdArray(cShape)
+        data = np.random.randint(100, 1000, [size,]).astype(np.double)
+        cArray.setArray(data)
+        kernalSize = 0
+        while kernalSize % 2 == 0:
+            kernalSize = np.random.randint(81, 201)
+        weights = np.random.randint(1, 5, [kernalSize,])
+        cWeights = NumCpp.NdArray(1, kernalSize)
+        cWeights.setArray(weights)
+        constantValue = np.random.randint(0, 5, [1,]).item() # only actaully needed for constant boundary condition
+        dataOutC = NumCpp.Filters.convolve1dFFT(cArray, cWeights, modes[mode], constantValue).getNumpyArray().flatten()
+        dataOutPy = filters.convolve(data, weights, mode=mode, cval=constantValue)
+        if np.array_equal(np.round(dataOutC, 8), np.round(dataOutPy, 8)):
+            print(colored('\tPASS', 'green'))
+        else:
+            print(colored('\tFAIL', 'red'))
+
         print(colored(f'Testing gaussianFilter1d: mode = {mode}', 'cyan'))
         size = np.random.randint(1000, 2000, [1,]).item()
         cShape = NumCpp.Shape(1, size)
@@ -75,6 +117,20 @@ def test1D():
         else:
             print(colored('\tFAIL', 'red'))
 
+        print(colored(f'Testing gaussianFilter1dRecursive: mode = {mode}', 'cyan'))
+        sigma = np.random.randint(5, 100, [1,]).item()
+        impulse = np.zeros([16 * sigma + 1,])
+        impulse[8 * sigma] = 1
+        cImpulse = NumCpp.NdArray(1, impulse.size)
+        cImpulse.setArray(impulse)
+        response = NumCpp.Filters.gaussianFilter1dRecursive(cImpulse, sigma, modes[mode], 0).getNumpyArray().flatten()
+        responseSigma, responsePeak = impulseResponseWidth(response)
+        if (abs(responseSigma / sigma - 1) < 0.01 and
+                abs(responsePeak * np.sqrt(2 * np.pi) * sigma - 1) < 0.015):
+            print(colored('\tPASS', 'green'))
+        else:
+            print(colored('\tFAIL', 'red'))
+
         print(colored(f'Testing maximumFilter1d: mode = {mode}', 'cyan'))
         size = np.random.randint(1000, 2000, [1,]).item()
         cShape = NumCpp.Shape(1, size)
@@ -179,6 +235,38 @@ def test1D():
         else:
             print(colored('\tFAIL', 'red'))
 
+        print(colored(f'Testing uniformFilter1d in place: mode = {mode}', 'cyan'))
+        dataOutC = NumCpp.Filters.uniformFilter1dInPlace(cArray, kernalSize, modes[mode], constantValue).getNumpyArray().flatten()
+        if np.array_equal(dataOutC, dataOutPy):
+            print(colored('\tPASS', 'green'))
+        else:
+            print(colored('\tFAIL', 'red'))
+
+        print(colored(f'Testing uniformFilter1dRecursive: mode = {mode}', 'cyan'))
+        dataOutC = NumCpp.Filters.uniformFilter1dRecursive(cArray, kernalSize, modes[mode], constantValue).getNumpyArray().flatten()
+        if np.array_equal(np.round(dataOutC, 8), np.round(dataOutPy, 8)):
+            print(colored('\tPASS', 'green'))
+        else:
+            print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing uniformFilter1d: large values and NaN', 'cyan'))
+    size = np.random.randint(1000, 2000, [1,]).item()
+    data = np.random.rand(size)
+    data[np.random.randint(20, size // 2)] = 1e17
+    data[np.random.randint(size // 2, size - 20)] = np.nan
+    cArray = NumCpp.NdArray(1, size)
+    cArray.setArray(data)
+    kernalSize = 0
+    while kernalSize % 2 == 0:
+        kernalSize = np.random.randint(5, 15)
+    dataOutPy = windowMean(data, kernalSize)
+    dataOutDirect = NumCpp.Filters.uniformFilter1d(cArray, kernalSize, NumCpp.Mode.NEAREST, 0).getNumpyArray().flatten()
+    dataOutRecursive = NumCpp.Filters.uniformFilter1dRecursive(cArray, kernalSize, NumCpp.Mode.NEAREST, 0).getNumpyArray().flatten()
+    if uniformOutliersOk(dataOutDirect, dataOutPy) and uniformOutliersOk(dataOutRecursive, dataOutPy):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
 ####################################################################################
 def test2D():
     modes = {'reflect' : NumCpp.Mode.REFLECT,
@@ -225,6 +313,26 @@ def test2D():
         else:
             print(colored('\tFAIL', 'red'))
 
+        print(colored(f'Testing convolveFFT: mode = {mode}', 'cyan'))
+        shape = np.random.randint(500, 1000, [2,]).tolist()
+        cShape = NumCpp.Shape(shape[0], shape[1])
+        cArray = NumCpp.NdArray(cShape)
+        data = np.random.randint(10, 20, shape).astype(np.double)
+        cArray.setArray(data)
+        kernalSize = 0
+        while kernalSize % 2 == 0:
+            kernalSize = np.random.randint(15, 41)
+        constantValue = np.random.randint(0, 5, [1,]).item() # only actaully needed for constant boundary condition
+        weights = np.random.randint(-2, 3, [kernalSize, kernalSize]).astype(np.double)
+        cWeights = NumCpp.NdArray(kernalSize)
+        cWeights.setArray(weights)
+        dataOutC = NumCpp.Filters.convolveFFT(cArray, kernalSize, cWeights, modes[mode], constantValue).getNumpyArray()
+        dataOutPy = filters.convolve(data, weights, mode=mode, cval=constantValue)
+        if np.array_equal(np.round(dataOutC, 8), np.round(dataOutPy, 8)):
+            print(colored('\tPASS', 'green'))
+        else:
+            print(colored('\tFAIL', 'red'))
+
         print(colored(f'Testing gaussianFilter: mode = {mode}', 'cyan'))
         shape = np.random.randint(1000, 2000, [2,]).tolist()
         cShape = NumCpp.Shape(shape[0], shape[1])
@@ -240,6 +348,23 @@ def test2D():
         else:
             print(colored('\tFAIL', 'red'))
 
+        print(colored(f'Testing gaussianFilterRecursive: mode = {mode}', 'cyan'))
+        sigma = np.random.randint(5, 50, [1,]).item()
+        impulse = np.zeros([16 * sigma + 1, 16 * sigma + 3])
+        impulse[8 * sigma, 8 * sigma + 1] = 1
+        cImpulse = NumCpp.NdArray(NumCpp.Shape(impulse.shape[0], impulse.shape[1]))
+        cImpulse.setArray(impulse)
+        response = NumCpp.Filters.gaussianFilterRecursive(cImpulse, sigma, modes[mode], 0).getNumpyArray()
+        # the filter is separable, so the row and column sums are the 1d responses
+        rowSigma, rowPeak = impulseResponseWidth(response.sum(axis=0))
+        colSigma, colPeak = impulseResponseWidth(response.sum(axis=1))
+        if (abs(rowSigma / sigma - 1) < 0.01 and abs(colSigma / sigma - 1) < 0.01 and
+                abs(rowPeak * np.sqrt(2 * np.pi) * sigma - 1) < 0.015 and
+                abs(colPeak * np.sqrt(2 * np.pi) * sigma - 1) < 0.015):
+            print(colored('\tPASS', 'green'))
+        else:
+            print(colored('\tFAIL', 'red'))
+
         print(colored(f'Testing maximumFilter: mode = {mode}', 'cyan'))
         shape = np.random.randint(1000, 2000, [2,]).tolist()
         cShape = NumCpp.Shape(shape[0], shape[1])
@@ -274,6 +399,13 @@ def test2D():
         else:
             print(colored('\tFAIL', 'red'))
 
+        print(colored(f'Testing medianFilter in place: mode = {mode}', 'cyan'))
+        dataOutC = NumCpp.Filters.medianFilterInPlace(cArray, kernalSize, modes[mode], constantValue).getNumpyArray()
+        if np.array_equal(dataOutC, dataOutPy):
+            print(colored('\tPASS', 'green'))
+        else:
+            print(colored('\tFAIL', 'red'))
+
         print(colored(f'Testing minimumFilter: mode = {mode}', 'cyan'))
         shape = np.random.randint(1000, 2000, [2,]).tolist()
         cShape = NumCpp.Shape(shape[0], shape[1])
@@ -344,6 +476,67 @@ def test2D():
         else:
             print(colored('\tFAIL', 'red'))
 
+        print(colored(f'Testing uniformFilterRecursive: mode = {mode}', 'cyan'))
+        dataOutC = NumCpp.Filters.uniformFilterRecursive(cArray, kernalSize, modes[mode], constantValue).getNumpyArray()
+        if np.array_equal(np.round(dataOutC, 8), np.round(dataOutPy, 8)):
+            print(colored('\tPASS', 'green'))
+        else:
+            print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing convolve: NaN', 'cyan'))
+    data = np.random.rand(20, 20)
+    data[np.random.randint(6, 14), np.random.randint(6, 14)] = np.nan
+    cArray = NumCpp.NdArray(NumCpp.Shape(20, 20))
+    cArray.setArray(data)
+    weights = np.random.rand(13, 13)
+    cWeights = NumCpp.NdArray(13)
+    cWeights.setArray(weights)
+    dataOutPy = filters.convolve(data, weights, mode='reflect')
+    dataOutDefault = NumCpp.Filters.convolve(cArray, 13, cWeights, NumCpp.Mode.REFLECT, 0).getNumpyArray()
+    dataOutAuto = NumCpp.Filters.convolveAuto(cArray, 13, cWeights, NumCpp.Mode.REFLECT, 0).getNumpyArray()
+    if (np.array_equal(np.isnan(dataOutDefault), np.isnan(dataOutPy)) and
+            np.array_equal(np.isnan(dataOutAuto), np.isnan(dataOutPy)) and
+            np.count_nonzero(np.isnan(dataOutPy)) < data.size):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing uniformFilter: large values and NaN', 'cyan'))
+    shape = np.random.randint(50, 100, [2,]).tolist()
+    data = np.random.rand(shape[0], shape[1])
+    data[np.random.randint(10, shape[0] // 2), np.random.randint(10, shape[1] - 10)] = 1e17
+    data[np.random.randint(shape[0] // 2, shape[0] - 10), np.random.randint(10, shape[1] - 10)] = np.nan
+    cArray = NumCpp.NdArray(NumCpp.Shape(shape[0], shape[1]))
+    cArray.setArray(data)
+    kernalSize = 0
+    while kernalSize % 2 == 0:
+        kernalSize = np.random.randint(3, 9)
+    dataOutPy = windowMean(data, kernalSize)
+    dataOutDirect = NumCpp.Filters.uniformFilter(cArray, kernalSize, NumCpp.Mode.NEAREST, 0).getNumpyArray()
+    dataOutRecursive = NumCpp.Filters.uniformFilterRecursive(cArray, kernalSize, NumCpp.Mode.NEAREST, 0).getNumpyArray()
+    if uniformOutliersOk(dataOutDirect, dataOutPy) and uniformOutliersOk(dataOutRecursive, dataOutPy):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing Filters thread count', 'cyan'))
+    shape = np.random.randint(1000, 2000, [2,]).tolist()
+    cShape = NumCpp.Shape(shape[0], shape[1])
+    cArray = NumCpp.NdArray(cShape)
+    data = np.random.randint(100, 1000, shape).astype(np.double)
+    cArray.setArray(data)
+    NumCpp.TileExecutor.setNumThreads(1)
+    serialMedian = NumCpp.Filters.medianFilter(cArray, 5, NumCpp.Mode.REFLECT, 0).getNumpyArray()
+    serialUniform = NumCpp.Filters.uniformFilter(cArray, 5, NumCpp.Mode.REFLECT, 0).getNumpyArray()
+    NumCpp.TileExecutor.setNumThreads(0)
+    parallelMedian = NumCpp.Filters.medianFilter(cArray, 5, NumCpp.Mode.REFLECT, 0).getNumpyArray()
+    parallelUniform = NumCpp.Filters.uniformFilter(cArray, 5, NumCpp.Mode.REFLECT, 0).getNumpyArray()
+    if (NumCpp.TileExecutor.numThreads() >= 1 and
+            np.array_equal(serialMedian, parallelMedian) and np.array_equal(serialUniform, parallelUniform)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
 ####################################################################################
 if __name__ == '__main__':
     # test1D()
@@ -0,0 +1,90 @@
+import numpy as np
+from termcolor import colored
+import sys
+sys.path.append(r'../build/x64/Release')
+import NumCpp
+
+####################################################################################
+def doTest():
+    print(colored('Testing Generator Module', 'magenta'))
+
+    print(colored('Testing arange', 'cyan'))
+    start = np.random.randn(1).item()
+    stop = start + np.random.randint(10, 100, [1, ]).item()
+    step = np.abs(np.random.randn(1).item())
+    generator = NumCpp.Generator.arange(start, stop, step)
+    if np.allclose(generator.toNdArray().flatten(), np.arange(start, stop, step)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing linspace', 'cyan'))
+    num = np.random.randint(10, 100, [1, ]).item()
+    generator = NumCpp.Generator.linspace(start, stop, num, True)
+    if (generator.size() == num and
+            np.allclose(generator.toNdArray().flatten(), np.linspace(start, stop, num, endpoint=True))):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing linspace no endPoint', 'cyan'))
+    generator = NumCpp.Generator.linspace(start, stop, num, False)
+    if np.allclose(generator.toNdArray().flatten(), np.linspace(start, stop, num, endpoint=False)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing eye', 'cyan'))
+    shapeInput = np.random.randint(10, 100, [2, ])
+    numRows = shapeInput[0].item()
+    numCols = shapeInput[1].item()
+    k = np.random.randint(-5, 5, [1, ]).item()
+    generator = NumCpp.Generator.eye(numRows, numCols, k)
+    if np.array_equal(generator.toNdArray(), np.eye(numRows, numCols, k)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing identity', 'cyan'))
+    if np.array_equal(NumCpp.Generator.identity(numRows).toNdArray(), np.identity(numRows)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing tri', 'cyan'))
+    generator = NumCpp.Generator.tri(numRows, numCols, k)
+    if np.array_equal(generator.toNdArray(), np.tri(numRows, numCols, k)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing element-wise operators', 'cyan'))
+    shape = NumCpp.Shape(numRows, numCols)
+    cArray = NumCpp.NdArray(shape)
+    data = np.random.randn(numRows, numCols) + 10
+    cArray.setArray(data)
+    generator = NumCpp.Generator.tri(numRows, numCols, k)
+    npTri = np.tri(numRows, numCols, k)
+    if (np.array_equal(generator.add(cArray), data + npTri) and
+            np.array_equal(generator.subtract(cArray), data - npTri) and
+            np.array_equal(generator.multiply(cArray), data * npTri)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing linspace multiply/divide', 'cyan'))
+    rowShape = NumCpp.Shape(1, num)
+    cArray = NumCpp.NdArray(rowShape)
+    data = np.random.randn(1, num) + 10
+    cArray.setArray(data)
+    generator = NumCpp.Generator.linspace(1, 2, num, True)
+    npLinspace = np.linspace(1, 2, num, endpoint=True)
+    if (np.allclose(generator.multiply(cArray), data * npLinspace) and
+            np.allclose(generator.divide(cArray), data / npLinspace)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+####################################################################################
+if __name__ == '__main__':
+    doTest()
@@ -44,7 +44,7 @@ def doTest():
     print(f'Actual Rate(Threshold) = {np.count_nonzero(scene > threshold) / scene.size}')
     print(f'Actual Rate(Threshold - 1) = {np.count_nonzero(scene > threshold - 1) / scene.size}')
 
-    centroids = list(NumCpp.ImageProcessing.generateCentroids(cScene, thresholdRate, 'pre', borderWidth))
+    centroids = list(NumCpp.ImageProcessing.generateCentroids(cScene, thresholdRate, 'pre', borderWidth, False))
     print(f'Window Pre Number of Centroids (Border = {borderWidth}) = {len(centroids)}')
 
     # plt the results
@@ -77,7 +77,7 @@ def doTest():
     plt.ylabel('EOD (%)')
     plt.show()
 
-    centroids = list(NumCpp.ImageProcessing.generateCentroids(cScene, thresholdRate, 'post', borderWidth))
+    centroids = list(NumCpp.ImageProcessing.generateCentroids(cScene, thresholdRate, 'post', borderWidth, False))
     print(f'Window Post Number of Centroids (Border = {borderWidth}) = {len(centroids)}')
 
     # plt the results
@@ -110,6 +110,57 @@ def doTest():
     plt.ylabel('EOD (%)')
     plt.show()
 
+    print(colored('Testing fused centroiding', 'cyan'))
+    cExceedances = NumCpp.ImageProcessing.applyThreshold(cScene, threshold)
+    clusterCentroids = list(NumCpp.ImageProcessing.centroidClusters(NumCpp.ImageProcessing.clusterPixels(cScene, cExceedances, 0, False)))
+    if (list(NumCpp.ImageProcessing.centroidExceedances(cScene, cExceedances, False)) == clusterCentroids and
+            list(NumCpp.ImageProcessing.centroidThreshold(cScene, threshold, True)) == clusterCentroids):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing cluster store', 'cyan'))
+    clusters = list(NumCpp.ImageProcessing.clusterPixels(cScene, cExceedances, borderWidth, False))
+    clusterStore = NumCpp.ImageProcessing.clusterStore(cScene, cExceedances, borderWidth, True)
+    if (clusterStore.size() == len(clusters) and
+            all(clusterStore.cluster(idx) == cluster for idx, cluster in enumerate(clusters)) and
+            all(clusterStore.contains(idx, cluster[0].row(), cluster[0].col()) for idx, cluster in enumerate(clusters)) and
+            list(NumCpp.ImageProcessing.centroidClusterStore(clusterStore, False)) ==
+            list(NumCpp.ImageProcessing.centroidClusters(NumCpp.ImageProcessing.clusterPixels(cScene, cExceedances, borderWidth, False)))):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing cluster border', 'cyan'))
+    # grow the border one pixel at a time, in the original order, from the clusters without a border
+    testBorderWidth = 2
+    exceedances = scene > threshold
+    expectedClusters = list()
+    for cluster in NumCpp.ImageProcessing.clusterPixels(cScene, cExceedances, 0, False):
+        pixels = [(cluster[idx].row(), cluster[idx].col()) for idx in range(cluster.size())]
+        for step in range(testBorderWidth):
+            for row, col in pixels[:]:
+                for neighborRow in range(max(row - 1, 0), min(row + 2, imageSize)):
+                    for neighborCol in range(max(col - 1, 0), min(col + 2, imageSize)):
+                        if not exceedances[neighborRow, neighborCol] and (neighborRow, neighborCol) not in pixels:
+                            pixels.append((neighborRow, neighborCol))
+        expectedClusters.append(pixels)
+    borderClusters = list(NumCpp.ImageProcessing.clusterPixels(cScene, cExceedances, testBorderWidth, False))
+    if (len(borderClusters) == len(expectedClusters) and
+            all([(cluster[idx].row(), cluster[idx].col()) for idx in range(cluster.size())] == pixels
+                for cluster, pixels in zip(borderClusters, expectedClusters)) and
+            list(NumCpp.ImageProcessing.clusterPixels(cScene, cExceedances, testBorderWidth, True)) == borderClusters):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing parallel clustering', 'cyan'))
+    parallelCentroids = list(NumCpp.ImageProcessing.generateCentroids(cScene, thresholdRate, 'post', borderWidth, True))
+    if parallelCentroids == centroids:
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
     print(colored('\tPASS', 'green'))
 
 ####################################################################################
@@ -0,0 +1,87 @@
+import numpy as np
+from termcolor import colored
+import sys
+sys.path.append(r'../build/x64/Release')
+import NumCpp
+
+####################################################################################
+def doTest():
+    print(colored('Testing MaskedArray Module', 'magenta'))
+
+    shapeInput = np.random.randint(20, 100, [2, ])
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArray = NumCpp.NdArray(shape)
+    data = np.random.randn(shape.rows, shape.cols) * 100 + 1000
+    cArray.setArray(data)
+    cMask = NumCpp.NdArray(shape)
+    mask = np.random.randint(0, 2, [shape.rows, shape.cols]).astype(np.double)
+    mask[:, 0] = 1
+    cMask.setArray(mask)
+    maskedArray = NumCpp.MaskedArray(cArray, cMask)
+    npMaskedArray = np.ma.MaskedArray(data, mask=mask.astype(np.bool))
+
+    print(colored('Testing mask', 'cyan'))
+    if np.array_equal(maskedArray.mask(), mask.astype(np.bool)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing filled', 'cyan'))
+    if np.array_equal(maskedArray.filled(-1.0), npMaskedArray.filled(-1.0)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing isValid/setValid', 'cyan'))
+    maskedArray.setValid(0, True)
+    isValid = maskedArray.isValid(0)
+    maskedArray.setValid(0, False)
+    if isValid and not maskedArray.isValid(0):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing reductions: Axis = None', 'cyan'))
+    if (maskedArray.count(NumCpp.Axis.NONE).item() == npMaskedArray.count() and
+            np.round(maskedArray.sum(NumCpp.Axis.NONE).item(), 8) == np.round(npMaskedArray.sum(), 8) and
+            np.round(maskedArray.mean(NumCpp.Axis.NONE).item(), 8) == np.round(npMaskedArray.mean(), 8) and
+            np.round(maskedArray.std(NumCpp.Axis.NONE).item(), 8) == np.round(npMaskedArray.std(), 8) and
+            maskedArray.min(NumCpp.Axis.NONE).item() == npMaskedArray.min() and
+            maskedArray.max(NumCpp.Axis.NONE).item() == npMaskedArray.max()):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing reductions: Axis = Row', 'cyan'))
+    if (np.array_equal(maskedArray.count(NumCpp.Axis.ROW).flatten(), npMaskedArray.count(axis=0)) and
+            np.allclose(maskedArray.sum(NumCpp.Axis.ROW).flatten(), npMaskedArray.sum(axis=0).filled(0)) and
+            np.allclose(maskedArray.mean(NumCpp.Axis.ROW).flatten(), npMaskedArray.mean(axis=0).filled(np.nan), equal_nan=True) and
+            np.allclose(maskedArray.var(NumCpp.Axis.ROW).flatten(), npMaskedArray.var(axis=0).filled(np.nan), equal_nan=True) and
+            np.allclose(maskedArray.max(NumCpp.Axis.ROW).flatten(), npMaskedArray.max(axis=0).filled(np.nan), equal_nan=True)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing reductions: Axis = Column', 'cyan'))
+    if (np.array_equal(maskedArray.count(NumCpp.Axis.COL).flatten(), npMaskedArray.count(axis=1)) and
+            np.allclose(maskedArray.sum(NumCpp.Axis.COL).flatten(), npMaskedArray.sum(axis=1).filled(0)) and
+            np.allclose(maskedArray.mean(NumCpp.Axis.COL).flatten(), npMaskedArray.mean(axis=1).filled(np.nan), equal_nan=True) and
+            np.allclose(maskedArray.std(NumCpp.Axis.COL).flatten(), npMaskedArray.std(axis=1).filled(np.nan), equal_nan=True) and
+            np.allclose(maskedArray.min(NumCpp.Axis.COL).flatten(), npMaskedArray.min(axis=1).filled(np.nan), equal_nan=True)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing maskedInvalid', 'cyan'))
+    data[data > 1100] = np.nan
+    cArray.setArray(data)
+    maskedArray = NumCpp.MaskedArray.maskedInvalid(cArray)
+    if (np.array_equal(maskedArray.mask(), np.isnan(data)) and
+            np.allclose(maskedArray.mean(NumCpp.Axis.ROW).flatten(), np.nanmean(data, axis=0), equal_nan=True)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+####################################################################################
+if __name__ == '__main__':
+    doTest()
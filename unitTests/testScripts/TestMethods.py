@@ -372,6 +372,21 @@ def doTest():
     else:
         print(colored('\tFAIL', 'red'))
 
+    print(colored('Testing arctan2 array float', 'cyan'))
+    shapeInput = np.random.randint(20, 100, [2, ])
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArrayX = NumCpp.NdArray(shape)
+    cArrayY = NumCpp.NdArray(shape)
+    xy = NumCpp.Random.uniformOnSphere(np.prod(shapeInput).item(), 2).getNumpyArray()
+    xData = xy[:, 0].reshape(shapeInput).astype(np.float32)
+    yData = xy[:, 1].reshape(shapeInput).astype(np.float32)
+    cArrayX.setArray(xData)
+    cArrayY.setArray(yData)
+    if np.allclose(NumCpp.MethodsDouble.arctan2ArrayFloat(cArrayY, cArrayX), np.arctan2(yData, xData), rtol=1e-6, atol=1e-7):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
     print(colored('Testing arctanh scalar', 'cyan'))
     value = np.abs(np.random.rand(1).item())
     if np.round(NumCpp.MethodsDouble.arctanhScalar(value), 10) == np.round(np.arctanh(value), 10):
@@ -572,6 +587,29 @@ def doTest():
     else:
         print(colored('\tFAIL', 'red'))
 
+    print(colored('Testing astype: round and saturate', 'cyan'))
+    shapeInput = np.random.randint(20, 100, [2, ])
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArray = NumCpp.NdArray(shape)
+    data = np.random.randn(shape.rows, shape.cols) * 50000 + 30000
+    cArray.setArray(data)
+    truth = np.clip(np.rint(data), 0, np.iinfo(np.uint16).max).astype(np.uint16)
+    if np.array_equal(NumCpp.MethodsDouble.astypeUint16(cArray, NumCpp.Rounding.NEAREST, True), truth):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing astype: saturate float with inf and nan', 'cyan'))
+    shape = NumCpp.Shape(1, 6)
+    cArray = NumCpp.NdArray(shape)
+    data = np.array([[np.inf, -np.inf, np.nan, 1e300, -1e300, 1.5]])
+    cArray.setArray(data)
+    truth = np.array([[np.inf, -np.inf, np.nan, np.finfo(np.float32).max, -np.finfo(np.float32).max, 1.5]], dtype=np.float32)
+    if np.array_equal(NumCpp.MethodsDouble.astypeFloat(cArray, NumCpp.Rounding.NEAREST, True), truth, equal_nan=True):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
     print(colored('Testing average: Axis = None', 'cyan'))
     shapeInput = np.random.randint(20, 100, [2, ])
     shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
@@ -796,6 +834,12 @@ def doTest():
     else:
         print(colored('\tFAIL', 'red'))
 
+    print(colored('Testing clip array in place', 'cyan'))
+    if np.array_equal(NumCpp.MethodsDouble.clipArrayInPlace(cArray, minValue, maxValue), np.clip(data, minValue, maxValue)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
     print(colored('Testing column_stack', 'cyan'))
     shapeInput = np.random.randint(20, 100, [2, ])
     shape1 = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
@@ -892,6 +936,31 @@ def doTest():
     else:
         print(colored('\tFAIL', 'red'))
 
+    print(colored('Testing concatenate_into: Axis = Row', 'cyan'))
+    shapeInput = np.random.randint(20, 100, [2, ])
+    shape1 = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    shape2 = NumCpp.Shape(shapeInput[0].item() + np.random.randint(1, 10, [1,]).item(), shapeInput[1].item())
+    shape3 = NumCpp.Shape(shapeInput[0].item() + np.random.randint(1, 10, [1,]).item(), shapeInput[1].item())
+    shape4 = NumCpp.Shape(shapeInput[0].item() + np.random.randint(1, 10, [1,]).item(), shapeInput[1].item())
+    cArray1 = NumCpp.NdArray(shape1)
+    cArray2 = NumCpp.NdArray(shape2)
+    cArray3 = NumCpp.NdArray(shape3)
+    cArray4 = NumCpp.NdArray(shape4)
+    data1 = np.random.randint(1, 100, [shape1.rows, shape1.cols])
+    data2 = np.random.randint(1, 100, [shape2.rows, shape2.cols])
+    data3 = np.random.randint(1, 100, [shape3.rows, shape3.cols])
+    data4 = np.random.randint(1, 100, [shape4.rows, shape4.cols])
+    cArray1.setArray(data1)
+    cArray2.setArray(data2)
+    cArray3.setArray(data3)
+    cArray4.setArray(data4)
+    cArrayOut = NumCpp.NdArray(NumCpp.Shape(shape1.rows + shape2.rows + shape3.rows + shape4.rows, shape1.cols))
+    if np.array_equal(NumCpp.MethodsDouble.concatenate_into(cArray1, cArray2, cArray3, cArray4, cArrayOut, NumCpp.Axis.ROW),
+                      np.concatenate([data1, data2, data3, data4], axis=0)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
     print(colored('Testing contains: Axis = None', 'cyan'))
     shapeInput = np.random.randint(20, 100, [2, ])
     shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
@@ -1195,6 +1264,23 @@ def doTest():
     else:
         print(colored('\tFAIL', 'red'))
 
+    print(colored('Testing cumsum: blocked scan', 'cyan'))
+    shape = NumCpp.Shape(3, 200000)
+    cArray = NumCpp.NdArray(shape)
+    data = np.random.randint(1, 50, [shape.rows, shape.cols], dtype=np.uint32)
+    cArray.setArray(data)
+    NumCpp.TileExecutor.setNumThreads(1)
+    dataOutSerial = [NumCpp.MethodsDouble.cumsum(cArray, axis) for axis in [NumCpp.Axis.NONE, NumCpp.Axis.COL]]
+    NumCpp.TileExecutor.setNumThreads(4)
+    dataOutThreaded = [NumCpp.MethodsDouble.cumsum(cArray, axis) for axis in [NumCpp.Axis.NONE, NumCpp.Axis.COL]]
+    NumCpp.TileExecutor.setNumThreads(0)
+    if (np.array_equal(dataOutThreaded[0].flatten(), data.cumsum()) and
+            np.array_equal(dataOutThreaded[1], data.cumsum(axis=1)) and
+            all(np.array_equal(serial, threaded) for serial, threaded in zip(dataOutSerial, dataOutThreaded))):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
     print(colored('Testing deg2rad scalar', 'cyan'))
     value = np.abs(np.random.rand(1).item()) * 360
     if np.round(NumCpp.MethodsDouble.deg2radScalar(value), 10) == np.round(np.deg2rad(value), 10):
@@ -1288,6 +1374,78 @@ def doTest():
     else:
         print(colored('\tFAIL', 'red'))
 
+    print(colored('Testing describe: Axis = None', 'cyan'))
+    shapeInput = np.random.randint(20, 100, [2, ])
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArray = NumCpp.NdArray(shape)
+    data = np.random.randn(shape.rows, shape.cols) * 100 + 1000
+    cArray.setArray(data)
+    count, minValue, maxValue, sumValue, meanValue, stdValue, nonzero, argmin, argmax = NumCpp.MethodsDouble.describe(cArray, NumCpp.Axis.NONE, False)
+    if (np.array_equal(minValue.flatten(), np.min(data, axis=None).flatten()) and
+            np.array_equal(maxValue.flatten(), np.max(data, axis=None).flatten()) and
+            np.allclose(sumValue.flatten(), np.sum(data, axis=None).flatten()) and
+            np.allclose(meanValue.flatten(), np.mean(data, axis=None).flatten()) and
+            np.allclose(stdValue.flatten(), np.std(data, axis=None).flatten()) and
+            np.array_equal(nonzero.flatten(), np.count_nonzero(data, axis=None).flatten()) and
+            np.array_equal(argmin.flatten(), np.argmin(data, axis=None).flatten()) and
+            np.array_equal(argmax.flatten(), np.argmax(data, axis=None).flatten())):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing describe: Axis = Row', 'cyan'))
+    shapeInput = np.random.randint(20, 100, [2, ])
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArray = NumCpp.NdArray(shape)
+    data = np.random.randn(shape.rows, shape.cols) * 100 + 1000
+    cArray.setArray(data)
+    count, minValue, maxValue, sumValue, meanValue, stdValue, nonzero, argmin, argmax = NumCpp.MethodsDouble.describe(cArray, NumCpp.Axis.ROW, False)
+    if (np.array_equal(minValue.flatten(), np.min(data, axis=0).flatten()) and
+            np.array_equal(maxValue.flatten(), np.max(data, axis=0).flatten()) and
+            np.allclose(sumValue.flatten(), np.sum(data, axis=0).flatten()) and
+            np.allclose(meanValue.flatten(), np.mean(data, axis=0).flatten()) and
+            np.allclose(stdValue.flatten(), np.std(data, axis=0).flatten()) and
+            np.array_equal(nonzero.flatten(), np.count_nonzero(data, axis=0).flatten()) and
+            np.array_equal(argmin.flatten(), np.argmin(data, axis=0).flatten()) and
+            np.array_equal(argmax.flatten(), np.argmax(data, axis=0).flatten())):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing describe: Axis = Column', 'cyan'))
+    shapeInput = np.random.randint(20, 100, [2, ])
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArray = NumCpp.NdArray(shape)
+    data = np.random.randn(shape.rows, shape.cols) * 100 + 1000
+    cArray.setArray(data)
+    count, minValue, maxValue, sumValue, meanValue, stdValue, nonzero, argmin, argmax = NumCpp.MethodsDouble.describe(cArray, NumCpp.Axis.COL, False)
+    if (np.array_equal(minValue.flatten(), np.min(data, axis=1).flatten()) and
+            np.array_equal(maxValue.flatten(), np.max(data, axis=1).flatten()) and
+            np.allclose(sumValue.flatten(), np.sum(data, axis=1).flatten()) and
+            np.allclose(meanValue.flatten(), np.mean(data, axis=1).flatten()) and
+            np.allclose(stdValue.flatten(), np.std(data, axis=1).flatten()) and
+            np.array_equal(nonzero.flatten(), np.count_nonzero(data, axis=1).flatten()) and
+            np.array_equal(argmin.flatten(), np.argmin(data, axis=1).flatten()) and
+            np.array_equal(argmax.flatten(), np.argmax(data, axis=1).flatten())):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing describe: ignore NaN', 'cyan'))
+    shapeInput = np.random.randint(20, 100, [2, ])
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArray = NumCpp.NdArray(shape)
+    data = np.random.randn(shape.rows, shape.cols) * 100 + 1000
+    data[data > 1100] = np.nan
+    cArray.setArray(data)
+    count, minValue, maxValue, sumValue, meanValue, stdValue, nonzero, argmin, argmax = NumCpp.MethodsDouble.describe(cArray, NumCpp.Axis.ROW, True)
+    if (np.array_equal(count.flatten(), np.count_nonzero(~np.isnan(data), axis=0)) and
+            np.allclose(meanValue.flatten(), np.nanmean(data, axis=0), equal_nan=True) and
+            np.allclose(stdValue.flatten(), np.nanstd(data, axis=0), equal_nan=True)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
     print(colored('Testing diagflat array', 'cyan'))
     numElements = np.random.randint(1, 25, [1, ]).item()
     shape = NumCpp.Shape(1, numElements)
@@ -1495,6 +1653,28 @@ def doTest():
     else:
         print(colored('\tFAIL', 'red'))
 
+    print(colored('Testing exp array float', 'cyan'))
+    shapeInput = np.random.randint(20, 100, [2, ])
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArray = NumCpp.NdArray(shape)
+    data = (np.random.randn(shape.rows, shape.cols) * 20).astype(np.float32)
+    cArray.setArray(data)
+    if np.allclose(NumCpp.MethodsDouble.expArrayFloat(cArray), np.exp(data), rtol=1e-6, atol=0):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing exp array in place', 'cyan'))
+    shapeInput = np.random.randint(20, 100, [2, ])
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArray = NumCpp.NdArray(shape)
+    data = np.random.rand(shape.rows, shape.cols)
+    cArray.setArray(data)
+    if np.array_equal(np.round(NumCpp.MethodsDouble.expArrayInPlace(cArray), 10), np.round(np.exp(data), 10)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
     print(colored('Testing exp2 scalar', 'cyan'))
     value = np.abs(np.random.rand(1).item())
     if np.round(NumCpp.MethodsDouble.exp2Scalar(value), 10) == np.round(np.exp2(value), 10):
@@ -2086,6 +2266,17 @@ def doTest():
     else:
         print(colored('\tFAIL', 'red'))
 
+    print(colored('Testing log array float', 'cyan'))
+    shapeInput = np.random.randint(20, 100, [2, ])
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArray = NumCpp.NdArray(shape)
+    data = (np.random.rand(shape.rows, shape.cols) * 1000).astype(np.float32)
+    cArray.setArray(data)
+    if np.allclose(NumCpp.MethodsDouble.logArrayFloat(cArray), np.log(data), rtol=1e-6, atol=1e-7):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
     print(colored('Testing log10 scalar', 'cyan'))
     value = np.random.randn(1).item() * 100 + 1000
     if np.round(NumCpp.MethodsDouble.log10Scalar(value), 10) == np.round(np.log10(value), 10):
@@ -2330,6 +2521,48 @@ def doTest():
     else:
         print(colored('\tFAIL', 'red'))
 
+    print(colored('Testing median out: axis = None', 'cyan'))
+    isEven = True
+    while isEven:
+        shapeInput = np.random.randint(20, 100, [2, ])
+        isEven = shapeInput.prod().item() % 2 == 0
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArray = NumCpp.NdArray(shape)
+    data = np.random.randint(0, 100, [shape.rows, shape.cols])
+    cArray.setArray(data)
+    if np.array_equal(NumCpp.MethodsDouble.medianOut(cArray, NumCpp.Axis.NONE).flatten(), np.median(data, axis=None).flatten()):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing median out: axis = Row', 'cyan'))
+    isEven = True
+    while isEven:
+        shapeInput = np.random.randint(20, 100, [2, ])
+        isEven = shapeInput.prod().item() % 2 == 0
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArray = NumCpp.NdArray(shape)
+    data = np.random.randint(0, 100, [shape.rows, shape.cols])
+    cArray.setArray(data)
+    if np.array_equal(NumCpp.MethodsDouble.medianOut(cArray, NumCpp.Axis.ROW).flatten(), np.median(data, axis=0).flatten()):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing median out: axis = Col', 'cyan'))
+    isEven = True
+    while isEven:
+        shapeInput = np.random.randint(20, 100, [2, ])
+        isEven = shapeInput.prod().item() % 2 == 0
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArray = NumCpp.NdArray(shape)
+    data = np.random.randint(0, 100, [shape.rows, shape.cols])
+    cArray.setArray(data)
+    if np.array_equal(NumCpp.MethodsDouble.medianOut(cArray, NumCpp.Axis.COL).flatten(), np.median(data, axis=1).flatten()):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
     print(colored('Testing min: Axis = None', 'cyan'))
     shapeInput = np.random.randint(20, 100, [2, ])
     shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
@@ -2661,6 +2894,21 @@ def doTest():
     else:
         print(colored('\tFAIL', 'red'))
 
+    print(colored('Testing nanmean out: Axis = Row', 'cyan'))
+    shapeInput = np.random.randint(20, 100, [2, ])
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArray = NumCpp.NdArray(shape)
+    data = np.random.randint(0, 100, [shape.rows, shape.cols]).astype(np.double)
+    data = data.flatten()
+    data[np.random.randint(0, shape.size(), [shape.size() // 10, ])] = np.nan
+    data = data.reshape(shapeInput)
+    cArray.setArray(data)
+    if np.array_equal(np.round(NumCpp.MethodsDouble.nanmeanOut(cArray, NumCpp.Axis.ROW).flatten(), 10),
+                      np.round(np.nanmean(data, axis=0), 10)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
     print(colored('Testing nanmedian: axis = None', 'cyan'))
     isEven = True
     while isEven:
@@ -3244,6 +3492,17 @@ def doTest():
     else:
         print(colored('\tFAIL', 'red'))
 
+    print(colored('Testing negative array in place', 'cyan'))
+    shapeInput = np.random.randint(20, 100, [2, ])
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArray = NumCpp.NdArray(shape)
+    data = np.random.randint(-100, 100, [shape.rows, shape.cols])
+    cArray.setArray(data)
+    if np.array_equal(np.round(NumCpp.MethodsDouble.negativeArrayInPlace(cArray), 10), np.round(np.negative(data), 10)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
     print(colored('Testing nonzero', 'cyan'))
     shapeInput = np.random.randint(20, 100, [2, ])
     shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
@@ -4016,6 +4275,17 @@ def doTest():
     else:
         print(colored('\tFAIL', 'red'))
 
+    print(colored('Testing sin array float', 'cyan'))
+    shapeInput = np.random.randint(20, 100, [2, ])
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArray = NumCpp.NdArray(shape)
+    data = (np.random.randn(shape.rows, shape.cols) * 100).astype(np.float32)
+    cArray.setArray(data)
+    if np.allclose(NumCpp.MethodsDouble.sinArrayFloat(cArray), np.sin(data.astype(np.double)), rtol=1e-6, atol=1e-7):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
     print(colored('Testing sinc scalar', 'cyan'))
     value = np.random.randn(1).item()
     if np.round(NumCpp.MethodsDouble.sincScalar(value), 10) == np.round(np.sinc(value), 10):
@@ -4169,6 +4439,17 @@ def doTest():
     else:
         print(colored('\tFAIL', 'red'))
 
+    print(colored('Testing std out: Axis = Column', 'cyan'))
+    shapeInput = np.random.randint(20, 100, [2, ])
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArray = NumCpp.NdArray(shape)
+    data = np.random.randint(0, 100, [shape.rows, shape.cols]).astype(np.double)
+    cArray.setArray(data)
+    if np.array_equal(np.round(NumCpp.MethodsDouble.stdOut(cArray, NumCpp.Axis.COL).flatten(), 10), np.round(np.std(data, axis=1), 10)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
     print(colored('Testing sum: Axis = None', 'cyan'))
     shapeInput = np.random.randint(20, 100, [2, ])
     shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
@@ -4202,6 +4483,39 @@ def doTest():
     else:
         print(colored('\tFAIL', 'red'))
 
+    print(colored('Testing sum out: Axis = None', 'cyan'))
+    shapeInput = np.random.randint(20, 100, [2, ])
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArray = NumCpp.NdArray(shape)
+    data = np.random.randint(0, 100, [shape.rows, shape.cols]).astype(np.double)
+    cArray.setArray(data)
+    if np.array_equal(NumCpp.MethodsDouble.sumOut(cArray, NumCpp.Axis.NONE).flatten(), np.sum(data, axis=None).flatten()):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing sum out: Axis = Row', 'cyan'))
+    shapeInput = np.random.randint(20, 100, [2, ])
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArray = NumCpp.NdArray(shape)
+    data = np.random.randint(0, 100, [shape.rows, shape.cols]).astype(np.double)
+    cArray.setArray(data)
+    if np.array_equal(NumCpp.MethodsDouble.sumOut(cArray, NumCpp.Axis.ROW).flatten(), np.sum(data, axis=0).flatten()):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing sum out: Axis = Column', 'cyan'))
+    shapeInput = np.random.randint(20, 100, [2, ])
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArray = NumCpp.NdArray(shape)
+    data = np.random.randint(0, 100, [shape.rows, shape.cols]).astype(np.double)
+    cArray.setArray(data)
+    if np.array_equal(NumCpp.MethodsDouble.sumOut(cArray, NumCpp.Axis.COL).flatten(), np.sum(data, axis=1).flatten()):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
     print(colored('Testing swapaxes', 'cyan'))
     shapeInput = np.random.randint(20, 100, [2, ])
     shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
@@ -4639,6 +4953,23 @@ def doTest():
     else:
         print(colored('\tFAIL', 'red'))
 
+    print(colored('Testing where', 'cyan'))
+    shapeInput = np.random.randint(20, 100, [2, ])
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cArrayMask = NumCpp.NdArray(shape)
+    cArrayA = NumCpp.NdArray(shape)
+    cArrayB = NumCpp.NdArray(shape)
+    dataMask = np.random.randint(0, 2, [shape.rows, shape.cols])
+    dataA = np.random.randint(1, 100, [shape.rows, shape.cols])
+    dataB = np.random.randint(1, 100, [shape.rows, shape.cols])
+    cArrayMask.setArray(dataMask)
+    cArrayA.setArray(dataA)
+    cArrayB.setArray(dataB)
+    if np.array_equal(NumCpp.MethodsDouble.where(cArrayMask, cArrayA, cArrayB), np.where(dataMask.astype(np.bool), dataA, dataB)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
     print(colored('Testing zeros square', 'cyan'))
     shapeInput = np.random.randint(1, 100, [1, ]).item()
     cArray = NumCpp.MethodsDouble.zerosSquare(shapeInput)
@@ -0,0 +1,59 @@
+import numpy as np
+from termcolor import colored
+import scipy.ndimage as ndimage
+import sys
+sys.path.append(r'../build/x64/Release')
+import NumCpp
+
+####################################################################################
+def doTest():
+    print(colored('Testing Morphology', 'magenta'))
+
+    for radius in [0, 1, 2, 5, 40, 70]:
+        shapeInput = np.random.randint(20, 150, [2,])
+        shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+        cMask = NumCpp.NdArrayBool(shape)
+        data = np.random.rand(shape.rows, shape.cols) < np.random.rand()
+        cMask.setArray(data)
+        structure = np.ones([2 * radius + 1, 2 * radius + 1], dtype=bool)
+
+        print(colored(f'Testing dilate: radius = {radius}', 'cyan'))
+        if radius == 0:
+            dataOutPy = data
+        else:
+            dataOutPy = ndimage.binary_dilation(data, structure)
+        if np.array_equal(NumCpp.Morphology.dilate(cMask, radius).getNumpyArray(), dataOutPy):
+            print(colored('\tPASS', 'green'))
+        else:
+            print(colored('\tFAIL', 'red'))
+
+        print(colored(f'Testing erode: radius = {radius}', 'cyan'))
+        if radius == 0:
+            dataOutPy = data
+        else:
+            dataOutPy = ndimage.binary_erosion(data, structure)
+        if np.array_equal(NumCpp.Morphology.erode(cMask, radius).getNumpyArray(), dataOutPy):
+            print(colored('\tPASS', 'green'))
+        else:
+            print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing BitMask', 'cyan'))
+    shapeInput = np.random.randint(20, 150, [2,])
+    shape = NumCpp.Shape(shapeInput[0].item(), shapeInput[1].item())
+    cMask = NumCpp.NdArrayBool(shape)
+    data = np.random.rand(shape.rows, shape.cols) < 0.3
+    cMask.setArray(data)
+    bitMask = NumCpp.BitMask(cMask)
+    if (np.array_equal(bitMask.toNdArray().getNumpyArray(), data) and
+            bitMask.count() == np.count_nonzero(data) and
+            (~bitMask).count() == data.size - np.count_nonzero(data) and
+            not (bitMask & ~bitMask).any() and
+            (bitMask | ~bitMask).count() == data.size and
+            bitMask.dilate(3).erode(3) == NumCpp.BitMask(NumCpp.Morphology.erode(NumCpp.Morphology.dilate(cMask, 3), 3))):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+####################################################################################
+if __name__ == '__main__':
+    doTest()
@@ -0,0 +1,128 @@
+import numpy as np
+from termcolor import colored
+import sys
+sys.path.append(r'../build/x64/Release')
+import NumCpp
+
+####################################################################################
+def doTest():
+    print(colored('Testing RunningStatistics Module', 'magenta'))
+
+    shapeInput = np.random.randint(20, 100, [2, ])
+    numRows = shapeInput[0].item()
+    numCols = shapeInput[1].item()
+    data = np.random.randn(numRows, numCols) * 100 + 1000
+    half = numRows // 2
+    rowShape = NumCpp.Shape(1, numCols)
+
+    moments1 = NumCpp.RunningMoments()
+    moments2 = NumCpp.RunningMoments()
+    minMax1 = NumCpp.RunningMinMax()
+    minMax2 = NumCpp.RunningMinMax()
+    ema = NumCpp.ExponentialMovingAverage(0.25)
+    ema1 = NumCpp.ExponentialMovingAverage(0.25)
+    ema2 = NumCpp.ExponentialMovingAverage(0.25)
+    histogram1 = NumCpp.RunningHistogram(20, 700, 1300)
+    histogram2 = NumCpp.RunningHistogram(20, 700, 1300)
+    for row in range(numRows):
+        cArray = NumCpp.NdArray(rowShape)
+        cArray.setArray(data[row, :].reshape([1, numCols]))
+        if row < half:
+            moments1.push(cArray)
+            minMax1.push(cArray)
+            histogram1.push(cArray)
+            ema1.push(cArray)
+        else:
+            moments2.push(cArray)
+            minMax2.push(cArray)
+            histogram2.push(cArray)
+            ema2.push(cArray)
+        ema.push(cArray)
+
+    moments1.merge(moments2)
+    minMax1.merge(minMax2)
+    histogram1.merge(histogram2)
+    ema1.merge(ema2)
+
+    print(colored('Testing RunningMoments', 'cyan'))
+    if (moments1.count() == numRows and
+            np.allclose(moments1.mean().flatten(), np.mean(data, axis=0)) and
+            np.allclose(moments1.std(0).flatten(), np.std(data, axis=0)) and
+            np.allclose(moments1.var(1).flatten(), np.var(data, axis=0, ddof=1))):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing RunningMinMax', 'cyan'))
+    if (np.array_equal(minMax1.min().flatten(), np.min(data, axis=0)) and
+            np.array_equal(minMax1.max().flatten(), np.max(data, axis=0))):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing ExponentialMovingAverage', 'cyan'))
+    value = data[0, :].copy()
+    for row in range(1, numRows):
+        value += 0.25 * (data[row, :] - value)
+    if np.allclose(ema.value().flatten(), value):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing ExponentialMovingAverage merge', 'cyan'))
+    if ema1.count() == numRows and np.allclose(ema1.value().flatten(), value):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing RunningHistogram', 'cyan'))
+    inRange = data[np.logical_and(data >= 700, data <= 1300)]
+    counts, edges = histogram1.histogram()
+    npCounts, npEdges = np.histogram(inRange, bins=20, range=(700, 1300))
+    if (np.array_equal(counts.flatten(), npCounts) and np.allclose(edges.flatten(), npEdges) and
+            histogram1.numUnderflow() == np.count_nonzero(data < 700) and
+            histogram1.numOverflow() == np.count_nonzero(data > 1300)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing RunningQuantile', 'cyan'))
+    # a small capacity on a large stream so that the sketch compacts many times
+    capacity = 64
+    shapeInput = np.random.randint(200, 400, [2, ])
+    numRows = shapeInput[0].item()
+    numCols = shapeInput[1].item()
+    data = np.random.randn(numRows, numCols) * 100 + 1000
+    half = numRows // 2
+    rowShape = NumCpp.Shape(1, numCols)
+    quantile1 = NumCpp.RunningQuantile(capacity)
+    quantile2 = NumCpp.RunningQuantile(capacity)
+    for row in range(numRows):
+        cArray = NumCpp.NdArray(rowShape)
+        cArray.setArray(data[row, :].reshape([1, numCols]))
+        if row < half:
+            quantile1.push(cArray)
+        else:
+            quantile2.push(cArray)
+    quantile1.merge(quantile2)
+
+    sortedData = np.sort(data.flatten())
+    rankBound = data.size / capacity * (np.log2(data.size / capacity) + 1)
+    percentiles = np.random.rand(20) * 100
+    withinBound = True
+    for percentile in percentiles:
+        value = quantile1.percentile(percentile.item())
+        rank = percentile / 100 * (data.size - 1)
+        lowerRank = np.searchsorted(sortedData, value, side='left')
+        upperRank = np.searchsorted(sortedData, value, side='right')
+        if rank < lowerRank - rankBound or rank > upperRank + rankBound:
+            withinBound = False
+    if (quantile1.count() == data.size and withinBound and
+            quantile1.percentile(0) == sortedData[0] and quantile1.percentile(100) == sortedData[-1]):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+####################################################################################
+if __name__ == '__main__':
+    doTest()
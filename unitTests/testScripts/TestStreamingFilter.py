@@ -0,0 +1,97 @@
+import numpy as np
+from termcolor import colored
+import sys
+sys.path.append(r'../build/x64/Release')
+import NumCpp
+
+####################################################################################
+def doTest():
+    print(colored('Testing StreamingFilter', 'magenta'))
+
+    modes = {'reflect' : NumCpp.Mode.REFLECT,
+             'constant': NumCpp.Mode.CONSTANT,
+             'nearest': NumCpp.Mode.NEAREST,
+             'mirror': NumCpp.Mode.MIRROR}
+
+    for mode in modes.keys():
+        size = np.random.randint(1000, 2000, [1,]).item()
+        cArray = NumCpp.NdArray(1, size)
+        data = np.random.randint(100, 1000, [size,]).astype(np.double)
+        cArray.setArray(data)
+        kernalSize = 0
+        while kernalSize % 2 == 0:
+            kernalSize = np.random.randint(5, 15)
+        constantValue = np.random.randint(0, 5, [1,]).item() # only actaully needed for constant boundary condition
+        weights = np.random.randint(1, 5, [kernalSize,])
+        cWeights = NumCpp.NdArray(1, kernalSize)
+        cWeights.setArray(weights)
+
+        tests = [('convolve1d', NumCpp.StreamingFilter.convolve1d(cWeights, modes[mode], constantValue),
+                  NumCpp.Filters.convolve1d(cArray, cWeights, modes[mode], constantValue)),
+                 ('gaussianFilter1d', NumCpp.StreamingFilter.gaussianFilter1d(2.0, modes[mode], constantValue),
+                  NumCpp.Filters.gaussianFilter1d(cArray, 2.0, modes[mode], constantValue)),
+                 ('maximumFilter1d', NumCpp.StreamingFilter.maximumFilter1d(kernalSize, modes[mode], constantValue),
+                  NumCpp.Filters.maximumFilter1d(cArray, kernalSize, modes[mode], constantValue)),
+                 ('medianFilter1d', NumCpp.StreamingFilter.medianFilter1d(kernalSize, modes[mode], constantValue),
+                  NumCpp.Filters.medianFilter1d(cArray, kernalSize, modes[mode], constantValue)),
+                 ('minimumFilter1d', NumCpp.StreamingFilter.minimumFilter1d(kernalSize, modes[mode], constantValue),
+                  NumCpp.Filters.minumumFilter1d(cArray, kernalSize, modes[mode], constantValue)),
+                 ('uniformFilter1d', NumCpp.StreamingFilter.uniformFilter1d(kernalSize, modes[mode], constantValue),
+                  NumCpp.Filters.uniformFilter1dRecursive(cArray, kernalSize, modes[mode], constantValue))]
+
+        for name, streamingFilter, batchOut in tests:
+            print(colored(f'Testing {name}: mode = {mode}', 'cyan'))
+            outputs = list()
+            latencyOk = True
+            start = 0
+            while start < size:
+                chunkSize = min(np.random.randint(1, 100), size - start)
+                cChunk = NumCpp.NdArray(1, chunkSize)
+                cChunk.setArray(data[start:start + chunkSize])
+                start += chunkSize
+                outputs.append(streamingFilter.push(cChunk).getNumpyArray().flatten())
+                latencyOk = latencyOk and streamingFilter.numIn() - streamingFilter.numOut() == min(streamingFilter.latency(), start)
+            outputs.append(streamingFilter.flush().getNumpyArray().flatten())
+            if latencyOk and np.array_equal(np.concatenate(outputs), batchOut.getNumpyArray().flatten()):
+                print(colored('\tPASS', 'green'))
+            else:
+                print(colored('\tFAIL', 'red'))
+
+    print(colored('Testing uniformFilter1d: NaN and Inf then finite data', 'cyan'))
+    size = np.random.randint(5000, 10000, [1,]).item()
+    data = np.random.rand(size) * 100
+    nanIndex = np.random.randint(10, 100)
+    infIndex = np.random.randint(100, 200)
+    data[nanIndex] = np.nan
+    data[infIndex] = np.inf
+    kernalSize = 0
+    while kernalSize % 2 == 0:
+        kernalSize = np.random.randint(5, 15)
+    streamingFilter = NumCpp.StreamingFilter.uniformFilter1d(kernalSize, NumCpp.Mode.REFLECT, 0)
+    outputs = list()
+    start = 0
+    while start < size:
+        chunkSize = min(np.random.randint(1, 100), size - start)
+        cChunk = NumCpp.NdArray(1, chunkSize)
+        cChunk.setArray(data[start:start + chunkSize])
+        start += chunkSize
+        outputs.append(streamingFilter.push(cChunk).getNumpyArray().flatten())
+    outputs.append(streamingFilter.flush().getNumpyArray().flatten())
+    dataOut = np.concatenate(outputs)
+    # only the windows holding the NaN or the Inf may be non-finite
+    halfSize = kernalSize // 2
+    expectedNonFinite = np.zeros([size,], dtype=bool)
+    expectedNonFinite[nanIndex - halfSize:nanIndex + halfSize + 1] = True
+    expectedNonFinite[infIndex - halfSize:infIndex + halfSize + 1] = True
+    cArray = NumCpp.NdArray(1, size)
+    cArray.setArray(data)
+    batchOut = NumCpp.Filters.uniformFilter1dRecursive(cArray, kernalSize, NumCpp.Mode.REFLECT, 0).getNumpyArray().flatten()
+    if (np.array_equal(~np.isfinite(dataOut), expectedNonFinite) and
+            np.array_equal(dataOut, batchOut, equal_nan=True)):
+        print(colored('\tPASS', 'green'))
+    else:
+        print(colored('\tFAIL', 'red'))
+
+####################################################################################
+if __name__ == '__main__':
+    doTest()